@@ -0,0 +1,212 @@
+/*
+** Benchmark of the AST constant folding (AST_CONSTANT_FOLDING).
+**
+** Runs a block of common x86-64 instructions in full symbolic mode, where only one input
+** byte is symbolized, once with the default builders and once with the constant folding.
+** Most of the computations are concrete, so their trees are built as constants. The
+** concrete state, the value of the symbolic registers and the path constraints must be
+** the same. The number of nodes kept by the symbolic expressions and the solving time
+** of the path constraints are compared.
+*/
+
+#include <chrono>
+#include <iostream>
+#include <set>
+#include <vector>
+
+#include <triton/api.hpp>
+#include <triton/ast.hpp>
+#include <triton/astContext.hpp>
+#include <triton/x86Specifications.hpp>
+
+using namespace triton;
+using namespace triton::arch;
+using namespace triton::arch::x86;
+
+const triton::uint64 stack = 0x7fffffff0000;
+const triton::uint64 input = 0x600000;
+
+
+static OperandWrapper reg(triton::API& api, register_e id) {
+  return OperandWrapper(api.getRegister(id));
+}
+
+
+static OperandWrapper imm(triton::uint64 value, triton::uint32 size) {
+  return OperandWrapper(Immediate(value, size));
+}
+
+
+static OperandWrapper mem(triton::API& api, triton::uint32 size, register_e base, triton::uint64 disp, register_e index=ID_REG_INVALID, triton::uint64 scale=1) {
+  MemoryAccess m(0, size);
+  m.setBaseRegister(api.getRegister(base));
+  if (index != ID_REG_INVALID)
+    m.setIndexRegister(api.getRegister(index));
+  m.setDisplacement(Immediate(disp, 8));
+  m.setScale(Immediate(scale, 8));
+  return OperandWrapper(m);
+}
+
+
+static void add(std::vector<Instruction>& block, triton::uint32 type, const std::vector<OperandWrapper>& operands) {
+  Instruction inst;
+  inst.setType(type);
+  inst.setSize(4);
+  inst.setAddress(0x400000 + block.size() * 4);
+  for (const auto& op : operands)
+    inst.operands.push_back(op);
+  block.push_back(inst);
+}
+
+
+static std::vector<Instruction> buildBlock(triton::API& api) {
+  std::vector<Instruction> block;
+
+  add(block, ID_INS_MOV,    {reg(api, ID_REG_X86_RAX), mem(api, 8, ID_REG_X86_RSP, 8)});
+  add(block, ID_INS_MOVZX,  {reg(api, ID_REG_X86_ECX), mem(api, 1, ID_REG_X86_RSI, 0, ID_REG_X86_RDI)});
+  add(block, ID_INS_ADD,    {reg(api, ID_REG_X86_RAX), reg(api, ID_REG_X86_RBX)});
+  add(block, ID_INS_ADC,    {reg(api, ID_REG_X86_RDX), reg(api, ID_REG_X86_RAX)});
+  add(block, ID_INS_XOR,    {reg(api, ID_REG_X86_R8D), reg(api, ID_REG_X86_R9D)});
+  add(block, ID_INS_AND,    {reg(api, ID_REG_X86_AL), imm(0x7f, 1)});
+  add(block, ID_INS_SUB,    {reg(api, ID_REG_X86_AH), reg(api, ID_REG_X86_DL)});
+  add(block, ID_INS_INC,    {reg(api, ID_REG_X86_RDX)});
+  add(block, ID_INS_NOT,    {reg(api, ID_REG_X86_R9)});
+  add(block, ID_INS_CMP,    {reg(api, ID_REG_X86_RAX), imm(-0x10ULL, 1)});
+  add(block, ID_INS_JNE,    {imm(0x400100, 8)});
+  add(block, ID_INS_ADD,    {reg(api, ID_REG_X86_CL), reg(api, ID_REG_X86_DL)});
+  add(block, ID_INS_CMP,    {reg(api, ID_REG_X86_CL), imm(0x42, 1)});
+  add(block, ID_INS_JA,     {imm(0x400100, 8)});
+  add(block, ID_INS_LEA,    {reg(api, ID_REG_X86_R10), mem(api, 8, ID_REG_X86_RAX, 0x10, ID_REG_X86_RDX, 4)});
+  add(block, ID_INS_PUSH,   {reg(api, ID_REG_X86_RAX)});
+  add(block, ID_INS_POP,    {reg(api, ID_REG_X86_R11)});
+  add(block, ID_INS_XCHG,   {reg(api, ID_REG_X86_R11), reg(api, ID_REG_X86_RBX)});
+  add(block, ID_INS_MOV,    {mem(api, 8, ID_REG_X86_RSP, -0x20ULL), reg(api, ID_REG_X86_R10)});
+  add(block, ID_INS_OR,     {mem(api, 2, ID_REG_X86_RSP, -0x20ULL), reg(api, ID_REG_X86_DX)});
+  add(block, ID_INS_SBB,    {reg(api, ID_REG_X86_R13), mem(api, 8, ID_REG_X86_RSP, -0x20ULL)});
+  add(block, ID_INS_MOVSX,  {reg(api, ID_REG_X86_R14), mem(api, 2, ID_REG_X86_RSP, -0x1fULL)});
+  add(block, ID_INS_XOR,    {reg(api, ID_REG_X86_R14B), reg(api, ID_REG_X86_CL)});
+  add(block, ID_INS_TEST,   {reg(api, ID_REG_X86_R14B), imm(0x1, 1)});
+  add(block, ID_INS_JE,     {imm(0x400100, 8)});
+
+  return block;
+}
+
+
+static void setState(triton::API& api, triton::uint32 round) {
+  api.setConcreteRegisterValue(api.getRegister(ID_REG_X86_RSP), stack);
+  api.setConcreteRegisterValue(api.getRegister(ID_REG_X86_RSI), input);
+  api.setConcreteRegisterValue(api.getRegister(ID_REG_X86_RDI), round % 8);
+  api.setConcreteRegisterValue(api.getRegister(ID_REG_X86_RBX), round * 0x1111);
+  api.setConcreteMemoryValue(MemoryAccess(stack + 8, 8), 0xfedcba9876543210 + round);
+  api.setConcreteMemoryValue(MemoryAccess(input, 8), 0x8070605040302010);
+}
+
+
+static void init(triton::API& api, bool folding) {
+  api.setArchitecture(triton::arch::ARCH_X86_64);
+  api.enableMode(triton::modes::AST_CONSTANT_FOLDING, folding);
+  api.convertMemoryToSymbolicVariable(MemoryAccess(input + 4, 1));
+}
+
+
+/* Returns the number of distinct nodes kept by the symbolic expressions */
+static triton::usize countNodes(triton::API& api) {
+  std::set<triton::ast::AbstractNode*> nodes;
+
+  for (const auto& item : api.getSymbolicExpressions()) {
+    for (const auto& node : triton::ast::childrenExtraction(item.second->getAst(), false, false))
+      nodes.insert(node.get());
+  }
+
+  return nodes.size();
+}
+
+
+static triton::uint32 compare(triton::API& api1, triton::API& api2, const Instruction& inst) {
+  triton::uint32 errors = 0;
+
+  for (const auto& item : api1.getAllRegisters()) {
+    const auto& r = api2.getRegister(item.first);
+    if (api1.getConcreteRegisterValue(item.second) != api2.getConcreteRegisterValue(r) ||
+        api1.isRegisterSymbolized(item.second) != api2.isRegisterSymbolized(r)) {
+      std::cerr << inst.getType() << ": " << item.second.getName() << " differs" << std::endl;
+      errors++;
+    }
+  }
+
+  for (const auto& item : api1.getSymbolicRegisters()) {
+    const auto& r = api2.getRegister(item.first);
+    if (item.second->getAst()->evaluate() != api2.getSymbolicRegister(r)->getAst()->evaluate()) {
+      std::cerr << inst.getType() << ": the expression of " << r.getName() << " differs" << std::endl;
+      errors++;
+    }
+  }
+
+  if (api1.getPathConstraints().size() != api2.getPathConstraints().size()) {
+    std::cerr << inst.getType() << ": the path constraints differ" << std::endl;
+    errors++;
+  }
+
+  return errors;
+}
+
+
+int main(int ac, const char **av) {
+  triton::uint32 errors = 0;
+  triton::API    apis[2];
+
+  init(apis[0], false);
+  init(apis[1], true);
+
+  /* Both contexts must give the same state after each instruction */
+  const triton::uint32 rounds = 32;
+  double times[2] = {0, 0};
+
+  for (triton::uint32 round = 0; round < rounds; round++) {
+    auto block = buildBlock(apis[0]);
+    for (triton::uint32 i = 0; i < 2; i++)
+      setState(apis[i], round);
+    for (const auto& inst : block) {
+      Instruction insts[2] = {inst, inst};
+      for (triton::uint32 i = 0; i < 2; i++) {
+        auto t0 = std::chrono::steady_clock::now();
+        apis[i].buildSemantics(insts[i]);
+        auto t1 = std::chrono::steady_clock::now();
+        times[i] += std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+      }
+      errors += compare(apis[0], apis[1], inst);
+    }
+  }
+
+  /* Size of the symbolic state */
+  triton::usize nodes[2];
+  for (triton::uint32 i = 0; i < 2; i++)
+    nodes[i] = countNodes(apis[i]);
+
+  /* Solving the path constraints */
+  double solving[2] = {0, 0};
+  triton::usize models[2] = {0, 0};
+  for (triton::uint32 i = 0; i < 2; i++) {
+    auto pc = apis[i].getPathConstraintsAst();
+    auto t0 = std::chrono::steady_clock::now();
+    models[i] = apis[i].getModel(pc).size();
+    auto t1 = std::chrono::steady_clock::now();
+    solving[i] = std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+  }
+
+  if (models[0] != models[1]) {
+    std::cerr << "the models differ" << std::endl;
+    errors++;
+  }
+
+  std::cout << "nodes: " << nodes[0] << " -> " << nodes[1] << std::endl;
+  std::cout << "semantics: " << times[0] << " us -> " << times[1] << " us" << std::endl;
+  std::cout << "solving: " << solving[0] << " us -> " << solving[1] << " us" << std::endl;
+
+  if (errors) {
+    std::cerr << "KO (" << errors << " errors)" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,104 @@
+/*
+** Micro benchmark of the AST structural hash.
+**
+** Builds deep ADC/SBB chains (result + carry flag trees as done by the x86 semantics)
+** where every step shares the previous result and carry subtrees. Hashes are memoized
+** in each node, so equalTo() and getHash() are constant-time whatever the depth of the
+** DAG. The naive recursive hash (what was done before the memoization) is computed on
+** small chains to show how it explodes on shared subtrees.
+*/
+
+#include <chrono>
+#include <iostream>
+
+#include <triton/api.hpp>
+#include <triton/ast.hpp>
+#include <triton/astContext.hpp>
+
+using namespace triton;
+
+
+/* Returns the number of nodes visited by a recursive hash walk (no memoization) */
+static triton::uint64 naiveHashVisits(ast::AbstractNode* node) {
+  triton::uint64 visits = 1;
+  for (auto& child : node->getChildren())
+    visits += naiveHashVisits(child.get());
+  return visits;
+}
+
+
+/* Builds a chain of ADC/SBB with their carry flag */
+static ast::SharedAbstractNode buildChain(ast::AstContext& ctxt, const ast::SharedAbstractNode& a, const ast::SharedAbstractNode& b, triton::uint32 steps) {
+  auto op1 = a;
+  auto op2 = b;
+  auto cf  = ctxt.bv(0, 1);
+
+  for (triton::uint32 i = 0; i < steps; i++) {
+    ast::SharedAbstractNode res = nullptr;
+
+    if (i & 1) {
+      /* sbb op1, op2 */
+      res = ctxt.bvsub(ctxt.bvsub(op1, op2), ctxt.zx(63, cf));
+      /* cf = MSB((~op1 & op2) | ((~op1 ^ op2) & res)) */
+      cf  = ctxt.extract(63, 63, ctxt.bvor(ctxt.bvand(ctxt.bvnot(op1), op2), ctxt.bvand(ctxt.bvxor(ctxt.bvnot(op1), op2), res)));
+    }
+    else {
+      /* adc op1, op2 */
+      res = ctxt.bvadd(ctxt.bvadd(op1, op2), ctxt.zx(63, cf));
+      /* cf = MSB((op1 & op2) ^ ((op1 ^ op2 ^ res) & (op1 ^ op2))) */
+      cf  = ctxt.extract(63, 63, ctxt.bvxor(ctxt.bvand(op1, op2), ctxt.bvand(ctxt.bvxor(ctxt.bvxor(op1, op2), res), ctxt.bvxor(op1, op2))));
+    }
+
+    op2 = op1;
+    op1 = res;
+  }
+
+  return ctxt.concat(cf, op1);
+}
+
+
+int main(int ac, const char **av) {
+  triton::API api;
+
+  api.setArchitecture(triton::arch::ARCH_X86_64);
+
+  auto& ctxt = api.getAstContext();
+  auto  x    = ctxt.variable(api.newSymbolicVariable(64));
+  auto  y    = ctxt.variable(api.newSymbolicVariable(64));
+
+  /* Shows the cost of a recursive hash on the DAG */
+  for (triton::uint32 steps = 2; steps <= 10; steps += 4) {
+    auto root = buildChain(ctxt, x, y, steps);
+    std::cout << "steps " << steps << ": recursive hash visits " << naiveHashVisits(root.get()) << " nodes" << std::endl;
+  }
+
+  /* Memoized hash on deep chains */
+  const triton::uint32 steps = 2000;
+  const triton::uint32 loops = 1000000;
+
+  auto t0    = std::chrono::steady_clock::now();
+  auto root1 = buildChain(ctxt, x, y, steps);
+  auto root2 = buildChain(ctxt, x, y, steps);
+  auto root3 = buildChain(ctxt, y, x, steps);
+  auto t1    = std::chrono::steady_clock::now();
+
+  triton::uint32 equal = 0;
+  for (triton::uint32 i = 0; i < loops; i++)
+    equal += root1->equalTo(root2);
+  auto t2 = std::chrono::steady_clock::now();
+
+  std::cout << "steps " << steps << ": build of 3 chains in " << std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count() << " ms" << std::endl;
+  std::cout << "steps " << steps << ": " << loops << " equalTo in " << std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1).count() << " ms" << std::endl;
+
+  if (equal != loops) {
+    std::cerr << "KO (identical chains must be equal)" << std::endl;
+    return 1;
+  }
+
+  if (root1->equalTo(root3) || root1->getHash() == root3->getHash()) {
+    std::cerr << "KO (different chains must not be equal)" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
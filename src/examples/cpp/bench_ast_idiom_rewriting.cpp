@@ -0,0 +1,245 @@
+/*
+** Benchmark of the rewriting of the lifting idioms (AST_IDIOM_REWRITING).
+**
+** Runs a block of x86-64 instructions working on partial registers, the stack and
+** misaligned memory on a symbolized input, once with the default builders and once
+** with AST_IDIOM_REWRITING: extractions of concatenations, extensions and extractions,
+** concatenations of adjacent extractions, A ^ A, A - A and ite on a constant are
+** rewritten when the nodes are built. The concrete state and the value of
+** the symbolic registers must be the same, the model of the path constraints of each
+** context must satisfy the other one. The size of the symbolic state and the solving
+** time of the path constraints are compared.
+*/
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <set>
+#include <vector>
+
+#include <triton/api.hpp>
+#include <triton/ast.hpp>
+#include <triton/astContext.hpp>
+#include <triton/x86Specifications.hpp>
+
+using namespace triton;
+using namespace triton::arch;
+using namespace triton::arch::x86;
+
+const triton::uint64 stack = 0x7fffffff0000;
+const triton::uint64 input = 0x600000;
+
+
+static OperandWrapper reg(triton::API& api, register_e id) {
+  return OperandWrapper(api.getRegister(id));
+}
+
+
+static OperandWrapper imm(triton::uint64 value, triton::uint32 size) {
+  return OperandWrapper(Immediate(value, size));
+}
+
+
+static OperandWrapper mem(triton::API& api, triton::uint32 size, register_e base, triton::uint64 disp, register_e index=ID_REG_INVALID, triton::uint64 scale=1) {
+  MemoryAccess m(0, size);
+  m.setBaseRegister(api.getRegister(base));
+  if (index != ID_REG_INVALID)
+    m.setIndexRegister(api.getRegister(index));
+  m.setDisplacement(Immediate(disp, 8));
+  m.setScale(Immediate(scale, 8));
+  return OperandWrapper(m);
+}
+
+
+static void add(std::vector<Instruction>& block, triton::uint32 type, const std::vector<OperandWrapper>& operands) {
+  Instruction inst;
+  inst.setType(type);
+  inst.setSize(4);
+  inst.setAddress(0x400000 + block.size() * 4);
+  for (const auto& op : operands)
+    inst.operands.push_back(op);
+  block.push_back(inst);
+}
+
+
+static std::vector<Instruction> buildBlock(triton::API& api) {
+  std::vector<Instruction> block;
+
+  add(block, ID_INS_MOV,    {reg(api, ID_REG_X86_RAX), mem(api, 8, ID_REG_X86_RSI, 0)});
+  add(block, ID_INS_MOV,    {reg(api, ID_REG_X86_RCX), mem(api, 8, ID_REG_X86_RSI, 8)});
+  add(block, ID_INS_MOV,    {reg(api, ID_REG_X86_AL), reg(api, ID_REG_X86_CL)});
+  add(block, ID_INS_MOV,    {reg(api, ID_REG_X86_AH), reg(api, ID_REG_X86_CH)});
+  add(block, ID_INS_MOVZX,  {reg(api, ID_REG_X86_EDX), reg(api, ID_REG_X86_AX)});
+  add(block, ID_INS_ADD,    {reg(api, ID_REG_X86_DL), imm(1, 1)});
+  add(block, ID_INS_CMP,    {reg(api, ID_REG_X86_DL), imm(0x41, 1)});
+  add(block, ID_INS_JNE,    {imm(0x400100, 8)});
+  add(block, ID_INS_MOVSX,  {reg(api, ID_REG_X86_R10), reg(api, ID_REG_X86_CX)});
+  add(block, ID_INS_MOV,    {reg(api, ID_REG_X86_R11W), reg(api, ID_REG_X86_R10W)});
+  add(block, ID_INS_MOV,    {reg(api, ID_REG_X86_R12D), reg(api, ID_REG_X86_R11D)});
+  add(block, ID_INS_MOV,    {reg(api, ID_REG_X86_BL), reg(api, ID_REG_X86_R12B)});
+  add(block, ID_INS_MOV,    {reg(api, ID_REG_X86_R13), reg(api, ID_REG_X86_RAX)});
+  add(block, ID_INS_XOR,    {reg(api, ID_REG_X86_R13), reg(api, ID_REG_X86_R13)});
+  add(block, ID_INS_MOV,    {reg(api, ID_REG_X86_R14), reg(api, ID_REG_X86_RCX)});
+  add(block, ID_INS_SUB,    {reg(api, ID_REG_X86_R14), reg(api, ID_REG_X86_R14)});
+  add(block, ID_INS_TEST,   {reg(api, ID_REG_X86_R13), reg(api, ID_REG_X86_R13)});
+  add(block, ID_INS_JE,     {imm(0x400100, 8)});
+  add(block, ID_INS_PUSH,   {reg(api, ID_REG_X86_RAX)});
+  add(block, ID_INS_POP,    {reg(api, ID_REG_X86_R15)});
+  add(block, ID_INS_MOV,    {mem(api, 8, ID_REG_X86_RSP, -0x20ULL), reg(api, ID_REG_X86_RCX)});
+  add(block, ID_INS_MOV,    {reg(api, ID_REG_X86_EDX), mem(api, 4, ID_REG_X86_RSP, -0x1eULL)});
+  add(block, ID_INS_CMP,    {reg(api, ID_REG_X86_DX), reg(api, ID_REG_X86_R11W)});
+  add(block, ID_INS_JA,     {imm(0x400100, 8)});
+  add(block, ID_INS_ADD,    {reg(api, ID_REG_X86_R15B), reg(api, ID_REG_X86_BL)});
+  add(block, ID_INS_CMP,    {reg(api, ID_REG_X86_R15W), imm(0x1234, 2)});
+  add(block, ID_INS_JLE,    {imm(0x400100, 8)});
+
+  return block;
+}
+
+
+static void setState(triton::API& api) {
+  api.setConcreteRegisterValue(api.getRegister(ID_REG_X86_RSP), stack);
+  api.setConcreteRegisterValue(api.getRegister(ID_REG_X86_RSI), input);
+  api.setConcreteMemoryValue(MemoryAccess(input, 8), 0x8070605040302010);
+  api.setConcreteMemoryValue(MemoryAccess(input + 8, 8), 0x0123456789abcdef);
+}
+
+
+static void init(triton::API& api, bool rewriting) {
+  api.setArchitecture(triton::arch::ARCH_X86_64);
+  api.enableMode(triton::modes::AST_IDIOM_REWRITING, rewriting);
+  for (triton::uint64 offset = 0; offset < 16; offset++)
+    api.convertMemoryToSymbolicVariable(MemoryAccess(input + offset, 1));
+}
+
+
+/* Returns the number of distinct nodes kept by the symbolic expressions */
+static triton::usize countNodes(triton::API& api) {
+  std::set<triton::ast::AbstractNode*> nodes;
+
+  for (const auto& item : api.getSymbolicExpressions()) {
+    for (const auto& node : triton::ast::childrenExtraction(item.second->getAst(), false, false))
+      nodes.insert(node.get());
+  }
+
+  return nodes.size();
+}
+
+
+/* Returns the number of nodes of an AST once its references are unrolled */
+static triton::usize countUnrolledNodes(triton::API& api, const triton::ast::SharedAbstractNode& node) {
+  triton::usize count = 0;
+
+  for (const auto& item : api.getAstContext().getNodeCensus(node))
+    count += item.second;
+
+  return count;
+}
+
+
+static triton::uint32 compare(triton::API& api1, triton::API& api2, const Instruction& inst) {
+  triton::uint32 errors = 0;
+
+  /* A rewriting may only remove the dependency of a register on the symbolic variables (e.g. A ^ A) */
+  for (const auto& item : api1.getAllRegisters()) {
+    const auto& r = api2.getRegister(item.first);
+    if (api1.getConcreteRegisterValue(item.second) != api2.getConcreteRegisterValue(r) ||
+        (!api1.isRegisterSymbolized(item.second) && api2.isRegisterSymbolized(r))) {
+      std::cerr << inst.getType() << ": " << item.second.getName() << " differs" << std::endl;
+      errors++;
+    }
+  }
+
+  for (const auto& item : api1.getSymbolicRegisters()) {
+    const auto& r = api2.getRegister(item.first);
+    const auto& expr = api2.getSymbolicRegister(r);
+    if (expr != nullptr && item.second->getAst()->evaluate() != expr->getAst()->evaluate()) {
+      std::cerr << inst.getType() << ": the expression of " << r.getName() << " differs" << std::endl;
+      errors++;
+    }
+  }
+
+  /* The branches whose condition became concrete are not tracked (PC_TRACKING_SYMBOLIC) */
+  if (api1.getPathConstraints().size() < api2.getPathConstraints().size()) {
+    std::cerr << inst.getType() << ": the path constraints differ" << std::endl;
+    errors++;
+  }
+
+  return errors;
+}
+
+
+int main(int ac, const char **av) {
+  triton::uint32 errors = 0;
+  triton::API    apis[2];
+
+  init(apis[0], false);
+  init(apis[1], true);
+
+  /* Both contexts must give the same state after each instruction */
+  const triton::uint32 rounds = 16;
+  double times[2] = {0, 0};
+
+  for (triton::uint32 round = 0; round < rounds; round++) {
+    auto block = buildBlock(apis[0]);
+    for (triton::uint32 i = 0; i < 2; i++)
+      setState(apis[i]);
+    for (const auto& inst : block) {
+      Instruction insts[2] = {inst, inst};
+      for (triton::uint32 i = 0; i < 2; i++) {
+        auto t0 = std::chrono::steady_clock::now();
+        apis[i].buildSemantics(insts[i]);
+        auto t1 = std::chrono::steady_clock::now();
+        times[i] += std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+      }
+      errors += compare(apis[0], apis[1], inst);
+    }
+  }
+
+  /* Size of the symbolic state and of the path constraints */
+  triton::usize nodes[2];
+  triton::usize unrolled[2];
+  for (triton::uint32 i = 0; i < 2; i++) {
+    nodes[i]    = countNodes(apis[i]);
+    unrolled[i] = countUnrolledNodes(apis[i], apis[i].getPathConstraintsAst());
+  }
+
+  /* Solving the path constraints */
+  double solving[2] = {0, 0};
+  std::map<triton::usize, triton::uint512> models[2];
+  for (triton::uint32 i = 0; i < 2; i++) {
+    auto pc = apis[i].getPathConstraintsAst();
+    auto t0 = std::chrono::steady_clock::now();
+    for (const auto& item : apis[i].getModel(pc))
+      models[i][item.first] = item.second.getValue();
+    auto t1 = std::chrono::steady_clock::now();
+    solving[i] = std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+  }
+
+  /* The model of each context must satisfy the path constraints of the other one */
+  for (triton::uint32 i = 0; i < 2; i++) {
+    auto& other = apis[1 - i];
+    if (models[i].empty()) {
+      std::cerr << "no model" << std::endl;
+      errors++;
+      continue;
+    }
+    other.setConcreteVariableValues(models[i]);
+    if (other.getPathConstraintsAst()->evaluate() == 0) {
+      std::cerr << "the models differ" << std::endl;
+      errors++;
+    }
+  }
+
+  std::cout << "nodes: " << nodes[0] << " -> " << nodes[1] << std::endl;
+  std::cout << "path constraints (unrolled): " << unrolled[0] << " -> " << unrolled[1] << " nodes" << std::endl;
+  std::cout << "semantics: " << times[0] << " us -> " << times[1] << " us" << std::endl;
+  std::cout << "solving: " << solving[0] << " us -> " << solving[1] << " us" << std::endl;
+
+  if (errors) {
+    std::cerr << "KO (" << errors << " errors)" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,121 @@
+/*
+** Micro benchmark of the AST re-evaluation after a concrete variable update.
+**
+** Builds a trace of symbolic expressions hashing an input buffer, like a
+** checksum loop would do, where every step reads the previous state twice.
+** Then a single input byte is mutated and the whole trace is re-evaluated,
+** which is the core loop of a concolic input mutation. Nodes depending on the
+** byte are re-evaluated once each, in topological order. The number of nodes
+** a naive recursive propagation through the parents (what was done before)
+** would visit is computed on small traces to show how it explodes.
+*/
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include <triton/api.hpp>
+#include <triton/ast.hpp>
+#include <triton/astContext.hpp>
+
+using namespace triton;
+
+const triton::uint64 prime = 0x100000001b3;
+
+
+/* Returns the number of nodes visited by a recursive propagation through the parents */
+static triton::uint64 naivePropagationVisits(ast::AbstractNode* node) {
+  triton::uint64 visits = 0;
+  for (auto& parent : node->getParents())
+    visits += 1 + naivePropagationVisits(parent.get());
+  return visits;
+}
+
+
+/* Builds a trace of `steps` expressions hashing the inputs */
+static std::vector<engines::symbolic::SharedSymbolicExpression> buildTrace(triton::API& api, const std::vector<ast::SharedAbstractNode>& inputs, triton::uint32 steps) {
+  std::vector<engines::symbolic::SharedSymbolicExpression> trace;
+  auto& ctxt = api.getAstContext();
+
+  trace.push_back(api.newSymbolicExpression(ctxt.bv(0xcbf29ce484222325, 64)));
+
+  for (triton::uint32 i = 0; i < steps; i++) {
+    auto s = ctxt.reference(trace.back());
+    auto b = ctxt.zx(56, inputs[i % inputs.size()]);
+    /* s = ((s ^ b) * prime) + (s >> 7) */
+    auto node = ctxt.bvadd(ctxt.bvmul(ctxt.bvxor(s, b), ctxt.bv(prime, 64)), ctxt.bvlshr(s, ctxt.bv(7, 64)));
+    trace.push_back(api.newSymbolicExpression(node));
+  }
+
+  return trace;
+}
+
+
+/* The same hash computed natively */
+static triton::uint64 nativeHash(const std::vector<triton::uint8>& inputs, triton::uint32 steps) {
+  triton::uint64 s = 0xcbf29ce484222325;
+  for (triton::uint32 i = 0; i < steps; i++)
+    s = ((s ^ inputs[i % inputs.size()]) * prime) + (s >> 7);
+  return s;
+}
+
+
+int main(int ac, const char **av) {
+  triton::API api;
+
+  api.setArchitecture(triton::arch::ARCH_X86_64);
+
+  auto& ctxt = api.getAstContext();
+
+  std::vector<engines::symbolic::SharedSymbolicVariable> vars;
+  std::vector<ast::SharedAbstractNode> inputs;
+  std::vector<triton::uint8> values;
+
+  for (triton::uint32 i = 0; i < 16; i++) {
+    vars.push_back(api.newSymbolicVariable(8));
+    inputs.push_back(ctxt.variable(vars.back()));
+    values.push_back(static_cast<triton::uint8>(i * 7 + 1));
+  }
+
+  std::map<triton::usize, triton::uint512> seed;
+  for (triton::uint32 i = 0; i < vars.size(); i++)
+    seed[vars[i]->getId()] = values[i];
+  api.setConcreteVariableValues(seed);
+
+  /* Shows the cost of a recursive propagation on the DAG */
+  for (triton::uint32 steps = 4; steps <= 16; steps += 6) {
+    triton::API small;
+    small.setArchitecture(triton::arch::ARCH_X86_64);
+    auto var   = small.newSymbolicVariable(8);
+    auto trace = buildTrace(small, {small.getAstContext().variable(var)}, steps);
+    std::cout << "steps " << steps << ": recursive propagation visits " << naivePropagationVisits(small.getAstContext().variable(var).get()) << " nodes" << std::endl;
+  }
+
+  /* Topological re-evaluation on a long trace */
+  const triton::uint32 steps = 10000;
+  const triton::uint32 loops = 50;
+
+  auto t0    = std::chrono::steady_clock::now();
+  auto trace = buildTrace(api, inputs, steps);
+  auto t1    = std::chrono::steady_clock::now();
+
+  triton::uint32 errors = 0;
+  for (triton::uint32 i = 0; i < loops; i++) {
+    triton::uint32 index = i % vars.size();
+    values[index] = static_cast<triton::uint8>(values[index] * 13 + 5);
+    api.setConcreteVariableValue(vars[index], values[index]);
+    if (trace.back()->getAst()->evaluate() != nativeHash(values, steps))
+      errors++;
+  }
+  auto t2 = std::chrono::steady_clock::now();
+
+  std::cout << "steps " << steps << ": build of the trace in " << std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count() << " ms" << std::endl;
+  std::cout << "steps " << steps << ": " << loops << " single byte mutations re-evaluated in " << std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1).count() << " ms" << std::endl;
+
+  if (errors) {
+    std::cerr << "KO (" << errors << " wrong evaluations)" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,148 @@
+/*
+** Scaling benchmark of the AST traversal.
+**
+** Builds layered DAGs from 10^3 to 10^6 nodes where every node is shared by two
+** parents, like the flag and result trees of an instruction trace. The nodes are
+** extracted in topological order with childrenExtraction(), which expands each node
+** once, so the cost per node does not grow with the size of the DAG (only with the
+** cache misses once the DAG does not fit in the caches). The previous level-sorted
+** extraction is run on the small DAGs to show its quadratic cost.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <iostream>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/api.hpp>
+#include <triton/ast.hpp>
+#include <triton/astContext.hpp>
+#ifdef Z3_INTERFACE
+  #include <triton/tritonToZ3Ast.hpp>
+#endif
+
+using namespace triton;
+
+const triton::uint32 width = 1000;
+
+
+/* The previous implementation of nodesExtraction() */
+static void legacyNodesExtraction(std::deque<ast::SharedAbstractNode>* output, const ast::SharedAbstractNode& node) {
+  std::unordered_map<triton::usize, std::set<ast::SharedAbstractNode>> sortedlist;
+  std::deque<std::pair<ast::SharedAbstractNode,triton::usize>> worklist;
+  triton::usize depth = 0;
+
+  worklist.push_back({node, 0});
+  while (worklist.empty() == false) {
+    auto ast = worklist.front().first;
+    auto lvl = worklist.front().second;
+    worklist.pop_front();
+    depth = std::max(depth, lvl);
+    for (const auto& child : ast->getChildren()) {
+      if (std::find(worklist.begin(), worklist.end(), std::make_pair(child, lvl + 1)) == worklist.end())
+        worklist.push_back({child, lvl + 1});
+    }
+    sortedlist[lvl].insert(ast);
+  }
+
+  for (triton::usize index = 0; index <= depth; index++) {
+    for (auto&& n : sortedlist[depth - index]) {
+      if (std::find(output->begin(), output->end(), n) == output->end())
+        output->push_back(n);
+    }
+  }
+}
+
+
+/* Builds a layered DAG of about `size` nodes and returns its root */
+static ast::SharedAbstractNode buildDag(triton::API& api, triton::usize size) {
+  auto& ctxt = api.getAstContext();
+  std::vector<ast::SharedAbstractNode> layer;
+
+  for (triton::uint32 i = 0; i < width; i++)
+    layer.push_back(ctxt.variable(api.newSymbolicVariable(8)));
+
+  for (triton::usize n = 2 * width; n <= size; n += width) {
+    std::vector<ast::SharedAbstractNode> next;
+    for (triton::uint32 i = 0; i < width; i++)
+      next.push_back(ctxt.bvadd(layer[i], layer[(i + 1) % width]));
+    layer.swap(next);
+  }
+
+  auto root = layer[0];
+  for (triton::uint32 i = 1; i < width; i++)
+    root = ctxt.bvxor(root, layer[i]);
+
+  return root;
+}
+
+
+/* Returns true if every node is after its children */
+static bool isTopological(const std::vector<ast::SharedAbstractNode>& nodes) {
+  std::unordered_map<const ast::AbstractNode*, triton::usize> index;
+
+  for (triton::usize i = 0; i < nodes.size(); i++)
+    index[nodes[i].get()] = i;
+
+  for (triton::usize i = 0; i < nodes.size(); i++) {
+    for (const auto& child : nodes[i]->getChildren()) {
+      if (index.at(child.get()) >= i)
+        return false;
+    }
+  }
+
+  return true;
+}
+
+
+int main(int ac, const char **av) {
+  triton::uint32 errors = 0;
+
+  for (triton::usize size = 1000; size <= 1000000; size *= 10) {
+    triton::API api;
+    api.setArchitecture(triton::arch::ARCH_X86_64);
+
+    auto root  = buildDag(api, size);
+    auto t0    = std::chrono::steady_clock::now();
+    auto nodes = ast::childrenExtraction(root, false /* unroll */, true /* revert */);
+    auto t1    = std::chrono::steady_clock::now();
+    auto us    = std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+
+    std::cout << "nodes " << nodes.size() << ": childrenExtraction in " << us << " us (" << (us * 1000.0 / nodes.size()) << " ns/node)" << std::endl;
+
+    if (nodes.back() != root || !isTopological(nodes))
+      errors++;
+
+    if (size <= 10000) {
+      std::deque<ast::SharedAbstractNode> legacy;
+      t0 = std::chrono::steady_clock::now();
+      legacyNodesExtraction(&legacy, root);
+      t1 = std::chrono::steady_clock::now();
+      us = std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+      std::cout << "nodes " << legacy.size() << ": legacy nodesExtraction in " << us << " us (" << (us * 1000.0 / legacy.size()) << " ns/node)" << std::endl;
+      if (legacy.size() != nodes.size())
+        errors++;
+    }
+
+    #ifdef Z3_INTERFACE
+    if (size <= 100000) {
+      ast::TritonToZ3Ast z3Ast{false};
+      t0 = std::chrono::steady_clock::now();
+      z3Ast.convert(root);
+      t1 = std::chrono::steady_clock::now();
+      us = std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+      std::cout << "nodes " << nodes.size() << ": conversion to z3 in " << us << " us (" << (us * 1000.0 / nodes.size()) << " ns/node)" << std::endl;
+    }
+    #endif
+  }
+
+  if (errors) {
+    std::cerr << "KO (" << errors << " errors)" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,218 @@
+/*
+** Benchmark of the native concrete fast path (CONCRETE_FAST_PATH).
+**
+** Runs a block of common x86-64 instructions (arithmetic, logic, moves, stack and
+** branches on registers, memory and immediates) with ONLY_ON_SYMBOLIZED, once through
+** the full semantics and once through the native interpreter. One input byte is
+** symbolized, so some rounds fall back to the full semantics. After each instruction,
+** the concrete state, the symbolic state, the path constraints and the instruction
+** must be the same.
+*/
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include <triton/api.hpp>
+#include <triton/x86Specifications.hpp>
+
+using namespace triton;
+using namespace triton::arch;
+using namespace triton::arch::x86;
+
+const triton::uint64 stack = 0x7fffffff0000;
+const triton::uint64 input = 0x600000;
+
+
+static OperandWrapper reg(triton::API& api, register_e id) {
+  return OperandWrapper(api.getRegister(id));
+}
+
+
+static OperandWrapper imm(triton::uint64 value, triton::uint32 size) {
+  return OperandWrapper(Immediate(value, size));
+}
+
+
+static OperandWrapper mem(triton::API& api, triton::uint32 size, register_e base, triton::uint64 disp, register_e index=ID_REG_INVALID, triton::uint64 scale=1) {
+  MemoryAccess m(0, size);
+  m.setBaseRegister(api.getRegister(base));
+  if (index != ID_REG_INVALID)
+    m.setIndexRegister(api.getRegister(index));
+  m.setDisplacement(Immediate(disp, 8));
+  m.setScale(Immediate(scale, 8));
+  return OperandWrapper(m);
+}
+
+
+static void add(std::vector<Instruction>& block, triton::uint32 type, const std::vector<OperandWrapper>& operands) {
+  Instruction inst;
+  inst.setType(type);
+  inst.setSize(4);
+  inst.setAddress(0x400000 + block.size() * 4);
+  for (const auto& op : operands)
+    inst.operands.push_back(op);
+  block.push_back(inst);
+}
+
+
+static std::vector<Instruction> buildBlock(triton::API& api) {
+  std::vector<Instruction> block;
+
+  add(block, ID_INS_MOV,    {reg(api, ID_REG_X86_RAX), mem(api, 8, ID_REG_X86_RSP, 8)});
+  add(block, ID_INS_MOVZX,  {reg(api, ID_REG_X86_ECX), mem(api, 1, ID_REG_X86_RSI, 0, ID_REG_X86_RDI)});
+  add(block, ID_INS_ADD,    {reg(api, ID_REG_X86_RAX), reg(api, ID_REG_X86_RBX)});
+  add(block, ID_INS_ADC,    {reg(api, ID_REG_X86_RDX), reg(api, ID_REG_X86_RCX)});
+  add(block, ID_INS_XOR,    {reg(api, ID_REG_X86_R8D), reg(api, ID_REG_X86_R9D)});
+  add(block, ID_INS_AND,    {reg(api, ID_REG_X86_AL), imm(0x7f, 1)});
+  add(block, ID_INS_SUB,    {reg(api, ID_REG_X86_AH), reg(api, ID_REG_X86_CL)});
+  add(block, ID_INS_INC,    {reg(api, ID_REG_X86_RDX)});
+  add(block, ID_INS_NEG,    {reg(api, ID_REG_X86_CX)});
+  add(block, ID_INS_NOT,    {reg(api, ID_REG_X86_R9)});
+  add(block, ID_INS_CMP,    {reg(api, ID_REG_X86_RAX), imm(-0x10ULL, 1)});
+  add(block, ID_INS_JNE,    {imm(0x400100, 8)});
+  add(block, ID_INS_TEST,   {reg(api, ID_REG_X86_CL), reg(api, ID_REG_X86_CL)});
+  add(block, ID_INS_JA,     {imm(0x400100, 8)});
+  add(block, ID_INS_LEA,    {reg(api, ID_REG_X86_R10), mem(api, 8, ID_REG_X86_RAX, 0x10, ID_REG_X86_RCX, 4)});
+  add(block, ID_INS_LEA,    {reg(api, ID_REG_X86_R11D), mem(api, 8, ID_REG_X86_RIP, -0x20ULL)});
+  add(block, ID_INS_PUSH,   {reg(api, ID_REG_X86_RAX)});
+  add(block, ID_INS_POP,    {reg(api, ID_REG_X86_R11)});
+  add(block, ID_INS_PUSH,   {imm(0x81234, 4)});
+  add(block, ID_INS_POP,    {reg(api, ID_REG_X86_R12)});
+  add(block, ID_INS_XCHG,   {reg(api, ID_REG_X86_R12), reg(api, ID_REG_X86_RAX)});
+  add(block, ID_INS_MOV,    {mem(api, 8, ID_REG_X86_RSP, -0x20ULL), reg(api, ID_REG_X86_R12)});
+  add(block, ID_INS_OR,     {mem(api, 2, ID_REG_X86_RSP, -0x20ULL), reg(api, ID_REG_X86_DX)});
+  add(block, ID_INS_SBB,    {reg(api, ID_REG_X86_R13), mem(api, 8, ID_REG_X86_RSP, -0x20ULL)});
+  add(block, ID_INS_MOVSX,  {reg(api, ID_REG_X86_R14), mem(api, 2, ID_REG_X86_RSP, -0x1fULL)});
+  add(block, ID_INS_MOVSXD, {reg(api, ID_REG_X86_R15), mem(api, 4, ID_REG_X86_RSP, -0x1cULL)});
+  add(block, ID_INS_DEC,    {mem(api, 8, ID_REG_X86_RSP, 0x10)});
+  add(block, ID_INS_NOP,    {});
+  add(block, ID_INS_JLE,    {imm(0x400100, 8)});
+  add(block, ID_INS_CALL,   {reg(api, ID_REG_X86_R10)});
+  add(block, ID_INS_RET,    {});
+  add(block, ID_INS_JMP,    {imm(0x400000, 8)});
+  add(block, ID_INS_MOV,    {reg(api, ID_REG_X86_RBX), reg(api, ID_REG_X86_R11)});
+  add(block, ID_INS_MOV,    {reg(api, ID_REG_X86_AX), reg(api, ID_REG_X86_R14W)});
+
+  return block;
+}
+
+
+static void setState(triton::API& api, triton::uint32 round) {
+  api.setConcreteRegisterValue(api.getRegister(ID_REG_X86_RSP), stack);
+  api.setConcreteRegisterValue(api.getRegister(ID_REG_X86_RSI), input);
+  api.setConcreteRegisterValue(api.getRegister(ID_REG_X86_RDI), round % 16);
+  api.setConcreteRegisterValue(api.getRegister(ID_REG_X86_RBX), round * 0x1111);
+  api.setConcreteRegisterValue(api.getRegister(ID_REG_X86_CF), round & 1);
+  api.setConcreteRegisterValue(api.getRegister(ID_REG_X86_ZF), (round >> 1) & 1);
+  api.setConcreteRegisterValue(api.getRegister(ID_REG_X86_SF), (round >> 2) & 1);
+  api.setConcreteRegisterValue(api.getRegister(ID_REG_X86_OF), (round >> 3) & 1);
+  api.setConcreteMemoryValue(MemoryAccess(stack + 8, 8), 0xfedcba9876543210 + round);
+  api.setConcreteMemoryValue(MemoryAccess(input, 8), 0x8070605040302010);
+}
+
+
+static void init(triton::API& api, bool fast) {
+  api.setArchitecture(triton::arch::ARCH_X86_64);
+  api.enableMode(triton::modes::ONLY_ON_SYMBOLIZED, true);
+  api.enableMode(triton::modes::PC_TRACKING_SYMBOLIC, true);
+  api.enableMode(triton::modes::CONCRETE_FAST_PATH, fast);
+  api.convertMemoryToSymbolicVariable(MemoryAccess(input + 4, 1));
+}
+
+
+static triton::uint32 compare(triton::API& full, triton::API& fast, const Instruction& inst1, const Instruction& inst2) {
+  triton::uint32 errors = 0;
+
+  for (const auto& item : full.getAllRegisters()) {
+    const auto& r = fast.getRegister(item.first);
+    if (full.getConcreteRegisterValue(item.second) != fast.getConcreteRegisterValue(r) ||
+        full.isRegisterSymbolized(item.second) != fast.isRegisterSymbolized(r)) {
+      std::cerr << inst1.getType() << ": " << item.second.getName() << " differs" << std::endl;
+      errors++;
+    }
+  }
+
+  if (full.getSymbolicRegisters().size() != fast.getSymbolicRegisters().size()) {
+    std::cerr << inst1.getType() << ": the symbolic registers differ" << std::endl;
+    errors++;
+  }
+
+  for (triton::uint64 base : {stack - 0x40, input}) {
+    if (full.getConcreteMemoryAreaValue(base, 0x80) != fast.getConcreteMemoryAreaValue(base, 0x80)) {
+      std::cerr << inst1.getType() << ": the memory differs" << std::endl;
+      errors++;
+    }
+  }
+
+  if (full.getSymbolicMemory().size() != fast.getSymbolicMemory().size()) {
+    std::cerr << inst1.getType() << ": the symbolic memory differs" << std::endl;
+    errors++;
+  }
+
+  if (full.getPathConstraints().size() != fast.getPathConstraints().size()) {
+    std::cerr << inst1.getType() << ": the path constraints differ" << std::endl;
+    errors++;
+  }
+
+  Instruction i1 = inst1;
+  Instruction i2 = inst2;
+  if (i1.isSymbolized() != i2.isSymbolized() || i1.isConditionTaken() != i2.isConditionTaken() || i1.getUndefinedRegisters() != i2.getUndefinedRegisters()) {
+    std::cerr << inst1.getType() << ": the instruction differs" << std::endl;
+    errors++;
+  }
+
+  return errors;
+}
+
+
+int main(int ac, const char **av) {
+  triton::uint32 errors = 0;
+
+  triton::API full;
+  triton::API fast;
+
+  init(full, false);
+  init(fast, true);
+
+  /* Both paths must give the same state after each instruction */
+  for (triton::uint32 round = 0; round < 32; round++) {
+    setState(full, round);
+    setState(fast, round);
+    for (const auto& inst : buildBlock(full)) {
+      Instruction inst1 = inst;
+      Instruction inst2 = inst;
+      full.buildSemantics(inst1);
+      fast.buildSemantics(inst2);
+      errors += compare(full, fast, inst1, inst2);
+    }
+  }
+
+  /* Timings on a concrete input, the memory operands keep the address of their first run */
+  const triton::uint32 loops = 1000;
+  double times[2] = {0, 0};
+
+  for (triton::uint32 i = 0; i < 2; i++) {
+    triton::API api;
+    init(api, i == 1);
+    auto block = buildBlock(api);
+    setState(api, 0);
+    auto t0 = std::chrono::steady_clock::now();
+    for (triton::uint32 loop = 0; loop < loops; loop++) {
+      for (auto& inst : block)
+        api.buildSemantics(inst);
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    times[i] = std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+  }
+
+  std::cout << "full semantics: " << times[0] << " us, "
+            << "native interpreter: " << times[1] << " us (x" << (times[1] ? times[0] / times[1] : 0) << ")" << std::endl;
+
+  if (errors) {
+    std::cerr << "KO (" << errors << " errors)" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
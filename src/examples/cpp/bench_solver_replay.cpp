@@ -0,0 +1,245 @@
+/*
+** Replay benchmark of the solver queries.
+**
+** Usage: bench_solver_replay [directory]
+**
+** Replays the queries recorded with the SOLVER_QUERY_RECORDING mode (query-<n>.smt2
+** files) through TritonToZ3Ast and Z3Solver, with the limits of the recording, and
+** reports the latency distribution next to the recorded one, so a slowdown of the
+** solver side can be reproduced offline. Without directory, a set of path constraints
+** is recorded in the current directory, replayed and removed. The replay must find
+** the same SAT/UNSAT status as the recording.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <triton/api.hpp>
+#include <triton/ast.hpp>
+#include <triton/astContext.hpp>
+#ifdef Z3_INTERFACE
+  #include <z3++.h>
+  #include <triton/z3Solver.hpp>
+  #include <triton/z3ToTritonAst.hpp>
+#endif
+
+using namespace triton;
+
+
+#ifdef Z3_INTERFACE
+/* A recorded query and its replay */
+struct Query {
+  std::string path;
+  std::map<std::string, std::string> metadata;
+  std::string status;
+  triton::uint64 recorded;
+  triton::uint64 replayed;
+};
+
+
+/* Returns the name of a query file */
+static std::string queryPath(const std::string& directory, triton::usize index) {
+  char name[32];
+  std::snprintf(name, sizeof(name), "query-%06lu.smt2", static_cast<unsigned long>(index));
+  return directory + "/" + name;
+}
+
+
+/* Records the path constraints of a parser on its input */
+static triton::usize record(void) {
+  triton::API api;
+  api.setArchitecture(triton::arch::ARCH_X86_64);
+  api.enableMode(triton::modes::SOLVER_QUERY_RECORDING, true);
+
+  auto& ctxt = api.getAstContext();
+  std::vector<ast::SharedAbstractNode> input;
+  for (triton::usize i = 0; i < 16; i++)
+    input.push_back(ctxt.variable(api.newSymbolicVariable(8)));
+
+  /* A checksum through a chain of references */
+  auto sum = ctxt.bv(0, 16);
+  for (triton::usize i = 0; i < 16; i++) {
+    auto expr = api.newSymbolicExpression(ctxt.bvadd(ctxt.bvmul(sum, ctxt.bv(31, 16)), ctxt.zx(8, input[i])));
+    sum = ctxt.reference(expr);
+  }
+
+  auto pc = ctxt.equal(ctxt.bvtrue(), ctxt.bvtrue());
+  for (triton::usize i = 0; i < 15; i++) {
+    auto branch = ctxt.bvult(ctxt.bvxor(input[i], input[i + 1]), ctxt.bv(0x20 + i, 8));
+    api.getModel(ctxt.land(pc, ctxt.lnot(branch)));
+    pc = ctxt.land(pc, branch);
+  }
+
+  api.getModel(ctxt.land(pc, ctxt.equal(sum, ctxt.bv(0x1337, 16))));
+  api.getModels(ctxt.land(pc, ctxt.bvult(input[0], ctxt.bv(8, 8))), 8);
+  api.isSat(ctxt.land(ctxt.bvult(input[0], input[1]), ctxt.bvult(input[1], input[0])));
+
+  /* The factorization of the product of the two largest 32-bit primes does not end in time */
+  auto x = ctxt.zx(32, ctxt.concat(std::vector<ast::SharedAbstractNode>(input.begin(), input.begin() + 4)));
+  auto y = ctxt.zx(32, ctxt.concat(std::vector<ast::SharedAbstractNode>(input.begin() + 4, input.begin() + 8)));
+  api.setSolverTimeout(100);
+  api.getModel(ctxt.land(std::vector<ast::SharedAbstractNode>{
+    ctxt.equal(ctxt.bvmul(x, y), ctxt.bv(0xffffffea00000055, 64)),
+    ctxt.bvugt(x, ctxt.bv(1, 64)),
+    ctxt.bvugt(y, ctxt.bv(1, 64)),
+  }));
+
+  return api.getSolverRecordedQueries();
+}
+
+
+/* Replays a recorded query, returns false if it cannot be read */
+static bool replay(Query& query) {
+  static const char* names[] = {"UNSAT", "SAT", "TIMEOUT", "OUTOFMEM", "UNKNOWN"};
+
+  std::ifstream file(query.path);
+  if (!file)
+    return false;
+
+  std::stringstream text;
+  std::string line;
+  while (std::getline(file, line)) {
+    auto colon = line.find(": ");
+    if (line.size() > 2 && line[0] == ';' && colon != std::string::npos)
+      query.metadata[line.substr(2, colon - 2)] = line.substr(colon + 2);
+    text << line << std::endl;
+  }
+
+  triton::API api;
+  api.setArchitecture(triton::arch::ARCH_X86_64);
+
+  z3::context ctx;
+  z3::expr_vector from(ctx);
+  z3::expr_vector to(ctx);
+  z3::expr_vector assertions = ctx.parse_string(text.str().c_str());
+  z3::expr constraint = (assertions.size() == 1) ? assertions[0] : z3::mk_and(assertions);
+
+  /* The declared variables become symbolic variables of the new context */
+  std::vector<z3::expr> worklist = {constraint};
+  std::unordered_set<unsigned> visited;
+  while (worklist.empty() == false) {
+    auto e = worklist.back();
+    worklist.pop_back();
+    if (visited.insert(e.id()).second == false)
+      continue;
+    if (e.is_const() && e.decl().decl_kind() == Z3_OP_UNINTERPRETED) {
+      auto var = api.newSymbolicVariable(e.get_sort().bv_size());
+      api.getAstContext().variable(var);
+      from.push_back(e);
+      to.push_back(ctx.bv_const(var->getName().c_str(), var->getSize()));
+      continue;
+    }
+    for (unsigned i = 0; i < e.num_args(); i++)
+      worklist.push_back(e.arg(i));
+  }
+
+  auto node = ast::Z3ToTritonAst(api.getAstContext()).convert(constraint.substitute(from, to));
+
+  engines::solver::Z3Solver solver;
+  engines::solver::SolverQueryStats stats;
+  auto limit   = std::stoul(query.metadata["limit"]);
+  auto timeout = std::stoul(query.metadata["timeout"]);
+  auto memory  = std::stoul(query.metadata["memory-limit"]);
+
+  solver.solve(node, limit, timeout, memory, stats);
+
+  query.status   = names[stats.status];
+  query.recorded = std::stoull(query.metadata["conversion-time"]) + std::stoull(query.metadata["solving-time"]);
+  query.replayed = stats.conversionTime + stats.solvingTime;
+
+  return true;
+}
+
+
+/* Prints the latency distribution of queries */
+static void distribution(const std::string& name, std::vector<triton::uint64> latencies) {
+  triton::uint64 total = 0;
+
+  std::sort(latencies.begin(), latencies.end());
+  for (auto latency : latencies)
+    total += latency;
+
+  auto percentile = [&latencies](triton::usize p) {
+    return latencies[std::min(latencies.size() - 1, latencies.size() * p / 100)];
+  };
+
+  std::cout << name << ": min " << latencies.front() << " us, p50 " << percentile(50) << " us, p90 " << percentile(90)
+            << " us, p99 " << percentile(99) << " us, max " << latencies.back() << " us, total " << total << " us" << std::endl;
+}
+#endif
+
+
+int main(int ac, const char **av) {
+  #ifdef Z3_INTERFACE
+  triton::uint32 errors = 0;
+  triton::usize recorded = 0;
+  std::string directory = ".";
+  std::vector<Query> queries;
+
+  if (ac > 1)
+    directory = av[1];
+  else
+    recorded = record();
+
+  for (triton::usize i = 0;; i++) {
+    Query query;
+    query.path = queryPath(directory, i);
+    if (!replay(query))
+      break;
+    queries.push_back(query);
+  }
+
+  if (queries.empty()) {
+    std::cerr << "No query recorded in " << directory << std::endl;
+    return 1;
+  }
+
+  std::vector<triton::uint64> before;
+  std::vector<triton::uint64> after;
+  for (const auto& query : queries) {
+    before.push_back(query.recorded);
+    after.push_back(query.replayed);
+    /* A query which reached a limit may succeed with another run */
+    const auto& status = query.metadata.at("status");
+    if ((status == "SAT" || status == "UNSAT") && (query.status == "SAT" || query.status == "UNSAT") && status != query.status) {
+      std::cerr << query.path << ": " << status << " recorded, " << query.status << " replayed" << std::endl;
+      errors++;
+    }
+  }
+
+  std::cout << queries.size() << " queries replayed from " << directory << std::endl;
+  distribution("recorded", before);
+  distribution("replayed", after);
+
+  /* The slowest queries of the replay */
+  std::sort(queries.begin(), queries.end(), [](const Query& a, const Query& b) { return a.replayed > b.replayed; });
+  for (triton::usize i = 0; i < std::min<triton::usize>(queries.size(), 5); i++) {
+    std::cout << "  " << queries[i].path << ": " << queries[i].replayed << " us (" << queries[i].recorded << " us recorded), "
+              << queries[i].status << ", " << queries[i].metadata["ast-size"] << " nodes" << std::endl;
+  }
+
+  if (recorded) {
+    if (queries.size() != recorded)
+      errors++;
+    for (triton::usize i = 0; i < recorded; i++)
+      std::remove(queryPath(directory, i).c_str());
+  }
+
+  if (errors) {
+    std::cerr << "KO (" << errors << " errors)" << std::endl;
+    return 1;
+  }
+  #else
+  std::cout << "The replay needs z3" << std::endl;
+  #endif
+
+  return 0;
+}
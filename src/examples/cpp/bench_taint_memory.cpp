@@ -0,0 +1,80 @@
+/*
+** Benchmark of the taint of the memory.
+**
+** Taints a 1 MB input, checks every 8-byte access of the input and of the memory
+** around it, and untaints it, with the shadow bitmap of the taint engine and with
+** the previous std::set of tainted addresses. Both must agree on every access.
+** The bitmap needs 256 pages of 512 bytes instead of a million tree nodes.
+*/
+
+#include <chrono>
+#include <iostream>
+#include <set>
+
+#include <triton/api.hpp>
+#include <triton/shadowMemory.hpp>
+
+using namespace triton;
+
+const triton::uint64 base = 0x7fff00000000;
+const triton::usize  size = 0x100000;
+
+
+int main(int ac, const char **av) {
+  triton::uint32 errors = 0;
+  triton::usize hits[2] = {0, 0};
+
+  triton::API api;
+  api.setArchitecture(triton::arch::ARCH_X86_64);
+
+  /* The shadow bitmap */
+  auto t0 = std::chrono::steady_clock::now();
+  api.taintMemoryRange(base, size);
+  auto t1 = std::chrono::steady_clock::now();
+  for (triton::uint64 addr = base - 0x1000; addr < base + size + 0x1000; addr += 8)
+    hits[0] += api.isMemoryTainted(triton::arch::MemoryAccess(addr, 8));
+  auto t2 = std::chrono::steady_clock::now();
+  auto ranges = api.getTaintedMemoryRanges();
+  api.untaintMemoryRange(base, size);
+  auto t3 = std::chrono::steady_clock::now();
+
+  std::cout << "shadow bitmap: taint in " << std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count() << " us, "
+            << "checks in " << std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count() << " us, "
+            << "ranges and untaint in " << std::chrono::duration_cast<std::chrono::microseconds>(t3 - t2).count() << " us" << std::endl;
+
+  if (ranges.size() != 1 || ranges[0].first != base || ranges[0].second != size || api.getTaintedMemoryRanges().empty() == false)
+    errors++;
+
+  /* The previous implementation */
+  std::set<triton::uint64> tainted;
+  t0 = std::chrono::steady_clock::now();
+  for (triton::uint64 addr = base; addr < base + size; addr++)
+    tainted.insert(addr);
+  t1 = std::chrono::steady_clock::now();
+  for (triton::uint64 addr = base - 0x1000; addr < base + size + 0x1000; addr += 8) {
+    for (triton::uint64 i = 0; i < 8; i++) {
+      if (tainted.find(addr + i) != tainted.end()) {
+        hits[1]++;
+        break;
+      }
+    }
+  }
+  t2 = std::chrono::steady_clock::now();
+  for (triton::uint64 addr = base; addr < base + size; addr++)
+    tainted.erase(addr);
+  t3 = std::chrono::steady_clock::now();
+
+  std::cout << "std::set: taint in " << std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count() << " us, "
+            << "checks in " << std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count() << " us, "
+            << "untaint in " << std::chrono::duration_cast<std::chrono::microseconds>(t3 - t2).count() << " us" << std::endl;
+
+  if (hits[0] != hits[1] || hits[0] != size / 8)
+    errors++;
+
+  if (errors) {
+    std::cerr << "KO (" << errors << " errors)" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
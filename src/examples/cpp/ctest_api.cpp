@@ -440,6 +440,40 @@ int test_8(void) {
 }
 
 
+int test_9(void) {
+  triton::API api;
+
+  api.setArchitecture(triton::arch::ARCH_X86_64);
+  api.enableMode(triton::modes::AST_HASH_CONSING, true);
+
+  auto& ast = api.getAstContext();
+  auto  x   = ast.variable(api.newSymbolicVariable(64));
+  auto  e   = api.newSymbolicExpression(ast.bvadd(x, ast.bv(1, 64)));
+  auto  n1  = ast.extract(7, 0, ast.reference(e));
+  auto  n2  = ast.extract(7, 0, ast.reference(e));
+  auto  n3  = ast.extract(15, 8, ast.reference(e));
+
+  if (n1 != n2) {
+    std::cerr << "test_9: KO (identical nodes are not shared)" << std::endl;
+    return 1;
+  }
+
+  if (n1 == n3 || n1->getChildren()[2] != n3->getChildren()[2]) {
+    std::cerr << "test_9: KO (invalid sharing of extract nodes)" << std::endl;
+    return 1;
+  }
+
+  api.enableMode(triton::modes::AST_HASH_CONSING, false);
+  if (ast.extract(7, 0, ast.reference(e)) == n1) {
+    std::cerr << "test_9: KO (nodes are shared while the mode is disabled)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_9: OK" << std::endl;
+  return 0;
+}
+
+
 int main(int ac, const char **av) {
   if (test_1())
     return 1;
@@ -465,5 +499,8 @@ int main(int ac, const char **av) {
   if (test_8())
     return 1;
 
+  if (test_9())
+    return 1;
+
   return 0;
 }
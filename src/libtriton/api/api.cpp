@@ -224,7 +224,7 @@ Note that only the version `71313` of Pin is supported.
 
 namespace triton {
 
-  API::API() : callbacks(*this), arch(&this->callbacks), modes(), astCtxt(this->modes) {
+  API::API() : callbacks(*this), arch(&this->callbacks, &this->modes), modes(), astCtxt(this->modes) {
   }
 
 
@@ -424,6 +424,31 @@ namespace triton {
   }
 
 
+  triton::usize API::getDisassemblyCacheHits(void) const {
+    return this->arch.getDisassemblyCacheHits();
+  }
+
+
+  triton::usize API::getDisassemblyCacheMisses(void) const {
+    return this->arch.getDisassemblyCacheMisses();
+  }
+
+
+  void API::clearDisassemblyCache(void) {
+    this->arch.clearDisassemblyCache();
+  }
+
+
+  void API::setDisassemblyCacheSize(triton::usize size) {
+    this->arch.setDisassemblyCacheSize(size);
+  }
+
+
+  triton::usize API::getDisassemblyCacheSize(void) const {
+    return this->arch.getDisassemblyCacheSize();
+  }
+
+
 
   /* Processing API ================================================================================ */
 
@@ -434,7 +459,7 @@ namespace triton {
     if (this->symbolic == nullptr)
       throw triton::exceptions::API("API::initEngines(): No enough memory.");
 
-    this->solver = new(std::nothrow) triton::engines::solver::SolverEngine();
+    this->solver = new(std::nothrow) triton::engines::solver::SolverEngine(&this->modes);
     if (this->solver == nullptr)
       throw triton::exceptions::API("API::initEngines(): No enough memory.");
 
@@ -826,6 +851,12 @@ namespace triton {
   }
 
 
+  void API::setConcreteVariableValues(const std::map<triton::usize, triton::uint512>& values) {
+    this->checkSymbolic();
+    this->symbolic->setConcreteVariableValues(values);
+  }
+
+
   const triton::engines::symbolic::SharedSymbolicVariable& API::getSymbolicVariableFromId(triton::usize symVarId) const {
     this->checkSymbolic();
     return this->symbolic->getSymbolicVariableFromId(symVarId);
@@ -991,21 +1022,177 @@ namespace triton {
   }
 
 
-  std::map<triton::uint32, triton::engines::solver::SolverModel> API::getModel(const triton::ast::SharedAbstractNode& node) const {
+  std::map<triton::uint32, triton::engines::solver::SolverModel> API::getModel(const triton::ast::SharedAbstractNode& node, bool independence, triton::engines::solver::status_e* status, triton::uint32 timeout) const {
+    this->checkSolver();
+    return this->solver->getModel(node, independence, status, timeout);
+  }
+
+
+  std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>> API::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, bool independence, triton::engines::solver::status_e* status, triton::uint32 timeout) const {
+    this->checkSolver();
+    return this->solver->getModels(node, limit, independence, status, timeout);
+  }
+
+
+  bool API::isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout) const {
+    this->checkSolver();
+    return this->solver->isSat(node, status, timeout);
+  }
+
+
+  std::vector<std::map<triton::uint32, triton::engines::solver::SolverModel>> API::getBatchModels(const std::vector<triton::ast::SharedAbstractNode>& nodes, triton::uint32 workers, triton::uint32 timeout) const {
+    this->checkSolver();
+    return this->solver->getBatchModels(nodes, workers, timeout);
+  }
+
+
+  void API::setSolverTimeout(triton::uint32 timeout) {
+    this->checkSolver();
+    this->solver->setTimeout(timeout);
+  }
+
+
+  triton::uint32 API::getSolverTimeout(void) const {
+    this->checkSolver();
+    return this->solver->getTimeout();
+  }
+
+
+  void API::setSolverMemoryLimit(triton::uint32 limit) {
+    this->checkSolver();
+    this->solver->setMemoryLimit(limit);
+  }
+
+
+  triton::uint32 API::getSolverMemoryLimit(void) const {
+    this->checkSolver();
+    return this->solver->getMemoryLimit();
+  }
+
+
+  const std::deque<triton::engines::solver::SolverQueryStats>& API::getSolverQueryStats(void) const {
+    this->checkSolver();
+    return this->solver->getQueryStats();
+  }
+
+
+  void API::clearSolverQueryStats(void) {
+    this->checkSolver();
+    this->solver->clearQueryStats();
+  }
+
+
+  void API::setSolverQueryStatsSize(triton::usize size) {
+    this->checkSolver();
+    this->solver->setQueryStatsSize(size);
+  }
+
+
+  void API::setSolverQueryRecordingDirectory(const std::string& path) {
+    this->checkSolver();
+    this->solver->setRecordingDirectory(path);
+  }
+
+
+  const std::string& API::getSolverQueryRecordingDirectory(void) const {
     this->checkSolver();
-    return this->solver->getModel(node);
+    return this->solver->getRecordingDirectory();
   }
 
 
-  std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>> API::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit) const {
+  triton::usize API::getSolverRecordedQueries(void) const {
     this->checkSolver();
-    return this->solver->getModels(node, limit);
+    return this->solver->getRecordedQueries();
   }
 
 
-  bool API::isSat(const triton::ast::SharedAbstractNode& node) const {
+  triton::usize API::getSolverRecordingFailures(void) const {
     this->checkSolver();
-    return this->solver->isSat(node);
+    return this->solver->getRecordingFailures();
+  }
+
+
+  triton::usize API::getSolverQueryCacheHits(void) const {
+    this->checkSolver();
+    return this->solver->getCacheHits();
+  }
+
+
+  triton::usize API::getSolverQueryCacheMisses(void) const {
+    this->checkSolver();
+    return this->solver->getCacheMisses();
+  }
+
+
+  triton::uint64 API::getSolverQueryCacheTimeSaved(void) const {
+    this->checkSolver();
+    return this->solver->getCacheTimeSaved();
+  }
+
+
+  void API::clearSolverQueryCache(void) {
+    this->checkSolver();
+    this->solver->clearCache();
+  }
+
+
+  void API::setSolverQueryCacheFile(const std::string& path) {
+    this->checkSolver();
+    this->solver->setCacheFile(path);
+  }
+
+
+  void API::setSolverQueryCacheSize(triton::usize size) {
+    this->checkSolver();
+    this->solver->setCacheSize(size);
+  }
+
+
+  triton::usize API::getSolverModelReuseHits(void) const {
+    this->checkSolver();
+    return this->solver->getModelReuseHits();
+  }
+
+
+  void API::setSolverModelReuseSize(triton::usize size) {
+    this->checkSolver();
+    this->solver->setModelReuseSize(size);
+  }
+
+
+  void API::pushSolverScope(void) {
+    this->checkSolver();
+    this->solver->push();
+  }
+
+
+  void API::popSolverScope(void) {
+    this->checkSolver();
+    this->solver->pop();
+  }
+
+
+  void API::addSolverConstraint(const triton::ast::SharedAbstractNode& node) {
+    this->checkSolver();
+    this->solver->addConstraint(node);
+  }
+
+
+  void API::resetSolverSession(void) {
+    this->checkSolver();
+    this->solver->resetSession();
+  }
+
+
+  std::map<triton::uint32, triton::engines::solver::SolverModel> API::getSessionModel(const triton::ast::SharedAbstractNode& node) {
+    this->checkSolver();
+    return this->solver->getSessionModel(node);
+  }
+
+
+  bool API::isSessionSat(const triton::ast::SharedAbstractNode& node) {
+    this->checkSolver();
+    return this->solver->isSessionSat(node);
   }
 
 
@@ -1046,18 +1233,36 @@ namespace triton {
   }
 
 
-  const std::set<triton::uint64>& API::getTaintedMemory(void) const {
+  std::set<triton::uint64> API::getTaintedMemory(void) const {
     this->checkTaint();
     return this->taint->getTaintedMemory();
   }
 
 
+  std::vector<std::pair<triton::uint64, triton::usize>> API::getTaintedMemoryRanges(void) const {
+    this->checkTaint();
+    return this->taint->getTaintedMemoryRanges();
+  }
+
+
   std::set<const triton::arch::Register*> API::getTaintedRegisters(void) const {
     this->checkTaint();
     return this->taint->getTaintedRegisters();
   }
 
 
+  std::vector<triton::uint32> API::getMemoryTaintLabels(const triton::arch::MemoryAccess& mem) const {
+    this->checkTaint();
+    return this->taint->getMemoryTaintLabels(mem);
+  }
+
+
+  std::vector<triton::uint32> API::getRegisterTaintLabels(const triton::arch::Register& reg) const {
+    this->checkTaint();
+    return this->taint->getRegisterTaintLabels(reg);
+  }
+
+
   void API::enableTaintEngine(bool flag) {
     this->checkTaint();
     this->taint->enable(flag);
@@ -1126,12 +1331,30 @@ namespace triton {
   }
 
 
+  bool API::taintMemoryRange(triton::uint64 baseAddr, triton::usize size) {
+    this->checkTaint();
+    return this->taint->taintMemoryRange(baseAddr, size);
+  }
+
+
+  bool API::taintMemoryWithLabel(const triton::arch::MemoryAccess& mem, triton::uint32 label) {
+    this->checkTaint();
+    return this->taint->taintMemoryWithLabel(mem, label);
+  }
+
+
   bool API::taintRegister(const triton::arch::Register& reg) {
     this->checkTaint();
     return this->taint->taintRegister(reg);
   }
 
 
+  bool API::taintRegisterWithLabel(const triton::arch::Register& reg, triton::uint32 label) {
+    this->checkTaint();
+    return this->taint->taintRegisterWithLabel(reg, label);
+  }
+
+
   bool API::untaintMemory(triton::uint64 addr) {
     this->checkTaint();
     return this->taint->untaintMemory(addr);
@@ -1144,6 +1367,12 @@ namespace triton {
   }
 
 
+  bool API::untaintMemoryRange(triton::uint64 baseAddr, triton::usize size) {
+    this->checkTaint();
+    return this->taint->untaintMemoryRange(baseAddr, size);
+  }
+
+
   bool API::untaintRegister(const triton::arch::Register& reg) {
     this->checkTaint();
     return this->taint->untaintRegister(reg);
@@ -24,16 +24,19 @@ namespace triton {
       AArch64Cpu::AArch64Cpu(triton::callbacks::Callbacks* callbacks) : AArch64Specifications(ARCH_AARCH64) {
         this->callbacks = callbacks;
         this->clear();
+        this->disassInit();
       }
 
 
       AArch64Cpu::AArch64Cpu(const AArch64Cpu& other) : AArch64Specifications(ARCH_AARCH64) {
         this->copy(other);
+        this->disassInit();
       }
 
 
       AArch64Cpu::~AArch64Cpu() {
         this->memory.clear();
+        triton::extlibs::capstone::cs_close(&this->handle);
       }
 
 
@@ -220,8 +223,20 @@ namespace triton {
       }
 
 
+      void AArch64Cpu::disassInit(void) {
+        if (triton::extlibs::capstone::cs_open(triton::extlibs::capstone::CS_ARCH_ARM64, triton::extlibs::capstone::CS_MODE_ARM, &this->handle) != triton::extlibs::capstone::CS_ERR_OK)
+          throw triton::exceptions::Disassembly("AArch64Cpu::disassInit(): Cannot open capstone.");
+
+        triton::extlibs::capstone::cs_option(this->handle, triton::extlibs::capstone::CS_OPT_DETAIL, triton::extlibs::capstone::CS_OPT_ON);
+      }
+
+
+      triton::usize AArch64Cpu::getHandle(void) const {
+        return this->handle;
+      }
+
+
       void AArch64Cpu::disassembly(triton::arch::Instruction& inst) const {
-        triton::extlibs::capstone::csh       handle;
         triton::extlibs::capstone::cs_insn*  insn;
         triton::usize                        count = 0;
         triton::uint32                       size = 0;
@@ -230,18 +245,11 @@ namespace triton {
         if (inst.getOpcode() == nullptr || inst.getSize() == 0)
           throw triton::exceptions::Disassembly("AArch64Cpu::disassembly(): Opcode and opcodeSize must be definied.");
 
-        /* Open capstone */
-        if (triton::extlibs::capstone::cs_open(triton::extlibs::capstone::CS_ARCH_ARM64, triton::extlibs::capstone::CS_MODE_ARM, &handle) != triton::extlibs::capstone::CS_ERR_OK)
-          throw triton::exceptions::Disassembly("AArch64Cpu::disassembly(): Cannot open capstone.");
-
-        /* Init capstone's options */
-        triton::extlibs::capstone::cs_option(handle, triton::extlibs::capstone::CS_OPT_DETAIL, triton::extlibs::capstone::CS_OPT_ON);
-
         /* Clear instructicon's operands if alredy defined */
         inst.operands.clear();
 
         /* Let's disass and build our operands */
-        count = triton::extlibs::capstone::cs_disasm(handle, inst.getOpcode(), inst.getSize(), inst.getAddress(), 0, &insn);
+        count = triton::extlibs::capstone::cs_disasm(this->getHandle(), inst.getOpcode(), inst.getSize(), inst.getAddress(), 0, &insn);
         if (count > 0) {
           triton::extlibs::capstone::cs_detail* detail = insn->detail;
           for (triton::uint32 j = 0; j < 1; j++) {
@@ -373,7 +381,6 @@ namespace triton {
         else
           throw triton::exceptions::Disassembly("AArch64Cpu::disassembly(): Failed to disassemble the given code.");
 
-        triton::extlibs::capstone::cs_close(&handle);
         return;
       }
 
@@ -382,15 +389,12 @@ namespace triton {
         if (execCallbacks && this->callbacks)
           this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, MemoryAccess(addr, BYTE_SIZE));
 
-        auto it = this->memory.find(addr);
-        if (it == this->memory.end())
-          return 0x00;
-
-        return it->second;
+        return this->memory.read(addr);
       }
 
 
       triton::uint512 AArch64Cpu::getConcreteMemoryValue(const triton::arch::MemoryAccess& mem, bool execCallbacks) const {
+        triton::uint8 buffer[DQQWORD_SIZE];
         triton::uint512 ret = 0;
         triton::uint64 addr = 0;
         triton::uint32 size = 0;
@@ -404,18 +408,33 @@ namespace triton {
         if (size == 0 || size > DQQWORD_SIZE)
           throw triton::exceptions::Cpu("AArch64Cpu::getConcreteMemoryValue(): Invalid size memory.");
 
+        this->memory.read(addr, buffer, size);
+
+        /* Fast path for accesses which fit in 64 bits */
+        if (size <= QWORD_SIZE) {
+          triton::uint64 value = 0;
+          std::memcpy(&value, buffer, size);
+          return value;
+        }
+
         for (triton::sint32 i = size-1; i >= 0; i--)
-          ret = ((ret << BYTE_SIZE_BIT) | this->getConcreteMemoryValue(addr+i, false));
+          ret = ((ret << BYTE_SIZE_BIT) | buffer[i]);
 
         return ret;
       }
 
 
       std::vector<triton::uint8> AArch64Cpu::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks) const {
-        std::vector<triton::uint8> area;
+        std::vector<triton::uint8> area(size);
+
+        /* Callbacks are processed for each byte */
+        if (execCallbacks && this->callbacks && this->callbacks->isDefined) {
+          for (triton::usize index = 0; index < size; index++)
+            area[index] = this->getConcreteMemoryValue(baseAddr+index);
+          return area;
+        }
 
-        for (triton::usize index = 0; index < size; index++)
-          area.push_back(this->getConcreteMemoryValue(baseAddr+index));
+        this->memory.read(baseAddr, area.data(), size);
 
         return area;
       }
@@ -511,11 +530,12 @@ namespace triton {
       void AArch64Cpu::setConcreteMemoryValue(triton::uint64 addr, triton::uint8 value) {
         if (this->callbacks)
           this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_VALUE, MemoryAccess(addr, BYTE_SIZE), value);
-        this->memory[addr] = value;
+        this->memory.write(addr, value);
       }
 
 
       void AArch64Cpu::setConcreteMemoryValue(const triton::arch::MemoryAccess& mem, const triton::uint512& value) {
+        triton::uint8 buffer[DQQWORD_SIZE];
         triton::uint64 addr = mem.getAddress();
         triton::uint32 size = mem.getSize();
         triton::uint512 cv  = value;
@@ -529,24 +549,36 @@ namespace triton {
         if (this->callbacks)
           this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_VALUE, mem, value);
 
-        for (triton::uint32 i = 0; i < size; i++) {
-          this->memory[addr+i] = (cv & 0xff).convert_to<triton::uint8>();
-          cv >>= 8;
+        /* Fast path for accesses which fit in 64 bits */
+        if (size <= QWORD_SIZE) {
+          triton::uint64 v = cv.convert_to<triton::uint64>();
+          std::memcpy(buffer, &v, size);
+        }
+        else {
+          for (triton::uint32 i = 0; i < size; i++) {
+            buffer[i] = (cv & 0xff).convert_to<triton::uint8>();
+            cv >>= 8;
+          }
         }
+
+        this->memory.write(addr, buffer, size);
       }
 
 
       void AArch64Cpu::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const std::vector<triton::uint8>& values) {
-        for (triton::usize index = 0; index < values.size(); index++) {
-          this->setConcreteMemoryValue(baseAddr+index, values[index]);
-        }
+        this->setConcreteMemoryAreaValue(baseAddr, values.data(), values.size());
       }
 
 
       void AArch64Cpu::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size) {
-        for (triton::usize index = 0; index < size; index++) {
-          this->setConcreteMemoryValue(baseAddr+index, area[index]);
+        /* Callbacks are processed for each byte */
+        if (this->callbacks && this->callbacks->isDefined) {
+          for (triton::usize index = 0; index < size; index++)
+            this->setConcreteMemoryValue(baseAddr+index, area[index]);
+          return;
         }
+
+        this->memory.write(baseAddr, area, size);
       }
 
 
@@ -653,19 +685,12 @@ namespace triton {
 
 
       bool AArch64Cpu::isMemoryMapped(triton::uint64 baseAddr, triton::usize size) {
-        for (triton::usize index = 0; index < size; index++) {
-          if (this->memory.find(baseAddr + index) == this->memory.end())
-            return false;
-        }
-        return true;
+        return this->memory.isMapped(baseAddr, size);
       }
 
 
       void AArch64Cpu::unmapMemory(triton::uint64 baseAddr, triton::usize size) {
-        for (triton::usize index = 0; index < size; index++) {
-          if (this->memory.find(baseAddr + index) != this->memory.end())
-            this->memory.erase(baseAddr + index);
-        }
+        this->memory.unmap(baseAddr, size);
       }
 
     }; /* x86 namespace */
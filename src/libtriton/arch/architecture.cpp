@@ -18,9 +18,13 @@
 namespace triton {
   namespace arch {
 
-    Architecture::Architecture(triton::callbacks::Callbacks* callbacks) {
-      this->arch      = triton::arch::ARCH_INVALID;
-      this->callbacks = callbacks;
+    Architecture::Architecture(triton::callbacks::Callbacks* callbacks, const triton::modes::Modes* modes) {
+      this->arch              = triton::arch::ARCH_INVALID;
+      this->callbacks         = callbacks;
+      this->modes             = modes;
+      this->disassCacheHits   = 0;
+      this->disassCacheMisses = 0;
+      this->disassCacheSize   = 65536;
     }
 
 
@@ -74,6 +78,9 @@ namespace triton {
 
       /* Setup global variables */
       this->arch = arch;
+
+      /* Decoded instructions belong to the previous CPU */
+      this->clearDisassemblyCache();
     }
 
 
@@ -200,7 +207,80 @@ namespace triton {
     void Architecture::disassembly(triton::arch::Instruction& inst) const {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::disassembly(): You must define an architecture.");
-      this->cpu->disassembly(inst);
+
+      if (this->modes == nullptr || !this->modes->isModeEnabled(triton::modes::DISASSEMBLY_CACHE) || inst.getOpcode() == nullptr) {
+        this->cpu->disassembly(inst);
+        return;
+      }
+
+      /* The key is the address followed by the opcode bytes */
+      triton::uint64 addr = inst.getAddress();
+      std::string key(reinterpret_cast<const char*>(&addr), sizeof(addr));
+      key.append(reinterpret_cast<const char*>(inst.getOpcode()), inst.getSize());
+
+      auto it = this->disassCache.find(key);
+      if (it == this->disassCache.end()) {
+        this->disassCacheMisses++;
+        this->cpu->disassembly(inst);
+        if (this->disassCacheSize) {
+          this->disassCacheEntries.emplace_front(key, inst);
+          this->disassCache[key] = this->disassCacheEntries.begin();
+          this->evictDisassemblyCache();
+        }
+        return;
+      }
+
+      /* Restore what the disassembler would have set */
+      this->disassCacheEntries.splice(this->disassCacheEntries.begin(), this->disassCacheEntries, it->second);
+      const triton::arch::Instruction& tpl = it->second->second;
+      this->disassCacheHits++;
+      inst.setDisassembly(tpl.getDisassembly());
+      inst.setSize(tpl.getSize());
+      inst.setType(tpl.getType());
+      inst.setPrefix(tpl.getPrefix());
+      inst.setCodeCondition(tpl.getCodeCondition());
+      inst.setBranch(tpl.isBranch());
+      inst.setControlFlow(tpl.isControlFlow());
+      inst.setUpdateFlag(tpl.isUpdateFlag());
+      inst.setWriteBack(tpl.isWriteBack());
+      inst.operands = tpl.operands;
+    }
+
+
+    triton::usize Architecture::getDisassemblyCacheHits(void) const {
+      return this->disassCacheHits;
+    }
+
+
+    triton::usize Architecture::getDisassemblyCacheMisses(void) const {
+      return this->disassCacheMisses;
+    }
+
+
+    void Architecture::clearDisassemblyCache(void) {
+      this->disassCache.clear();
+      this->disassCacheEntries.clear();
+      this->disassCacheHits   = 0;
+      this->disassCacheMisses = 0;
+    }
+
+
+    void Architecture::setDisassemblyCacheSize(triton::usize size) {
+      this->disassCacheSize = size;
+      this->evictDisassemblyCache();
+    }
+
+
+    triton::usize Architecture::getDisassemblyCacheSize(void) const {
+      return this->disassCacheSize;
+    }
+
+
+    void Architecture::evictDisassemblyCache(void) const {
+      while (this->disassCacheEntries.size() > this->disassCacheSize) {
+        this->disassCache.erase(this->disassCacheEntries.back().first);
+        this->disassCacheEntries.pop_back();
+      }
     }
 
 
@@ -232,6 +312,42 @@ namespace triton {
     }
 
 
+    triton::uint64 Architecture::getConcreteMemoryAddress(const triton::arch::MemoryAccess& mem) const {
+      const triton::arch::Register& base  = mem.getConstBaseRegister();
+      const triton::arch::Register& index = mem.getConstIndexRegister();
+      const triton::arch::Register& seg   = mem.getConstSegmentRegister();
+      triton::uint64 segmentValue         = (this->isRegisterValid(seg) ? this->getConcreteRegisterValue(seg).convert_to<triton::uint64>() : 0);
+      triton::uint64 scaleValue           = mem.getConstScale().getValue();
+      triton::uint64 dispValue            = mem.getConstDisplacement().getValue();
+      triton::uint32 bitSize              = (this->isRegisterValid(index) ? index.getBitSize() :
+                                              (this->isRegisterValid(base) ? base.getBitSize() :
+                                                (mem.getConstDisplacement().getBitSize() ? mem.getConstDisplacement().getBitSize() :
+                                                  this->gprBitSize()
+                                                )
+                                              )
+                                            );
+
+      /* (pc + base) + (index * scale) + disp */
+      triton::uint64 baseValue  = (mem.getPcRelative() ? mem.getPcRelative() :
+                                    (this->isRegisterValid(base) ? this->getConcreteRegisterValue(base).convert_to<triton::uint64>() : 0)
+                                  );
+      triton::uint64 indexValue = (this->isRegisterValid(index) ? this->getConcreteRegisterValue(index).convert_to<triton::uint64>() : 0);
+      triton::uint64 mask       = (bitSize >= 64 ? ~0ULL : ((1ULL << bitSize) - 1));
+      triton::uint64 address    = (baseValue + indexValue * scaleValue + dispValue) & mask;
+
+      /* Use segments as base address instead of selector into the GDT. The address is sign-extended */
+      if (segmentValue) {
+        if (bitSize < 64 && ((address >> (bitSize - 1)) & 1))
+          address |= ~mask;
+        address += segmentValue;
+        if (seg.getBitSize() < 64)
+          address &= ((1ULL << seg.getBitSize()) - 1);
+      }
+
+      return address;
+    }
+
+
     void Architecture::setConcreteMemoryValue(triton::uint64 addr, triton::uint8 value) {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::setConcreteMemoryValue(): You must define an architecture.");
@@ -15,6 +15,7 @@
 #include <triton/operandWrapper.hpp>
 #include <triton/register.hpp>
 #include <triton/x86Semantics.hpp>
+#include <triton/x86TaintSemantics.hpp>
 
 
 
@@ -43,8 +44,10 @@ namespace triton {
       this->taintEngine               = taintEngine;
       this->aarch64Isa                = new(std::nothrow) triton::arch::aarch64::AArch64Semantics(architecture, symbolicEngine, taintEngine, astCtxt);
       this->x86Isa                    = new(std::nothrow) triton::arch::x86::x86Semantics(architecture, symbolicEngine, taintEngine, modes, astCtxt);
+      this->x86ConcreteIsa            = new(std::nothrow) triton::arch::x86::x86ConcreteSemantics(architecture, symbolicEngine, taintEngine, modes);
+      this->x86TaintIsa               = new(std::nothrow) triton::arch::x86::x86TaintSemantics(architecture, taintEngine, this->x86ConcreteIsa);
 
-      if (this->x86Isa == nullptr || this->aarch64Isa == nullptr || this->backupSymbolicEngine == nullptr)
+      if (this->x86Isa == nullptr || this->x86TaintIsa == nullptr || this->x86ConcreteIsa == nullptr || this->aarch64Isa == nullptr || this->backupSymbolicEngine == nullptr)
         throw triton::exceptions::IrBuilder("IrBuilder::IrBuilder(): Not enough memory.");
     }
 
@@ -53,6 +56,38 @@ namespace triton {
       delete this->backupSymbolicEngine;
       delete this->aarch64Isa;
       delete this->x86Isa;
+      delete this->x86TaintIsa;
+      delete this->x86ConcreteIsa;
+    }
+
+
+    bool IrBuilder::isTaintFastPath(const triton::arch::Instruction& inst) const {
+      if (!this->modes.isModeEnabled(triton::modes::TAINT_FAST_PATH) || this->symbolicEngine->isEnabled())
+        return false;
+
+      switch (this->architecture->getArchitecture()) {
+        case triton::arch::ARCH_X86:
+        case triton::arch::ARCH_X86_64:
+          return this->x86TaintIsa->isSupported(inst);
+
+        default:
+          return false;
+      }
+    }
+
+
+    bool IrBuilder::isConcreteFastPath(const triton::arch::Instruction& inst) const {
+      if (!this->modes.isModeEnabled(triton::modes::CONCRETE_FAST_PATH) || !this->symbolicEngine->isEnabled())
+        return false;
+
+      switch (this->architecture->getArchitecture()) {
+        case triton::arch::ARCH_X86:
+        case triton::arch::ARCH_X86_64:
+          return this->x86ConcreteIsa->isSupported(inst);
+
+        default:
+          return false;
+      }
     }
 
 
@@ -62,6 +97,23 @@ namespace triton {
       if (this->architecture->getArchitecture() == triton::arch::ARCH_INVALID)
         throw triton::exceptions::IrBuilder("IrBuilder::buildSemantics(): You must define an architecture.");
 
+      /* Only spread the taint, no expression is built */
+      if (this->isTaintFastPath(inst)) {
+        this->preIrInit(inst);
+        ret = this->x86TaintIsa->buildSemantics(inst);
+        this->postIrInit(inst);
+        return ret;
+      }
+
+      /* Execute the instruction natively if all its operands are concrete, no expression is built */
+      if (this->isConcreteFastPath(inst)) {
+        this->preIrInit(inst);
+        if (this->x86ConcreteIsa->buildSemantics(inst)) {
+          this->postIrInit(inst);
+          return true;
+        }
+      }
+
       /* Initialize the target address of memory operands */
       for (auto& operand : inst.operands) {
         if (operand.getType() == triton::arch::OP_MEM) {
@@ -111,7 +163,7 @@ namespace triton {
         inst.setAddress(this->architecture->getConcreteRegisterValue(this->architecture->getProgramCounter()).convert_to<triton::uint64>());
 
       /* Backup the symbolic engine in the case where only the taint is available. */
-      if (!this->symbolicEngine->isEnabled()) {
+      if (!this->symbolicEngine->isEnabled() && !this->isTaintFastPath(inst)) {
         *this->backupSymbolicEngine = *this->symbolicEngine;
       }
     }
@@ -150,8 +202,9 @@ namespace triton {
         /* Symbolic Expressions */
         this->removeSymbolicExpressions(inst);
 
-        /* Restore backup */
-        *this->symbolicEngine = *this->backupSymbolicEngine;
+        /* Restore backup, the symbolic engine is not used by the fast path */
+        if (!this->isTaintFastPath(inst))
+          *this->symbolicEngine = *this->backupSymbolicEngine;
       }
 
       // ----------------------------------------------------------------------
@@ -0,0 +1,227 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <bitset>
+#include <cstring>
+#include <new>
+
+#include <triton/exceptions.hpp>
+#include <triton/pagedMemory.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    PagedMemory::PagedMemory() {
+      this->lastBase = 0;
+      this->lastPage = nullptr;
+    }
+
+
+    PagedMemory::PagedMemory(const PagedMemory& other) {
+      this->copy(other);
+    }
+
+
+    PagedMemory& PagedMemory::operator=(const PagedMemory& other) {
+      this->copy(other);
+      return *this;
+    }
+
+
+    void PagedMemory::copy(const PagedMemory& other) {
+      this->pages.clear();
+      this->lastBase = 0;
+      this->lastPage = nullptr;
+
+      for (const auto& item : other.pages) {
+        std::unique_ptr<Page> page(new(std::nothrow) Page(*item.second));
+        if (page == nullptr)
+          throw triton::exceptions::Cpu("PagedMemory::copy(): Not enough memory.");
+        this->pages.emplace(item.first, std::move(page));
+      }
+    }
+
+
+    PagedMemory::Page* PagedMemory::findPage(triton::uint64 addr) const {
+      triton::uint64 base = addr & ~(MEMORY_PAGE_SIZE - 1);
+
+      if (this->lastPage != nullptr && this->lastBase == base)
+        return this->lastPage;
+
+      auto it = this->pages.find(base);
+      if (it == this->pages.end())
+        return nullptr;
+
+      this->lastBase = base;
+      this->lastPage = it->second.get();
+
+      return this->lastPage;
+    }
+
+
+    PagedMemory::Page* PagedMemory::getPage(triton::uint64 addr) {
+      Page* page = this->findPage(addr);
+
+      if (page == nullptr) {
+        /* Value-initialized, the data and the bitmap are zeroed */
+        page = new(std::nothrow) Page();
+        if (page == nullptr)
+          throw triton::exceptions::Cpu("PagedMemory::getPage(): Not enough memory.");
+
+        this->lastBase = addr & ~(MEMORY_PAGE_SIZE - 1);
+        this->lastPage = page;
+        this->pages.emplace(this->lastBase, std::unique_ptr<Page>(page));
+      }
+
+      return page;
+    }
+
+
+    void PagedMemory::map(Page* page, triton::uint64 offset, triton::usize size) {
+      triton::uint64 end = offset + size;
+
+      while (offset < end) {
+        triton::uint64 bit  = offset % 64;
+        triton::uint64 n    = std::min<triton::uint64>(64 - bit, end - offset);
+        triton::uint64 mask = (n == 64 ? ~0ULL : ((1ULL << n) - 1)) << bit;
+        triton::uint64& w   = page->mapped[offset / 64];
+
+        page->count += std::bitset<64>(mask & ~w).count();
+        w |= mask;
+        offset += n;
+      }
+    }
+
+
+    triton::uint8 PagedMemory::read(triton::uint64 addr) const {
+      const Page* page = this->findPage(addr);
+
+      if (page == nullptr)
+        return 0x00;
+
+      return page->data[addr & (MEMORY_PAGE_SIZE - 1)];
+    }
+
+
+    void PagedMemory::read(triton::uint64 addr, triton::uint8* out, triton::usize size) const {
+      while (size) {
+        triton::uint64 offset = addr & (MEMORY_PAGE_SIZE - 1);
+        triton::usize chunk   = static_cast<triton::usize>(std::min<triton::uint64>(size, MEMORY_PAGE_SIZE - offset));
+        const Page* page      = this->findPage(addr);
+
+        if (page != nullptr)
+          std::memcpy(out, page->data + offset, chunk);
+        else
+          std::memset(out, 0x00, chunk);
+
+        out  += chunk;
+        addr += chunk;
+        size -= chunk;
+      }
+    }
+
+
+    void PagedMemory::write(triton::uint64 addr, triton::uint8 value) {
+      Page* page = this->getPage(addr);
+      triton::uint64 offset = addr & (MEMORY_PAGE_SIZE - 1);
+
+      page->data[offset] = value;
+      this->map(page, offset, 1);
+    }
+
+
+    void PagedMemory::write(triton::uint64 addr, const triton::uint8* in, triton::usize size) {
+      while (size) {
+        triton::uint64 offset = addr & (MEMORY_PAGE_SIZE - 1);
+        triton::usize chunk   = static_cast<triton::usize>(std::min<triton::uint64>(size, MEMORY_PAGE_SIZE - offset));
+        Page* page            = this->getPage(addr);
+
+        std::memcpy(page->data + offset, in, chunk);
+        this->map(page, offset, chunk);
+
+        in   += chunk;
+        addr += chunk;
+        size -= chunk;
+      }
+    }
+
+
+    bool PagedMemory::isMapped(triton::uint64 baseAddr, triton::usize size) const {
+      while (size) {
+        triton::uint64 offset = baseAddr & (MEMORY_PAGE_SIZE - 1);
+        triton::usize chunk   = static_cast<triton::usize>(std::min<triton::uint64>(size, MEMORY_PAGE_SIZE - offset));
+        const Page* page      = this->findPage(baseAddr);
+
+        if (page == nullptr)
+          return false;
+
+        for (triton::uint64 i = offset, end = offset + chunk; i < end;) {
+          triton::uint64 bit  = i % 64;
+          triton::uint64 n    = std::min<triton::uint64>(64 - bit, end - i);
+          triton::uint64 mask = (n == 64 ? ~0ULL : ((1ULL << n) - 1)) << bit;
+          if ((page->mapped[i / 64] & mask) != mask)
+            return false;
+          i += n;
+        }
+
+        baseAddr += chunk;
+        size     -= chunk;
+      }
+
+      return true;
+    }
+
+
+    void PagedMemory::unmap(triton::uint64 baseAddr, triton::usize size) {
+      while (size) {
+        triton::uint64 offset = baseAddr & (MEMORY_PAGE_SIZE - 1);
+        triton::usize chunk   = static_cast<triton::usize>(std::min<triton::uint64>(size, MEMORY_PAGE_SIZE - offset));
+        Page* page            = this->findPage(baseAddr);
+
+        if (page != nullptr) {
+          for (triton::uint64 i = offset, end = offset + chunk; i < end;) {
+            triton::uint64 bit  = i % 64;
+            triton::uint64 n    = std::min<triton::uint64>(64 - bit, end - i);
+            triton::uint64 mask = (n == 64 ? ~0ULL : ((1ULL << n) - 1)) << bit;
+            triton::uint64& w   = page->mapped[i / 64];
+
+            page->count -= std::bitset<64>(mask & w).count();
+            w &= ~mask;
+            i += n;
+          }
+
+          /* Unmapped bytes are read as zero */
+          std::memset(page->data + offset, 0x00, chunk);
+
+          if (page->count == 0) {
+            this->pages.erase(baseAddr & ~(MEMORY_PAGE_SIZE - 1));
+            this->lastPage = nullptr;
+          }
+        }
+
+        baseAddr += chunk;
+        size     -= chunk;
+      }
+    }
+
+
+    triton::usize PagedMemory::getNumberOfPages(void) const {
+      return this->pages.size();
+    }
+
+
+    void PagedMemory::clear(void) {
+      this->pages.clear();
+      this->lastBase = 0;
+      this->lastPage = nullptr;
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
@@ -0,0 +1,687 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <triton/exceptions.hpp>
+#include <triton/x86ConcreteSemantics.hpp>
+#include <triton/x86Specifications.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+    namespace x86 {
+
+      /* The flags written by the supported instructions */
+      static const triton::arch::register_e concreteFlags[] = {
+        ID_REG_X86_AF,
+        ID_REG_X86_CF,
+        ID_REG_X86_OF,
+        ID_REG_X86_PF,
+        ID_REG_X86_SF,
+        ID_REG_X86_ZF,
+      };
+
+
+      /* Returns the value masked to its size */
+      static inline triton::uint64 maskValue(triton::uint64 value, triton::uint32 bitSize) {
+        if (bitSize >= 64)
+          return value;
+        return value & ((1ULL << bitSize) - 1);
+      }
+
+
+      /* Returns the most significant bit of a value */
+      static inline bool msb(triton::uint64 value, triton::uint32 bitSize) {
+        return (value >> (bitSize - 1)) & 1;
+      }
+
+
+      /* Returns the value sign extended from its size */
+      static inline triton::uint64 signExtend(triton::uint64 value, triton::uint32 bitSize) {
+        if (bitSize >= 64 || !msb(value, bitSize))
+          return value;
+        return value | ~((1ULL << bitSize) - 1);
+      }
+
+
+      x86ConcreteSemantics::x86ConcreteSemantics(triton::arch::Architecture* architecture,
+                                                 triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                                                 triton::engines::taint::TaintEngine* taintEngine,
+                                                 triton::modes::Modes& modes)
+        : modes(modes) {
+
+        this->architecture    = architecture;
+        this->symbolicEngine  = symbolicEngine;
+        this->taintEngine     = taintEngine;
+        this->concretize      = true;
+
+        if (architecture == nullptr)
+          throw triton::exceptions::Semantics("x86ConcreteSemantics::x86ConcreteSemantics(): The architecture API must be defined.");
+
+        if (this->symbolicEngine == nullptr)
+          throw triton::exceptions::Semantics("x86ConcreteSemantics::x86ConcreteSemantics(): The symbolic engine API must be defined.");
+
+        if (this->taintEngine == nullptr)
+          throw triton::exceptions::Semantics("x86ConcreteSemantics::x86ConcreteSemantics(): The taint engines API must be defined.");
+      }
+
+
+      bool x86ConcreteSemantics::isSupported(const triton::arch::Instruction& inst) const {
+        bool branch = false;
+
+        /* Otherwise the expressions of a concrete instruction are kept */
+        if (!this->modes.isModeEnabled(triton::modes::ONLY_ON_SYMBOLIZED) && !this->modes.isModeEnabled(triton::modes::ONLY_ON_TAINTED))
+          return false;
+
+        if (!this->isExecutable(inst, branch))
+          return false;
+
+        /* A concrete branch is recorded in the path constraints unless it is filtered out */
+        if (branch && !this->modes.isModeEnabled(triton::modes::PC_TRACKING_SYMBOLIC) && !this->modes.isModeEnabled(triton::modes::ONLY_ON_TAINTED))
+          return false;
+
+        return true;
+      }
+
+
+      bool x86ConcreteSemantics::isExecutable(const triton::arch::Instruction& inst) const {
+        bool branch = false;
+        return this->isExecutable(inst, branch);
+      }
+
+
+      bool x86ConcreteSemantics::isExecutable(const triton::arch::Instruction& inst, bool& branch) const {
+        triton::uint32 operands = 0;
+
+        branch = false;
+
+        /* The REP prefixes loop on the counter */
+        switch (inst.getPrefix()) {
+          case ID_PREFIX_REP:
+          case ID_PREFIX_REPE:
+          case ID_PREFIX_REPNE:
+            return false;
+          default:
+            break;
+        }
+
+        switch (inst.getType()) {
+          case ID_INS_ADC:
+          case ID_INS_ADD:
+          case ID_INS_AND:
+          case ID_INS_CMP:
+          case ID_INS_LEA:
+          case ID_INS_MOV:
+          case ID_INS_MOVSX:
+          case ID_INS_MOVSXD:
+          case ID_INS_MOVZX:
+          case ID_INS_OR:
+          case ID_INS_SBB:
+          case ID_INS_SUB:
+          case ID_INS_TEST:
+          case ID_INS_XCHG:
+          case ID_INS_XOR:
+            operands = 2;
+            break;
+
+          case ID_INS_DEC:
+          case ID_INS_INC:
+          case ID_INS_NEG:
+          case ID_INS_NOT:
+          case ID_INS_POP:
+          case ID_INS_PUSH:
+            operands = 1;
+            break;
+
+          case ID_INS_CALL:
+          case ID_INS_JA:
+          case ID_INS_JAE:
+          case ID_INS_JB:
+          case ID_INS_JBE:
+          case ID_INS_JE:
+          case ID_INS_JG:
+          case ID_INS_JGE:
+          case ID_INS_JL:
+          case ID_INS_JLE:
+          case ID_INS_JMP:
+          case ID_INS_JNE:
+          case ID_INS_JNO:
+          case ID_INS_JNP:
+          case ID_INS_JNS:
+          case ID_INS_JO:
+          case ID_INS_JP:
+          case ID_INS_JS:
+            operands = 1;
+            branch   = true;
+            break;
+
+          /* RET may pop an immediate */
+          case ID_INS_RET:
+            if (inst.operands.size() == 1 && inst.operands[0].getType() != triton::arch::OP_IMM)
+              return false;
+            operands = (inst.operands.size() ? 1 : 0);
+            branch   = true;
+            break;
+
+          case ID_INS_NOP:
+            operands = static_cast<triton::uint32>(inst.operands.size());
+            break;
+
+          default:
+            return false;
+        }
+
+        if (inst.operands.size() != operands)
+          return false;
+
+        for (const auto& operand : inst.operands) {
+          if (operand.getSize() > QWORD_SIZE)
+            return false;
+
+          switch (operand.getType()) {
+            /* The address of a POP destination may depend on the stack pointer once it is aligned */
+            case triton::arch::OP_MEM:
+              if (inst.getType() == ID_INS_POP)
+                return false;
+              break;
+
+            /* Moves of the segment and control registers have their own semantics */
+            case triton::arch::OP_REG: {
+              triton::uint32 id = operand.getConstRegister().getId();
+              if (id >= ID_REG_X86_CR0 && id <= ID_REG_X86_CR15)
+                return false;
+              if (id >= ID_REG_X86_CS && id <= ID_REG_X86_SS)
+                return false;
+              break;
+            }
+
+            default:
+              break;
+          }
+        }
+
+        switch (inst.getType()) {
+          case ID_INS_LEA:
+            return inst.operands[0].getType() == triton::arch::OP_REG && inst.operands[1].getType() == triton::arch::OP_MEM;
+
+          /* The source is sign extended */
+          case ID_INS_CMP:
+            return inst.operands[1].getSize() <= inst.operands[0].getSize();
+
+          case ID_INS_MOVSX:
+          case ID_INS_MOVSXD:
+          case ID_INS_MOVZX:
+            return inst.operands[1].getSize() <= inst.operands[0].getSize();
+
+          default:
+            if (operands == 2 && inst.operands[0].getSize() != inst.operands[1].getSize())
+              return false;
+            return true;
+        }
+      }
+
+
+      bool x86ConcreteSemantics::isConcrete(const triton::arch::Register& reg) {
+        /* A write merges into the parent register, so the whole parent must be concrete */
+        const auto& parent = this->architecture->getParentRegister(reg);
+
+        if (this->taintEngine->isRegisterTainted(parent))
+          return false;
+
+        if (this->modes.isModeEnabled(triton::modes::ONLY_ON_SYMBOLIZED) && this->symbolicEngine->isRegisterSymbolized(parent))
+          return false;
+
+        return true;
+      }
+
+
+      bool x86ConcreteSemantics::isConcrete(const triton::arch::MemoryAccess& mem) {
+        if (this->taintEngine->isMemoryTainted(mem))
+          return false;
+
+        if (this->modes.isModeEnabled(triton::modes::ONLY_ON_SYMBOLIZED) && this->symbolicEngine->isMemorySymbolized(mem))
+          return false;
+
+        for (const auto& reg : {mem.getConstBaseRegister(), mem.getConstIndexRegister(), mem.getConstSegmentRegister()}) {
+          if (this->architecture->isRegisterValid(reg) && !this->isConcrete(reg))
+            return false;
+        }
+
+        return true;
+      }
+
+
+      bool x86ConcreteSemantics::isConcrete(const triton::arch::Instruction& inst) {
+        const auto& stack = this->architecture->getStackPointer();
+
+        for (auto flag : concreteFlags) {
+          if (!this->isConcrete(this->architecture->getRegister(flag)))
+            return false;
+        }
+
+        if (!this->isConcrete(this->architecture->getProgramCounter()))
+          return false;
+
+        for (const auto& operand : inst.operands) {
+          switch (operand.getType()) {
+            case triton::arch::OP_MEM:
+              if (!this->isConcrete(operand.getConstMemory()))
+                return false;
+              break;
+
+            case triton::arch::OP_REG:
+              if (!this->isConcrete(operand.getConstRegister()))
+                return false;
+              break;
+
+            default:
+              break;
+          }
+        }
+
+        /* The stack operations read or write one slot below or above the stack pointer */
+        switch (inst.getType()) {
+          case ID_INS_CALL:
+          case ID_INS_POP:
+          case ID_INS_PUSH:
+          case ID_INS_RET: {
+            auto stackValue = this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+            auto slots      = triton::arch::MemoryAccess(maskValue(stackValue - stack.getSize(), stack.getBitSize()), stack.getSize());
+            if (!this->isConcrete(stack) || !this->isConcrete(slots))
+              return false;
+            slots.setAddress(stackValue);
+            if (!this->isConcrete(slots))
+              return false;
+            break;
+          }
+
+          default:
+            break;
+        }
+
+        return true;
+      }
+
+
+      bool x86ConcreteSemantics::isConditionTaken(const triton::arch::Instruction& inst) const {
+        auto flag = [this](triton::arch::register_e id) {
+          return !this->architecture->getConcreteRegisterValue(this->architecture->getRegister(id)).is_zero();
+        };
+
+        switch (inst.getType()) {
+          case ID_INS_JA:   return !flag(ID_REG_X86_CF) && !flag(ID_REG_X86_ZF);
+          case ID_INS_JAE:  return !flag(ID_REG_X86_CF);
+          case ID_INS_JB:   return flag(ID_REG_X86_CF);
+          case ID_INS_JBE:  return flag(ID_REG_X86_CF) || flag(ID_REG_X86_ZF);
+          case ID_INS_JE:   return flag(ID_REG_X86_ZF);
+          case ID_INS_JG:   return flag(ID_REG_X86_SF) == flag(ID_REG_X86_OF) && !flag(ID_REG_X86_ZF);
+          case ID_INS_JGE:  return flag(ID_REG_X86_SF) == flag(ID_REG_X86_OF);
+          case ID_INS_JL:   return flag(ID_REG_X86_SF) != flag(ID_REG_X86_OF);
+          case ID_INS_JLE:  return flag(ID_REG_X86_SF) != flag(ID_REG_X86_OF) || flag(ID_REG_X86_ZF);
+          case ID_INS_JNE:  return !flag(ID_REG_X86_ZF);
+          case ID_INS_JNO:  return !flag(ID_REG_X86_OF);
+          case ID_INS_JNP:  return !flag(ID_REG_X86_PF);
+          case ID_INS_JNS:  return !flag(ID_REG_X86_SF);
+          case ID_INS_JO:   return flag(ID_REG_X86_OF);
+          case ID_INS_JP:   return flag(ID_REG_X86_PF);
+          case ID_INS_JS:   return flag(ID_REG_X86_SF);
+          default:
+            throw triton::exceptions::Semantics("x86ConcreteSemantics::isConditionTaken(): Not a conditional jump.");
+        }
+      }
+
+
+      triton::uint64 x86ConcreteSemantics::read(const triton::arch::OperandWrapper& op) const {
+        switch (op.getType()) {
+          case triton::arch::OP_IMM:
+            return maskValue(op.getConstImmediate().getValue(), op.getBitSize());
+
+          case triton::arch::OP_MEM:
+            return this->architecture->getConcreteMemoryValue(op.getConstMemory()).convert_to<triton::uint64>();
+
+          case triton::arch::OP_REG:
+            return this->architecture->getConcreteRegisterValue(op.getConstRegister()).convert_to<triton::uint64>();
+
+          default:
+            throw triton::exceptions::Semantics("x86ConcreteSemantics::read(): Invalid operand.");
+        }
+      }
+
+
+      void x86ConcreteSemantics::write(const triton::arch::OperandWrapper& op, triton::uint64 value) {
+        switch (op.getType()) {
+          case triton::arch::OP_MEM:
+            this->architecture->setConcreteMemoryValue(op.getConstMemory(), maskValue(value, op.getBitSize()));
+            if (this->concretize)
+              this->symbolicEngine->concretizeMemory(op.getConstMemory());
+            break;
+
+          case triton::arch::OP_REG:
+            this->writeRegister(op.getConstRegister(), value);
+            break;
+
+          default:
+            throw triton::exceptions::Semantics("x86ConcreteSemantics::write(): Invalid operand.");
+        }
+      }
+
+
+      void x86ConcreteSemantics::writeRegister(const triton::arch::Register& reg, triton::uint64 value) {
+        const auto& parent = this->architecture->getParentRegister(reg);
+
+        /* Same as SymbolicEngine::assignSymbolicExpressionToRegister() */
+        if (!parent.isMutable())
+          return;
+
+        value = maskValue(value, reg.getBitSize());
+
+        /* The BYTE and WORD registers are merged into their parent, the others are zero extended */
+        if (reg.getSize() == BYTE_SIZE || reg.getSize() == WORD_SIZE) {
+          auto origin = this->architecture->getConcreteRegisterValue(parent).convert_to<triton::uint64>();
+          auto mask   = maskValue(-1, reg.getBitSize()) << reg.getLow();
+          value = (origin & ~mask) | (value << reg.getLow());
+        }
+
+        this->architecture->setConcreteRegisterValue(parent, value);
+        if (this->concretize)
+          this->symbolicEngine->concretizeRegister(parent);
+      }
+
+
+      void x86ConcreteSemantics::writeFlag(triton::arch::register_e flag, bool value) {
+        this->writeRegister(this->architecture->getRegister(flag), value);
+      }
+
+
+      void x86ConcreteSemantics::undefined(triton::arch::Instruction& inst, triton::arch::register_e flag) {
+        const auto& reg = this->architecture->getRegister(flag);
+
+        /* Same as x86Semantics::undefined_s(), the flag is already untainted */
+        if (this->concretize && this->modes.isModeEnabled(triton::modes::CONCRETIZE_UNDEFINED_REGISTERS))
+          this->symbolicEngine->concretizeRegister(reg);
+
+        inst.setUndefinedRegister(reg);
+      }
+
+
+      triton::uint64 x86ConcreteSemantics::alignStack(triton::uint64 delta, bool sub) {
+        const auto& stack = this->architecture->getStackPointer();
+        auto value        = this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+
+        value = maskValue(sub ? value - delta : value + delta, stack.getBitSize());
+        this->writeRegister(stack, value);
+
+        return value;
+      }
+
+
+      void x86ConcreteSemantics::addFlags(triton::uint32 bitSize, triton::uint64 op1, triton::uint64 op2, triton::uint64 res, bool cf) {
+        this->writeFlag(ID_REG_X86_AF, ((res ^ op1 ^ op2) & 0x10) != 0);
+        if (cf)
+          this->writeFlag(ID_REG_X86_CF, msb((op1 & op2) ^ ((op1 ^ op2 ^ res) & (op1 ^ op2)), bitSize));
+        this->writeFlag(ID_REG_X86_OF, msb((op1 ^ ~op2) & (op1 ^ res), bitSize));
+        this->resultFlags(bitSize, res);
+      }
+
+
+      void x86ConcreteSemantics::subFlags(triton::uint32 bitSize, triton::uint64 op1, triton::uint64 op2, triton::uint64 res, bool cf) {
+        this->writeFlag(ID_REG_X86_AF, ((res ^ op1 ^ op2) & 0x10) != 0);
+        if (cf)
+          this->writeFlag(ID_REG_X86_CF, msb((op1 ^ op2 ^ res) ^ ((op1 ^ res) & (op1 ^ op2)), bitSize));
+        this->writeFlag(ID_REG_X86_OF, msb((op1 ^ op2) & (op1 ^ res), bitSize));
+        this->resultFlags(bitSize, res);
+      }
+
+
+      void x86ConcreteSemantics::resultFlags(triton::uint32 bitSize, triton::uint64 res) {
+        triton::uint64 parity = res & 0xff;
+
+        parity ^= parity >> 4;
+        parity ^= parity >> 2;
+        parity ^= parity >> 1;
+
+        this->writeFlag(ID_REG_X86_PF, !(parity & 1));
+        this->writeFlag(ID_REG_X86_SF, msb(res, bitSize));
+        this->writeFlag(ID_REG_X86_ZF, maskValue(res, bitSize) == 0);
+      }
+
+
+      void x86ConcreteSemantics::logicFlags(triton::arch::Instruction& inst, triton::uint32 bitSize, triton::uint64 res) {
+        this->undefined(inst, ID_REG_X86_AF);
+        this->writeFlag(ID_REG_X86_CF, false);
+        this->writeFlag(ID_REG_X86_OF, false);
+        this->resultFlags(bitSize, res);
+      }
+
+
+      void x86ConcreteSemantics::controlFlow(const triton::arch::Instruction& inst) {
+        this->writeRegister(this->architecture->getProgramCounter(), inst.getNextAddress());
+      }
+
+
+      bool x86ConcreteSemantics::buildSemantics(triton::arch::Instruction& inst) {
+        if (!this->isSupported(inst))
+          return false;
+
+        /* Initialize the target address of memory operands, the LEA is concrete */
+        for (auto& operand : inst.operands) {
+          if (operand.getType() == triton::arch::OP_MEM) {
+            auto& mem = operand.getMemory();
+            if (mem.getBitSize() >= BYTE_SIZE_BIT && !mem.getAddress())
+              mem.setAddress(this->architecture->getConcreteMemoryAddress(mem));
+            mem.setLeaAst(nullptr);
+          }
+        }
+
+        if (!this->isConcrete(inst))
+          return false;
+
+        this->execute(inst, true);
+
+        return true;
+      }
+
+
+      void x86ConcreteSemantics::execute(triton::arch::Instruction& inst, bool concretize) {
+        const auto& stack = this->architecture->getStackPointer();
+        const auto& pc    = this->architecture->getProgramCounter();
+        bool branch       = false;
+
+        this->concretize = concretize;
+
+        switch (inst.getType()) {
+          case ID_INS_ADC:
+          case ID_INS_ADD: {
+            auto& dst      = inst.operands[0];
+            auto  bitSize  = dst.getBitSize();
+            auto  op1      = this->read(dst);
+            auto  op2      = this->read(inst.operands[1]);
+            auto  cf       = (inst.getType() == ID_INS_ADC ? this->read(triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_X86_CF))) : 0);
+            auto  res      = maskValue(op1 + op2 + cf, bitSize);
+            this->write(dst, res);
+            this->addFlags(bitSize, op1, op2, res, true);
+            break;
+          }
+
+          case ID_INS_CMP:
+          case ID_INS_SBB:
+          case ID_INS_SUB: {
+            auto& dst      = inst.operands[0];
+            auto  bitSize  = dst.getBitSize();
+            auto  op1      = this->read(dst);
+            auto  op2      = maskValue(signExtend(this->read(inst.operands[1]), inst.operands[1].getBitSize()), bitSize);
+            auto  cf       = (inst.getType() == ID_INS_SBB ? this->read(triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_X86_CF))) : 0);
+            auto  res      = maskValue(op1 - (op2 + cf), bitSize);
+            if (inst.getType() != ID_INS_CMP)
+              this->write(dst, res);
+            this->subFlags(bitSize, op1, op2, res, true);
+            break;
+          }
+
+          case ID_INS_AND:
+          case ID_INS_OR:
+          case ID_INS_TEST:
+          case ID_INS_XOR: {
+            auto& dst = inst.operands[0];
+            auto  op1 = this->read(dst);
+            auto  op2 = this->read(inst.operands[1]);
+            auto  res = (inst.getType() == ID_INS_OR ? op1 | op2 : inst.getType() == ID_INS_XOR ? op1 ^ op2 : op1 & op2);
+            if (inst.getType() != ID_INS_TEST)
+              this->write(dst, res);
+            this->logicFlags(inst, dst.getBitSize(), res);
+            break;
+          }
+
+          /* CF is not affected */
+          case ID_INS_DEC:
+          case ID_INS_INC: {
+            auto& dst     = inst.operands[0];
+            auto  bitSize = dst.getBitSize();
+            auto  op1     = this->read(dst);
+            if (inst.getType() == ID_INS_INC) {
+              auto res = maskValue(op1 + 1, bitSize);
+              this->write(dst, res);
+              this->addFlags(bitSize, op1, 1, res, false);
+            }
+            else {
+              auto res = maskValue(op1 - 1, bitSize);
+              this->write(dst, res);
+              this->subFlags(bitSize, op1, 1, res, false);
+            }
+            break;
+          }
+
+          case ID_INS_NEG: {
+            auto& dst     = inst.operands[0];
+            auto  bitSize = dst.getBitSize();
+            auto  op1     = this->read(dst);
+            auto  res     = maskValue(-op1, bitSize);
+            this->write(dst, res);
+            this->writeFlag(ID_REG_X86_AF, ((op1 ^ res) & 0x10) != 0);
+            this->writeFlag(ID_REG_X86_CF, op1 != 0);
+            this->writeFlag(ID_REG_X86_OF, msb(res & op1, bitSize));
+            this->resultFlags(bitSize, res);
+            break;
+          }
+
+          case ID_INS_NOT:
+            this->write(inst.operands[0], ~this->read(inst.operands[0]));
+            break;
+
+          case ID_INS_MOV:
+          case ID_INS_MOVZX:
+            this->write(inst.operands[0], this->read(inst.operands[1]));
+            break;
+
+          case ID_INS_MOVSX:
+          case ID_INS_MOVSXD:
+            this->write(inst.operands[0], signExtend(this->read(inst.operands[1]), inst.operands[1].getBitSize()));
+            break;
+
+          /* Same as x86Semantics::lea_s(), the effective address is computed on the LEA size */
+          case ID_INS_LEA: {
+            const auto& mem     = inst.operands[1].getConstMemory();
+            const auto& base    = mem.getConstBaseRegister();
+            const auto& index   = mem.getConstIndexRegister();
+            triton::uint32 leaSize = 0;
+            triton::uint64 value   = mem.getConstDisplacement().getValue();
+
+            if (this->architecture->isRegisterValid(base))
+              leaSize = base.getBitSize();
+            else if (this->architecture->isRegisterValid(index))
+              leaSize = index.getBitSize();
+            else
+              leaSize = mem.getConstDisplacement().getBitSize();
+
+            if (this->architecture->isRegisterValid(base)) {
+              value += this->architecture->getConcreteRegisterValue(base).convert_to<triton::uint64>();
+              if (this->architecture->getParentRegister(base) == pc)
+                value += inst.getSize();
+            }
+
+            if (this->architecture->isRegisterValid(index))
+              value += this->architecture->getConcreteRegisterValue(index).convert_to<triton::uint64>() * mem.getConstScale().getValue();
+
+            this->write(inst.operands[0], maskValue(value, leaSize));
+            break;
+          }
+
+          case ID_INS_NOP:
+            break;
+
+          case ID_INS_POP: {
+            auto& dst       = inst.operands[0];
+            auto stackValue = this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+            auto value      = this->read(triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue, dst.getSize())));
+            this->write(dst, value);
+            /* Don't increment SP if the destination register is SP */
+            if (this->architecture->getParentRegister(dst.getConstRegister()) != stack)
+              this->alignStack(dst.getSize(), false);
+            break;
+          }
+
+          case ID_INS_PUSH: {
+            auto& src           = inst.operands[0];
+            triton::uint32 size = (src.getType() == triton::arch::OP_IMM ? stack.getSize() : src.getSize());
+            auto value          = this->read(src);
+            auto stackValue     = this->alignStack(size, true);
+            this->write(triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue, size)), value);
+            break;
+          }
+
+          case ID_INS_XCHG: {
+            auto op1 = this->read(inst.operands[0]);
+            auto op2 = this->read(inst.operands[1]);
+            this->write(inst.operands[0], op2);
+            this->write(inst.operands[1], op1);
+            break;
+          }
+
+          case ID_INS_CALL: {
+            auto stackValue = this->alignStack(stack.getSize(), true);
+            auto target     = this->read(inst.operands[0]);
+            this->write(triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue, stack.getSize())), inst.getNextAddress());
+            this->writeRegister(pc, target);
+            branch = true;
+            break;
+          }
+
+          case ID_INS_JMP:
+            inst.setConditionTaken(true);
+            this->writeRegister(pc, this->read(inst.operands[0]));
+            branch = true;
+            break;
+
+          case ID_INS_RET: {
+            auto stackValue = this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+            this->writeRegister(pc, this->read(triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue, stack.getSize()))));
+            this->alignStack(stack.getSize(), false);
+            if (inst.operands.size() > 0)
+              this->alignStack(static_cast<triton::uint32>(inst.operands[0].getConstImmediate().getValue()), false);
+            branch = true;
+            break;
+          }
+
+          /* Conditional jumps */
+          default: {
+            bool taken = this->isConditionTaken(inst);
+            if (taken)
+              inst.setConditionTaken(true);
+            this->writeRegister(pc, taken ? this->read(inst.operands[0]) : inst.getNextAddress());
+            branch = true;
+            break;
+          }
+        }
+
+        /* The branches assign the program counter */
+        if (!branch)
+          this->controlFlow(inst);
+      }
+
+    }; /* x86 namespace */
+  }; /* arch namespace */
+}; /* triton namespace */
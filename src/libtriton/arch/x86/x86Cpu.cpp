@@ -24,15 +24,18 @@ namespace triton {
       x86Cpu::x86Cpu(triton::callbacks::Callbacks* callbacks) : x86Specifications(ARCH_X86) {
         this->callbacks = callbacks;
         this->clear();
+        this->disassInit();
       }
 
       x86Cpu::x86Cpu(const x86Cpu& other) : x86Specifications(ARCH_X86) {
         this->copy(other);
+        this->disassInit();
       }
 
 
       x86Cpu::~x86Cpu() {
         this->memory.clear();
+        triton::extlibs::capstone::cs_close(&this->handle);
       }
 
 
@@ -298,8 +301,21 @@ namespace triton {
       }
 
 
+      void x86Cpu::disassInit(void) {
+        if (triton::extlibs::capstone::cs_open(triton::extlibs::capstone::CS_ARCH_X86, triton::extlibs::capstone::CS_MODE_32, &this->handle) != triton::extlibs::capstone::CS_ERR_OK)
+          throw triton::exceptions::Disassembly("x86Cpu::disassInit(): Cannot open capstone.");
+
+        triton::extlibs::capstone::cs_option(this->handle, triton::extlibs::capstone::CS_OPT_DETAIL, triton::extlibs::capstone::CS_OPT_ON);
+        triton::extlibs::capstone::cs_option(this->handle, triton::extlibs::capstone::CS_OPT_SYNTAX, triton::extlibs::capstone::CS_OPT_SYNTAX_INTEL);
+      }
+
+
+      triton::usize x86Cpu::getHandle(void) const {
+        return this->handle;
+      }
+
+
       void x86Cpu::disassembly(triton::arch::Instruction& inst) const {
-        triton::extlibs::capstone::csh       handle;
         triton::extlibs::capstone::cs_insn*  insn;
         triton::usize                        count = 0;
 
@@ -307,19 +323,11 @@ namespace triton {
         if (inst.getOpcode() == nullptr || inst.getSize() == 0)
           throw triton::exceptions::Disassembly("x86Cpu::disassembly(): Opcode and opcodeSize must be definied.");
 
-        /* Open capstone */
-        if (triton::extlibs::capstone::cs_open(triton::extlibs::capstone::CS_ARCH_X86, triton::extlibs::capstone::CS_MODE_32, &handle) != triton::extlibs::capstone::CS_ERR_OK)
-          throw triton::exceptions::Disassembly("x86Cpu::disassembly(): Cannot open capstone.");
-
-        /* Init capstone's options */
-        triton::extlibs::capstone::cs_option(handle, triton::extlibs::capstone::CS_OPT_DETAIL, triton::extlibs::capstone::CS_OPT_ON);
-        triton::extlibs::capstone::cs_option(handle, triton::extlibs::capstone::CS_OPT_SYNTAX, triton::extlibs::capstone::CS_OPT_SYNTAX_INTEL);
-
         /* Clear instructicon's operands if alredy defined */
         inst.operands.clear();
 
         /* Let's disass and build our operands */
-        count = triton::extlibs::capstone::cs_disasm(handle, inst.getOpcode(), inst.getSize(), inst.getAddress(), 0, &insn);
+        count = triton::extlibs::capstone::cs_disasm(this->getHandle(), inst.getOpcode(), inst.getSize(), inst.getAddress(), 0, &insn);
         if (count > 0) {
           triton::extlibs::capstone::cs_detail* detail = insn->detail;
           for (triton::uint32 j = 0; j < 1; j++) {
@@ -414,7 +422,6 @@ namespace triton {
         else
           throw triton::exceptions::Disassembly("x86Cpu::disassembly(): Failed to disassemble the given code.");
 
-        triton::extlibs::capstone::cs_close(&handle);
         return;
       }
 
@@ -423,15 +430,12 @@ namespace triton {
         if (execCallbacks && this->callbacks)
           this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, MemoryAccess(addr, BYTE_SIZE));
 
-        auto it = this->memory.find(addr);
-        if (it == this->memory.end())
-          return 0x00;
-
-        return it->second;
+        return this->memory.read(addr);
       }
 
 
       triton::uint512 x86Cpu::getConcreteMemoryValue(const triton::arch::MemoryAccess& mem, bool execCallbacks) const {
+        triton::uint8 buffer[DQQWORD_SIZE];
         triton::uint512 ret = 0;
         triton::uint64 addr = 0;
         triton::uint32 size = 0;
@@ -445,18 +449,33 @@ namespace triton {
         if (size == 0 || size > DQQWORD_SIZE)
           throw triton::exceptions::Cpu("x86Cpu::getConcreteMemoryValue(): Invalid size memory.");
 
+        this->memory.read(addr, buffer, size);
+
+        /* Fast path for accesses which fit in 64 bits */
+        if (size <= QWORD_SIZE) {
+          triton::uint64 value = 0;
+          std::memcpy(&value, buffer, size);
+          return value;
+        }
+
         for (triton::sint32 i = size-1; i >= 0; i--)
-          ret = ((ret << BYTE_SIZE_BIT) | this->getConcreteMemoryValue(addr+i, false));
+          ret = ((ret << BYTE_SIZE_BIT) | buffer[i]);
 
         return ret;
       }
 
 
       std::vector<triton::uint8> x86Cpu::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks) const {
-        std::vector<triton::uint8> area;
+        std::vector<triton::uint8> area(size);
+
+        /* Callbacks are processed for each byte */
+        if (execCallbacks && this->callbacks && this->callbacks->isDefined) {
+          for (triton::usize index = 0; index < size; index++)
+            area[index] = this->getConcreteMemoryValue(baseAddr+index);
+          return area;
+        }
 
-        for (triton::usize index = 0; index < size; index++)
-          area.push_back(this->getConcreteMemoryValue(baseAddr+index));
+        this->memory.read(baseAddr, area.data(), size);
 
         return area;
       }
@@ -608,11 +627,12 @@ namespace triton {
       void x86Cpu::setConcreteMemoryValue(triton::uint64 addr, triton::uint8 value) {
         if (this->callbacks)
           this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_VALUE, MemoryAccess(addr, BYTE_SIZE), value);
-        this->memory[addr] = value;
+        this->memory.write(addr, value);
       }
 
 
       void x86Cpu::setConcreteMemoryValue(const triton::arch::MemoryAccess& mem, const triton::uint512& value) {
+        triton::uint8 buffer[DQQWORD_SIZE];
         triton::uint64 addr = mem.getAddress();
         triton::uint32 size = mem.getSize();
         triton::uint512 cv  = value;
@@ -626,24 +646,36 @@ namespace triton {
         if (this->callbacks)
           this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_VALUE, mem, value);
 
-        for (triton::uint32 i = 0; i < size; i++) {
-          this->memory[addr+i] = (cv & 0xff).convert_to<triton::uint8>();
-          cv >>= 8;
+        /* Fast path for accesses which fit in 64 bits */
+        if (size <= QWORD_SIZE) {
+          triton::uint64 v = cv.convert_to<triton::uint64>();
+          std::memcpy(buffer, &v, size);
+        }
+        else {
+          for (triton::uint32 i = 0; i < size; i++) {
+            buffer[i] = (cv & 0xff).convert_to<triton::uint8>();
+            cv >>= 8;
+          }
         }
+
+        this->memory.write(addr, buffer, size);
       }
 
 
       void x86Cpu::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const std::vector<triton::uint8>& values) {
-        for (triton::usize index = 0; index < values.size(); index++) {
-          this->setConcreteMemoryValue(baseAddr+index, values[index]);
-        }
+        this->setConcreteMemoryAreaValue(baseAddr, values.data(), values.size());
       }
 
 
       void x86Cpu::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size) {
-        for (triton::usize index = 0; index < size; index++) {
-          this->setConcreteMemoryValue(baseAddr+index, area[index]);
+        /* Callbacks are processed for each byte */
+        if (this->callbacks && this->callbacks->isDefined) {
+          for (triton::usize index = 0; index < size; index++)
+            this->setConcreteMemoryValue(baseAddr+index, area[index]);
+          return;
         }
+
+        this->memory.write(baseAddr, area, size);
       }
 
 
@@ -918,19 +950,12 @@ namespace triton {
 
 
       bool x86Cpu::isMemoryMapped(triton::uint64 baseAddr, triton::usize size) {
-        for (triton::usize index = 0; index < size; index++) {
-          if (this->memory.find(baseAddr + index) == this->memory.end())
-            return false;
-        }
-        return true;
+        return this->memory.isMapped(baseAddr, size);
       }
 
 
       void x86Cpu::unmapMemory(triton::uint64 baseAddr, triton::usize size) {
-        for (triton::usize index = 0; index < size; index++) {
-          if (this->memory.find(baseAddr + index) != this->memory.end())
-            this->memory.erase(baseAddr + index);
-        }
+        this->memory.unmap(baseAddr, size);
       }
 
     }; /* x86 namespace */
@@ -685,27 +685,45 @@ namespace triton {
       }
 
 
+      template <typename S, typename V>
+      void x86Semantics::flag_s(triton::arch::Instruction& inst, const triton::arch::Register& flag, const S& semantics, const V& value, bool isTainted, const std::string& comment) {
+        /* Only record how to build the flag, its AST is created when it is read */
+        if (this->modes.isModeEnabled(triton::modes::LAZY_FLAGS)) {
+          this->symbolicEngine->createLazySymbolicFlagExpression(semantics, flag, value() ? 1 : 0, isTainted, comment);
+          return;
+        }
+
+        /* Create the symbolic expression */
+        auto expr = this->symbolicEngine->createSymbolicExpression(inst, semantics(), flag, comment);
+
+        /* Spread the taint */
+        expr->isTainted = isTainted;
+      }
+
+
+      triton::uint512 x86Semantics::extractValue(const triton::engines::symbolic::SharedSymbolicExpression& expr, triton::uint32 high, triton::uint32 low) const {
+        triton::uint512 mask = (triton::uint512(1) << (high - low + 1)) - 1;
+        return (expr->getAst()->evaluate() >> low) & mask;
+      }
+
+
       void x86Semantics::clearFlag_s(triton::arch::Instruction& inst, const triton::arch::Register& flag, std::string comment) {
         /* Create the semantics */
-        auto node = this->astCtxt.bv(0, 1);
-
-        /* Create symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, flag, comment);
+        auto node  = [=](void) { return this->astCtxt.bv(0, 1); };
+        auto value = [](void) { return false; };
 
-        /* Spread taint */
-        expr->isTainted = this->taintEngine->setTaintRegister(flag, triton::engines::taint::UNTAINTED);
+        /* Create symbolic expression and spread taint */
+        this->flag_s(inst, flag, node, value, this->taintEngine->setTaintRegister(flag, triton::engines::taint::UNTAINTED), comment);
       }
 
 
       void x86Semantics::setFlag_s(triton::arch::Instruction& inst, const triton::arch::Register& flag, std::string comment) {
         /* Create the semantics */
-        auto node = this->astCtxt.bv(1, 1);
-
-        /* Create symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, flag, comment);
+        auto node  = [=](void) { return this->astCtxt.bv(1, 1); };
+        auto value = [](void) { return true; };
 
-        /* Spread taint */
-        expr->isTainted = this->taintEngine->setTaintRegister(flag, triton::engines::taint::UNTAINTED);
+        /* Create symbolic expression and spread taint */
+        this->flag_s(inst, flag, node, value, this->taintEngine->setTaintRegister(flag, triton::engines::taint::UNTAINTED), comment);
       }
 
 
@@ -848,26 +866,31 @@ namespace triton {
          * Create the semantic.
          * af = 0x10 == (0x10 & (regDst ^ op1 ^ op2))
          */
-        auto node = this->astCtxt.ite(
-                      this->astCtxt.equal(
-                        this->astCtxt.bv(0x10, bvSize),
-                        this->astCtxt.bvand(
-                          this->astCtxt.bv(0x10, bvSize),
-                          this->astCtxt.bvxor(
-                            this->astCtxt.extract(high, low, this->astCtxt.reference(parent)),
-                            this->astCtxt.bvxor(op1, op2)
-                          )
-                        )
-                      ),
-                      this->astCtxt.bv(1, 1),
-                      this->astCtxt.bv(0, 1)
-                    );
+        auto node = [=](void) {
+          return this->astCtxt.ite(
+                   this->astCtxt.equal(
+                     this->astCtxt.bv(0x10, bvSize),
+                     this->astCtxt.bvand(
+                       this->astCtxt.bv(0x10, bvSize),
+                       this->astCtxt.bvxor(
+                         this->astCtxt.extract(high, low, this->astCtxt.reference(parent)),
+                         this->astCtxt.bvxor(op1, op2)
+                       )
+                     )
+                   ),
+                   this->astCtxt.bv(1, 1),
+                   this->astCtxt.bv(0, 1)
+                 );
+        };
 
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_AF), "Adjust flag");
+        /* The concrete value of the flag */
+        auto value = [=](void) {
+          return ((this->extractValue(parent, high, low) ^ op1->evaluate() ^ op2->evaluate()) & 0x10) != 0;
+        };
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_AF), parent->isTainted);
+        /* Create the symbolic expression and spread the taint from the parent to the child */
+        auto flag = this->architecture->getRegister(ID_REG_X86_AF);
+        this->flag_s(inst, flag, node, value, this->taintEngine->setTaintRegister(flag, parent->isTainted), "Adjust flag");
       }
 
 
@@ -989,23 +1012,31 @@ namespace triton {
          * Create the semantic.
          * cf = MSB((op1 & op2) ^ ((op1 ^ op2 ^ parent) & (op1 ^ op2)));
          */
-        auto node = this->astCtxt.extract(bvSize-1, bvSize-1,
-                      this->astCtxt.bvxor(
-                        this->astCtxt.bvand(op1, op2),
-                        this->astCtxt.bvand(
-                          this->astCtxt.bvxor(
-                            this->astCtxt.bvxor(op1, op2),
-                            this->astCtxt.extract(high, low, this->astCtxt.reference(parent))
-                          ),
-                        this->astCtxt.bvxor(op1, op2))
-                      )
-                    );
+        auto node = [=](void) {
+          return this->astCtxt.extract(bvSize-1, bvSize-1,
+                   this->astCtxt.bvxor(
+                     this->astCtxt.bvand(op1, op2),
+                     this->astCtxt.bvand(
+                       this->astCtxt.bvxor(
+                         this->astCtxt.bvxor(op1, op2),
+                         this->astCtxt.extract(high, low, this->astCtxt.reference(parent))
+                       ),
+                     this->astCtxt.bvxor(op1, op2))
+                   )
+                 );
+        };
 
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_CF), "Carry flag");
+        /* The concrete value of the flag */
+        auto value = [=](void) {
+          auto v1  = op1->evaluate();
+          auto v2  = op2->evaluate();
+          auto res = this->extractValue(parent, high, low);
+          return (((v1 & v2) ^ ((v1 ^ v2 ^ res) & (v1 ^ v2))) >> (bvSize-1) & 1) != 0;
+        };
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_CF), parent->isTainted);
+        /* Create the symbolic expression and spread the taint from the parent to the child */
+        auto flag = this->architecture->getRegister(ID_REG_X86_CF);
+        this->flag_s(inst, flag, node, value, this->taintEngine->setTaintRegister(flag, parent->isTainted), "Carry flag");
       }
 
 
@@ -1541,21 +1572,29 @@ namespace triton {
          * Create the semantic.
          * cf = extract(bvSize, bvSize (((op1 ^ op2 ^ res) ^ ((op1 ^ res) & (op1 ^ op2)))))
          */
-        auto node = this->astCtxt.extract(bvSize-1, bvSize-1,
-                      this->astCtxt.bvxor(
-                        this->astCtxt.bvxor(op1, this->astCtxt.bvxor(op2, this->astCtxt.extract(high, low, this->astCtxt.reference(parent)))),
-                        this->astCtxt.bvand(
-                          this->astCtxt.bvxor(op1, this->astCtxt.extract(high, low, this->astCtxt.reference(parent))),
-                          this->astCtxt.bvxor(op1, op2)
-                        )
-                      )
-                    );
+        auto node = [=](void) {
+          return this->astCtxt.extract(bvSize-1, bvSize-1,
+                   this->astCtxt.bvxor(
+                     this->astCtxt.bvxor(op1, this->astCtxt.bvxor(op2, this->astCtxt.extract(high, low, this->astCtxt.reference(parent)))),
+                     this->astCtxt.bvand(
+                       this->astCtxt.bvxor(op1, this->astCtxt.extract(high, low, this->astCtxt.reference(parent))),
+                       this->astCtxt.bvxor(op1, op2)
+                     )
+                   )
+                 );
+        };
 
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_CF), "Carry flag");
+        /* The concrete value of the flag */
+        auto value = [=](void) {
+          auto v1  = op1->evaluate();
+          auto v2  = op2->evaluate();
+          auto res = this->extractValue(parent, high, low);
+          return (((v1 ^ v2 ^ res) ^ ((v1 ^ res) & (v1 ^ v2))) >> (bvSize-1) & 1) != 0;
+        };
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_CF), parent->isTainted);
+        /* Create the symbolic expression and spread the taint from the parent to the child */
+        auto flag = this->architecture->getRegister(ID_REG_X86_CF);
+        this->flag_s(inst, flag, node, value, this->taintEngine->setTaintRegister(flag, parent->isTainted), "Carry flag");
       }
 
 
@@ -1574,18 +1613,26 @@ namespace triton {
          * Create the semantic.
          * of = MSB((op1 ^ ~op2) & (op1 ^ regDst))
          */
-        auto node = this->astCtxt.extract(bvSize-1, bvSize-1,
-                      this->astCtxt.bvand(
-                        this->astCtxt.bvxor(op1, this->astCtxt.bvnot(op2)),
-                        this->astCtxt.bvxor(op1, this->astCtxt.extract(high, low, this->astCtxt.reference(parent)))
-                      )
-                    );
+        auto node = [=](void) {
+          return this->astCtxt.extract(bvSize-1, bvSize-1,
+                   this->astCtxt.bvand(
+                     this->astCtxt.bvxor(op1, this->astCtxt.bvnot(op2)),
+                     this->astCtxt.bvxor(op1, this->astCtxt.extract(high, low, this->astCtxt.reference(parent)))
+                   )
+                 );
+        };
 
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_OF), "Overflow flag");
+        /* The concrete value of the flag */
+        auto value = [=](void) {
+          auto v1  = op1->evaluate();
+          auto v2  = op2->evaluate();
+          auto res = this->extractValue(parent, high, low);
+          return (((v1 ^ ~v2) & (v1 ^ res)) >> (bvSize-1) & 1) != 0;
+        };
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_OF), parent->isTainted);
+        /* Create the symbolic expression and spread the taint from the parent to the child */
+        auto flag = this->architecture->getRegister(ID_REG_X86_OF);
+        this->flag_s(inst, flag, node, value, this->taintEngine->setTaintRegister(flag, parent->isTainted), "Overflow flag");
       }
 
 
@@ -2002,18 +2049,26 @@ namespace triton {
          * Create the semantic.
          * of = high:bool((op1 ^ op2) & (op1 ^ regDst))
          */
-        auto node = this->astCtxt.extract(bvSize-1, bvSize-1,
-                      this->astCtxt.bvand(
-                        this->astCtxt.bvxor(op1, op2),
-                        this->astCtxt.bvxor(op1, this->astCtxt.extract(high, low, this->astCtxt.reference(parent)))
-                      )
-                    );
+        auto node = [=](void) {
+          return this->astCtxt.extract(bvSize-1, bvSize-1,
+                   this->astCtxt.bvand(
+                     this->astCtxt.bvxor(op1, op2),
+                     this->astCtxt.bvxor(op1, this->astCtxt.extract(high, low, this->astCtxt.reference(parent)))
+                   )
+                 );
+        };
 
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_OF), "Overflow flag");
+        /* The concrete value of the flag */
+        auto value = [=](void) {
+          auto v1  = op1->evaluate();
+          auto v2  = op2->evaluate();
+          auto res = this->extractValue(parent, high, low);
+          return (((v1 ^ v2) & (v1 ^ res)) >> (bvSize-1) & 1) != 0;
+        };
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_OF), parent->isTainted);
+        /* Create the symbolic expression and spread the taint from the parent to the child */
+        auto flag = this->architecture->getRegister(ID_REG_X86_OF);
+        this->flag_s(inst, flag, node, value, this->taintEngine->setTaintRegister(flag, parent->isTainted), "Overflow flag");
       }
 
 
@@ -2031,24 +2086,34 @@ namespace triton {
          * pf is set to one if there is an even number of bit set to 1 in the least
          * significant byte of the result.
          */
-        auto node = this->astCtxt.bv(1, 1);
-        for (triton::uint32 counter = 0; counter <= BYTE_SIZE_BIT-1; counter++) {
-          node = this->astCtxt.bvxor(
-                   node,
-                   this->astCtxt.extract(0, 0,
-                     this->astCtxt.bvlshr(
-                       this->astCtxt.extract(high, low, this->astCtxt.reference(parent)),
-                       this->astCtxt.bv(counter, BYTE_SIZE_BIT)
-                     )
-                  )
-                );
-        }
+        auto node = [=](void) {
+          auto node = this->astCtxt.bv(1, 1);
+          for (triton::uint32 counter = 0; counter <= BYTE_SIZE_BIT-1; counter++) {
+            node = this->astCtxt.bvxor(
+                     node,
+                     this->astCtxt.extract(0, 0,
+                       this->astCtxt.bvlshr(
+                         this->astCtxt.extract(high, low, this->astCtxt.reference(parent)),
+                         this->astCtxt.bv(counter, BYTE_SIZE_BIT)
+                       )
+                    )
+                  );
+          }
+          return node;
+        };
 
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_PF), "Parity flag");
+        /* The concrete value of the flag */
+        auto value = [=](void) {
+          auto res = this->extractValue(parent, high, low).convert_to<triton::uint32>();
+          bool pf  = true;
+          for (triton::uint32 counter = 0; counter <= BYTE_SIZE_BIT-1; counter++)
+            pf ^= ((res >> counter) & 1);
+          return pf;
+        };
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_PF), parent->isTainted);
+        /* Create the symbolic expression and spread the taint from the parent to the child */
+        auto flag = this->architecture->getRegister(ID_REG_X86_PF);
+        this->flag_s(inst, flag, node, value, this->taintEngine->setTaintRegister(flag, parent->isTainted), "Parity flag");
       }
 
 
@@ -2111,13 +2176,18 @@ namespace triton {
          * Create the semantic.
          * sf = high:bool(regDst)
          */
-        auto node = this->astCtxt.extract(high, high, this->astCtxt.reference(parent));
+        auto node = [=](void) {
+          return this->astCtxt.extract(high, high, this->astCtxt.reference(parent));
+        };
 
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_SF), "Sign flag");
+        /* The concrete value of the flag */
+        auto value = [=](void) {
+          return this->extractValue(parent, high, high) != 0;
+        };
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_SF), parent->isTainted);
+        /* Create the symbolic expression and spread the taint from the parent to the child */
+        auto flag = this->architecture->getRegister(ID_REG_X86_SF);
+        this->flag_s(inst, flag, node, value, this->taintEngine->setTaintRegister(flag, parent->isTainted), "Sign flag");
       }
 
 
@@ -2253,20 +2323,25 @@ namespace triton {
          * Create the semantic.
          * zf = 0 == regDst
          */
-        auto node = this->astCtxt.ite(
-                      this->astCtxt.equal(
-                        this->astCtxt.extract(high, low, this->astCtxt.reference(parent)),
-                        this->astCtxt.bv(0, bvSize)
-                      ),
-                      this->astCtxt.bv(1, 1),
-                      this->astCtxt.bv(0, 1)
-                    );
+        auto node = [=](void) {
+          return this->astCtxt.ite(
+                   this->astCtxt.equal(
+                     this->astCtxt.extract(high, low, this->astCtxt.reference(parent)),
+                     this->astCtxt.bv(0, bvSize)
+                   ),
+                   this->astCtxt.bv(1, 1),
+                   this->astCtxt.bv(0, 1)
+                 );
+        };
 
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_ZF), "Zero flag");
+        /* The concrete value of the flag */
+        auto value = [=](void) {
+          return this->extractValue(parent, high, low) == 0;
+        };
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_ZF), parent->isTainted);
+        /* Create the symbolic expression and spread the taint from the parent to the child */
+        auto flag = this->architecture->getRegister(ID_REG_X86_ZF);
+        this->flag_s(inst, flag, node, value, this->taintEngine->setTaintRegister(flag, parent->isTainted), "Zero flag");
       }
 
 
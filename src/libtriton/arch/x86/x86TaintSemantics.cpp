@@ -0,0 +1,404 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <triton/exceptions.hpp>
+#include <triton/x86Specifications.hpp>
+#include <triton/x86TaintSemantics.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+    namespace x86 {
+
+      /* The flags in the order of Transfer::flags */
+      static const triton::arch::register_e transferFlags[] = {
+        ID_REG_X86_AF,
+        ID_REG_X86_CF,
+        ID_REG_X86_OF,
+        ID_REG_X86_PF,
+        ID_REG_X86_SF,
+        ID_REG_X86_ZF,
+      };
+
+
+      /* Returns the value masked to its size */
+      static inline triton::uint64 maskValue(triton::uint64 value, triton::uint32 bitSize) {
+        if (bitSize >= 64)
+          return value;
+        return value & ((1ULL << bitSize) - 1);
+      }
+
+
+      x86TaintSemantics::x86TaintSemantics(triton::arch::Architecture* architecture,
+                                           triton::engines::taint::TaintEngine* taintEngine,
+                                           triton::arch::x86::x86ConcreteSemantics* concreteIsa) {
+
+        this->architecture  = architecture;
+        this->taintEngine   = taintEngine;
+        this->concreteIsa   = concreteIsa;
+
+        if (architecture == nullptr)
+          throw triton::exceptions::Semantics("x86TaintSemantics::x86TaintSemantics(): The architecture API must be defined.");
+
+        if (this->taintEngine == nullptr)
+          throw triton::exceptions::Semantics("x86TaintSemantics::x86TaintSemantics(): The taint engines API must be defined.");
+
+        if (this->concreteIsa == nullptr)
+          throw triton::exceptions::Semantics("x86TaintSemantics::x86TaintSemantics(): The concrete semantics must be defined.");
+
+        this->initTable();
+      }
+
+
+      void x86TaintSemantics::addTransfer(triton::uint32 type, transfer_e kind, triton::uint32 operands, const char* flags,
+                                          triton::arch::register_e c1, triton::arch::register_e c2, triton::arch::register_e c3) {
+        Transfer& transfer = this->table[type];
+
+        transfer.kind     = kind;
+        transfer.operands = operands;
+
+        /* R: result, C: cleared, U: undefined, -: not written */
+        for (triton::uint32 i = 0; i < NUMBER_OF_FLAGS; i++) {
+          switch (flags[i]) {
+            case 'R': transfer.flags[i] = FLAG_RESULT;    break;
+            case 'C': transfer.flags[i] = FLAG_CLEAR;     break;
+            case 'U': transfer.flags[i] = FLAG_UNDEFINED; break;
+            default:  transfer.flags[i] = FLAG_KEEP;      break;
+          }
+        }
+
+        transfer.conditions[0] = c1;
+        transfer.conditions[1] = c2;
+        transfer.conditions[2] = c3;
+      }
+
+
+      void x86TaintSemantics::initTable(void) {
+        Transfer invalid = {TRANSFER_INVALID, 0, {FLAG_KEEP}, {ID_REG_INVALID, ID_REG_INVALID, ID_REG_INVALID}};
+
+        this->table.assign(ID_INS_LAST_ITEM, invalid);
+
+        /*                type            kind                operands  AF CF OF PF SF ZF */
+        this->addTransfer(ID_INS_ADC,     TRANSFER_UNION_CF,  2,        "RRRRRR");
+        this->addTransfer(ID_INS_ADD,     TRANSFER_UNION,     2,        "RRRRRR");
+        this->addTransfer(ID_INS_AND,     TRANSFER_UNION,     2,        "UCCRRR");
+        this->addTransfer(ID_INS_CALL,    TRANSFER_CALL,      1);
+        this->addTransfer(ID_INS_CMP,     TRANSFER_COMPARE,   2,        "RRRRRR");
+        this->addTransfer(ID_INS_DEC,     TRANSFER_SELF,      1,        "R-RRRR");
+        this->addTransfer(ID_INS_INC,     TRANSFER_SELF,      1,        "R-RRRR");
+        this->addTransfer(ID_INS_JA,      TRANSFER_BRANCH,    1,        "------", ID_REG_X86_CF, ID_REG_X86_ZF);
+        this->addTransfer(ID_INS_JAE,     TRANSFER_BRANCH,    1,        "------", ID_REG_X86_CF);
+        this->addTransfer(ID_INS_JB,      TRANSFER_BRANCH,    1,        "------", ID_REG_X86_CF);
+        this->addTransfer(ID_INS_JBE,     TRANSFER_BRANCH,    1,        "------", ID_REG_X86_CF, ID_REG_X86_ZF);
+        this->addTransfer(ID_INS_JE,      TRANSFER_BRANCH,    1,        "------", ID_REG_X86_ZF);
+        this->addTransfer(ID_INS_JG,      TRANSFER_BRANCH,    1,        "------", ID_REG_X86_SF, ID_REG_X86_OF, ID_REG_X86_ZF);
+        this->addTransfer(ID_INS_JGE,     TRANSFER_BRANCH,    1,        "------", ID_REG_X86_SF, ID_REG_X86_OF);
+        this->addTransfer(ID_INS_JL,      TRANSFER_BRANCH,    1,        "------", ID_REG_X86_SF, ID_REG_X86_OF);
+        this->addTransfer(ID_INS_JLE,     TRANSFER_BRANCH,    1,        "------", ID_REG_X86_SF, ID_REG_X86_OF, ID_REG_X86_ZF);
+        this->addTransfer(ID_INS_JMP,     TRANSFER_JUMP,      1);
+        this->addTransfer(ID_INS_JNE,     TRANSFER_BRANCH,    1,        "------", ID_REG_X86_ZF);
+        this->addTransfer(ID_INS_JNO,     TRANSFER_BRANCH,    1,        "------", ID_REG_X86_OF);
+        this->addTransfer(ID_INS_JNP,     TRANSFER_BRANCH,    1,        "------", ID_REG_X86_PF);
+        this->addTransfer(ID_INS_JNS,     TRANSFER_BRANCH,    1,        "------", ID_REG_X86_SF);
+        this->addTransfer(ID_INS_JO,      TRANSFER_BRANCH,    1,        "------", ID_REG_X86_OF);
+        this->addTransfer(ID_INS_JP,      TRANSFER_BRANCH,    1,        "------", ID_REG_X86_PF);
+        this->addTransfer(ID_INS_JS,      TRANSFER_BRANCH,    1,        "------", ID_REG_X86_SF);
+        this->addTransfer(ID_INS_LEA,     TRANSFER_LEA,       2);
+        this->addTransfer(ID_INS_MOV,     TRANSFER_ASSIGN,    2);
+        this->addTransfer(ID_INS_MOVSX,   TRANSFER_ASSIGN,    2);
+        this->addTransfer(ID_INS_MOVSXD,  TRANSFER_ASSIGN,    2);
+        this->addTransfer(ID_INS_MOVZX,   TRANSFER_ASSIGN,    2);
+        this->addTransfer(ID_INS_NEG,     TRANSFER_SELF,      1,        "RRRRRR");
+        this->addTransfer(ID_INS_NOP,     TRANSFER_NOP,       0);
+        this->addTransfer(ID_INS_NOT,     TRANSFER_SELF,      1);
+        this->addTransfer(ID_INS_OR,      TRANSFER_UNION,     2,        "UCCRRR");
+        this->addTransfer(ID_INS_POP,     TRANSFER_POP,       1);
+        this->addTransfer(ID_INS_PUSH,    TRANSFER_PUSH,      1);
+        this->addTransfer(ID_INS_RET,     TRANSFER_RET,       0);
+        this->addTransfer(ID_INS_SBB,     TRANSFER_UNION_CF,  2,        "RRRRRR");
+        this->addTransfer(ID_INS_SUB,     TRANSFER_UNION,     2,        "RRRRRR");
+        this->addTransfer(ID_INS_TEST,    TRANSFER_COMPARE,   2,        "UCCRRR");
+        this->addTransfer(ID_INS_XCHG,    TRANSFER_XCHG,      2);
+        this->addTransfer(ID_INS_XOR,     TRANSFER_UNION,     2,        "UCCRRR");
+      }
+
+
+      bool x86TaintSemantics::isSupported(const triton::arch::Instruction& inst) const {
+        triton::uint32 type = inst.getType();
+
+        if (type >= this->table.size() || this->table[type].kind == TRANSFER_INVALID)
+          return false;
+
+        /* The taint of the flags and of the program counter would add to the taint of the instruction */
+        if (!this->taintEngine->isEnabled())
+          return false;
+
+        /* The concrete state is updated by the native interpreter */
+        if (!this->concreteIsa->isExecutable(inst))
+          return false;
+
+        /* The REP prefixes loop on the counter */
+        switch (inst.getPrefix()) {
+          case ID_PREFIX_REP:
+          case ID_PREFIX_REPE:
+          case ID_PREFIX_REPNE:
+            return false;
+          default:
+            break;
+        }
+
+        const Transfer& transfer = this->table[type];
+
+        /* RET may pop an immediate */
+        if (transfer.kind == TRANSFER_RET) {
+          if (inst.operands.size() > 1 || (inst.operands.size() == 1 && inst.operands[0].getType() != triton::arch::OP_IMM))
+            return false;
+        }
+        else if (transfer.kind != TRANSFER_NOP && inst.operands.size() != transfer.operands)
+          return false;
+
+        if (transfer.kind == TRANSFER_LEA) {
+          if (inst.operands[0].getType() != triton::arch::OP_REG || inst.operands[1].getType() != triton::arch::OP_MEM)
+            return false;
+        }
+
+        for (const auto& operand : inst.operands) {
+          switch (operand.getType()) {
+            /* The address of a POP destination may depend on the stack pointer once it is aligned */
+            case triton::arch::OP_MEM:
+              if (transfer.kind == TRANSFER_POP)
+                return false;
+              break;
+
+            /* Moves of the control registers undefine the flags */
+            case triton::arch::OP_REG: {
+              triton::uint32 id = operand.getConstRegister().getId();
+              if (id >= ID_REG_X86_CR0 && id <= ID_REG_X86_CR15)
+                return false;
+              break;
+            }
+
+            default:
+              break;
+          }
+        }
+
+        return true;
+      }
+
+
+      void x86TaintSemantics::initAddress(triton::arch::MemoryAccess& mem) const {
+        /* Same as SymbolicEngine::initLeaAst() but on the concrete values */
+        if (mem.getBitSize() >= BYTE_SIZE_BIT && !mem.getAddress())
+          mem.setAddress(this->architecture->getConcreteMemoryAddress(mem));
+      }
+
+
+      bool x86TaintSemantics::isConditionTaken(const triton::arch::Instruction& inst) const {
+        auto flag = [this](triton::arch::register_e id) {
+          return !this->architecture->getConcreteRegisterValue(this->architecture->getRegister(id)).is_zero();
+        };
+
+        switch (inst.getType()) {
+          case ID_INS_JA:   return !flag(ID_REG_X86_CF) && !flag(ID_REG_X86_ZF);
+          case ID_INS_JAE:  return !flag(ID_REG_X86_CF);
+          case ID_INS_JB:   return flag(ID_REG_X86_CF);
+          case ID_INS_JBE:  return flag(ID_REG_X86_CF) || flag(ID_REG_X86_ZF);
+          case ID_INS_JE:   return flag(ID_REG_X86_ZF);
+          case ID_INS_JG:   return flag(ID_REG_X86_SF) == flag(ID_REG_X86_OF) && !flag(ID_REG_X86_ZF);
+          case ID_INS_JGE:  return flag(ID_REG_X86_SF) == flag(ID_REG_X86_OF);
+          case ID_INS_JL:   return flag(ID_REG_X86_SF) != flag(ID_REG_X86_OF);
+          case ID_INS_JLE:  return flag(ID_REG_X86_SF) != flag(ID_REG_X86_OF) || flag(ID_REG_X86_ZF);
+          case ID_INS_JNE:  return !flag(ID_REG_X86_ZF);
+          case ID_INS_JNO:  return !flag(ID_REG_X86_OF);
+          case ID_INS_JNP:  return !flag(ID_REG_X86_PF);
+          case ID_INS_JNS:  return !flag(ID_REG_X86_SF);
+          case ID_INS_JO:   return flag(ID_REG_X86_OF);
+          case ID_INS_JP:   return flag(ID_REG_X86_PF);
+          case ID_INS_JS:   return flag(ID_REG_X86_SF);
+          default:
+            throw triton::exceptions::Semantics("x86TaintSemantics::isConditionTaken(): Not a conditional jump.");
+        }
+      }
+
+
+      void x86TaintSemantics::spreadFlags(triton::arch::Instruction& inst, const Transfer& transfer, bool result) {
+        for (triton::uint32 i = 0; i < NUMBER_OF_FLAGS; i++) {
+          switch (transfer.flags[i]) {
+            case FLAG_RESULT:
+              this->taintEngine->setTaintRegister(this->architecture->getRegister(transferFlags[i]), result);
+              break;
+
+            case FLAG_CLEAR:
+              this->taintEngine->setTaintRegister(this->architecture->getRegister(transferFlags[i]), triton::engines::taint::UNTAINTED);
+              break;
+
+            case FLAG_UNDEFINED:
+              inst.setUndefinedRegister(this->architecture->getRegister(transferFlags[i]));
+              this->taintEngine->setTaintRegister(this->architecture->getRegister(transferFlags[i]), triton::engines::taint::UNTAINTED);
+              break;
+
+            default:
+              break;
+          }
+        }
+      }
+
+
+      void x86TaintSemantics::controlFlow(void) {
+        this->taintEngine->setTaintRegister(this->architecture->getProgramCounter(), triton::engines::taint::UNTAINTED);
+      }
+
+
+      bool x86TaintSemantics::alignStack(void) {
+        auto sp = triton::arch::OperandWrapper(this->architecture->getStackPointer());
+        return this->taintEngine->taintUnion(sp, sp);
+      }
+
+
+      bool x86TaintSemantics::buildSemantics(triton::arch::Instruction& inst) {
+        if (!this->isSupported(inst))
+          return false;
+
+        const Transfer& transfer = this->table[inst.getType()];
+        const auto& stack        = this->architecture->getStackPointer();
+        auto pc                  = triton::arch::OperandWrapper(this->architecture->getProgramCounter());
+        bool tainted             = false;
+        bool result              = false;
+
+        /* Initialize the target address of memory operands */
+        for (auto& operand : inst.operands) {
+          if (operand.getType() == triton::arch::OP_MEM)
+            this->initAddress(operand.getMemory());
+        }
+
+        switch (transfer.kind) {
+          case TRANSFER_ASSIGN:
+            result = this->taintEngine->taintAssignment(inst.operands[0], inst.operands[1]);
+            break;
+
+          case TRANSFER_BRANCH: {
+            if (this->isConditionTaken(inst))
+              inst.setConditionTaken(true);
+            result = this->taintEngine->taintAssignment(pc, triton::arch::OperandWrapper(this->architecture->getRegister(transfer.conditions[0])));
+            for (triton::uint32 i = 1; i < 3 && transfer.conditions[i] != ID_REG_INVALID; i++)
+              result = this->taintEngine->taintUnion(pc, triton::arch::OperandWrapper(this->architecture->getRegister(transfer.conditions[i])));
+            break;
+          }
+
+          case TRANSFER_CALL: {
+            tainted |= this->alignStack();
+            auto stackValue = this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+            auto sp = triton::arch::MemoryAccess(maskValue(stackValue - stack.getSize(), stack.getBitSize()), stack.getSize());
+            tainted |= this->taintEngine->taintAssignmentMemoryImmediate(sp);
+            result = this->taintEngine->taintAssignment(pc, inst.operands[0]);
+            break;
+          }
+
+          case TRANSFER_COMPARE:
+            result = this->taintEngine->isTainted(inst.operands[0]) | this->taintEngine->isTainted(inst.operands[1]);
+            break;
+
+          case TRANSFER_JUMP:
+            inst.setConditionTaken(true);
+            result = this->taintEngine->taintAssignment(pc, inst.operands[0]);
+            break;
+
+          case TRANSFER_LEA: {
+            const auto& mem = inst.operands[1].getConstMemory();
+            result = this->taintEngine->setTaint(inst.operands[0], this->taintEngine->isTainted(mem.getConstBaseRegister()) | this->taintEngine->isTainted(mem.getConstIndexRegister()));
+            break;
+          }
+
+          case TRANSFER_NOP:
+            break;
+
+          case TRANSFER_POP: {
+            auto& dst = inst.operands[0];
+            auto stackValue = this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+            auto src = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue, dst.getSize()));
+            result = this->taintEngine->taintAssignment(dst, src);
+            /* Don't increment SP if the destination register is SP */
+            if (this->architecture->getParentRegister(dst.getConstRegister()) != stack)
+              tainted |= this->alignStack();
+            break;
+          }
+
+          case TRANSFER_PUSH: {
+            auto& src = inst.operands[0];
+            triton::uint32 size = (src.getType() == triton::arch::OP_IMM ? stack.getSize() : src.getSize());
+            tainted |= this->alignStack();
+            auto stackValue = this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+            auto dst = triton::arch::OperandWrapper(triton::arch::MemoryAccess(maskValue(stackValue - size, stack.getBitSize()), size));
+            result = this->taintEngine->taintAssignment(dst, src);
+            break;
+          }
+
+          case TRANSFER_RET: {
+            auto stackValue = this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+            auto sp = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue, stack.getSize()));
+            result = this->taintEngine->taintAssignment(pc, sp);
+            tainted |= this->alignStack();
+            if (inst.operands.size() > 0)
+              tainted |= this->alignStack();
+            break;
+          }
+
+          case TRANSFER_SELF:
+            result = this->taintEngine->taintUnion(inst.operands[0], inst.operands[0]);
+            break;
+
+          case TRANSFER_UNION:
+            result = this->taintEngine->taintUnion(inst.operands[0], inst.operands[1]);
+            break;
+
+          case TRANSFER_UNION_CF:
+            this->taintEngine->taintUnion(inst.operands[0], inst.operands[1]);
+            result = this->taintEngine->taintUnion(inst.operands[0], triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_X86_CF)));
+            break;
+
+          case TRANSFER_XCHG: {
+            bool dstT = this->taintEngine->isTainted(inst.operands[0]);
+            bool srcT = this->taintEngine->isTainted(inst.operands[1]);
+            result  = this->taintEngine->setTaint(inst.operands[0], srcT);
+            result |= this->taintEngine->setTaint(inst.operands[1], dstT);
+            break;
+          }
+
+          default:
+            throw triton::exceptions::Semantics("x86TaintSemantics::buildSemantics(): Invalid transfer.");
+        }
+
+        /* Flags */
+        this->spreadFlags(inst, transfer, result);
+
+        /* The branches assign the program counter */
+        switch (transfer.kind) {
+          case TRANSFER_BRANCH:
+          case TRANSFER_CALL:
+          case TRANSFER_JUMP:
+          case TRANSFER_RET:
+            break;
+          default:
+            this->controlFlow();
+            break;
+        }
+
+        /* Set the taint */
+        if (tainted || result)
+          inst.setTaint(true);
+
+        /* Update the concrete state, the symbolic engine is disabled so nothing is concretized */
+        this->concreteIsa->execute(inst, false);
+
+        return true;
+      }
+
+    }; /* x86 namespace */
+  }; /* arch namespace */
+}; /* triton namespace */
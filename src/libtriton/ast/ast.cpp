@@ -10,6 +10,7 @@
 #include <new>
 #include <stack>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
 #include <triton/ast.hpp>
@@ -27,10 +28,17 @@ namespace triton {
     /* ====== Abstract node */
 
     AbstractNode::AbstractNode(triton::ast::ast_e type, AstContext& ctxt): ctxt(ctxt) {
-      this->eval        = 0;
-      this->size        = 0;
-      this->symbolized  = false;
-      this->type        = type;
+      this->dirty          = false;
+      this->eval           = 0;
+      this->hash           = 0;
+      this->interned       = false;
+      this->level          = 1;
+      this->linked         = false;
+      this->logical        = false;
+      this->sharedConstant = false;
+      this->size           = 0;
+      this->symbolized     = false;
+      this->type           = type;
     }
 
 
@@ -61,8 +69,17 @@ namespace triton {
     }
 
 
+    triton::uint64 AbstractNode::getBitvectorMask64(void) const {
+      if (this->size >= 64)
+        return static_cast<triton::uint64>(-1);
+      return ((static_cast<triton::uint64>(1) << this->size) - 1);
+    }
+
+
     bool AbstractNode::isSigned(void) const {
-      if ((this->eval >> (this->size-1)) & 1)
+      if (this->size <= 64)
+        return (this->size != 0 && ((this->eval >> (this->size-1)) & 1));
+      if ((this->evaluate() >> (this->size-1)) & 1)
         return true;
       return false;
     }
@@ -102,21 +119,225 @@ namespace triton {
     }
 
 
+    bool AbstractNode::isInterned(void) const {
+      return this->interned;
+    }
+
+
+    void AbstractNode::setInterned(bool flag) {
+      this->interned = flag;
+    }
+
+
+    bool AbstractNode::isSharedConstant(void) const {
+      return this->sharedConstant;
+    }
+
+
+    void AbstractNode::setSharedConstant(bool flag) {
+      this->sharedConstant = flag;
+    }
+
+
     bool AbstractNode::equalTo(const SharedAbstractNode& other) const {
+      /* The value, the size and the hash only discard the different trees quickly */
       return (this->evaluate() == other->evaluate()) &&
              (this->getBitvectorSize() == other->getBitvectorSize()) &&
-             (this->hash(1) == other->hash(1));
+             (this->getHash() == other->getHash()) &&
+             (this == other.get() || this->ctxt.isSameTree(std::const_pointer_cast<AbstractNode>(this->shared_from_this()), other));
     }
 
 
     triton::uint512 AbstractNode::evaluate(void) const {
+      if (this->wideEval != nullptr)
+        return *this->wideEval;
       return this->eval;
     }
 
 
+    triton::uint64 AbstractNode::evaluate64(void) const {
+      return this->eval;
+    }
+
+
+    void AbstractNode::setEval(const triton::uint512& value) {
+      this->eval = (value & 0xffffffffffffffff).convert_to<triton::uint64>();
+
+      if (value > 0xffffffffffffffff)
+        this->wideEval = std::make_shared<triton::uint512>(value);
+      else
+        this->wideEval = nullptr;
+    }
+
+
+    void AbstractNode::setEval(triton::uint64 value) {
+      this->eval = value;
+      this->wideEval = nullptr;
+    }
+
+
+    triton::usize AbstractNode::getMemorySize(void) const {
+      triton::usize size = 0;
+
+      switch (this->type) {
+        case ASSERT_NODE:               size = sizeof(AssertNode);    break;
+        case BVADD_NODE:                size = sizeof(BvaddNode);     break;
+        case BVAND_NODE:                size = sizeof(BvandNode);     break;
+        case BVASHR_NODE:               size = sizeof(BvashrNode);    break;
+        case BVLSHR_NODE:               size = sizeof(BvlshrNode);    break;
+        case BVMUL_NODE:                size = sizeof(BvmulNode);     break;
+        case BVNAND_NODE:               size = sizeof(BvnandNode);    break;
+        case BVNEG_NODE:                size = sizeof(BvnegNode);     break;
+        case BVNOR_NODE:                size = sizeof(BvnorNode);     break;
+        case BVNOT_NODE:                size = sizeof(BvnotNode);     break;
+        case BVOR_NODE:                 size = sizeof(BvorNode);      break;
+        case BVROL_NODE:                size = sizeof(BvrolNode);     break;
+        case BVROR_NODE:                size = sizeof(BvrorNode);     break;
+        case BVSDIV_NODE:               size = sizeof(BvsdivNode);    break;
+        case BVSGE_NODE:                size = sizeof(BvsgeNode);     break;
+        case BVSGT_NODE:                size = sizeof(BvsgtNode);     break;
+        case BVSHL_NODE:                size = sizeof(BvshlNode);     break;
+        case BVSLE_NODE:                size = sizeof(BvsleNode);     break;
+        case BVSLT_NODE:                size = sizeof(BvsltNode);     break;
+        case BVSMOD_NODE:               size = sizeof(BvsmodNode);    break;
+        case BVSREM_NODE:               size = sizeof(BvsremNode);    break;
+        case BVSUB_NODE:                size = sizeof(BvsubNode);     break;
+        case BVUDIV_NODE:               size = sizeof(BvudivNode);    break;
+        case BVUGE_NODE:                size = sizeof(BvugeNode);     break;
+        case BVUGT_NODE:                size = sizeof(BvugtNode);     break;
+        case BVULE_NODE:                size = sizeof(BvuleNode);     break;
+        case BVULT_NODE:                size = sizeof(BvultNode);     break;
+        case BVUREM_NODE:               size = sizeof(BvuremNode);    break;
+        case BVXNOR_NODE:               size = sizeof(BvxnorNode);    break;
+        case BVXOR_NODE:                size = sizeof(BvxorNode);     break;
+        case BV_NODE:                   size = sizeof(BvNode);        break;
+        case COMPOUND_NODE:             size = sizeof(CompoundNode);  break;
+        case CONCAT_NODE:               size = sizeof(ConcatNode);    break;
+        case DECLARE_NODE:              size = sizeof(DeclareNode);   break;
+        case DISTINCT_NODE:             size = sizeof(DistinctNode);  break;
+        case EQUAL_NODE:                size = sizeof(EqualNode);     break;
+        case EXTRACT_NODE:              size = sizeof(ExtractNode);   break;
+        case IFF_NODE:                  size = sizeof(IffNode);       break;
+        case INTEGER_NODE:              size = sizeof(IntegerNode);   break;
+        case ITE_NODE:                  size = sizeof(IteNode);       break;
+        case LAND_NODE:                 size = sizeof(LandNode);      break;
+        case LET_NODE:                  size = sizeof(LetNode);       break;
+        case LNOT_NODE:                 size = sizeof(LnotNode);      break;
+        case LOR_NODE:                  size = sizeof(LorNode);       break;
+        case REFERENCE_NODE:            size = sizeof(ReferenceNode); break;
+        case STRING_NODE:               size = sizeof(StringNode);    break;
+        case SX_NODE:                   size = sizeof(SxNode);        break;
+        case VARIABLE_NODE:             size = sizeof(VariableNode);  break;
+        case ZX_NODE:                   size = sizeof(ZxNode);        break;
+        default:
+          throw triton::exceptions::Ast("AbstractNode::getMemorySize(): Invalid type node.");
+      }
+
+      /* The control block allocated by std::make_shared (use and weak counters) */
+      size += 2 * sizeof(void*);
+
+      size += this->children.capacity() * sizeof(SharedAbstractNode);
+      size += this->parents.capacity() * sizeof(Parent);
+
+      if (this->wideEval != nullptr)
+        size += sizeof(triton::uint512) + 2 * sizeof(void*);
+
+      return size;
+    }
+
+
+    triton::uint64 AbstractNode::getHash(void) const {
+      return this->hash;
+    }
+
+
+    triton::uint32 AbstractNode::getLevel(void) const {
+      return this->level;
+    }
+
+
     void AbstractNode::initParents(void) {
-      for (auto& sp : this->getParents())
-        sp->init();
+      AbstractNode* node = this;
+      AbstractNode::initParents(&node, 1);
+    }
+
+
+    void AbstractNode::initParents(const std::vector<AbstractNode*>& nodes) {
+      AbstractNode::initParents(nodes.data(), nodes.size());
+    }
+
+
+    void AbstractNode::initParents(AbstractNode* const* nodes, triton::usize count) {
+      if (count == 0)
+        return;
+
+      /*
+       * The order and the DFS stack are borrowed from the context so that
+       * their capacity is reused from one call to another. A nested call
+       * finds them empty and uses its own storage.
+       */
+      AstContext& ctxt = nodes[0]->ctxt;
+      std::vector<SharedAbstractNode> order;
+      std::vector<std::pair<AbstractNode*, triton::usize>> stack;
+      order.swap(ctxt.initOrder);
+      stack.swap(ctxt.initStack);
+
+      auto clean = [&]() {
+        for (triton::usize i = 0; i < count; i++)
+          nodes[i]->dirty = false;
+        for (auto& node : order)
+          node->dirty = false;
+        for (auto& frame : stack)
+          frame.first->dirty = false;
+        order.clear();
+        stack.clear();
+        order.swap(ctxt.initOrder);
+        stack.swap(ctxt.initStack);
+      };
+
+      for (triton::usize i = 0; i < count; i++)
+        nodes[i]->dirty = true;
+
+      try {
+        /*
+         * Post-order DFS through the parents. The dirty bit marks the nodes
+         * already scheduled, so a node reachable through several paths is
+         * visited only once. The parents are read in place, the expired
+         * ones are skipped. Nothing is released during the walk, so the
+         * stack holds raw pointers and only the order keeps references.
+         */
+        for (triton::usize i = 0; i < count; i++) {
+          stack.push_back({nodes[i], 0});
+          while (!stack.empty()) {
+            auto& top = stack.back();
+            if (top.second < top.first->parents.size()) {
+              SharedAbstractNode parent = top.first->parents[top.second++].weak.lock();
+              if (parent != nullptr && parent->dirty == false) {
+                parent->dirty = true;
+                stack.push_back({parent.get(), 0});
+              }
+            }
+            else {
+              /* The given nodes (bottom of the stack) are not re-evaluated */
+              if (stack.size() > 1)
+                order.push_back(top.first->shared_from_this());
+              stack.pop_back();
+            }
+          }
+        }
+
+        /* The reverse post-order is a topological order, children are re-evaluated before their parents */
+        for (auto it = order.rbegin(); it != order.rend(); it++) {
+          (*it)->init(false);
+          (*it)->dirty = false;
+        }
+      }
+      catch (...) {
+        clean();
+        throw;
+      }
+
+      clean();
     }
 
 
@@ -127,52 +348,63 @@ namespace triton {
 
     std::vector<SharedAbstractNode> AbstractNode::getParents(void) {
       std::vector<SharedAbstractNode> res;
-      std::vector<AbstractNode*> toRemove;
 
-      for (auto& kv: parents) {
-        if (auto sp = kv.second.second.lock())
+      res.reserve(this->parents.size());
+      for (auto& parent : this->parents) {
+        if (auto sp = parent.weak.lock())
           res.push_back(sp);
-        else
-          toRemove.push_back(kv.first);
       }
 
-      for(auto* an: toRemove)
-        parents.erase(an);
+      /* Remove expired parents */
+      if (res.size() != this->parents.size()) {
+        this->parents.erase(std::remove_if(this->parents.begin(), this->parents.end(), [](const Parent& parent) {
+          return parent.weak.expired();
+        }), this->parents.end());
+      }
 
       return res;
     }
 
 
     void AbstractNode::setParent(AbstractNode* p) {
-      auto it = parents.find(p);
+      /* A shared constant is used by most trees, its value never needs to be spread */
+      if (this->sharedConstant)
+        return;
 
-      if (it == parents.end()) {
-        auto A = p->shared_from_this();
-        this->parents.insert(std::make_pair(p, std::make_pair(1, WeakAbstractNode(A))));
-      }
-      else {
-        if (it->second.second.expired()) {
-          parents.erase(it);
-          auto A = p->shared_from_this();
-          this->parents.insert(std::make_pair(p, std::make_pair(1, WeakAbstractNode(A))));
-        }
-        // Ptr already in, add it for the counter
-        else {
-          it->second.first += 1;
+      for (auto& parent : this->parents) {
+        if (parent.node == p) {
+          if (parent.weak.expired()) {
+            parent.weak  = p->shared_from_this();
+            parent.count = 1;
+          }
+          // Ptr already in, add it for the counter
+          else {
+            parent.count += 1;
+          }
+          return;
         }
       }
-    }
 
+      /* Remove expired parents before growing the vector */
+      if (this->parents.size() == this->parents.capacity()) {
+        this->parents.erase(std::remove_if(this->parents.begin(), this->parents.end(), [](const Parent& parent) {
+          return parent.weak.expired();
+        }), this->parents.end());
+      }
 
-    void AbstractNode::removeParent(AbstractNode* p) {
-      auto it = this->parents.find(p);
+      this->parents.push_back({p, 1, p->shared_from_this()});
+    }
 
-      if(it == parents.end())
-        return;
 
-      it->second.first--;
-      if(it->second.first == 0)
-        this->parents.erase(it);
+    void AbstractNode::removeParent(AbstractNode* p) {
+      for (auto it = this->parents.begin(); it != this->parents.end(); it++) {
+        if (it->node == p) {
+          it->count--;
+          if (it->count == 0)
+            this->parents.erase(it);
+          return;
+        }
+      }
     }
 
 
@@ -187,6 +419,17 @@ namespace triton {
     }
 
 
+    void AbstractNode::linkChildren(void) {
+      if (this->linked)
+        return;
+
+      for (auto& child : this->children)
+        child->setParent(this);
+
+      this->linked = true;
+    }
+
+
     void AbstractNode::setChild(triton::uint32 index, const SharedAbstractNode& child) {
       if (index >= this->children.size())
         throw triton::exceptions::Ast("AbstractNode::setChild(): Invalid index.");
@@ -194,11 +437,18 @@ namespace triton {
       if (child == nullptr)
         throw triton::exceptions::Ast("AbstractNode::setChild(): child cannot be null.");
 
-      /* Remove the parent of the old child */
-      this->children[index]->removeParent(this);
+      /* The node may be shared by unrelated trees */
+      if (this->interned)
+        throw triton::exceptions::Ast("AbstractNode::setChild(): The node is interned, modify a copy of it.");
 
-      /* Setup the parent of the child */
-      child->setParent(this);
+      /* The links are set up at the first initialization of the node */
+      if (this->linked) {
+        /* Remove the parent of the old child */
+        this->children[index]->removeParent(this);
+
+        /* Setup the parent of the child */
+        child->setParent(this);
+      }
 
       /* Setup the child of the parent */
       this->children[index] = child;
@@ -227,7 +477,7 @@ namespace triton {
     }
 
 
-    void AssertNode::init(void) {
+    void AssertNode::init(bool withParents) {
       if (this->children.size() < 1)
         throw triton::exceptions::Ast("AssertNode::init(): Must take at least one child.");
 
@@ -236,25 +486,37 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
-      this->eval = ((this->children[0]->evaluate()) & this->getBitvectorMask());
+      if (this->size <= 64)
+        this->setEval(this->children[0]->evaluate64() & this->getBitvectorMask64());
+      else
+        this->setEval(this->children[0]->evaluate() & this->getBitvectorMask());
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 AssertNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void AssertNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * this->children[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = this->hash * (this->children[index]->getHash() | 1);
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -267,7 +529,7 @@ namespace triton {
     }
 
 
-    void BvaddNode::init(void) {
+    void BvaddNode::init(bool withParents) {
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("BvaddNode::init(): Must take at least two children.");
 
@@ -276,25 +538,37 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
-      this->eval = ((this->children[0]->evaluate() + this->children[1]->evaluate()) & this->getBitvectorMask());
+      if (this->size <= 64)
+        this->setEval((this->children[0]->evaluate64() + this->children[1]->evaluate64()) & this->getBitvectorMask64());
+      else
+        this->setEval((this->children[0]->evaluate() + this->children[1]->evaluate()) & this->getBitvectorMask());
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 BvaddNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void BvaddNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * this->children[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = this->hash * (this->children[index]->getHash() | 1);
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -307,7 +581,7 @@ namespace triton {
     }
 
 
-    void BvandNode::init(void) {
+    void BvandNode::init(bool withParents) {
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("BvandNode::init(): Must take at least two children.");
 
@@ -316,25 +590,37 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
-      this->eval = (this->children[0]->evaluate() & this->children[1]->evaluate());
+      if (this->size <= 64)
+        this->setEval(this->children[0]->evaluate64() & this->children[1]->evaluate64());
+      else
+        this->setEval(this->children[0]->evaluate() & this->children[1]->evaluate());
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 BvandNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void BvandNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * this->children[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = this->hash * (this->children[index]->getHash() | 1);
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -348,7 +634,7 @@ namespace triton {
     }
 
 
-    void BvashrNode::init(void) {
+    void BvashrNode::init(bool withParents) {
       triton::uint32 shift  = 0;
       triton::uint512 mask  = 0;
       triton::uint512 value = 0;
@@ -359,55 +645,77 @@ namespace triton {
       if (this->children[0]->getBitvectorSize() != this->children[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvashrNode::init(): Must take two nodes of same size.");
 
-      value = this->children[0]->evaluate();
-      shift = this->children[1]->evaluate().convert_to<triton::uint32>();
-
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
 
-      /* Mask based on the sign */
-      if (this->children[0]->isSigned()) {
-        mask = 1;
-        mask = ((mask << (this->size-1)) & this->getBitvectorMask());
-      }
+      /* Native evaluation */
+      if (this->size <= 64) {
+        triton::uint64 shift64 = this->children[1]->evaluate64();
+        triton::sint64 value64 = triton::ast::signExtend64(this->children[0]->evaluate64(), this->size);
 
-      if (shift >= this->size && this->children[0]->isSigned()) {
-        this->eval = -1;
-        this->eval &= this->getBitvectorMask();
+        if (shift64 >= this->size)
+          this->setEval(value64 < 0 ? this->getBitvectorMask64() : 0);
+        else
+          this->setEval(static_cast<triton::uint64>(value64 >> shift64) & this->getBitvectorMask64());
       }
 
-      else if (shift >= this->size && !this->children[0]->isSigned()) {
-        this->eval = 0;
-      }
+      else {
+        value = this->children[0]->evaluate();
+        shift = this->children[1]->evaluate().convert_to<triton::uint32>();
 
-      else if (shift == 0) {
-        this->eval = value;
-      }
+        /* Mask based on the sign */
+        if (this->children[0]->isSigned()) {
+          mask = 1;
+          mask = ((mask << (this->size-1)) & this->getBitvectorMask());
+        }
 
-      else {
-        this->eval = value & this->getBitvectorMask();
-        for (triton::uint32 index = 0; index < shift; index++) {
-          this->eval = (((this->eval >> 1) | mask) & this->getBitvectorMask());
+        if (shift >= this->size && this->children[0]->isSigned()) {
+          this->setEval(this->getBitvectorMask());
+        }
+
+        else if (shift >= this->size && !this->children[0]->isSigned()) {
+          this->setEval(0);
+        }
+
+        else if (shift == 0) {
+          this->setEval(value);
+        }
+
+        else {
+          value = value & this->getBitvectorMask();
+          for (triton::uint32 index = 0; index < shift; index++) {
+            value = (((value >> 1) | mask) & this->getBitvectorMask());
+          }
+          this->setEval(value);
         }
       }
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 BvashrNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void BvashrNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::hash2n(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = triton::ast::hashMix(this->hash, this->children[index]->getHash());
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -420,7 +728,7 @@ namespace triton {
     }
 
 
-    void BvlshrNode::init(void) {
+    void BvlshrNode::init(bool withParents) {
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("BvlshrNode::init(): Must take at least two children.");
 
@@ -429,25 +737,39 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
-      this->eval = (this->children[0]->evaluate() >> this->children[1]->evaluate().convert_to<triton::uint32>());
+      if (this->size <= 64) {
+        triton::uint64 shift = this->children[1]->evaluate64();
+        this->setEval(shift >= 64 ? 0 : (this->children[0]->evaluate64() >> shift));
+      }
+      else
+        this->setEval(this->children[0]->evaluate() >> this->children[1]->evaluate().convert_to<triton::uint32>());
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 BvlshrNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void BvlshrNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::hash2n(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = triton::ast::hashMix(this->hash, this->children[index]->getHash());
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -460,7 +782,7 @@ namespace triton {
     }
 
 
-    void BvmulNode::init(void) {
+    void BvmulNode::init(bool withParents) {
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("BvmulNode::init(): Must take at least two children.");
 
@@ -469,25 +791,37 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
-      this->eval = ((this->children[0]->evaluate() * this->children[1]->evaluate()) & this->getBitvectorMask());
+      if (this->size <= 64)
+        this->setEval((this->children[0]->evaluate64() * this->children[1]->evaluate64()) & this->getBitvectorMask64());
+      else
+        this->setEval((this->children[0]->evaluate() * this->children[1]->evaluate()) & this->getBitvectorMask());
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 BvmulNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void BvmulNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * this->children[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = this->hash * (this->children[index]->getHash() | 1);
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -500,7 +834,7 @@ namespace triton {
     }
 
 
-    void BvnandNode::init(void) {
+    void BvnandNode::init(bool withParents) {
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("BvnandNode::init(): Must take at least two children.");
 
@@ -509,25 +843,37 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
-      this->eval = (~(this->children[0]->evaluate() & this->children[1]->evaluate()) & this->getBitvectorMask());
+      if (this->size <= 64)
+        this->setEval(~(this->children[0]->evaluate64() & this->children[1]->evaluate64()) & this->getBitvectorMask64());
+      else
+        this->setEval(~(this->children[0]->evaluate() & this->children[1]->evaluate()) & this->getBitvectorMask());
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 BvnandNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void BvnandNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * this->children[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = this->hash * (this->children[index]->getHash() | 1);
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -539,31 +885,43 @@ namespace triton {
     }
 
 
-    void BvnegNode::init(void) {
+    void BvnegNode::init(bool withParents) {
       if (this->children.size() < 1)
         throw triton::exceptions::Ast("BvnegNode::init(): Must take at least one child.");
 
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
-      this->eval = ((-(this->children[0]->evaluate().convert_to<triton::sint512>())).convert_to<triton::uint512>() & this->getBitvectorMask());
+      if (this->size <= 64)
+        this->setEval((0 - this->children[0]->evaluate64()) & this->getBitvectorMask64());
+      else
+        this->setEval((-(this->children[0]->evaluate().convert_to<triton::sint512>())).convert_to<triton::uint512>() & this->getBitvectorMask());
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 BvnegNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void BvnegNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * this->children[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = this->hash * (this->children[index]->getHash() | 1);
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -576,7 +934,7 @@ namespace triton {
     }
 
 
-    void BvnorNode::init(void) {
+    void BvnorNode::init(bool withParents) {
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("BvnorNode::init(): Must take at least two children.");
 
@@ -585,25 +943,37 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
-      this->eval = (~(this->children[0]->evaluate() | this->children[1]->evaluate()) & this->getBitvectorMask());
+      if (this->size <= 64)
+        this->setEval(~(this->children[0]->evaluate64() | this->children[1]->evaluate64()) & this->getBitvectorMask64());
+      else
+        this->setEval(~(this->children[0]->evaluate() | this->children[1]->evaluate()) & this->getBitvectorMask());
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 BvnorNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void BvnorNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * this->children[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = this->hash * (this->children[index]->getHash() | 1);
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -615,31 +985,43 @@ namespace triton {
     }
 
 
-    void BvnotNode::init(void) {
+    void BvnotNode::init(bool withParents) {
       if (this->children.size() < 1)
         throw triton::exceptions::Ast("BvnotNode::init(): Must take at least one child.");
 
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
-      this->eval = (~this->children[0]->evaluate() & this->getBitvectorMask());
+      if (this->size <= 64)
+        this->setEval(~this->children[0]->evaluate64() & this->getBitvectorMask64());
+      else
+        this->setEval(~this->children[0]->evaluate() & this->getBitvectorMask());
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 BvnotNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void BvnotNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * this->children[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = this->hash * (this->children[index]->getHash() | 1);
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -652,7 +1034,7 @@ namespace triton {
     }
 
 
-    void BvorNode::init(void) {
+    void BvorNode::init(bool withParents) {
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("BvorNode::init(): Must take at least two children.");
 
@@ -661,25 +1043,37 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
-      this->eval = (this->children[0]->evaluate() | this->children[1]->evaluate());
+      if (this->size <= 64)
+        this->setEval(this->children[0]->evaluate64() | this->children[1]->evaluate64());
+      else
+        this->setEval(this->children[0]->evaluate() | this->children[1]->evaluate());
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 BvorNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void BvorNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * this->children[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = this->hash * (this->children[index]->getHash() | 1);
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -696,7 +1090,7 @@ namespace triton {
     }
 
 
-    void BvrolNode::init(void) {
+    void BvrolNode::init(bool withParents) {
       triton::uint32 rot    = 0;
       triton::uint512 value = 0;
 
@@ -707,30 +1101,45 @@ namespace triton {
         throw triton::exceptions::Ast("BvrolNode::init(): rot must be a INTEGER_NODE.");
 
       rot   = reinterpret_cast<IntegerNode*>(this->children[1].get())->getInteger().convert_to<triton::uint32>();
-      value = this->children[0]->evaluate();
 
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
       rot %= this->size;
-      this->eval = (((value << rot) | (value >> (this->size - rot))) & this->getBitvectorMask());
+      if (this->size <= 64) {
+        triton::uint64 value64 = this->children[0]->evaluate64();
+        this->setEval(rot == 0 ? value64 : (((value64 << rot) | (value64 >> (this->size - rot))) & this->getBitvectorMask64()));
+      }
+      else {
+        value = this->children[0]->evaluate();
+        this->setEval(((value << rot) | (value >> (this->size - rot))) & this->getBitvectorMask());
+      }
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 BvrolNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void BvrolNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::hash2n(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = triton::ast::hashMix(this->hash, this->children[index]->getHash());
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -747,7 +1156,7 @@ namespace triton {
     }
 
 
-    void BvrorNode::init(void) {
+    void BvrorNode::init(bool withParents) {
       triton::uint32 rot    = 0;
       triton::uint512 value = 0;
 
@@ -758,30 +1167,45 @@ namespace triton {
         throw triton::exceptions::Ast("BvrorNode::init(): rot must be a INTEGER_NODE.");
 
       rot   = reinterpret_cast<IntegerNode*>(this->children[1].get())->getInteger().convert_to<triton::uint32>();
-      value = this->children[0]->evaluate();
 
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
       rot %= this->size;
-      this->eval = (((value >> rot) | (value << (this->size - rot))) & this->getBitvectorMask());
+      if (this->size <= 64) {
+        triton::uint64 value64 = this->children[0]->evaluate64();
+        this->setEval(rot == 0 ? value64 : (((value64 >> rot) | (value64 << (this->size - rot))) & this->getBitvectorMask64()));
+      }
+      else {
+        value = this->children[0]->evaluate();
+        this->setEval(((value >> rot) | (value << (this->size - rot))) & this->getBitvectorMask());
+      }
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 BvrorNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void BvrorNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::hash2n(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = triton::ast::hashMix(this->hash, this->children[index]->getHash());
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -794,7 +1218,7 @@ namespace triton {
     }
 
 
-    void BvsdivNode::init(void) {
+    void BvsdivNode::init(bool withParents) {
       triton::sint512 op1Signed = 0;
       triton::sint512 op2Signed = 0;
 
@@ -804,37 +1228,57 @@ namespace triton {
       if (this->children[0]->getBitvectorSize() != this->children[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsdivNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->children[0].get());
-      op2Signed = triton::ast::modularSignExtend(this->children[1].get());
-
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
 
-      if (op2Signed == 0) {
-        this->eval = (op1Signed < 0 ? 1 : -1);
-        this->eval &= this->getBitvectorMask();
+      /* Native evaluation (the sign extended operands cannot overflow) */
+      if (this->size < 64) {
+        triton::sint64 op1 = triton::ast::signExtend64(this->children[0]->evaluate64(), this->size);
+        triton::sint64 op2 = triton::ast::signExtend64(this->children[1]->evaluate64(), this->size);
+
+        if (op2 == 0)
+          this->setEval(op1 < 0 ? 1 : this->getBitvectorMask64());
+        else
+          this->setEval(static_cast<triton::uint64>(op1 / op2) & this->getBitvectorMask64());
+      }
+
+      else {
+        /* Sign extend */
+        op1Signed = triton::ast::modularSignExtend(this->children[0].get());
+        op2Signed = triton::ast::modularSignExtend(this->children[1].get());
+
+        if (op2Signed == 0)
+          this->setEval(op1Signed < 0 ? triton::uint512(1) : this->getBitvectorMask());
+        else
+          this->setEval((op1Signed / op2Signed).convert_to<triton::uint512>() & this->getBitvectorMask());
       }
-      else
-        this->eval = ((op1Signed / op2Signed).convert_to<triton::uint512>() & this->getBitvectorMask());
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 BvsdivNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void BvsdivNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::hash2n(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = triton::ast::hashMix(this->hash, this->children[index]->getHash());
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -847,7 +1291,7 @@ namespace triton {
     }
 
 
-    void BvsgeNode::init(void) {
+    void BvsgeNode::init(bool withParents) {
       triton::sint512 op1Signed = 0;
       triton::sint512 op2Signed = 0;
 
@@ -857,31 +1301,49 @@ namespace triton {
       if (this->children[0]->getBitvectorSize() != this->children[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsgeNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->children[0].get());
-      op2Signed = triton::ast::modularSignExtend(this->children[1].get());
-
       /* Init attributes */
       this->size = 1;
-      this->eval = (op1Signed >= op2Signed);
+
+      if (this->children[0]->getBitvectorSize() <= 64) {
+        /* Native evaluation */
+        triton::sint64 op1 = triton::ast::signExtend64(this->children[0]->evaluate64(), this->children[0]->getBitvectorSize());
+        triton::sint64 op2 = triton::ast::signExtend64(this->children[1]->evaluate64(), this->children[1]->getBitvectorSize());
+        this->setEval(op1 >= op2);
+      }
+
+      else {
+        /* Sign extend */
+        op1Signed = triton::ast::modularSignExtend(this->children[0].get());
+        op2Signed = triton::ast::modularSignExtend(this->children[1].get());
+        this->setEval(op1Signed >= op2Signed);
+      }
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 BvsgeNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void BvsgeNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::hash2n(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = triton::ast::hashMix(this->hash, this->children[index]->getHash());
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -894,7 +1356,7 @@ namespace triton {
     }
 
 
-    void BvsgtNode::init(void) {
+    void BvsgtNode::init(bool withParents) {
       triton::sint512 op1Signed = 0;
       triton::sint512 op2Signed = 0;
 
@@ -904,31 +1366,49 @@ namespace triton {
       if (this->children[0]->getBitvectorSize() != this->children[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsgtNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->children[0].get());
-      op2Signed = triton::ast::modularSignExtend(this->children[1].get());
-
       /* Init attributes */
       this->size = 1;
-      this->eval = (op1Signed > op2Signed);
+
+      if (this->children[0]->getBitvectorSize() <= 64) {
+        /* Native evaluation */
+        triton::sint64 op1 = triton::ast::signExtend64(this->children[0]->evaluate64(), this->children[0]->getBitvectorSize());
+        triton::sint64 op2 = triton::ast::signExtend64(this->children[1]->evaluate64(), this->children[1]->getBitvectorSize());
+        this->setEval(op1 > op2);
+      }
+
+      else {
+        /* Sign extend */
+        op1Signed = triton::ast::modularSignExtend(this->children[0].get());
+        op2Signed = triton::ast::modularSignExtend(this->children[1].get());
+        this->setEval(op1Signed > op2Signed);
+      }
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 BvsgtNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void BvsgtNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::hash2n(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = triton::ast::hashMix(this->hash, this->children[index]->getHash());
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -941,7 +1421,7 @@ namespace triton {
     }
 
 
-    void BvshlNode::init(void) {
+    void BvshlNode::init(bool withParents) {
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("BvshlNode::init(): Must take at least two children.");
 
@@ -950,25 +1430,39 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
-      this->eval = ((this->children[0]->evaluate() << this->children[1]->evaluate().convert_to<triton::uint32>()) & this->getBitvectorMask());
+      if (this->size <= 64) {
+        triton::uint64 shift = this->children[1]->evaluate64();
+        this->setEval(shift >= 64 ? 0 : ((this->children[0]->evaluate64() << shift) & this->getBitvectorMask64()));
+      }
+      else
+        this->setEval((this->children[0]->evaluate() << this->children[1]->evaluate().convert_to<triton::uint32>()) & this->getBitvectorMask());
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 BvshlNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void BvshlNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::hash2n(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = triton::ast::hashMix(this->hash, this->children[index]->getHash());
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -981,7 +1475,7 @@ namespace triton {
     }
 
 
-    void BvsleNode::init(void) {
+    void BvsleNode::init(bool withParents) {
       triton::sint512 op1Signed = 0;
       triton::sint512 op2Signed = 0;
 
@@ -991,31 +1485,49 @@ namespace triton {
       if (this->children[0]->getBitvectorSize() != this->children[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsleNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->children[0].get());
-      op2Signed = triton::ast::modularSignExtend(this->children[1].get());
-
       /* Init attributes */
       this->size = 1;
-      this->eval = (op1Signed <= op2Signed);
+
+      if (this->children[0]->getBitvectorSize() <= 64) {
+        /* Native evaluation */
+        triton::sint64 op1 = triton::ast::signExtend64(this->children[0]->evaluate64(), this->children[0]->getBitvectorSize());
+        triton::sint64 op2 = triton::ast::signExtend64(this->children[1]->evaluate64(), this->children[1]->getBitvectorSize());
+        this->setEval(op1 <= op2);
+      }
+
+      else {
+        /* Sign extend */
+        op1Signed = triton::ast::modularSignExtend(this->children[0].get());
+        op2Signed = triton::ast::modularSignExtend(this->children[1].get());
+        this->setEval(op1Signed <= op2Signed);
+      }
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 BvsleNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void BvsleNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::hash2n(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = triton::ast::hashMix(this->hash, this->children[index]->getHash());
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -1028,7 +1540,7 @@ namespace triton {
     }
 
 
-    void BvsltNode::init(void) {
+    void BvsltNode::init(bool withParents) {
       triton::sint512 op1Signed = 0;
       triton::sint512 op2Signed = 0;
 
@@ -1038,31 +1550,49 @@ namespace triton {
       if (this->children[0]->getBitvectorSize() != this->children[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsltNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->children[0].get());
-      op2Signed = triton::ast::modularSignExtend(this->children[1].get());
-
       /* Init attributes */
       this->size = 1;
-      this->eval = (op1Signed < op2Signed);
+
+      if (this->children[0]->getBitvectorSize() <= 64) {
+        /* Native evaluation */
+        triton::sint64 op1 = triton::ast::signExtend64(this->children[0]->evaluate64(), this->children[0]->getBitvectorSize());
+        triton::sint64 op2 = triton::ast::signExtend64(this->children[1]->evaluate64(), this->children[1]->getBitvectorSize());
+        this->setEval(op1 < op2);
+      }
+
+      else {
+        /* Sign extend */
+        op1Signed = triton::ast::modularSignExtend(this->children[0].get());
+        op2Signed = triton::ast::modularSignExtend(this->children[1].get());
+        this->setEval(op1Signed < op2Signed);
+      }
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 BvsltNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void BvsltNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::hash2n(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = triton::ast::hashMix(this->hash, this->children[index]->getHash());
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -1075,7 +1605,7 @@ namespace triton {
     }
 
 
-    void BvsmodNode::init(void) {
+    void BvsmodNode::init(bool withParents) {
       triton::sint512 op1Signed = 0;
       triton::sint512 op2Signed = 0;
 
@@ -1085,35 +1615,57 @@ namespace triton {
       if (this->children[0]->getBitvectorSize() != this->children[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsmodNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->children[0].get());
-      op2Signed = triton::ast::modularSignExtend(this->children[1].get());
-
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
 
-      if (this->children[1]->evaluate() == 0)
-        this->eval = this->children[0]->evaluate();
-      else
-        this->eval = ((((op1Signed % op2Signed) + op2Signed) % op2Signed).convert_to<triton::uint512>() & this->getBitvectorMask());
+      /* Native evaluation (the sign extended operands cannot overflow) */
+      if (this->size < 64) {
+        triton::sint64 op1 = triton::ast::signExtend64(this->children[0]->evaluate64(), this->size);
+        triton::sint64 op2 = triton::ast::signExtend64(this->children[1]->evaluate64(), this->size);
+
+        if (op2 == 0)
+          this->setEval(this->children[0]->evaluate64());
+        else
+          this->setEval(static_cast<triton::uint64>(((op1 % op2) + op2) % op2) & this->getBitvectorMask64());
+      }
+
+      else {
+        /* Sign extend */
+        op1Signed = triton::ast::modularSignExtend(this->children[0].get());
+        op2Signed = triton::ast::modularSignExtend(this->children[1].get());
+
+        if (this->children[1]->evaluate() == 0)
+          this->setEval(this->children[0]->evaluate());
+        else
+          this->setEval((((op1Signed % op2Signed) + op2Signed) % op2Signed).convert_to<triton::uint512>() & this->getBitvectorMask());
+      }
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 BvsmodNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void BvsmodNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::hash2n(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = triton::ast::hashMix(this->hash, this->children[index]->getHash());
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -1126,7 +1678,7 @@ namespace triton {
     }
 
 
-    void BvsremNode::init(void) {
+    void BvsremNode::init(bool withParents) {
       triton::sint512 op1Signed = 0;
       triton::sint512 op2Signed = 0;
 
@@ -1136,35 +1688,57 @@ namespace triton {
       if (this->children[0]->getBitvectorSize() != this->children[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsremNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->children[0].get());
-      op2Signed = triton::ast::modularSignExtend(this->children[1].get());
-
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
 
-      if (this->children[1]->evaluate() == 0)
-        this->eval = this->children[0]->evaluate();
-      else
-        this->eval = ((op1Signed - ((op1Signed / op2Signed) * op2Signed)).convert_to<triton::uint512>() & this->getBitvectorMask());
+      /* Native evaluation (the sign extended operands cannot overflow) */
+      if (this->size < 64) {
+        triton::sint64 op1 = triton::ast::signExtend64(this->children[0]->evaluate64(), this->size);
+        triton::sint64 op2 = triton::ast::signExtend64(this->children[1]->evaluate64(), this->size);
+
+        if (op2 == 0)
+          this->setEval(this->children[0]->evaluate64());
+        else
+          this->setEval(static_cast<triton::uint64>(op1 % op2) & this->getBitvectorMask64());
+      }
+
+      else {
+        /* Sign extend */
+        op1Signed = triton::ast::modularSignExtend(this->children[0].get());
+        op2Signed = triton::ast::modularSignExtend(this->children[1].get());
+
+        if (this->children[1]->evaluate() == 0)
+          this->setEval(this->children[0]->evaluate());
+        else
+          this->setEval((op1Signed - ((op1Signed / op2Signed) * op2Signed)).convert_to<triton::uint512>() & this->getBitvectorMask());
+      }
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 BvsremNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void BvsremNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::hash2n(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = triton::ast::hashMix(this->hash, this->children[index]->getHash());
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -1177,7 +1751,7 @@ namespace triton {
     }
 
 
-    void BvsubNode::init(void) {
+    void BvsubNode::init(bool withParents) {
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("BvsubNode::init(): Must take at least two children.");
 
@@ -1186,25 +1760,37 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
-      this->eval = ((this->children[0]->evaluate() - this->children[1]->evaluate()) & this->getBitvectorMask());
+      if (this->size <= 64)
+        this->setEval((this->children[0]->evaluate64() - this->children[1]->evaluate64()) & this->getBitvectorMask64());
+      else
+        this->setEval((this->children[0]->evaluate() - this->children[1]->evaluate()) & this->getBitvectorMask());
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 BvsubNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void BvsubNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::hash2n(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = triton::ast::hashMix(this->hash, this->children[index]->getHash());
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -1217,7 +1803,7 @@ namespace triton {
     }
 
 
-    void BvudivNode::init(void) {
+    void BvudivNode::init(bool withParents) {
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("BvudivNode::init(): Must take at least two children.");
 
@@ -1227,28 +1813,41 @@ namespace triton {
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
 
-      if (this->children[1]->evaluate() == 0)
-        this->eval = (-1 & this->getBitvectorMask());
+      if (this->size <= 64) {
+        triton::uint64 op2 = this->children[1]->evaluate64();
+        this->setEval(op2 == 0 ? this->getBitvectorMask64() : (this->children[0]->evaluate64() / op2));
+      }
+      else if (this->children[1]->evaluate() == 0)
+        this->setEval(this->getBitvectorMask());
       else
-        this->eval = (this->children[0]->evaluate() / this->children[1]->evaluate());
+        this->setEval(this->children[0]->evaluate() / this->children[1]->evaluate());
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 BvudivNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void BvudivNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::hash2n(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = triton::ast::hashMix(this->hash, this->children[index]->getHash());
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -1261,7 +1860,7 @@ namespace triton {
     }
 
 
-    void BvugeNode::init(void) {
+    void BvugeNode::init(bool withParents) {
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("BvugeNode::init(): Must take at least two children.");
 
@@ -1270,25 +1869,37 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->children[0]->evaluate() >= this->children[1]->evaluate());
+      if (this->children[0]->getBitvectorSize() <= 64)
+        this->setEval(this->children[0]->evaluate64() >= this->children[1]->evaluate64());
+      else
+        this->setEval(this->children[0]->evaluate() >= this->children[1]->evaluate());
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 BvugeNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void BvugeNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::hash2n(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = triton::ast::hashMix(this->hash, this->children[index]->getHash());
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -1301,7 +1912,7 @@ namespace triton {
     }
 
 
-    void BvugtNode::init(void) {
+    void BvugtNode::init(bool withParents) {
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("BvugtNode::init(): Must take at least two children.");
 
@@ -1310,25 +1921,37 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->children[0]->evaluate() > this->children[1]->evaluate());
+      if (this->children[0]->getBitvectorSize() <= 64)
+        this->setEval(this->children[0]->evaluate64() > this->children[1]->evaluate64());
+      else
+        this->setEval(this->children[0]->evaluate() > this->children[1]->evaluate());
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 BvugtNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void BvugtNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::hash2n(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = triton::ast::hashMix(this->hash, this->children[index]->getHash());
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -1341,7 +1964,7 @@ namespace triton {
     }
 
 
-    void BvuleNode::init(void) {
+    void BvuleNode::init(bool withParents) {
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("BvuleNode::init(): Must take at least two children.");
 
@@ -1350,25 +1973,37 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->children[0]->evaluate() <= this->children[1]->evaluate());
+      if (this->children[0]->getBitvectorSize() <= 64)
+        this->setEval(this->children[0]->evaluate64() <= this->children[1]->evaluate64());
+      else
+        this->setEval(this->children[0]->evaluate() <= this->children[1]->evaluate());
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 BvuleNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void BvuleNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::hash2n(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = triton::ast::hashMix(this->hash, this->children[index]->getHash());
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -1381,7 +2016,7 @@ namespace triton {
     }
 
 
-    void BvultNode::init(void) {
+    void BvultNode::init(bool withParents) {
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("BvultNode::init(): Must take at least two children.");
 
@@ -1390,25 +2025,37 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->children[0]->evaluate() < this->children[1]->evaluate());
+      if (this->children[0]->getBitvectorSize() <= 64)
+        this->setEval(this->children[0]->evaluate64() < this->children[1]->evaluate64());
+      else
+        this->setEval(this->children[0]->evaluate() < this->children[1]->evaluate());
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 BvultNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void BvultNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::hash2n(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = triton::ast::hashMix(this->hash, this->children[index]->getHash());
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -1421,7 +2068,7 @@ namespace triton {
     }
 
 
-    void BvuremNode::init(void) {
+    void BvuremNode::init(bool withParents) {
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("BvuremNode::init(): Must take at least two children.");
 
@@ -1431,28 +2078,41 @@ namespace triton {
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
 
-      if (this->children[1]->evaluate() == 0)
-        this->eval = this->children[0]->evaluate();
+      if (this->size <= 64) {
+        triton::uint64 op2 = this->children[1]->evaluate64();
+        this->setEval(op2 == 0 ? this->children[0]->evaluate64() : (this->children[0]->evaluate64() % op2));
+      }
+      else if (this->children[1]->evaluate() == 0)
+        this->setEval(this->children[0]->evaluate());
       else
-        this->eval = (this->children[0]->evaluate() % this->children[1]->evaluate());
+        this->setEval(this->children[0]->evaluate() % this->children[1]->evaluate());
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 BvuremNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void BvuremNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::hash2n(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = triton::ast::hashMix(this->hash, this->children[index]->getHash());
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -1465,7 +2125,7 @@ namespace triton {
     }
 
 
-    void BvxnorNode::init(void) {
+    void BvxnorNode::init(bool withParents) {
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("BvxnorNode::init(): Must take at least two children.");
 
@@ -1474,25 +2134,37 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
-      this->eval = (~(this->children[0]->evaluate() ^ this->children[1]->evaluate()) & this->getBitvectorMask());
+      if (this->size <= 64)
+        this->setEval(~(this->children[0]->evaluate64() ^ this->children[1]->evaluate64()) & this->getBitvectorMask64());
+      else
+        this->setEval(~(this->children[0]->evaluate() ^ this->children[1]->evaluate()) & this->getBitvectorMask());
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 BvxnorNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void BvxnorNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * this->children[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = this->hash * (this->children[index]->getHash() | 1);
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -1505,7 +2177,7 @@ namespace triton {
     }
 
 
-    void BvxorNode::init(void) {
+    void BvxorNode::init(bool withParents) {
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("BvxorNode::init(): Must take at least two children.");
 
@@ -1514,25 +2186,37 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
-      this->eval = (this->children[0]->evaluate() ^ this->children[1]->evaluate());
+      if (this->size <= 64)
+        this->setEval(this->children[0]->evaluate64() ^ this->children[1]->evaluate64());
+      else
+        this->setEval(this->children[0]->evaluate() ^ this->children[1]->evaluate());
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 BvxorNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void BvxorNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * this->children[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = this->hash * (this->children[index]->getHash() | 1);
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -1545,7 +2229,7 @@ namespace triton {
     }
 
 
-    void BvNode::init(void) {
+    void BvNode::init(bool withParents) {
       triton::uint512 value = 0;
       triton::uint32 size   = 0;
 
@@ -1566,32 +2250,41 @@ namespace triton {
 
       /* Init attributes */
       this->size = size;
-      this->eval = (value & this->getBitvectorMask());
+      this->setEval(value & this->getBitvectorMask());
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 BvNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void BvNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::hash2n(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = triton::ast::hashMix(this->hash, this->children[index]->getHash());
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
     /* ====== compound */
 
 
-    void CompoundNode::init(void) {
+    void CompoundNode::init(bool withParents) {
       if (this->children.size() < 1)
         throw triton::exceptions::Ast("CompoundNode::init(): Must take at least one child.");
 
@@ -1600,22 +2293,31 @@ namespace triton {
       this->eval = 0;
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 CompoundNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void CompoundNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::hash2n(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = triton::ast::hashMix(this->hash, this->children[index]->getHash());
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -1628,7 +2330,7 @@ namespace triton {
     }
 
 
-    void ConcatNode::init(void) {
+    void ConcatNode::init(bool withParents) {
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("ConcatNode::init(): Must take at least two children.");
 
@@ -1641,27 +2343,45 @@ namespace triton {
       if (this->size > MAX_BITS_SUPPORTED)
         throw triton::exceptions::Ast("ConcatNode::init(): Size connot be greater than MAX_BITS_SUPPORTED.");
 
-      this->eval = this->children[0]->evaluate();
-      for (triton::uint32 index = 0; index < this->children.size()-1; index++)
-        this->eval = ((this->eval << this->children[index+1]->getBitvectorSize()) | this->children[index+1]->evaluate());
+      if (this->size <= 64) {
+        triton::uint64 value = this->children[0]->evaluate64();
+        for (triton::uint32 index = 0; index < this->children.size()-1; index++)
+          value = ((value << this->children[index+1]->getBitvectorSize()) | this->children[index+1]->evaluate64());
+        this->setEval(value);
+      }
+      else {
+        triton::uint512 value = this->children[0]->evaluate();
+        for (triton::uint32 index = 0; index < this->children.size()-1; index++)
+          value = ((value << this->children[index+1]->getBitvectorSize()) | this->children[index+1]->evaluate());
+        this->setEval(value);
+      }
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 ConcatNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void ConcatNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::hash2n(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = triton::ast::hashMix(this->hash, this->children[index]->getHash());
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -1673,7 +2393,7 @@ namespace triton {
     }
 
 
-    void DeclareNode::init(void) {
+    void DeclareNode::init(bool withParents) {
       if (this->children.size() < 1)
         throw triton::exceptions::Ast("DeclareNode::init(): Must take at least one child.");
 
@@ -1682,25 +2402,37 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
-      this->eval = this->children[0]->evaluate();
+      if (this->size <= 64)
+        this->setEval(this->children[0]->evaluate64());
+      else
+        this->setEval(this->children[0]->evaluate());
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 DeclareNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void DeclareNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::hash2n(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = triton::ast::hashMix(this->hash, this->children[index]->getHash());
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -1713,7 +2445,7 @@ namespace triton {
     }
 
 
-    void DistinctNode::init(void) {
+    void DistinctNode::init(bool withParents) {
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("DistinctNode::init(): Must take at least two children.");
 
@@ -1722,25 +2454,37 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->children[0]->evaluate() != this->children[1]->evaluate());
+      if (this->children[0]->getBitvectorSize() <= 64)
+        this->setEval(this->children[0]->evaluate64() != this->children[1]->evaluate64());
+      else
+        this->setEval(this->children[0]->evaluate() != this->children[1]->evaluate());
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 DistinctNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void DistinctNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * this->children[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = this->hash * (this->children[index]->getHash() | 1);
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -1753,7 +2497,7 @@ namespace triton {
     }
 
 
-    void EqualNode::init(void) {
+    void EqualNode::init(bool withParents) {
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("EqualNode::init(): Must take at least two children.");
 
@@ -1762,25 +2506,37 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->children[0]->evaluate() == this->children[1]->evaluate());
+      if (this->children[0]->getBitvectorSize() <= 64)
+        this->setEval(this->children[0]->evaluate64() == this->children[1]->evaluate64());
+      else
+        this->setEval(this->children[0]->evaluate() == this->children[1]->evaluate());
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 EqualNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void EqualNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * this->children[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = this->hash * (this->children[index]->getHash() | 1);
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -1794,7 +2550,7 @@ namespace triton {
     }
 
 
-    void ExtractNode::init(void) {
+    void ExtractNode::init(bool withParents) {
       triton::uint32 high = 0;
       triton::uint32 low  = 0;
 
@@ -1812,28 +2568,40 @@ namespace triton {
 
       /* Init attributes */
       this->size = ((high - low) + 1);
-      this->eval = ((this->children[2]->evaluate() >> low) & this->getBitvectorMask());
+      if (this->children[2]->getBitvectorSize() <= 64)
+        this->setEval((this->children[2]->evaluate64() >> low) & this->getBitvectorMask64());
+      else
+        this->setEval((this->children[2]->evaluate() >> low) & this->getBitvectorMask());
 
       if (this->size > this->children[2]->getBitvectorSize() || high >= this->children[2]->getBitvectorSize())
         throw triton::exceptions::Ast("ExtractNode::init(): The size of the extraction is higher than the child expression.");
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 ExtractNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void ExtractNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::hash2n(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = triton::ast::hashMix(this->hash, this->children[index]->getHash());
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -1846,7 +2614,7 @@ namespace triton {
     }
 
 
-    void IffNode::init(void) {
+    void IffNode::init(bool withParents) {
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("IffNode::init(): Must take at least two children.");
 
@@ -1857,29 +2625,38 @@ namespace triton {
         throw triton::exceptions::Ast("IffNode::init(): Must take a logical node as second argument.");
 
       /* Init attributes */
-      triton::uint512 P = this->children[0]->evaluate();
-      triton::uint512 Q = this->children[1]->evaluate();
+      triton::uint64 P = this->children[0]->evaluate64();
+      triton::uint64 Q = this->children[1]->evaluate64();
 
       this->size = 1;
-      this->eval = (P && Q) || (!P && !Q);
+      this->setEval((P && Q) || (!P && !Q));
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 IffNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void IffNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::hash2n(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = triton::ast::hashMix(this->hash, this->children[index]->getHash());
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -1891,14 +2668,18 @@ namespace triton {
     }
 
 
-    void IntegerNode::init(void) {
+    void IntegerNode::init(bool withParents) {
       /* Init attributes */
       this->eval        = 0;
       this->size        = 0;
       this->symbolized  = false;
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
@@ -1907,9 +2688,8 @@ namespace triton {
     }
 
 
-    triton::uint512 IntegerNode::hash(triton::uint32 deep) const {
-      triton::uint512 hash = this->type ^ this->value;
-      return hash;
+    void IntegerNode::initHash(void) {
+      this->hash = this->type ^ triton::ast::fold64(this->value);
     }
 
 
@@ -1923,7 +2703,7 @@ namespace triton {
     }
 
 
-    void IteNode::init(void) {
+    void IteNode::init(bool withParents) {
       if (this->children.size() < 3)
         throw triton::exceptions::Ast("IteNode::init(): Must take at least three children.");
 
@@ -1935,25 +2715,37 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->children[1]->getBitvectorSize();
-      this->eval = this->children[0]->evaluate() ? this->children[1]->evaluate() : this->children[2]->evaluate();
+      if (this->size <= 64)
+        this->setEval(this->children[0]->evaluate64() ? this->children[1]->evaluate64() : this->children[2]->evaluate64());
+      else
+        this->setEval(this->children[0]->evaluate64() ? this->children[1]->evaluate() : this->children[2]->evaluate());
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 IteNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void IteNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::hash2n(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = triton::ast::hashMix(this->hash, this->children[index]->getHash());
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -1966,35 +2758,44 @@ namespace triton {
     }
 
 
-    void LandNode::init(void) {
+    void LandNode::init(bool withParents) {
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("LandNode::init(): Must take at least two children.");
 
       /* Init attributes */
       this->size = 1;
-      this->eval = 1;
+      this->setEval(1);
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
-        this->eval = this->eval && this->children[index]->evaluate();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
+        this->eval = this->eval && this->children[index]->evaluate64();
 
         if (this->children[index]->isLogical() == false)
           throw triton::exceptions::Ast("LandNode::init(): Must take logical nodes as arguments.");
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 LandNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void LandNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * this->children[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = this->hash * (this->children[index]->getHash() | 1);
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -2008,7 +2809,7 @@ namespace triton {
     }
 
 
-    void LetNode::init(void) {
+    void LetNode::init(bool withParents) {
       if (this->children.size() < 3)
         throw triton::exceptions::Ast("LetNode::init(): Must take at least three children.");
 
@@ -2017,25 +2818,37 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->children[2]->getBitvectorSize();
-      this->eval = this->children[2]->evaluate();
+      if (this->size <= 64)
+        this->setEval(this->children[2]->evaluate64());
+      else
+        this->setEval(this->children[2]->evaluate());
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 LetNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void LetNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::hash2n(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = triton::ast::hashMix(this->hash, this->children[index]->getHash());
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -2047,35 +2860,44 @@ namespace triton {
     }
 
 
-    void LnotNode::init(void) {
+    void LnotNode::init(bool withParents) {
       if (this->children.size() < 1)
         throw triton::exceptions::Ast("LnotNode::init(): Must take at least one child.");
 
       /* Init attributes */
       this->size = 1;
-      this->eval = !(this->children[0]->evaluate());
+      this->setEval(!(this->children[0]->evaluate64()));
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
 
         if (this->children[index]->isLogical() == false)
           throw triton::exceptions::Ast("LnotNode::init(): Must take logical nodes arguments.");
       }
 
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 LnotNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void LnotNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * this->children[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = this->hash * (this->children[index]->getHash() | 1);
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -2088,35 +2910,44 @@ namespace triton {
     }
 
 
-    void LorNode::init(void) {
+    void LorNode::init(bool withParents) {
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("LorNode::init(): Must take at least two children.");
 
       /* Init attributes */
       this->size = 1;
-      this->eval = 0;
+      this->setEval(0);
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
-        this->eval = this->eval || this->children[index]->evaluate();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
+        this->eval = this->eval || this->children[index]->evaluate64();
 
         if (this->children[index]->isLogical() == false)
           throw triton::exceptions::Ast("LorNode::init(): Must take logical nodes as arguments.");
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 LorNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void LorNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * this->children[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = this->hash * (this->children[index]->getHash() | 1);
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -2129,23 +2960,31 @@ namespace triton {
     }
 
 
-    void ReferenceNode::init(void) {
+    void ReferenceNode::init(bool withParents) {
       /* Init attributes */
-      this->eval        = this->expr->getAst()->evaluate();
       this->logical     = this->expr->getAst()->isLogical();
       this->size        = this->expr->getAst()->getBitvectorSize();
       this->symbolized  = this->expr->getAst()->isSymbolized();
+      this->level       = 1 + this->expr->getAst()->getLevel();
+
+      if (this->size <= 64)
+        this->setEval(this->expr->getAst()->evaluate64());
+      else
+        this->setEval(this->expr->getAst()->evaluate());
 
       this->expr->getAst()->setParent(this);
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 ReferenceNode::hash(triton::uint32 deep) const {
-      triton::uint512 hash = this->type ^ this->expr->getId();
-      return hash;
+    void ReferenceNode::initHash(void) {
+      this->hash = this->type ^ this->expr->getId();
     }
 
 
@@ -2162,14 +3001,18 @@ namespace triton {
     }
 
 
-    void StringNode::init(void) {
+    void StringNode::init(bool withParents) {
       /* Init attributes */
       this->eval        = 0;
       this->size        = 0;
       this->symbolized  = false;
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
@@ -2178,12 +3021,12 @@ namespace triton {
     }
 
 
-    triton::uint512 StringNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type;
-      triton::uint32 index = 1;
+    void StringNode::initHash(void) {
+      this->hash = this->type;
       for (std::string::const_iterator it=this->value.cbegin(); it != this->value.cend(); it++)
-        h = h ^ triton::ast::hash2n(*it, index++);
-      return triton::ast::rotl(h, deep);
+        this->hash = triton::ast::hashMix(this->hash, static_cast<triton::uint8>(*it));
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -2196,7 +3039,7 @@ namespace triton {
     }
 
 
-    void SxNode::init(void) {
+    void SxNode::init(bool withParents) {
       triton::uint32 sizeExt = 0;
 
       if (this->children.size() < 2)
@@ -2212,25 +3055,37 @@ namespace triton {
       if (size > MAX_BITS_SUPPORTED)
         throw triton::exceptions::Ast("SxNode::SxNode(): Size connot be greater than MAX_BITS_SUPPORTED.");
 
-      this->eval = ((((this->children[1]->evaluate() >> (this->children[1]->getBitvectorSize()-1)) == 0) ? this->children[1]->evaluate() : (this->children[1]->evaluate() | ~(this->children[1]->getBitvectorMask()))) & this->getBitvectorMask());
+      if (this->size <= 64)
+        this->setEval(static_cast<triton::uint64>(triton::ast::signExtend64(this->children[1]->evaluate64(), this->children[1]->getBitvectorSize())) & this->getBitvectorMask64());
+      else
+        this->setEval((((this->children[1]->evaluate() >> (this->children[1]->getBitvectorSize()-1)) == 0) ? this->children[1]->evaluate() : (this->children[1]->evaluate() | ~(this->children[1]->getBitvectorMask()))) & this->getBitvectorMask());
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 SxNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void SxNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::hash2n(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = triton::ast::hashMix(this->hash, this->children[index]->getHash());
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -2244,13 +3099,17 @@ namespace triton {
     }
 
 
-    void VariableNode::init(void) {
+    void VariableNode::init(bool withParents) {
       this->size        = this->symVar->getSize();
-      this->eval        = ctxt.getVariableValue(this->symVar->getName()) & this->getBitvectorMask();
+      this->setEval(ctxt.getVariableValue(this->symVar->getId()) & this->getBitvectorMask());
       this->symbolized  = true;
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
@@ -2259,14 +3118,10 @@ namespace triton {
     }
 
 
-    triton::uint512 VariableNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type;
-      triton::uint32 index = 1;
+    void VariableNode::initHash(void) {
+      this->hash = triton::ast::hashMix(this->type, this->symVar->getId());
 
-      for (char c : this->symVar->getName())
-        h = h ^ triton::ast::hash2n(c, index++);
-
-      return triton::ast::rotl(h, deep);
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
 
@@ -2279,7 +3134,7 @@ namespace triton {
     }
 
 
-    void ZxNode::init(void) {
+    void ZxNode::init(bool withParents) {
       triton::uint32 sizeExt = 0;
 
       if (this->children.size() < 2)
@@ -2295,25 +3150,37 @@ namespace triton {
       if (size > MAX_BITS_SUPPORTED)
         throw triton::exceptions::Ast("ZxNode::init(): Size connot be greater than MAX_BITS_SUPPORTED.");
 
-      this->eval = (this->children[1]->evaluate() & this->getBitvectorMask());
+      if (this->size <= 64)
+        this->setEval(this->children[1]->evaluate64() & this->getBitvectorMask64());
+      else
+        this->setEval(this->children[1]->evaluate() & this->getBitvectorMask());
 
       /* Init children and spread information */
+      this->linkChildren();
+      this->level = 1;
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      /* Init the hash */
+      this->initHash();
+
       /* Init parents */
-      this->initParents();
+      if (withParents)
+        this->initParents();
     }
 
 
-    triton::uint512 ZxNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->type, s = this->children.size();
-      if (s) h = h * s;
+    void ZxNode::initHash(void) {
+      triton::uint64 s = this->children.size();
+
+      this->hash = this->type;
+      if (s) this->hash = this->hash * s;
       for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::hash2n(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+        this->hash = triton::ast::hashMix(this->hash, this->children[index]->getHash());
+
+      this->hash = triton::ast::rotl(this->hash, this->level);
     }
 
   }; /* ast namespace */
@@ -2360,18 +3227,40 @@ namespace triton {
 namespace triton {
   namespace ast {
 
-    triton::uint512 hash2n(triton::uint512 hash, triton::uint32 n) {
-      triton::uint512 mask = -1;
-      for (triton::uint32 i = 0; i < n; i++)
-        hash = ((hash * hash) & mask);
-      return hash;
+    triton::uint64 hashMix(triton::uint64 seed, triton::uint64 value) {
+      /* Combine both values then apply the splitmix64 finalizer */
+      triton::uint64 hash = seed ^ (value + 0x9e3779b97f4a7c15 + (seed << 6) + (seed >> 2));
+      hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9;
+      hash = (hash ^ (hash >> 27)) * 0x94d049bb133111eb;
+      return hash ^ (hash >> 31);
     }
 
 
-    triton::uint512 rotl(triton::uint512 value, triton::uint32 shift) {
-      if ((shift &= 511) == 0)
+    triton::uint64 rotl(triton::uint64 value, triton::uint32 shift) {
+      if ((shift &= 63) == 0)
         return value;
-      return ((value << shift) | (value >> (512 - shift)));
+      return ((value << shift) | (value >> (64 - shift)));
+    }
+
+
+    triton::uint64 fold64(triton::uint512 value) {
+      triton::uint64 hash = 0;
+      while (value != 0) {
+        hash = (hash ^ static_cast<triton::uint64>(value & 0xffffffffffffffff)) * 0x100000001b3;
+        value >>= 64;
+      }
+      return hash;
+    }
+
+
+    triton::sint64 signExtend64(triton::uint64 value, triton::uint32 size) {
+      if (size == 0 || size >= 64)
+        return static_cast<triton::sint64>(value);
+
+      triton::uint64 sign = (static_cast<triton::uint64>(1) << (size - 1));
+      value &= ((static_cast<triton::uint64>(1) << size) - 1);
+
+      return static_cast<triton::sint64>((value ^ sign) - sign);
     }
 
 
@@ -2399,12 +3288,10 @@ namespace triton {
 namespace triton {
   namespace ast {
 
-    SharedAbstractNode newInstance(AbstractNode* node, bool unroll) {
+    /* Returns a copy of the node, without parents and not interned */
+    static SharedAbstractNode copyNode(AbstractNode* node) {
       SharedAbstractNode newNode = nullptr;
 
-      if (node == nullptr)
-        return nullptr;
-
       switch (node->getType()) {
         case ASSERT_NODE:               newNode = std::make_shared<AssertNode>(*reinterpret_cast<AssertNode*>(node));     break;
         case BVADD_NODE:                newNode = std::make_shared<BvaddNode>(*reinterpret_cast<BvaddNode*>(node));       break;
@@ -2450,26 +3337,35 @@ namespace triton {
         case LET_NODE:                  newNode = std::make_shared<LetNode>(*reinterpret_cast<LetNode*>(node));           break;
         case LNOT_NODE:                 newNode = std::make_shared<LnotNode>(*reinterpret_cast<LnotNode*>(node));         break;
         case LOR_NODE:                  newNode = std::make_shared<LorNode>(*reinterpret_cast<LorNode*>(node));           break;
-        case REFERENCE_NODE: {
-          if (unroll)
-            return triton::ast::newInstance(reinterpret_cast<ReferenceNode*>(node)->getSymbolicExpression()->getAst().get(), unroll);
-          else
-            newNode = std::make_shared<ReferenceNode>(*reinterpret_cast<ReferenceNode*>(node));
-          break;
-        }
+        case REFERENCE_NODE:            newNode = std::make_shared<ReferenceNode>(*reinterpret_cast<ReferenceNode*>(node)); break;
         case STRING_NODE:               newNode = std::make_shared<StringNode>(*reinterpret_cast<StringNode*>(node));     break;
         case SX_NODE:                   newNode = std::make_shared<SxNode>(*reinterpret_cast<SxNode*>(node));             break;
         case VARIABLE_NODE:             newNode = std::make_shared<VariableNode>(*reinterpret_cast<VariableNode*>(node)); break;
         case ZX_NODE:                   newNode = std::make_shared<ZxNode>(*reinterpret_cast<ZxNode*>(node));             break;
         default:
-          throw triton::exceptions::Ast("triton::ast::newInstance(): Invalid type node.");
+          throw triton::exceptions::Ast("triton::ast::copyNode(): Invalid type node.");
       }
 
       if (newNode == nullptr)
-        throw triton::exceptions::Ast("triton::ast::newInstance(): No enough memory.");
+        throw triton::exceptions::Ast("triton::ast::copyNode(): No enough memory.");
 
       /* Remove parents as this is a new node which has no connections with original AST */
       newNode->getParents().clear();
+      newNode->setInterned(false);
+      newNode->setSharedConstant(false);
+
+      return newNode;
+    }
+
+
+    SharedAbstractNode newInstance(AbstractNode* node, bool unroll) {
+      if (node == nullptr)
+        return nullptr;
+
+      if (unroll && node->getType() == REFERENCE_NODE)
+        return triton::ast::newInstance(reinterpret_cast<ReferenceNode*>(node)->getSymbolicExpression()->getAst().get(), unroll);
+
+      SharedAbstractNode newNode = triton::ast::copyNode(node);
 
       /* Create new instances of children and set their new parents */
       auto& children = newNode->getChildren();
@@ -2482,58 +3378,96 @@ namespace triton {
     }
 
 
+    SharedAbstractNode shallowCopy(AbstractNode* node) {
+      if (node == nullptr)
+        return nullptr;
+
+      SharedAbstractNode newNode = triton::ast::copyNode(node);
+
+      /* The children are shared with the original node */
+      for (auto& child : newNode->getChildren())
+        child->setParent(newNode.get());
+
+      return newNode;
+    }
+
+
     SharedAbstractNode unrollAst(const triton::ast::SharedAbstractNode& node) {
       return triton::ast::newInstance(node.get(), true);
     }
 
 
-    void nodesExtraction(std::deque<SharedAbstractNode>* output, const SharedAbstractNode& node, bool unroll, bool revert) {
-      std::unordered_map<triton::usize, std::set<SharedAbstractNode>> sortedlist;
-      std::deque<std::pair<SharedAbstractNode,triton::usize>> worklist;
-      triton::usize depth = 0;
+    void postOrderTraversal(const SharedAbstractNode& node, bool unroll, const std::function<void(const SharedAbstractNode&)>& visit, const std::function<bool(const SharedAbstractNode&)>& skip) {
+      std::vector<std::pair<const SharedAbstractNode*, bool>> worklist;
+      std::unordered_set<const AbstractNode*> visited;
 
       if (node == nullptr)
-        throw triton::exceptions::Ast("triton::ast::nodesExtraction(): Node cannot be null.");
+        throw triton::exceptions::Ast("triton::ast::postOrderTraversal(): Node cannot be null.");
 
       /*
        *  We use a worklist strategy to avoid recursive calls
        *  and so stack overflow when going through a big AST.
+       *  A node is expanded once, so the traversal is linear
+       *  in the number of nodes and edges of the DAG.
        */
-      worklist.push_back({node, 0});
+      worklist.push_back({&node, false});
       while (worklist.empty() == false) {
-        auto ast = worklist.front().first;
-        auto lvl = worklist.front().second;
-        worklist.pop_front();
-
-        /* Keep up-to-date the depth of the tree */
-        depth = std::max(depth, lvl);
+        auto item = worklist.back();
+        worklist.pop_back();
 
-        /* Proceed children */
-        for (const auto& child : ast->getChildren()) {
-          if (std::find(worklist.begin(), worklist.end(), std::make_pair(child, lvl + 1)) == worklist.end()) {
-            worklist.push_back({child, lvl + 1});
-          }
+        /* All children have been visited */
+        if (item.second) {
+          visit(*item.first);
+          continue;
         }
 
+        if (visited.insert(item.first->get()).second == false)
+          continue;
+
+        if (skip && skip(*item.first))
+          continue;
+
+        worklist.push_back({item.first, true});
+
         /* If unroll is true, we unroll all references */
-        if (unroll == true && ast->getType() == REFERENCE_NODE) {
-          const auto& ref = reinterpret_cast<ReferenceNode*>(ast.get())->getSymbolicExpression()->getAst();
-          if (std::find(worklist.begin(), worklist.end(), std::make_pair(ref, lvl + 1)) == worklist.end()) {
-            worklist.push_back({ref, lvl + 1});
-          }
+        if (unroll == true && (*item.first)->getType() == REFERENCE_NODE) {
+          const auto& ref = reinterpret_cast<ReferenceNode*>(item.first->get())->getSymbolicExpression()->getAst();
+          if (visited.find(ref.get()) == visited.end())
+            worklist.push_back({&ref, false});
         }
 
-        sortedlist[lvl].insert(ast);
+        /* Children are pushed in reverse order to be visited from the first one */
+        const auto& children = (*item.first)->getChildren();
+        for (auto it = children.rbegin(); it != children.rend(); it++) {
+          if (visited.find(it->get()) == visited.end())
+            worklist.push_back({&(*it), false});
+        }
       }
+    }
 
-      /* Sort nodes into the output list */
-      for (triton::usize index = 0; index <= depth; index++) {
-        auto& nodes = revert ? sortedlist[depth - index] : sortedlist[index];
-        for (auto&& n : nodes) {
-          if (std::find(output->begin(), output->end(), n) == output->end()) {
-            output->push_back(n);
-          }
-        }
+
+    std::vector<SharedAbstractNode> childrenExtraction(const SharedAbstractNode& node, bool unroll, bool revert) {
+      std::vector<SharedAbstractNode> result;
+
+      postOrderTraversal(node, unroll, [&result](const SharedAbstractNode& n) { result.push_back(n); });
+
+      /* A post order puts children on top of the list */
+      if (revert == false)
+        std::reverse(result.begin(), result.end());
+
+      return result;
+    }
+
+
+    void nodesExtraction(std::deque<SharedAbstractNode>* output, const SharedAbstractNode& node, bool unroll, bool revert) {
+      std::unordered_set<const AbstractNode*> known(output->size());
+
+      for (const auto& n : *output)
+        known.insert(n.get());
+
+      for (auto&& n : childrenExtraction(node, unroll, revert)) {
+        if (known.insert(n.get()).second)
+          output->push_back(n);
       }
     }
 
@@ -2541,7 +3475,7 @@ namespace triton {
     std::deque<SharedAbstractNode> lookingForNodes(const SharedAbstractNode& node, triton::ast::ast_e match) {
       std::stack<triton::ast::AbstractNode*>      worklist;
       std::deque<triton::ast::SharedAbstractNode> result;
-      std::set<const triton::ast::AbstractNode*>  visited;
+      std::unordered_set<const triton::ast::AbstractNode*> visited;
 
       worklist.push(node.get());
       while (!worklist.empty()) {
@@ -2549,11 +3483,10 @@ namespace triton {
         worklist.pop();
 
         // This means that node is already in work_stack and we will not need to convert it second time
-        if (visited.find(current) != visited.end()) {
+        if (visited.insert(current).second == false) {
           continue;
         }
 
-        visited.insert(current);
         if (match == triton::ast::ANY_NODE || current->getType() == match)
           result.push_front(current->shared_from_this());
 
@@ -2568,5 +3501,77 @@ namespace triton {
       return result;
     }
 
+    triton::uint512 evaluate(const SharedAbstractNode& node, const std::map<triton::usize, triton::uint512>& assignment) {
+      std::unordered_map<const AbstractNode*, SharedAbstractNode> copies;
+      std::vector<SharedAbstractNode> order;
+
+      if (node == nullptr)
+        throw triton::exceptions::Ast("triton::ast::evaluate(): Node cannot be null.");
+
+      /* The sub-ASTs without variable keep their value */
+      triton::ast::postOrderTraversal(node, true /* unroll */,
+        [&order](const SharedAbstractNode& n) { order.push_back(n); },
+        [](const SharedAbstractNode& n) { return !n->isSymbolized(); }
+      );
+
+      /*
+       * Only the nodes depending on a variable whose value changes are
+       * evaluated again. Each of them is copied and the copy computes its
+       * value with its own init() from the values of the copied children.
+       * The copies are not linked to their children, so the AST is left
+       * untouched.
+       */
+      for (const auto& n : order) {
+        switch (n->getType()) {
+          case VARIABLE_NODE: {
+            auto it = assignment.find(reinterpret_cast<VariableNode*>(n.get())->getSymbolicVariable()->getId());
+            if (it == assignment.end())
+              break;
+            triton::uint512 value = it->second & n->getBitvectorMask();
+            if (value == n->evaluate())
+              break;
+            SharedAbstractNode copy = triton::ast::copyNode(n.get());
+            copy->setEval(value);
+            copies[n.get()] = copy;
+            break;
+          }
+
+          /* A reference has the value of its expression */
+          case REFERENCE_NODE: {
+            auto it = copies.find(reinterpret_cast<ReferenceNode*>(n.get())->getSymbolicExpression()->getAst().get());
+            if (it != copies.end())
+              copies[n.get()] = it->second;
+            break;
+          }
+
+          default: {
+            SharedAbstractNode copy = nullptr;
+            auto& children = n->getChildren();
+            for (triton::usize index = 0; index < children.size(); index++) {
+              auto it = copies.find(children[index].get());
+              if (it == copies.end())
+                continue;
+              if (copy == nullptr) {
+                copy = triton::ast::copyNode(n.get());
+                copy->linked = true;
+              }
+              copy->children[index] = it->second;
+            }
+            if (copy != nullptr) {
+              copy->init(false);
+              copies[n.get()] = copy;
+            }
+            break;
+          }
+        }
+      }
+
+      auto it = copies.find(node.get());
+      if (it != copies.end())
+        return it->second->evaluate();
+
+      return node->evaluate();
+    }
+
   }; /* ast namespace */
 }; /* triton namespace */
@@ -5,6 +5,9 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
+#include <set>
+
 #include <triton/ast.hpp>
 #include <triton/astContext.hpp>
 #include <triton/exceptions.hpp>
@@ -18,18 +21,30 @@ namespace triton {
 
     AstContext::AstContext(triton::modes::Modes& modes)
       : modes(modes) {
+      this->rewritesThreshold = 1024;
+      this->uniqueTableThreshold = 1024;
+      this->constants.resize(MAX_BITS_SUPPORTED + 1);
     }
 
 
     AstContext::AstContext(const AstContext& other)
       : modes(other.modes),
         astRepresentation(other.astRepresentation),
-        valueMapping(other.valueMapping) {
+        valueMapping(other.valueMapping),
+        variableNames(other.variableNames) {
+      /* The unique table, the rewritings and the constants are not copied, nodes belong to their own context */
+      this->rewritesThreshold = 1024;
+      this->uniqueTableThreshold = 1024;
+      this->constants.resize(MAX_BITS_SUPPORTED + 1);
     }
 
 
     AstContext::~AstContext() {
+      this->constants.clear();
+      this->rewrites.clear();
+      this->uniqueTable.clear();
       this->valueMapping.clear();
+      this->variableNames.clear();
     }
 
 
@@ -37,24 +52,357 @@ namespace triton {
       this->astRepresentation = other.astRepresentation;
       this->modes = other.modes;
       this->valueMapping = other.valueMapping;
+      this->variableNames = other.variableNames;
+      this->rewrites.clear();
+      this->rewritesThreshold = 1024;
+      this->uniqueTable.clear();
+      this->uniqueTableThreshold = 1024;
+      this->constants.assign(MAX_BITS_SUPPORTED + 1, {});
       return *this;
     }
 
 
+    bool AstContext::isSameLabel(AbstractNode* node1, AbstractNode* node2) const {
+      if (node1->getType() != node2->getType())
+        return false;
+
+      if (node1->getBitvectorSize() != node2->getBitvectorSize())
+        return false;
+
+      if (node1->getChildren().size() != node2->getChildren().size())
+        return false;
+
+      /* Leaves */
+      switch (node1->getType()) {
+        case INTEGER_NODE:
+          return reinterpret_cast<IntegerNode*>(node1)->getInteger() == reinterpret_cast<IntegerNode*>(node2)->getInteger();
+
+        case REFERENCE_NODE:
+          return reinterpret_cast<ReferenceNode*>(node1)->getSymbolicExpression() == reinterpret_cast<ReferenceNode*>(node2)->getSymbolicExpression();
+
+        case STRING_NODE:
+          return reinterpret_cast<StringNode*>(node1)->getString() == reinterpret_cast<StringNode*>(node2)->getString();
+
+        case VARIABLE_NODE:
+          return reinterpret_cast<VariableNode*>(node1)->getSymbolicVariable() == reinterpret_cast<VariableNode*>(node2)->getSymbolicVariable();
+
+        default:
+          break;
+      }
+
+      return true;
+    }
+
+
+    bool AstContext::isSameNode(const SharedAbstractNode& node1, const SharedAbstractNode& node2) const {
+      if (!this->isSameLabel(node1.get(), node2.get()))
+        return false;
+
+      /* Children are already unique, so comparing their instances is enough */
+      for (triton::usize index = 0; index < node1->getChildren().size(); index++) {
+        if (node1->getChildren()[index] != node2->getChildren()[index])
+          return false;
+      }
+
+      return true;
+    }
+
+
+    bool AstContext::isSameTree(const SharedAbstractNode& node1, const SharedAbstractNode& node2) const {
+      std::vector<std::pair<AbstractNode*, AbstractNode*>> worklist;
+      std::set<std::pair<AbstractNode*, AbstractNode*>> visited;
+
+      worklist.push_back(std::make_pair(node1.get(), node2.get()));
+
+      while (!worklist.empty()) {
+        auto pair = worklist.back();
+        worklist.pop_back();
+
+        /* Shared subtrees and pairs already compared */
+        if (pair.first == pair.second || !visited.insert(pair).second)
+          continue;
+
+        /* The hash only discards the different trees quickly, it may collide */
+        if (pair.first->getHash() != pair.second->getHash() || !this->isSameLabel(pair.first, pair.second))
+          return false;
+
+        auto& children1 = pair.first->getChildren();
+        auto& children2 = pair.second->getChildren();
+        for (triton::usize index = 0; index < children1.size(); index++)
+          worklist.push_back(std::make_pair(children1[index].get(), children2[index].get()));
+      }
+
+      return true;
+    }
+
+
+    void AstContext::sweepUniqueTable(void) {
+      for (auto it = this->uniqueTable.begin(); it != this->uniqueTable.end();) {
+        if (it->second.expired())
+          it = this->uniqueTable.erase(it);
+        else
+          it++;
+      }
+
+      /* Amortize the next sweep on the number of live nodes */
+      this->uniqueTableThreshold = std::max<triton::usize>(1024, this->uniqueTable.size() * 2);
+    }
+
+
+    SharedAbstractNode AstContext::getUniqueNode(const SharedAbstractNode& node) {
+      if (!this->modes.isModeEnabled(triton::modes::AST_HASH_CONSING))
+        return node;
+
+      triton::uint64 key = node->getHash();
+      auto range = this->uniqueTable.equal_range(key);
+
+      for (auto it = range.first; it != range.second;) {
+        SharedAbstractNode other = it->second.lock();
+        if (other == nullptr) {
+          it = this->uniqueTable.erase(it);
+          continue;
+        }
+        if (this->isSameNode(node, other))
+          return other;
+        it++;
+      }
+
+      /* From now on, the node may be shared by unrelated trees */
+      node->setInterned(true);
+      this->uniqueTable.insert(std::make_pair(key, WeakAbstractNode(node)));
+
+      if (this->uniqueTable.size() >= this->uniqueTableThreshold)
+        this->sweepUniqueTable();
+
+      return node;
+    }
+
+
+    SharedAbstractNode* AstContext::getConstantSlot(const triton::uint512& value, triton::uint32 size) {
+      if (!this->modes.isModeEnabled(triton::modes::AST_CONSTANT_FOLDING) || size == 0 || size >= this->constants.size())
+        return nullptr;
+
+      triton::uint512 mask = (size == MAX_BITS_SUPPORTED ? triton::uint512(0) : (triton::uint512(1) << size)) - 1;
+      triton::uint512 v    = value & mask;
+
+      if (v == 0)
+        return &this->constants[size][0];
+
+      if (v == 1)
+        return &this->constants[size][1];
+
+      if (v == mask)
+        return &this->constants[size][2];
+
+      return nullptr;
+    }
+
+
+    SharedAbstractNode AstContext::foldNode(const SharedAbstractNode& node) {
+      if (this->modes.isModeEnabled(triton::modes::AST_CONSTANT_FOLDING) && !node->isSymbolized() && !node->isLogical())
+        return this->bv(node->evaluate(), node->getBitvectorSize());
+      return this->getUniqueNode(node);
+    }
+
+
+    SharedAbstractNode AstContext::mergeExtracts(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
+      if (expr1->getType() != EXTRACT_NODE || expr2->getType() != EXTRACT_NODE)
+        return nullptr;
+
+      const auto& children1 = expr1->getChildren();
+      const auto& children2 = expr2->getChildren();
+
+      triton::uint32 high1 = reinterpret_cast<IntegerNode*>(children1[0].get())->getInteger().convert_to<triton::uint32>();
+      triton::uint32 low1  = reinterpret_cast<IntegerNode*>(children1[1].get())->getInteger().convert_to<triton::uint32>();
+      triton::uint32 high2 = reinterpret_cast<IntegerNode*>(children2[0].get())->getInteger().convert_to<triton::uint32>();
+      triton::uint32 low2  = reinterpret_cast<IntegerNode*>(children2[1].get())->getInteger().convert_to<triton::uint32>();
+
+      if (low1 != high2 + 1 || !this->isSameTree(children1[2], children2[2]))
+        return nullptr;
+
+      return this->extract(high1, low2, children1[2]);
+    }
+
+
+    SharedAbstractNode AstContext::getRewrite(const RewriteKey& key) {
+      auto it = this->rewrites.find(key);
+      if (it == this->rewrites.end())
+        return nullptr;
+
+      /* An operand may have been freed (and its address reused) or modified in place since */
+      const AbstractNode* operands[] = {std::get<3>(key), std::get<4>(key), std::get<5>(key)};
+      SharedAbstractNode node = it->second.node.lock();
+
+      for (triton::usize index = 0; node != nullptr && index < 3; index++) {
+        if (operands[index] == nullptr)
+          continue;
+        SharedAbstractNode operand = it->second.operands[index].first.lock();
+        if (operand.get() != operands[index] || operand->getHash() != it->second.operands[index].second)
+          node = nullptr;
+      }
+
+      if (node == nullptr)
+        this->rewrites.erase(it);
+
+      return node;
+    }
+
+
+    void AstContext::setRewrite(const RewriteKey& key, const std::array<SharedAbstractNode, 3>& operands, const SharedAbstractNode& node) {
+      Rewrite& rewrite = this->rewrites[key];
+
+      for (triton::usize index = 0; index < 3; index++) {
+        if (operands[index] != nullptr)
+          rewrite.operands[index] = std::make_pair(WeakAbstractNode(operands[index]), operands[index]->getHash());
+      }
+      rewrite.node = node;
+
+      if (this->rewrites.size() >= this->rewritesThreshold)
+        this->sweepRewrites();
+    }
+
+
+    void AstContext::sweepRewrites(void) {
+      for (auto it = this->rewrites.begin(); it != this->rewrites.end();) {
+        const AbstractNode* operands[] = {std::get<3>(it->first), std::get<4>(it->first), std::get<5>(it->first)};
+        bool expired = it->second.node.expired();
+        for (triton::usize index = 0; index < 3; index++)
+          expired |= (operands[index] != nullptr && it->second.operands[index].first.expired());
+        if (expired)
+          it = this->rewrites.erase(it);
+        else
+          it++;
+      }
+
+      /* Amortize the next sweep on the number of live rewritings */
+      this->rewritesThreshold = std::max<triton::usize>(1024, this->rewrites.size() * 2);
+    }
+
+
+    SharedAbstractNode AstContext::rewriteExtract(triton::uint32 high, triton::uint32 low, const SharedAbstractNode& expr) {
+      /* The references are not followed, their expression may be assigned a new AST later */
+      switch (expr->getType()) {
+        /* Rewriting: extract(h, l, extract(h', l', A)) = extract(h + l', l + l', A) */
+        case EXTRACT_NODE: {
+          triton::uint32 offset = reinterpret_cast<IntegerNode*>(expr->getChildren()[1].get())->getInteger().convert_to<triton::uint32>();
+          return this->extract(high + offset, low + offset, expr->getChildren()[2]);
+        }
+
+        /* Rewriting: extract(h, l, concat(A, B)) = extract(h', l', A or B) if the bits come from one child */
+        case CONCAT_NODE: {
+          triton::uint32 offset = 0;
+          const auto& children = expr->getChildren();
+          for (auto it = children.rbegin(); it != children.rend(); it++) {
+            triton::uint32 size = (*it)->getBitvectorSize();
+            if (low < offset + size) {
+              if (high < offset + size)
+                return this->extract(high - offset, low - offset, *it);
+              break;
+            }
+            offset += size;
+          }
+          break;
+        }
+
+        /* Rewriting: extract(h, l, zx(n, A)) = extract(h, l, A), 0 or zx(h - size + 1, extract(size - 1, l, A)) */
+        case ZX_NODE: {
+          const auto& value = expr->getChildren()[1];
+          triton::uint32 size = value->getBitvectorSize();
+          if (high < size)
+            return this->extract(high, low, value);
+          if (low >= size)
+            return this->bv(0, high - low + 1);
+          return this->zx(high - size + 1, this->extract(size - 1, low, value));
+        }
+
+        /* Rewriting: extract(h, l, sx(n, A)) = extract(h, l, A) if h < size(A) */
+        case SX_NODE: {
+          const auto& value = expr->getChildren()[1];
+          if (high < value->getBitvectorSize())
+            return this->extract(high, low, value);
+          break;
+        }
+
+        default:
+          break;
+      }
+
+      return nullptr;
+    }
+
+
+    SharedAbstractNode AstContext::rewriteIte(const SharedAbstractNode& ifExpr, const SharedAbstractNode& thenExpr, const SharedAbstractNode& elseExpr) {
+      /* Rewriting: ite(true, A, B) = A and ite(false, A, B) = B */
+      if (!ifExpr->isSymbolized())
+        return ifExpr->evaluate() ? thenExpr : elseExpr;
+
+      /* Rewriting: ite(C, A, A) = A */
+      if (this->isSameTree(thenExpr, elseExpr))
+        return thenExpr;
+
+      return nullptr;
+    }
+
+
+    triton::usize AstContext::getUniqueTableSize(void) {
+      this->sweepUniqueTable();
+      return this->uniqueTable.size();
+    }
+
+
+    std::map<triton::ast::ast_e, triton::usize> AstContext::getNodeCensus(const SharedAbstractNode& node) const {
+      std::map<triton::ast::ast_e, triton::usize> census;
+
+      if (node == nullptr)
+        return census;
+
+      triton::ast::postOrderTraversal(node, true /* unroll */, [&census](const SharedAbstractNode& n) { census[n->getType()]++; });
+
+      return census;
+    }
+
+
+    triton::usize AstContext::getNodeMemorySize(const SharedAbstractNode& node) const {
+      triton::usize size = 0;
+
+      if (node == nullptr)
+        return size;
+
+      triton::ast::postOrderTraversal(node, true /* unroll */, [&size](const SharedAbstractNode& n) { size += n->getMemorySize(); });
+
+      return size;
+    }
+
+
     SharedAbstractNode AstContext::assert_(const SharedAbstractNode& expr) {
       SharedAbstractNode node = std::make_shared<AssertNode>(expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->getUniqueNode(node);
     }
 
 
     SharedAbstractNode AstContext::bv(triton::uint512 value, triton::uint32 size) {
+      SharedAbstractNode* constant = this->getConstantSlot(value, size);
+
+      /* The small constants are shared */
+      if (constant != nullptr && *constant != nullptr)
+        return *constant;
+
       SharedAbstractNode node = std::make_shared<BvNode>(value, size, *this);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
+      node = this->getUniqueNode(node);
+
+      /* The shared constants are immutable and do not record their parents */
+      if (constant != nullptr) {
+        node->setInterned(true);
+        node->setSharedConstant(true);
+        *constant = node;
+      }
+
       return node;
     }
 
@@ -75,7 +423,7 @@ namespace triton {
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
 
-      return node;
+      return this->foldNode(node);
     }
 
 
@@ -107,7 +455,7 @@ namespace triton {
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
 
-      return node;
+      return this->foldNode(node);
     }
 
 
@@ -127,16 +475,12 @@ namespace triton {
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
 
-      return node;
+      return this->foldNode(node);
     }
 
 
     SharedAbstractNode AstContext::bvfalse(void) {
-      SharedAbstractNode node = std::make_shared<BvNode>(0, 1, *this);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      node->init();
-      return node;
+      return this->bv(0, 1);
     }
 
 
@@ -160,7 +504,7 @@ namespace triton {
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
 
-      return node;
+      return this->foldNode(node);
     }
 
 
@@ -180,7 +524,7 @@ namespace triton {
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
 
-      return node;
+      return this->foldNode(node);
     }
 
 
@@ -189,7 +533,7 @@ namespace triton {
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->foldNode(node);
     }
 
 
@@ -198,7 +542,7 @@ namespace triton {
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->foldNode(node);
     }
 
 
@@ -207,7 +551,7 @@ namespace triton {
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->foldNode(node);
     }
 
 
@@ -216,7 +560,7 @@ namespace triton {
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->foldNode(node);
     }
 
 
@@ -239,7 +583,7 @@ namespace triton {
           return this->bv(expr2->getBitvectorMask(), expr2->getBitvectorSize());
 
         /* Optimization: A | A = A */
-        if (expr1->equalTo(expr2))
+        if (this->isSameTree(expr1, expr2))
           return expr1;
       }
 
@@ -248,7 +592,7 @@ namespace triton {
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
 
-      return node;
+      return this->foldNode(node);
     }
 
 
@@ -257,7 +601,7 @@ namespace triton {
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->foldNode(node);
     }
 
 
@@ -285,7 +629,7 @@ namespace triton {
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
 
-      return node;
+      return this->foldNode(node);
     }
 
 
@@ -294,7 +638,7 @@ namespace triton {
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->foldNode(node);
     }
 
 
@@ -322,7 +666,7 @@ namespace triton {
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
 
-      return node;
+      return this->foldNode(node);
     }
 
 
@@ -338,7 +682,7 @@ namespace triton {
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
 
-      return node;
+      return this->foldNode(node);
     }
 
 
@@ -347,7 +691,7 @@ namespace triton {
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->getUniqueNode(node);
     }
 
 
@@ -356,7 +700,7 @@ namespace triton {
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->getUniqueNode(node);
     }
 
 
@@ -380,7 +724,7 @@ namespace triton {
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
 
-      return node;
+      return this->foldNode(node);
     }
 
 
@@ -389,7 +733,7 @@ namespace triton {
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->getUniqueNode(node);
     }
 
 
@@ -398,7 +742,7 @@ namespace triton {
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->getUniqueNode(node);
     }
 
 
@@ -407,7 +751,7 @@ namespace triton {
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->foldNode(node);
     }
 
 
@@ -416,7 +760,7 @@ namespace triton {
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->foldNode(node);
     }
 
 
@@ -431,25 +775,25 @@ namespace triton {
           return this->bvneg(expr2);
 
         /* Optimization: A - A = 0 */
-        if (expr1->equalTo(expr2))
+        if (this->isSameTree(expr1, expr2))
           return this->bv(0, expr1->getBitvectorSize());
       }
 
+      /* Rewriting: A - A = 0 */
+      if (this->modes.isModeEnabled(triton::modes::AST_IDIOM_REWRITING) && this->isSameTree(expr1, expr2))
+        return this->bv(0, expr1->getBitvectorSize());
+
       SharedAbstractNode node = std::make_shared<BvsubNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
 
-      return node;
+      return this->foldNode(node);
     }
 
 
     SharedAbstractNode AstContext::bvtrue(void) {
-      SharedAbstractNode node = std::make_shared<BvNode>(1, 1, *this);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      node->init();
-      return node;
+      return this->bv(1, 1);
     }
 
 
@@ -465,7 +809,7 @@ namespace triton {
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
 
-      return node;
+      return this->foldNode(node);
     }
 
 
@@ -474,7 +818,7 @@ namespace triton {
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->getUniqueNode(node);
     }
 
 
@@ -483,7 +827,7 @@ namespace triton {
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->getUniqueNode(node);
     }
 
 
@@ -492,7 +836,7 @@ namespace triton {
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->getUniqueNode(node);
     }
 
 
@@ -501,7 +845,7 @@ namespace triton {
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->getUniqueNode(node);
     }
 
 
@@ -510,7 +854,7 @@ namespace triton {
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->foldNode(node);
     }
 
 
@@ -519,7 +863,7 @@ namespace triton {
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->foldNode(node);
     }
 
 
@@ -534,16 +878,20 @@ namespace triton {
           return expr2;
 
         /* Optimization: A ^ A = 0 */
-        if (expr1->equalTo(expr2))
+        if (this->isSameTree(expr1, expr2))
           return this->bv(0, expr1->getBitvectorSize());
       }
 
+      /* Rewriting: A ^ A = 0 */
+      if (this->modes.isModeEnabled(triton::modes::AST_IDIOM_REWRITING) && this->isSameTree(expr1, expr2))
+        return this->bv(0, expr1->getBitvectorSize());
+
       SharedAbstractNode node = std::make_shared<BvxorNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
 
-      return node;
+      return this->foldNode(node);
     }
 
 
@@ -552,11 +900,24 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::concat(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
+      if (this->modes.isModeEnabled(triton::modes::AST_IDIOM_REWRITING)) {
+        RewriteKey key(CONCAT_NODE, 0, 0, expr1.get(), expr2.get(), nullptr);
+        SharedAbstractNode merged = this->getRewrite(key);
+
+        /* Rewriting: concat(extract(h, m + 1, A), extract(m, l, A)) = extract(h, l, A) */
+        if (merged == nullptr && (merged = this->mergeExtracts(expr1, expr2)) != nullptr)
+          this->setRewrite(key, {{expr1, expr2, nullptr}}, merged);
+
+        if (merged != nullptr)
+          return merged;
+      }
+
       SharedAbstractNode node = std::make_shared<ConcatNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+
+      return this->foldNode(node);
     }
 
 
@@ -569,7 +930,7 @@ namespace triton {
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->getUniqueNode(node);
     }
 
 
@@ -578,7 +939,7 @@ namespace triton {
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->getUniqueNode(node);
     }
 
 
@@ -587,7 +948,7 @@ namespace triton {
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->getUniqueNode(node);
     }
 
 
@@ -596,13 +957,24 @@ namespace triton {
       if (low == 0 && (high + 1) == expr->getBitvectorSize())
         return expr;
 
+      if (this->modes.isModeEnabled(triton::modes::AST_IDIOM_REWRITING)) {
+        RewriteKey key(EXTRACT_NODE, high, low, expr.get(), nullptr, nullptr);
+        SharedAbstractNode rewritten = this->getRewrite(key);
+
+        if (rewritten == nullptr && (rewritten = this->rewriteExtract(high, low, expr)) != nullptr)
+          this->setRewrite(key, {{expr, nullptr, nullptr}}, rewritten);
+
+        if (rewritten != nullptr)
+          return rewritten;
+      }
+
       SharedAbstractNode node = std::make_shared<ExtractNode>(high, low, expr);
 
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
 
       node->init();
-      return node;
+      return this->foldNode(node);
     }
 
 
@@ -611,7 +983,7 @@ namespace triton {
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->getUniqueNode(node);
     }
 
 
@@ -620,16 +992,28 @@ namespace triton {
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->getUniqueNode(node);
     }
 
 
     SharedAbstractNode AstContext::ite(const SharedAbstractNode& ifExpr, const SharedAbstractNode& thenExpr, const SharedAbstractNode& elseExpr) {
+      if (this->modes.isModeEnabled(triton::modes::AST_IDIOM_REWRITING)) {
+        RewriteKey key(ITE_NODE, 0, 0, ifExpr.get(), thenExpr.get(), elseExpr.get());
+        SharedAbstractNode rewritten = this->getRewrite(key);
+
+        if (rewritten == nullptr && (rewritten = this->rewriteIte(ifExpr, thenExpr, elseExpr)) != nullptr)
+          this->setRewrite(key, {{ifExpr, thenExpr, elseExpr}}, rewritten);
+
+        if (rewritten != nullptr)
+          return rewritten;
+      }
+
       SharedAbstractNode node = std::make_shared<IteNode>(ifExpr, thenExpr, elseExpr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+
+      return this->foldNode(node);
     }
 
 
@@ -638,7 +1022,7 @@ namespace triton {
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->getUniqueNode(node);
     }
 
 
@@ -651,7 +1035,7 @@ namespace triton {
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->getUniqueNode(node);
     }
 
 
@@ -660,7 +1044,7 @@ namespace triton {
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->getUniqueNode(node);
     }
 
 
@@ -669,7 +1053,7 @@ namespace triton {
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->getUniqueNode(node);
     }
 
 
@@ -682,7 +1066,7 @@ namespace triton {
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->getUniqueNode(node);
     }
 
 
@@ -691,7 +1075,7 @@ namespace triton {
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->getUniqueNode(node);
     }
 
 
@@ -706,29 +1090,29 @@ namespace triton {
         throw triton::exceptions::Ast("Node builders - Not enough memory");
 
       node->init();
-      return node;
+      return this->foldNode(node);
     }
 
 
     SharedAbstractNode AstContext::variable(const triton::engines::symbolic::SharedSymbolicVariable& symVar) {
+      triton::usize id = symVar->getId();
+
       // try to get node from variable pool
-      auto it = this->valueMapping.find(symVar->getName());
-      if (it != this->valueMapping.end()) {
-        auto& node = it->second.first;
+      if (id < this->valueMapping.size() && this->valueMapping[id].first != nullptr) {
+        auto& node = this->valueMapping[id].first;
 
         if (node->getBitvectorSize() != symVar->getSize())
           throw triton::exceptions::Ast("Node builders - Missmatching variable size.");
 
-        // This node already exist, just return it
-        node->init();
+        // This node already exist and is up to date, just return it
         return node;
       }
       else {
         // if not found, create a new variable node
         SharedAbstractNode node = std::make_shared<VariableNode>(symVar, *this);
-        this->initVariable(symVar->getName(), 0, node);
         if (node == nullptr)
           throw triton::exceptions::Ast("Node builders - Not enough memory");
+        this->initVariable(symVar, 0, node);
         node->init();
         return node;
       }
@@ -746,41 +1130,65 @@ namespace triton {
         throw triton::exceptions::Ast("Node builders - Not enough memory");
 
       node->init();
-      return node;
+      return this->foldNode(node);
     }
 
 
-    void AstContext::initVariable(const std::string& name, const triton::uint512& value, const SharedAbstractNode& node) {
-      auto it = this->valueMapping.find(name);
-      if (it == this->valueMapping.end())
-        this->valueMapping.insert(std::make_pair(name, std::make_pair(node, value)));
-      else
+    void AstContext::initVariable(const triton::engines::symbolic::SharedSymbolicVariable& symVar, const triton::uint512& value, const SharedAbstractNode& node) {
+      triton::usize id = symVar->getId();
+
+      if (id >= this->valueMapping.size())
+        this->valueMapping.resize(id + 1);
+
+      if (this->valueMapping[id].first != nullptr)
         throw triton::exceptions::Ast("Ast variable already initialized");
+
+      this->valueMapping[id] = std::make_pair(node, value);
+      this->variableNames[symVar->getName()] = id;
     }
 
 
-    void AstContext::updateVariable(const std::string& name, const triton::uint512& value) {
-      auto& kv = this->valueMapping.at(name);
+    void AstContext::updateVariable(triton::usize id, const triton::uint512& value) {
+      if (id >= this->valueMapping.size() || this->valueMapping[id].first == nullptr)
+        throw triton::exceptions::Ast("AstContext::updateVariable(): Variable doesn't exists");
+
+      auto& kv = this->valueMapping[id];
       kv.second = value;
       kv.first->init();
     }
 
 
+    void AstContext::updateVariables(const std::map<triton::usize, triton::uint512>& values) {
+      std::vector<AbstractNode*> nodes;
+
+      for (const auto& item : values) {
+        if (item.first >= this->valueMapping.size() || this->valueMapping[item.first].first == nullptr)
+          throw triton::exceptions::Ast("AstContext::updateVariables(): Variable doesn't exists");
+
+        auto& kv = this->valueMapping[item.first];
+        kv.second = item.second;
+        kv.first->init(false);
+        nodes.push_back(kv.first.get());
+      }
+
+      /* Re-evaluates the nodes depending on these variables, once */
+      AbstractNode::initParents(nodes);
+    }
+
+
     SharedAbstractNode AstContext::getVariableNode(const std::string& name) {
-      auto it = this->valueMapping.find(name);
-      if (it == this->valueMapping.end())
+      auto it = this->variableNames.find(name);
+      if (it == this->variableNames.end())
         return nullptr;
       else
-        return it->second.first;
+        return this->valueMapping[it->second].first;
     }
 
 
-    const triton::uint512& AstContext::getVariableValue(const std::string& varName) const {
-      try {
-        return this->valueMapping.at(varName).second;
-      } catch (const std::out_of_range&) {
+    const triton::uint512& AstContext::getVariableValue(triton::usize id) const {
+      if (id >= this->valueMapping.size() || this->valueMapping[id].first == nullptr)
         throw triton::exceptions::Ast("AstContext::getVariableValue(): Variable doesn't exists");
-      }
+      return this->valueMapping[id].second;
     }
 
 
@@ -42,15 +42,57 @@ namespace triton {
     }
 
 
+    z3::context& TritonToZ3Ast::getContext(void) {
+      return this->context;
+    }
+
+
+    void TritonToZ3Ast::clearCache(void) {
+      this->references.clear();
+    }
+
+
     z3::expr TritonToZ3Ast::convert(const triton::ast::SharedAbstractNode& node) {
       std::unordered_map<triton::ast::SharedAbstractNode, z3::expr> results;
-      std::deque<triton::ast::SharedAbstractNode> nodes;
 
-      triton::ast::nodesExtraction(&nodes, node, true /* unroll*/, true /* revert */);
+      if (node == nullptr)
+        throw triton::exceptions::AstTranslations("TritonToZ3Ast::convert(): node cannot be null.");
+
+      /*
+       * The nodes are only kept for this call, they may be re-initialized or
+       * released between two calls. The symbolic expressions are kept across
+       * calls as long as they are assigned to the same AST (see setAst()).
+       * Concrete values of variables may change, so they are not kept if the
+       * conversion is used to evaluate a node.
+       */
+      auto visit = [this, &results](const triton::ast::SharedAbstractNode& n) {
+        z3::expr expr = this->do_convert(n, &results);
+        results.insert(std::make_pair(n, expr));
+
+        if (!this->isEval && n->getType() == REFERENCE_NODE) {
+          const triton::engines::symbolic::SharedSymbolicExpression& se = reinterpret_cast<triton::ast::ReferenceNode*>(n.get())->getSymbolicExpression();
+          this->references.erase(se->getId());
+          this->references.insert(std::make_pair(se->getId(), ConvertedReference{se->getAst(), se->getAst()->getHash(), expr}));
+        }
+      };
 
-      for (auto&& n : nodes) {
-        results.insert(std::make_pair(n, this->do_convert(n, &results)));
-      }
+      auto skip = [this, &results](const triton::ast::SharedAbstractNode& n) {
+        if (results.find(n) != results.end())
+          return true;
+
+        if (this->isEval || n->getType() != REFERENCE_NODE)
+          return false;
+
+        const triton::engines::symbolic::SharedSymbolicExpression& se = reinterpret_cast<triton::ast::ReferenceNode*>(n.get())->getSymbolicExpression();
+        auto it = this->references.find(se->getId());
+        if (it == this->references.end() || it->second.ast != se->getAst() || it->second.hash != se->getAst()->getHash())
+          return false;
+
+        results.insert(std::make_pair(n, it->second.expr));
+        return true;
+      };
+
+      triton::ast::postOrderTraversal(node, true /* unroll */, visit, skip);
 
       return results.at(node);
     }
@@ -32,14 +32,44 @@ The MODE namespace contains all kinds of mode.
 <hr>
 
 - **MODE.ALIGNED_MEMORY**<br>
-Enabled, Triton will keep a map of aligned memory to reduce the symbolic memory explosion of `LOAD` and `STORE` acceess.
+Deprecated, this mode has no effect. The symbolic memory is always recorded by ranges: a `STORE` is assigned to a single
+expression and a `LOAD` which exactly matches a previous `STORE` returns its expression.
+
+- **MODE.AST_CONSTANT_FOLDING**<br>
+Enabled, Triton will build a bitvector node whose children are not symbolized as a constant (`bv`) of its value, so
+concrete computations do not produce trees. The constants 0, 1 and -1 of each size are shared by the nodes of a context.
+
+- **MODE.AST_HASH_CONSING**<br>
+Enabled, Triton will share structurally identical nodes (hash-consing) to reduce the memory consumption. Note that
+the AST nodes become shared, so modifying a node in place (e.g. `setChild()`) modifies every tree which uses it.
+
+- **MODE.AST_IDIOM_REWRITING**<br>
+Enabled, Triton will rewrite the idioms of the lifting when a node is built: extractions of concatenations, extensions
+and extractions, concatenations of adjacent extractions of a same node, `A ^ A`, `A - A`, the `ite` on a constant condition
+and the `ite` whose branches are equal. The references are not followed and the operands are compared structurally.
+The rewritings are memoized by operands, so a sub-register read many times is rewritten once.
 
 - **MODE.AST_OPTIMIZATIONS**<br>
 Enabled, Triton will reduces the depth of the trees using classical arithmetic optimisations.
 
+- **MODE.CONCRETE_FAST_PATH**<br>
+Enabled with `MODE.ONLY_ON_SYMBOLIZED` or `MODE.ONLY_ON_TAINTED`, Triton will execute the common x86 instructions
+(arithmetic, logic, moves, stack and branches) natively if none of their operands is symbolized (with `MODE.ONLY_ON_SYMBOLIZED`)
+or tainted. The registers, the memory and the flags are updated without building any AST, as the expressions would be removed anyway.
+Branches are only executed natively if `MODE.PC_TRACKING_SYMBOLIC` or `MODE.ONLY_ON_TAINTED` is enabled, as their path constraints would be recorded.
+
 - **MODE.CONCRETIZE_UNDEFINED_REGISTERS**<br>
 Enabled, Triton will concretize every registers tagged as undefined (see #750).
 
+- **MODE.DISASSEMBLY_CACHE**<br>
+Enabled, Triton will keep decoded instructions in a cache keyed by their address and opcode bytes, so
+instructions executed several times are disassembled only once.
+
+- **MODE.LAZY_FLAGS**<br>
+Enabled, Triton will only build the ASTs and symbolic expressions of the x86 arithmetic flags when they are read
+(e.g. by a `jcc`, a `setcc`, a `pushf` or `getSymbolicRegister()`). Their concrete values are still updated at each
+instruction. Note that these flags are not part of the written registers and the symbolic expressions of the instruction.
+
 - **MODE.ONLY_ON_SYMBOLIZED**<br>
 Enabled, Triton will perform symbolic execution only on symbolized expressions.
 
@@ -49,9 +79,38 @@ Enabled, Triton will perform symbolic execution only on tainted instructions.
 - **MODE.PC_TRACKING_SYMBOLIC**<br>
 Enabled, Triton will track path constraints only if they are symbolized. This mode is enabled by default.
 
+- **MODE.SOLVER_MODEL_REUSE**<br>
+Enabled, `getModel()` and `isSat()` first evaluate the constraint with the last models returned by the solver. If one of
+them satisfies the constraint, it is returned without calling the solver. See `setSolverModelReuseSize()`.
+
+- **MODE.SOLVER_QUERY_CACHE**<br>
+Enabled, Triton will keep the results of `getModel()`, `getModels()` and `isSat()` in a cache keyed by the canonical
+form of the constraints (symbolic variables renamed by order of appearance), so a constraint already solved is not
+sent again to the solver. See `setSolverQueryCacheFile()` to keep the results across runs and `setSolverQueryCacheSize()`
+to bound the cache.
+
+- **MODE.SOLVER_QUERY_RECORDING**<br>
+Enabled, Triton will write each query sent to the solver to a self-contained SMT-LIB2 file (`query-<n>.smt2`),
+with its status, AST size, conversion and solving times in comments. See `setSolverQueryRecordingDirectory()`.
+
+- **MODE.SOLVER_QUERY_STATS**<br>
+Enabled, Triton will record the statistics of each query sent to the solver: the hash of its constraint, status,
+AST size, conversion and solving times. See `getSolverQueryStats()` and `setSolverQueryStatsSize()`.
+
 - **MODE.SYMBOLIZE_INDEX_ROTATION**<br>
 Enabled, Triton will symbolize the index of rotation for `bvror` and `bvrol` nodes. This mode increases the complexity of solving.
 
+- **MODE.TAINT_FAST_PATH**<br>
+Enabled and if the symbolic engine is disabled, Triton will spread the taint of the common x86 instructions
+(arithmetic, logic, moves, stack and branches) from a precomputed transfer table instead of building their semantics.
+The instructions are then executed natively, so the taint and the concrete state are the same as with the full semantics.
+As with the full semantics once the symbolic engine is disabled, the memory accesses and the registers read and written
+are not recorded on the instructions.
+
+- **MODE.TAINT_LABELS**<br>
+Enabled, Triton will also track which labels (ids of the taint sources) reach each tainted byte and register.
+See `taintMemoryWithLabel()`, `taintRegisterWithLabel()`, `getMemoryTaintLabels()` and `getRegisterTaintLabels()`.
+
 - **MODE.TAINT_THROUGH_POINTERS**<br>
 Enabled, the taint is spread if an index pointer is already tainted (see #725).
 */
@@ -64,12 +123,24 @@ namespace triton {
 
       void initModeNamespace(PyObject* modeDict) {
         xPyDict_SetItemString(modeDict, "ALIGNED_MEMORY",                 PyLong_FromUint32(triton::modes::ALIGNED_MEMORY));
+        xPyDict_SetItemString(modeDict, "AST_CONSTANT_FOLDING",           PyLong_FromUint32(triton::modes::AST_CONSTANT_FOLDING));
+        xPyDict_SetItemString(modeDict, "AST_HASH_CONSING",               PyLong_FromUint32(triton::modes::AST_HASH_CONSING));
+        xPyDict_SetItemString(modeDict, "AST_IDIOM_REWRITING",            PyLong_FromUint32(triton::modes::AST_IDIOM_REWRITING));
         xPyDict_SetItemString(modeDict, "AST_OPTIMIZATIONS",              PyLong_FromUint32(triton::modes::AST_OPTIMIZATIONS));
+        xPyDict_SetItemString(modeDict, "CONCRETE_FAST_PATH",             PyLong_FromUint32(triton::modes::CONCRETE_FAST_PATH));
         xPyDict_SetItemString(modeDict, "CONCRETIZE_UNDEFINED_REGISTERS", PyLong_FromUint32(triton::modes::CONCRETIZE_UNDEFINED_REGISTERS));
+        xPyDict_SetItemString(modeDict, "DISASSEMBLY_CACHE",              PyLong_FromUint32(triton::modes::DISASSEMBLY_CACHE));
+        xPyDict_SetItemString(modeDict, "LAZY_FLAGS",                     PyLong_FromUint32(triton::modes::LAZY_FLAGS));
         xPyDict_SetItemString(modeDict, "ONLY_ON_SYMBOLIZED",             PyLong_FromUint32(triton::modes::ONLY_ON_SYMBOLIZED));
         xPyDict_SetItemString(modeDict, "ONLY_ON_TAINTED",                PyLong_FromUint32(triton::modes::ONLY_ON_TAINTED));
         xPyDict_SetItemString(modeDict, "PC_TRACKING_SYMBOLIC",           PyLong_FromUint32(triton::modes::PC_TRACKING_SYMBOLIC));
+        xPyDict_SetItemString(modeDict, "SOLVER_MODEL_REUSE",             PyLong_FromUint32(triton::modes::SOLVER_MODEL_REUSE));
+        xPyDict_SetItemString(modeDict, "SOLVER_QUERY_CACHE",             PyLong_FromUint32(triton::modes::SOLVER_QUERY_CACHE));
+        xPyDict_SetItemString(modeDict, "SOLVER_QUERY_RECORDING",         PyLong_FromUint32(triton::modes::SOLVER_QUERY_RECORDING));
+        xPyDict_SetItemString(modeDict, "SOLVER_QUERY_STATS",             PyLong_FromUint32(triton::modes::SOLVER_QUERY_STATS));
         xPyDict_SetItemString(modeDict, "SYMBOLIZE_INDEX_ROTATION",       PyLong_FromUint32(triton::modes::SYMBOLIZE_INDEX_ROTATION));
+        xPyDict_SetItemString(modeDict, "TAINT_FAST_PATH",                PyLong_FromUint32(triton::modes::TAINT_FAST_PATH));
+        xPyDict_SetItemString(modeDict, "TAINT_LABELS",                   PyLong_FromUint32(triton::modes::TAINT_LABELS));
         xPyDict_SetItemString(modeDict, "TAINT_THROUGH_POINTERS",         PyLong_FromUint32(triton::modes::TAINT_THROUGH_POINTERS));
       }
 
@@ -0,0 +1,62 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <triton/pythonBindings.hpp>
+#include <triton/pythonUtils.hpp>
+#include <triton/pythonXFunctions.hpp>
+#include <triton/solverEnums.hpp>
+
+
+
+/*! \page py_SOLVER_page SOLVER
+    \brief [**python api**] All information about the SOLVER python namespace.
+
+\tableofcontents
+
+\section SOLVER_py_description Description
+<hr>
+
+The SOLVER namespace contains all kinds of solver.
+
+\subsection SOLVER_py_example Example
+
+~~~~~~~~~~~~~{.py}
+>>> ctxt.setSolver(SOLVER.LOCAL_SEARCH)
+~~~~~~~~~~~~~
+
+\section SOLVER_py_api Python API - Items of the SOLVER namespace
+<hr>
+
+- **SOLVER.CUSTOM**<br>
+A custom solver defined from the C++ API.
+
+- **SOLVER.LOCAL_SEARCH**<br>
+A local search on the compiled constraint, starting from the concrete values. It does not need z3, but it cannot prove that a
+constraint is UNSAT: if no model is found within its time budget, the query is sent to z3 if available.
+
+- **SOLVER.Z3**<br>
+The z3 solver. This is the default solver if Triton is built with z3.
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      void initSolverNamespace(PyObject* solverDict) {
+        xPyDict_SetItemString(solverDict, "CUSTOM",       PyLong_FromUint32(triton::engines::solver::SOLVER_CUSTOM));
+        xPyDict_SetItemString(solverDict, "LOCAL_SEARCH", PyLong_FromUint32(triton::engines::solver::SOLVER_LOCAL_SEARCH));
+        #ifdef Z3_INTERFACE
+        xPyDict_SetItemString(solverDict, "Z3",           PyLong_FromUint32(triton::engines::solver::SOLVER_Z3));
+        #endif
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
@@ -243,6 +243,12 @@ e.g: `((_ zero_extend sizeExt) expr1)`.
 - <b>\ref py_AstNode_page duplicate(\ref py_AstNode_page expr)</b><br>
 Duplicates the node and returns a new instance as \ref py_AstNode_page.
 
+- <b>dict getNodeCensus(\ref py_AstNode_page expr)</b><br>
+Returns the number of unique nodes per \ref py_AST_NODE_page kind reachable from `expr` (references are followed).
+
+- <b>integer getNodeMemorySize(\ref py_AstNode_page expr)</b><br>
+Returns an estimation of the memory footprint (in bytes) of the unique nodes reachable from `expr`.
+
 - <b>[\ref py_AstNode_page, ...] lookingForNodes(\ref py_AstNode_page expr, \ref py_AST_NODE_page match)</b><br>
 Returns a list of collected matched nodes via a depth-first pre order traversal.
 
@@ -1254,6 +1260,38 @@ namespace triton {
       }
 
 
+      static PyObject* AstContext_getNodeCensus(PyObject* self, PyObject* node) {
+        if (!PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "getNodeCensus(): expected a AstNode as argument");
+
+        try {
+          auto census = PyAstContext_AsAstContext(self)->getNodeCensus(PyAstNode_AsAstNode(node));
+          PyObject* ret = xPyDict_New();
+
+          for (const auto& item : census)
+            xPyDict_SetItem(ret, PyLong_FromUint32(item.first), PyLong_FromUsize(item.second));
+
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* AstContext_getNodeMemorySize(PyObject* self, PyObject* node) {
+        if (!PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "getNodeMemorySize(): expected a AstNode as argument");
+
+        try {
+          return PyLong_FromUsize(PyAstContext_AsAstContext(self)->getNodeMemorySize(PyAstNode_AsAstNode(node)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* AstContext_lookingForNodes(PyObject* self, PyObject* args) {
         PyObject* ret = nullptr;
         PyObject* op1 = nullptr;
@@ -1501,6 +1539,8 @@ namespace triton {
         {"duplicate",       AstContext_duplicate,       METH_O,           ""},
         {"equal",           AstContext_equal,           METH_VARARGS,     ""},
         {"extract",         AstContext_extract,         METH_VARARGS,     ""},
+        {"getNodeCensus",   AstContext_getNodeCensus,   METH_O,           ""},
+        {"getNodeMemorySize", AstContext_getNodeMemorySize, METH_O,       ""},
         {"iff",             AstContext_iff,             METH_VARARGS,     ""},
         {"ite",             AstContext_ite,             METH_VARARGS,     ""},
         {"land",            AstContext_land,            METH_O,           ""},
@@ -57,8 +57,10 @@ This object is used to represent each AST node of an expression.
 - <b>bool equalTo(\ref py_AstNode_page)</b><br>
 Compares the current tree to another one.
 
-- <b>integer evaluate(void)</b><br>
-Evaluates the tree and returns its value.
+- <b>integer evaluate(dict assignment={})</b><br>
+Evaluates the tree and returns its value. The optional `assignment` is a dictionary of {\ref py_SymbolicVariable_page or integer symVarId : integer value}.
+If it is given, the tree is evaluated with these values without modifying the concrete values of the variables, the other variables keep their
+concrete value.
 
 - <b>integer getBitvectorMask(void)</b><br>
 Returns the mask of the node vector according to its size.<br>
@@ -163,9 +165,39 @@ namespace triton {
       }
 
 
-      static PyObject* AstNode_evaluate(PyObject* self, PyObject* noarg) {
+      static PyObject* AstNode_evaluate(PyObject* self, PyObject* args) {
+        std::map<triton::usize, triton::uint512> assignment;
+        PyObject* values = nullptr;
+        PyObject* key    = nullptr;
+        PyObject* value  = nullptr;
+        Py_ssize_t pos   = 0;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|O", &values);
+
+        if (values == nullptr) {
+          try {
+            return PyLong_FromUint512(PyAstNode_AsAstNode(self)->evaluate());
+          }
+          catch (const triton::exceptions::Exception& e) {
+            return PyErr_Format(PyExc_TypeError, "%s", e.what());
+          }
+        }
+
+        if (!PyDict_Check(values))
+          return PyErr_Format(PyExc_TypeError, "evaluate(): Expects a dict as argument.");
+
+        while (PyDict_Next(values, &pos, &key, &value)) {
+          if (PySymbolicVariable_Check(key))
+            assignment[PySymbolicVariable_AsSymbolicVariable(key)->getId()] = PyLong_AsUint512(value);
+          else if (PyLong_Check(key) || PyInt_Check(key))
+            assignment[PyLong_AsUsize(key)] = PyLong_AsUint512(value);
+          else
+            return PyErr_Format(PyExc_TypeError, "evaluate(): Keys must be SymbolicVariable or integer.");
+        }
+
         try {
-          return PyLong_FromUint512(PyAstNode_AsAstNode(self)->evaluate());
+          return PyLong_FromUint512(triton::ast::evaluate(PyAstNode_AsAstNode(self), assignment));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -213,7 +245,7 @@ namespace triton {
 
       static PyObject* AstNode_getHash(PyObject* self, PyObject* noarg) {
         try {
-          return PyLong_FromUint512(PyAstNode_AsAstNode(self)->hash(1));
+          return PyLong_FromUint64(PyAstNode_AsAstNode(self)->getHash());
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -379,7 +411,7 @@ namespace triton {
 
 
       static int AstNode_cmp(AstNode_Object* a, AstNode_Object* b) {
-        return !(a->node->hash(1) == b->node->hash(1));
+        return !(a->node->equalTo(b->node));
       }
 
 
@@ -611,7 +643,7 @@ namespace triton {
       //! AstNode methods.
       PyMethodDef AstNode_callbacks[] = {
         {"equalTo",                 AstNode_equalTo,                METH_O,          ""},
-        {"evaluate",                AstNode_evaluate,               METH_NOARGS,     ""},
+        {"evaluate",                AstNode_evaluate,               METH_VARARGS,    ""},
         {"getBitvectorMask",        AstNode_getBitvectorMask,       METH_NOARGS,     ""},
         {"getBitvectorSize",        AstNode_getBitvectorSize,       METH_NOARGS,     ""},
         {"getChildren",             AstNode_getChildren,            METH_NOARGS,     ""},
@@ -39,6 +39,9 @@ The libTriton offers Python bindings on its C++ API which allow you to build ana
 - <b>void addCallback(function cb, \ref py_CALLBACK_page kind)</b><br>
 Adds a callback at specific internal points. Your callback will be called each time the point is reached.
 
+- <b>void addSolverConstraint(\ref py_AstNode_page node)</b><br>
+Adds a constraint to the current scope of the incremental solver session. The constraint is converted once and kept until its scope is popped.
+
 - <b>void assignSymbolicExpressionToMemory(\ref py_SymbolicExpression_page symExpr, \ref py_MemoryAccess_page mem)</b><br>
 Assigns a \ref py_SymbolicExpression_page to a \ref py_MemoryAccess_page area. **Be careful**, use this function only if you know what you are doing.
 The symbolic expression (`symExpr`) must be aligned to the memory access.
@@ -52,9 +55,18 @@ expression to a sub-register like `AX`, `AH` or `AL`, please, craft your express
 - <b>bool buildSemantics(\ref py_Instruction_page inst)</b><br>
 Builds the instruction semantics. Returns true if the instruction is supported. You must define an architecture before.
 
+- <b>void clearDisassemblyCache(void)</b><br>
+Clears the decoded instructions cache and its counters.
+
 - <b>void clearPathConstraints(void)</b><br>
 Clears the logical conjunction vector of path constraints.
 
+- <b>void clearSolverQueryCache(void)</b><br>
+Clears the solver query cache (see \ref py_MODE_page SOLVER_QUERY_CACHE) and its counters.
+
+- <b>void clearSolverQueryStats(void)</b><br>
+Clears the statistics of the solver queries.
+
 - <b>void concretizeAllMemory(void)</b><br>
 Concretizes all symbolic memory references.
 
@@ -118,6 +130,12 @@ Returns the AST context to create and modify nodes.
 - <b>\ref py_AST_REPRESENTATION_page getAstRepresentationMode(void)</b><br>
 Returns the current AST representation mode.
 
+- <b>[dict, ...] getBatchModels([\ref py_AstNode_page, ...] nodes, integer workers=0, integer timeout=0)</b><br>
+Computes a model for each constraint of `nodes` and returns the list of models in the same order. The queries are solved concurrently on
+`workers` threads (0 means one per core), each one on its own solver context, with a max time of `timeout` milliseconds per query
+(0 means the solver timeout). An empty dict means UNSAT, timeout or out of memory. The GIL is released while solving, the context must not be used by other
+threads until the call returns.
+
 - <b>bytes getConcreteMemoryAreaValue(integer baseAddr, integer size)</b><br>
 Returns the concrete value of a memory area.
 
@@ -133,6 +151,15 @@ Returns the concrete value of a register.
 - <b>integer getConcreteVariableValue(\ref py_SymbolicVariable_page symVar)</b><br>
 Returns the concrete value of a symbolic variable.
 
+- <b>integer getDisassemblyCacheHits(void)</b><br>
+Returns the number of disassembly requests served by the decoded instructions cache (see \ref py_MODE_page `DISASSEMBLY_CACHE`).
+
+- <b>integer getDisassemblyCacheMisses(void)</b><br>
+Returns the number of disassembly requests which went through the disassembler.
+
+- <b>integer getDisassemblyCacheSize(void)</b><br>
+Returns the max number of decoded instructions kept in the cache.
+
 - <b>integer getGprBitSize(void)</b><br>
 Returns the size in bit of the General Purpose Registers.
 
@@ -145,11 +172,19 @@ Returns the AST corresponding to the \ref py_Immediate_page.
 - <b>\ref py_AstNode_page getMemoryAst(\ref py_MemoryAccess_page mem)</b><br>
 Returns the AST corresponding to the \ref py_MemoryAccess_page with the SSA form.
 
-- <b>dict getModel(\ref py_AstNode_page node)</b><br>
+- <b>[integer, ...] getMemoryTaintLabels(\ref py_MemoryAccess_page mem)</b><br>
+Returns the sorted list of the labels which reach a memory (see \ref py_MODE_page TAINT_LABELS). An integer is a 1-byte memory.
+
+- <b>dict getModel(\ref py_AstNode_page node, bool independence=False, bool status=False, integer timeout=0)</b><br>
 Computes and returns a model as a dictionary of {integer symVarId : \ref py_SolverModel_page model} from a symbolic constraint.
+If `independence` is true, the constraint is sliced into independent partitions and only the partitions which do not hold with the
+concrete values are sent to the solver, the other variables keep their concrete values. If `status` is true, returns a tuple of the
+model and the \ref py_SOLVER_STATE_page of the query (an empty model means UNSAT, TIMEOUT or OUTOFMEM). A `timeout` in milliseconds
+overrides the solver timeout if not 0.
 
-- <b>[dict, ...] getModels(\ref py_AstNode_page node, integer limit)</b><br>
+- <b>[dict, ...] getModels(\ref py_AstNode_page node, integer limit, bool independence=False, bool status=False, integer timeout=0)</b><br>
 Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned.
+The `independence`, `status` and `timeout` options are the same as for getModel().
 
 - <b>\ref py_Register_page getParentRegister(\ref py_Register_page reg)</b><br>
 Returns the parent \ref py_Register_page from a \ref py_Register_page.
@@ -169,6 +204,47 @@ Returns the \ref py_Register_page class corresponding to a \ref py_REG_page id.
 - <b>\ref py_AstNode_page getRegisterAst(\ref py_Register_page reg)</b><br>
 Returns the AST corresponding to the \ref py_Register_page with the SSA form.
 
+- <b>[integer, ...] getRegisterTaintLabels(\ref py_Register_page reg)</b><br>
+Returns the sorted list of the labels which reach a register (see \ref py_MODE_page TAINT_LABELS).
+
+- <b>dict getSessionModel(\ref py_AstNode_page node)</b><br>
+Computes and returns a model as a dictionary of {integer symVarId : \ref py_SolverModel_page model} from a symbolic constraint and the constraints of the incremental solver session. The `node` constraint is not kept in the session.
+
+- <b>\ref py_SOLVER_page getSolver(void)</b><br>
+Returns the kind of solver used.
+
+- <b>integer getSolverMemoryLimit(void)</b><br>
+Returns the max memory of the solver in megabytes.
+
+- <b>integer getSolverModelReuseHits(void)</b><br>
+Returns the number of queries answered by a recent model (MODE.SOLVER_MODEL_REUSE).
+
+- <b>integer getSolverQueryCacheHits(void)</b><br>
+Returns the number of solver queries served by the solver query cache.
+
+- <b>integer getSolverQueryCacheMisses(void)</b><br>
+Returns the number of solver queries of the solver query cache sent to the solver.
+
+- <b>integer getSolverQueryCacheTimeSaved(void)</b><br>
+Returns the solver time saved by the solver query cache in microseconds.
+
+- <b>string getSolverQueryRecordingDirectory(void)</b><br>
+Returns the directory where the solver queries are recorded (see \ref py_MODE_page `SOLVER_QUERY_RECORDING`).
+
+- <b>[dict, ...] getSolverQueryStats(void)</b><br>
+Returns the statistics of the solver queries, the oldest first (see \ref py_MODE_page `SOLVER_QUERY_STATS`). Each query is a
+dictionary with the keys `hash` (the hash of the constraint, see \ref py_AstNode_page getHash()), `limit` (the max number of models, 0 for isSat()), `status` (\ref py_SOLVER_STATE_page),
+`astSize` (the number of unique nodes), `conversionTime` and `solvingTime` (in microseconds).
+
+- <b>integer getSolverRecordedQueries(void)</b><br>
+Returns the number of solver queries recorded.
+
+- <b>integer getSolverRecordingFailures(void)</b><br>
+Returns the number of solver queries which could not be recorded. Their results are returned anyway.
+
+- <b>integer getSolverTimeout(void)</b><br>
+Returns the default max time of a solver query in milliseconds.
+
 - <b>\ref py_SymbolicExpression_page getSymbolicExpressionFromId(integer symExprId)</b><br>
 Returns the symbolic expression corresponding to an id.
 
@@ -176,10 +252,12 @@ Returns the symbolic expression corresponding to an id.
 Returns all symbolic expressions as a dictionary of {integer SymExprId : \ref py_SymbolicExpression_page expr}.
 
 - <b>dict getSymbolicMemory(void)</b><br>
-Returns the map of symbolic memory as {integer address : \ref py_SymbolicExpression_page expr}.
+Returns the map of symbolic memory ranges as {integer address : \ref py_SymbolicExpression_page expr}. Each expression covers
+the memory from its address to the size of its AST.
 
 - <b>\ref py_SymbolicExpression_page getSymbolicMemory(integer addr)</b><br>
-Returns the \ref py_SymbolicExpression_page corresponding to a memory address.
+Returns the \ref py_SymbolicExpression_page corresponding to a memory address. The symbolic memory range is split to isolate
+the byte.
 
 - <b>integer getSymbolicMemoryValue(integer addr)</b><br>
 Returns the symbolic memory value.
@@ -208,6 +286,10 @@ Returns all symbolic variable as a dictionary of {integer SymVarId : \ref py_Sym
 - <b>[integer, ...] getTaintedMemory(void)</b><br>
 Returns the list of all tainted addresses.
 
+- <b>[(integer, integer), ...] getTaintedMemoryRanges(void)</b><br>
+Returns the tainted memory ranges as a list of (base address, size), sorted by address. Unlike `getTaintedMemory()`,
+its size does not grow with the number of tainted bytes.
+
 - <b>[\ref py_Register_page, ...] getTaintedRegisters(void)</b><br>
 Returns the list of all tainted registers.
 
@@ -250,8 +332,11 @@ Returns true if the register is tainted.
 - <b>bool isRegisterValid(\ref py_Register_page reg)</b><br>
 Returns true if the register is valid.
 
-- <b>bool isSat(\ref py_AstNode_page node)</b><br>
-Returns true if an expression is satisfiable.
+- <b>bool isSat(\ref py_AstNode_page node, bool status=False, integer timeout=0)</b><br>
+Returns true if an expression is satisfiable. The `status` and `timeout` options are the same as for getModel().
+
+- <b>bool isSessionSat(\ref py_AstNode_page node)</b><br>
+Returns true if an expression is satisfiable with the constraints of the incremental solver session. The `node` constraint is not kept in the session.
 
 - <b>bool isSymbolicEngineEnabled(void)</b><br>
 Returns true if the symbolic execution engine is enabled.
@@ -268,9 +353,15 @@ Returns a new symbolic expression. Note that if there are simplification passes
 - <b>\ref py_SymbolicVariable_page newSymbolicVariable(integer varSize, string comment)</b><br>
 Returns a new symbolic variable.
 
+- <b>void popSolverScope(void)</b><br>
+Removes the last scope of the incremental solver session and its constraints.
+
 - <b>bool processing(\ref py_Instruction_page inst)</b><br>
 Processes an instruction and updates engines according to the instruction semantics. Returns true if the instruction is supported. You must define an architecture before.
 
+- <b>void pushSolverScope(void)</b><br>
+Creates a new scope in the incremental solver session.
+
 - <b>void removeAllCallbacks(void)</b><br>
 Removes all recorded callbacks.
 
@@ -280,6 +371,9 @@ Removes a recorded callback.
 - <b>void reset(void)</b><br>
 Resets everything.
 
+- <b>void resetSolverSession(void)</b><br>
+Removes all scopes and constraints of the incremental solver session.
+
 - <b>void setArchitecture(\ref py_ARCH_page arch)</b><br>
 Initializes an architecture. This function must be called before any call to the rest of the API.
 
@@ -309,6 +403,39 @@ the symbolic state (if it exists). You should probably use the concretize functi
 - <b>void setConcreteVariableValue(\ref py_SymbolicVariable_page symVar, integer value)</b><br>
 Sets the concrete value of a symbolic variable.
 
+- <b>void setConcreteVariableValues(dict values)</b><br>
+Sets the concrete values of several symbolic variables at once. Keys are \ref py_SymbolicVariable_page or symbolic variable ids
+and values are integers. Each node depending on these variables is re-evaluated only once.
+
+- <b>void setDisassemblyCacheSize(integer size)</b><br>
+Sets the max number of decoded instructions kept in the cache (65536 by default). The least recently used ones are evicted.
+
+- <b>void setSolver(\ref py_SOLVER_page solver)</b><br>
+Initializes a predefined solver (see \ref py_SOLVER_page). The solver limits, cache and statistics are kept.
+
+- <b>void setSolverMemoryLimit(integer limit)</b><br>
+Sets the max memory of the solver in megabytes (0 means no limit). A query which reaches it returns the `OUTOFMEM` status.
+
+- <b>void setSolverModelReuseSize(integer size)</b><br>
+Sets the max number of recent models tried before the solver (16 by default).
+
+- <b>void setSolverQueryCacheFile(string path)</b><br>
+Uses a file to store the solver query cache, so results survive across runs. Entries already in the file are loaded. An empty path disables the file store.
+
+- <b>void setSolverQueryCacheSize(integer size)</b><br>
+Sets the max number of entries of the solver query cache (65536 by default), the least recently used ones are dropped first.
+The file store is rewritten with the live entries when the lines of the superseded ones outnumber them.
+
+- <b>void setSolverQueryRecordingDirectory(string path)</b><br>
+Sets the directory where the solver queries are recorded, the current directory by default. Each query is written to
+`query-<n>.smt2`, so the files of a previous recording in the same directory are overwritten.
+
+- <b>void setSolverQueryStatsSize(integer size)</b><br>
+Sets the max number of statistics of solver queries kept (4096 by default), the oldest ones are dropped first.
+
+- <b>void setSolverTimeout(integer timeout)</b><br>
+Sets the default max time of a solver query in milliseconds (0 means no limit). A query which reaches it returns the `TIMEOUT` status.
+
 - <b>bool setTaintMemory(\ref py_MemoryAccess_page mem, bool flag)</b><br>
 Sets the targeted memory as tainted or not. Returns true if the memory is still tainted.
 
@@ -350,9 +477,18 @@ Taints an address. Returns true if the address is tainted.
 - <b>bool taintMemory(\ref py_MemoryAccess_page mem)</b><br>
 Taints a memory. Returns true if the memory is tainted.
 
+- <b>bool taintMemoryRange(integer baseAddr, integer size)</b><br>
+Taints the memory range `[baseAddr:size]`. Returns true if the range is tainted.
+
+- <b>bool taintMemoryWithLabel(\ref py_MemoryAccess_page mem, integer label)</b><br>
+Taints a memory and, if \ref py_MODE_page TAINT_LABELS is enabled, adds a label to its bytes. An integer is a 1-byte memory. Returns true if the memory is tainted.
+
 - <b>bool taintRegister(\ref py_Register_page reg)</b><br>
 Taints a register. Returns true if the register is tainted.
 
+- <b>bool taintRegisterWithLabel(\ref py_Register_page reg, integer label)</b><br>
+Taints a register and, if \ref py_MODE_page TAINT_LABELS is enabled, adds a label to it. Returns true if the register is tainted.
+
 - <b>bool taintUnionMemoryImmediate(\ref py_MemoryAccess_page memDst)</b><br>
 Taints `memDst` with an union - `memDst` does not changes. Returns true if `memDst` is tainted.
 
@@ -384,6 +520,9 @@ Untaints an address. Returns true if the address is still tainted.
 - <b>bool untaintMemory(\ref py_MemoryAccess_page mem)</b><br>
 Untaints a memory. Returns true if the memory is still tainted.
 
+- <b>bool untaintMemoryRange(integer baseAddr, integer size)</b><br>
+Untaints the memory range `[baseAddr:size]`. Returns true if the range is still tainted.
+
 - <b>bool untaintRegister(\ref py_Register_page reg)</b><br>
 Untaints a register. Returns true if the register is still tainted.
 
@@ -686,6 +825,22 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_addSolverConstraint(PyObject* self, PyObject* node) {
+        if (!PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "addSolverConstraint(): Expects a AstNode as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->addSolverConstraint(PyAstNode_AsAstNode(node));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_assignSymbolicExpressionToMemory(PyObject* self, PyObject* args) {
         PyObject* se  = nullptr;
         PyObject* mem = nullptr;
@@ -757,6 +912,19 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_clearDisassemblyCache(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->clearDisassemblyCache();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_clearPathConstraints(PyObject* self, PyObject* noarg) {
         try {
           PyTritonContext_AsTritonContext(self)->clearPathConstraints();
@@ -770,6 +938,32 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_clearSolverQueryCache(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->clearSolverQueryCache();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_clearSolverQueryStats(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->clearSolverQueryStats();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_concretizeAllMemory(PyObject* self, PyObject* noarg) {
         try {
           PyTritonContext_AsTritonContext(self)->concretizeAllMemory();
@@ -1209,6 +1403,73 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_getBatchModels(PyObject* self, PyObject* args) {
+        std::vector<triton::ast::SharedAbstractNode> nodes;
+        std::vector<std::map<triton::uint32, triton::engines::solver::SolverModel>> models;
+        std::string error;
+        PyObject* errorType = nullptr;
+        PyObject* ret       = nullptr;
+        PyObject* list      = nullptr;
+        PyObject* workers   = nullptr;
+        PyObject* timeout   = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOO", &list, &workers, &timeout);
+
+        if (list == nullptr || !PyList_Check(list))
+          return PyErr_Format(PyExc_TypeError, "getBatchModels(): Expects a list of AstNode as first argument.");
+
+        if (workers != nullptr && !PyLong_Check(workers) && !PyInt_Check(workers))
+          return PyErr_Format(PyExc_TypeError, "getBatchModels(): Expects an integer as second argument.");
+
+        if (timeout != nullptr && !PyLong_Check(timeout) && !PyInt_Check(timeout))
+          return PyErr_Format(PyExc_TypeError, "getBatchModels(): Expects an integer as third argument.");
+
+        for (Py_ssize_t i = 0; i < PyList_Size(list); i++) {
+          PyObject* item = PyList_GetItem(list, i);
+          if (!PyAstNode_Check(item))
+            return PyErr_Format(PyExc_TypeError, "getBatchModels(): Each item of the list must be an AstNode.");
+          nodes.push_back(PyAstNode_AsAstNode(item));
+        }
+
+        triton::uint32 nworkers = (workers != nullptr) ? PyLong_AsUint32(workers) : 0;
+        triton::uint32 ntimeout = (timeout != nullptr) ? PyLong_AsUint32(timeout) : 0;
+
+        /* The GIL is released while solving */
+        Py_BEGIN_ALLOW_THREADS
+        try {
+          models = PyTritonContext_AsTritonContext(self)->getBatchModels(nodes, nworkers, ntimeout);
+        }
+        catch (const triton::exceptions::Exception& e) {
+          errorType = PyExc_TypeError;
+          error = e.what();
+        }
+        /* The workers may fail outside of Triton (threads, memory) */
+        catch (const std::bad_alloc& e) {
+          errorType = PyExc_MemoryError;
+          error = std::string("getBatchModels(): ") + e.what();
+        }
+        catch (const std::exception& e) {
+          errorType = PyExc_RuntimeError;
+          error = std::string("getBatchModels(): ") + e.what();
+        }
+        Py_END_ALLOW_THREADS
+
+        if (errorType != nullptr)
+          return PyErr_Format(errorType, "%s", error.c_str());
+
+        ret = xPyList_New(models.size());
+        for (triton::usize index = 0; index < models.size(); index++) {
+          PyObject* mdict = xPyDict_New();
+          for (auto it = models[index].begin(); it != models[index].end(); it++)
+            xPyDict_SetItem(mdict, PyLong_FromUint32(it->first), PySolverModel(it->second));
+          PyList_SetItem(ret, index, mdict);
+        }
+
+        return ret;
+      }
+
+
       static PyObject* TritonContext_getConcreteMemoryAreaValue(PyObject* self, PyObject* args) {
         triton::uint8*  area = nullptr;
         PyObject*       ret  = nullptr;
@@ -1279,6 +1540,36 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_getDisassemblyCacheHits(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getDisassemblyCacheHits());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getDisassemblyCacheMisses(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getDisassemblyCacheMisses());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getDisassemblyCacheSize(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getDisassemblyCacheSize());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* TritonContext_getGprBitSize(PyObject* self, PyObject* noarg) {
         try {
           return PyLong_FromUint32(PyTritonContext_AsTritonContext(self)->getGprBitSize());
@@ -1325,15 +1616,58 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_getModel(PyObject* self, PyObject* node) {
+      static PyObject* TritonContext_getMemoryTaintLabels(PyObject* self, PyObject* mem) {
         PyObject* ret = nullptr;
+        std::vector<triton::uint32> labels;
 
-        if (!PyAstNode_Check(node))
-          return PyErr_Format(PyExc_TypeError, "getModel(): Expects a AstNode as argument.");
+        try {
+          if (PyMemoryAccess_Check(mem))
+            labels = PyTritonContext_AsTritonContext(self)->getMemoryTaintLabels(*PyMemoryAccess_AsMemoryAccess(mem));
+
+          else if (PyLong_Check(mem) || PyInt_Check(mem))
+            labels = PyTritonContext_AsTritonContext(self)->getMemoryTaintLabels(triton::arch::MemoryAccess(PyLong_AsUint64(mem), BYTE_SIZE));
+
+          else
+            return PyErr_Format(PyExc_TypeError, "getMemoryTaintLabels(): Expects a MemoryAccess or an integer as argument.");
+
+          ret = xPyList_New(labels.size());
+          for (triton::usize index = 0; index < labels.size(); index++)
+            PyList_SetItem(ret, index, PyLong_FromUint32(labels[index]));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getModel(PyObject* self, PyObject* args) {
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+        PyObject* ret          = nullptr;
+        PyObject* node         = nullptr;
+        PyObject* independence = nullptr;
+        PyObject* status       = nullptr;
+        PyObject* timeout      = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOOO", &node, &independence, &status, &timeout);
+
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "getModel(): Expects a AstNode as first argument.");
+
+        if (independence != nullptr && !PyBool_Check(independence))
+          return PyErr_Format(PyExc_TypeError, "getModel(): Expects a boolean as second argument.");
+
+        if (status != nullptr && !PyBool_Check(status))
+          return PyErr_Format(PyExc_TypeError, "getModel(): Expects a boolean as third argument.");
+
+        if (timeout != nullptr && !PyLong_Check(timeout) && !PyInt_Check(timeout))
+          return PyErr_Format(PyExc_TypeError, "getModel(): Expects an integer as fourth argument.");
 
         try {
           ret = xPyDict_New();
-          auto model = PyTritonContext_AsTritonContext(self)->getModel(PyAstNode_AsAstNode(node));
+          auto model = PyTritonContext_AsTritonContext(self)->getModel(PyAstNode_AsAstNode(node), independence != nullptr && PyObject_IsTrue(independence), &st, (timeout != nullptr) ? PyLong_AsUint32(timeout) : 0);
           for (auto it = model.begin(); it != model.end(); it++) {
             xPyDict_SetItem(ret, PyLong_FromUint32(it->first), PySolverModel(it->second));
           }
@@ -1342,17 +1676,28 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
+        if (status != nullptr && PyObject_IsTrue(status)) {
+          PyObject* tuple = xPyTuple_New(2);
+          PyTuple_SetItem(tuple, 0, ret);
+          PyTuple_SetItem(tuple, 1, PyLong_FromUint32(st));
+          return tuple;
+        }
+
         return ret;
       }
 
 
       static PyObject* TritonContext_getModels(PyObject* self, PyObject* args) {
-        PyObject* ret   = nullptr;
-        PyObject* node  = nullptr;
-        PyObject* limit = nullptr;
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+        PyObject* ret          = nullptr;
+        PyObject* node         = nullptr;
+        PyObject* limit        = nullptr;
+        PyObject* independence = nullptr;
+        PyObject* status       = nullptr;
+        PyObject* timeout      = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &node, &limit);
+        PyArg_ParseTuple(args, "|OOOOO", &node, &limit, &independence, &status, &timeout);
 
         if (node == nullptr || !PyAstNode_Check(node))
           return PyErr_Format(PyExc_TypeError, "getModels(): Expects a AstNode as first argument.");
@@ -1360,8 +1705,17 @@ namespace triton {
         if (limit == nullptr || (!PyLong_Check(limit) && !PyInt_Check(limit)))
           return PyErr_Format(PyExc_TypeError, "getModels(): Expects an integer as second argument.");
 
+        if (independence != nullptr && !PyBool_Check(independence))
+          return PyErr_Format(PyExc_TypeError, "getModels(): Expects a boolean as third argument.");
+
+        if (status != nullptr && !PyBool_Check(status))
+          return PyErr_Format(PyExc_TypeError, "getModels(): Expects a boolean as fourth argument.");
+
+        if (timeout != nullptr && !PyLong_Check(timeout) && !PyInt_Check(timeout))
+          return PyErr_Format(PyExc_TypeError, "getModels(): Expects an integer as fifth argument.");
+
         try {
-          auto models = PyTritonContext_AsTritonContext(self)->getModels(PyAstNode_AsAstNode(node), PyLong_AsUint32(limit));
+          auto models = PyTritonContext_AsTritonContext(self)->getModels(PyAstNode_AsAstNode(node), PyLong_AsUint32(limit), independence != nullptr && PyObject_IsTrue(independence), &st, (timeout != nullptr) ? PyLong_AsUint32(timeout) : 0);
           triton::uint32 index = 0;
 
           ret = xPyList_New(models.size());
@@ -1380,6 +1734,13 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
+        if (status != nullptr && PyObject_IsTrue(status)) {
+          PyObject* tuple = xPyTuple_New(2);
+          PyTuple_SetItem(tuple, 0, ret);
+          PyTuple_SetItem(tuple, 1, PyLong_FromUint32(st));
+          return tuple;
+        }
+
         return ret;
       }
 
@@ -1463,28 +1824,39 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_getSymbolicExpressionFromId(PyObject* self, PyObject* symExprId) {
-        if (!PyLong_Check(symExprId) && !PyInt_Check(symExprId))
-          return PyErr_Format(PyExc_TypeError, "getSymbolicExpressionFromId(): Expects an integer as argument.");
+      static PyObject* TritonContext_getRegisterTaintLabels(PyObject* self, PyObject* reg) {
+        PyObject* ret = nullptr;
+
+        if (!PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "getRegisterTaintLabels(): Expects a Register as argument.");
 
         try {
-          return PySymbolicExpression(PyTritonContext_AsTritonContext(self)->getSymbolicExpressionFromId(PyLong_AsUsize(symExprId)));
+          std::vector<triton::uint32> labels = PyTritonContext_AsTritonContext(self)->getRegisterTaintLabels(*PyRegister_AsRegister(reg));
+
+          ret = xPyList_New(labels.size());
+          for (triton::usize index = 0; index < labels.size(); index++)
+            PyList_SetItem(ret, index, PyLong_FromUint32(labels[index]));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+
+        return ret;
       }
 
 
-      static PyObject* TritonContext_getSymbolicExpressions(PyObject* self, PyObject* noarg) {
+      static PyObject* TritonContext_getSessionModel(PyObject* self, PyObject* node) {
         PyObject* ret = nullptr;
 
-        try {
-          const auto& expressions = PyTritonContext_AsTritonContext(self)->getSymbolicExpressions();
+        if (!PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "getSessionModel(): Expects a AstNode as argument.");
 
+        try {
           ret = xPyDict_New();
-          for (auto it = expressions.begin(); it != expressions.end(); it++)
-            xPyDict_SetItem(ret, PyLong_FromUsize(it->first), PySymbolicExpression(it->second));
+          auto model = PyTritonContext_AsTritonContext(self)->getSessionModel(PyAstNode_AsAstNode(node));
+          for (auto it = model.begin(); it != model.end(); it++) {
+            xPyDict_SetItem(ret, PyLong_FromUint32(it->first), PySolverModel(it->second));
+          }
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -1494,44 +1866,19 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_getSymbolicMemory(PyObject* self, PyObject* args) {
-        PyObject* ret  = nullptr;
-        PyObject* addr = nullptr;
-
-        /* Extract arguments */
-        PyArg_ParseTuple(args, "|O", &addr);
-
+      static PyObject* TritonContext_getSolver(PyObject* self, PyObject* noarg) {
         try {
-          if (addr == nullptr) {
-            auto regs = PyTritonContext_AsTritonContext(self)->getSymbolicMemory();
-
-            ret = xPyDict_New();
-            for (auto it = regs.begin(); it != regs.end(); it++) {
-              xPyDict_SetItem(ret, PyLong_FromUint64(it->first), PySymbolicExpression(it->second));
-            }
-          }
-          else if (addr != nullptr && (PyLong_Check(addr) || PyInt_Check(addr))) {
-            ret = PySymbolicExpression(PyTritonContext_AsTritonContext(self)->getSymbolicMemory(PyLong_AsUint64(addr)));
-          }
-          else
-            return PyErr_Format(PyExc_TypeError, "getSymbolicMemory(): Expects an integer or nothing as argument.");
+          return PyLong_FromUint32(PyTritonContext_AsTritonContext(self)->getSolver());
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
-
-        return ret;
       }
 
 
-      static PyObject* TritonContext_getSymbolicMemoryValue(PyObject* self, PyObject* mem) {
-        if (!PyLong_Check(mem) && !PyInt_Check(mem) && !PyMemoryAccess_Check(mem))
-          return PyErr_Format(PyExc_TypeError, "getSymbolicMemoryValue(): Expects an integer or a MemoryAccess as argument.");
-
+      static PyObject* TritonContext_getSolverMemoryLimit(PyObject* self, PyObject* noarg) {
         try {
-          if (PyLong_Check(mem) || PyInt_Check(mem))
-            return PyLong_FromUint512(PyTritonContext_AsTritonContext(self)->getSymbolicMemoryValue(PyLong_AsUint64(mem)));
-          return PyLong_FromUint512(PyTritonContext_AsTritonContext(self)->getSymbolicMemoryValue(*PyMemoryAccess_AsMemoryAccess(mem)));
+          return PyLong_FromUint32(PyTritonContext_AsTritonContext(self)->getSolverMemoryLimit());
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -1539,31 +1886,19 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_getSymbolicRegisters(PyObject* self, PyObject* noarg) {
-        PyObject* ret = nullptr;
-
+      static PyObject* TritonContext_getSolverModelReuseHits(PyObject* self, PyObject* noarg) {
         try {
-          auto regs = PyTritonContext_AsTritonContext(self)->getSymbolicRegisters();
-
-          ret = xPyDict_New();
-          for (auto it = regs.begin(); it != regs.end(); it++) {
-            xPyDict_SetItem(ret, PyLong_FromUint64(it->first), PySymbolicExpression(it->second));
-          }
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getSolverModelReuseHits());
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
-
-        return ret;
       }
 
 
-      static PyObject* TritonContext_getSymbolicRegister(PyObject* self, PyObject* reg) {
-        if (!PyRegister_Check(reg))
-          return PyErr_Format(PyExc_TypeError, "getSymbolicRegister(): Expects a Register as argument.");
-
+      static PyObject* TritonContext_getSolverQueryCacheHits(PyObject* self, PyObject* noarg) {
         try {
-          return PySymbolicExpression(PyTritonContext_AsTritonContext(self)->getSymbolicRegister(*PyRegister_AsRegister(reg)));
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getSolverQueryCacheHits());
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -1571,12 +1906,9 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_getSymbolicRegisterValue(PyObject* self, PyObject* reg) {
-        if (!PyRegister_Check(reg))
-          return PyErr_Format(PyExc_TypeError, "getSymbolicRegisterValue(): Expects a Register as argument.");
-
+      static PyObject* TritonContext_getSolverQueryCacheMisses(PyObject* self, PyObject* noarg) {
         try {
-          return PyLong_FromUint512(PyTritonContext_AsTritonContext(self)->getSymbolicRegisterValue(*PyRegister_AsRegister(reg)));
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getSolverQueryCacheMisses());
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -1584,12 +1916,9 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_getSymbolicVariableFromId(PyObject* self, PyObject* symVarId) {
-        if (!PyLong_Check(symVarId) && !PyInt_Check(symVarId))
-          return PyErr_Format(PyExc_TypeError, "getSymbolicVariableFromId(): Expects an integer as argument.");
-
+      static PyObject* TritonContext_getSolverQueryCacheTimeSaved(PyObject* self, PyObject* noarg) {
         try {
-          return PySymbolicVariable(PyTritonContext_AsTritonContext(self)->getSymbolicVariableFromId(PyLong_AsUsize(symVarId)));
+          return PyLong_FromUint64(PyTritonContext_AsTritonContext(self)->getSolverQueryCacheTimeSaved());
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -1597,13 +1926,9 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_getSymbolicVariableFromName(PyObject* self, PyObject* symVarName) {
-        if (!PyString_Check(symVarName))
-          return PyErr_Format(PyExc_TypeError, "getSymbolicVariableFromName(): Expects a string as argument.");
-
+      static PyObject* TritonContext_getSolverQueryRecordingDirectory(PyObject* self, PyObject* noarg) {
         try {
-          std::string arg = PyString_AsString(symVarName);
-          return PySymbolicVariable(PyTritonContext_AsTritonContext(self)->getSymbolicVariableFromName(arg));
+          return PyString_FromString(PyTritonContext_AsTritonContext(self)->getSolverQueryRecordingDirectory().c_str());
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -1611,15 +1936,24 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_getSymbolicVariables(PyObject* self, PyObject* noarg) {
+      static PyObject* TritonContext_getSolverQueryStats(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
 
         try {
-          const auto& variables = PyTritonContext_AsTritonContext(self)->getSymbolicVariables();
+          const auto& stats = PyTritonContext_AsTritonContext(self)->getSolverQueryStats();
+          triton::uint32 index = 0;
 
-          ret = xPyDict_New();
-          for (auto sv: variables)
-            xPyDict_SetItem(ret, PyLong_FromUsize(sv.first), PySymbolicVariable(sv.second));
+          ret = xPyList_New(stats.size());
+          for (const auto& query : stats) {
+            PyObject* qdict = xPyDict_New();
+            xPyDict_SetItemString(qdict, "hash",           PyLong_FromUint64(query.hash));
+            xPyDict_SetItemString(qdict, "limit",          PyLong_FromUint32(query.limit));
+            xPyDict_SetItemString(qdict, "status",         PyLong_FromUint32(query.status));
+            xPyDict_SetItemString(qdict, "astSize",        PyLong_FromUsize(query.astSize));
+            xPyDict_SetItemString(qdict, "conversionTime", PyLong_FromUint64(query.conversionTime));
+            xPyDict_SetItemString(qdict, "solvingTime",    PyLong_FromUint64(query.solvingTime));
+            PyList_SetItem(ret, index++, qdict);
+          }
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -1629,12 +1963,208 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_getTaintedMemory(PyObject* self, PyObject* noarg) {
-        PyObject* ret = nullptr;
-        triton::usize size = 0, index = 0;
-
+      static PyObject* TritonContext_getSolverRecordedQueries(PyObject* self, PyObject* noarg) {
         try {
-          std::set<triton::uint64> addresses = PyTritonContext_AsTritonContext(self)->getTaintedMemory();
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getSolverRecordedQueries());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getSolverRecordingFailures(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getSolverRecordingFailures());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getSolverTimeout(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUint32(PyTritonContext_AsTritonContext(self)->getSolverTimeout());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getSymbolicExpressionFromId(PyObject* self, PyObject* symExprId) {
+        if (!PyLong_Check(symExprId) && !PyInt_Check(symExprId))
+          return PyErr_Format(PyExc_TypeError, "getSymbolicExpressionFromId(): Expects an integer as argument.");
+
+        try {
+          return PySymbolicExpression(PyTritonContext_AsTritonContext(self)->getSymbolicExpressionFromId(PyLong_AsUsize(symExprId)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getSymbolicExpressions(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          const auto& expressions = PyTritonContext_AsTritonContext(self)->getSymbolicExpressions();
+
+          ret = xPyDict_New();
+          for (auto it = expressions.begin(); it != expressions.end(); it++)
+            xPyDict_SetItem(ret, PyLong_FromUsize(it->first), PySymbolicExpression(it->second));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getSymbolicMemory(PyObject* self, PyObject* args) {
+        PyObject* ret  = nullptr;
+        PyObject* addr = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|O", &addr);
+
+        try {
+          if (addr == nullptr) {
+            auto regs = PyTritonContext_AsTritonContext(self)->getSymbolicMemory();
+
+            ret = xPyDict_New();
+            for (auto it = regs.begin(); it != regs.end(); it++) {
+              xPyDict_SetItem(ret, PyLong_FromUint64(it->first), PySymbolicExpression(it->second));
+            }
+          }
+          else if (addr != nullptr && (PyLong_Check(addr) || PyInt_Check(addr))) {
+            ret = PySymbolicExpression(PyTritonContext_AsTritonContext(self)->getSymbolicMemory(PyLong_AsUint64(addr)));
+          }
+          else
+            return PyErr_Format(PyExc_TypeError, "getSymbolicMemory(): Expects an integer or nothing as argument.");
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getSymbolicMemoryValue(PyObject* self, PyObject* mem) {
+        if (!PyLong_Check(mem) && !PyInt_Check(mem) && !PyMemoryAccess_Check(mem))
+          return PyErr_Format(PyExc_TypeError, "getSymbolicMemoryValue(): Expects an integer or a MemoryAccess as argument.");
+
+        try {
+          if (PyLong_Check(mem) || PyInt_Check(mem))
+            return PyLong_FromUint512(PyTritonContext_AsTritonContext(self)->getSymbolicMemoryValue(PyLong_AsUint64(mem)));
+          return PyLong_FromUint512(PyTritonContext_AsTritonContext(self)->getSymbolicMemoryValue(*PyMemoryAccess_AsMemoryAccess(mem)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getSymbolicRegisters(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          auto regs = PyTritonContext_AsTritonContext(self)->getSymbolicRegisters();
+
+          ret = xPyDict_New();
+          for (auto it = regs.begin(); it != regs.end(); it++) {
+            xPyDict_SetItem(ret, PyLong_FromUint64(it->first), PySymbolicExpression(it->second));
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getSymbolicRegister(PyObject* self, PyObject* reg) {
+        if (!PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "getSymbolicRegister(): Expects a Register as argument.");
+
+        try {
+          return PySymbolicExpression(PyTritonContext_AsTritonContext(self)->getSymbolicRegister(*PyRegister_AsRegister(reg)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getSymbolicRegisterValue(PyObject* self, PyObject* reg) {
+        if (!PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "getSymbolicRegisterValue(): Expects a Register as argument.");
+
+        try {
+          return PyLong_FromUint512(PyTritonContext_AsTritonContext(self)->getSymbolicRegisterValue(*PyRegister_AsRegister(reg)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getSymbolicVariableFromId(PyObject* self, PyObject* symVarId) {
+        if (!PyLong_Check(symVarId) && !PyInt_Check(symVarId))
+          return PyErr_Format(PyExc_TypeError, "getSymbolicVariableFromId(): Expects an integer as argument.");
+
+        try {
+          return PySymbolicVariable(PyTritonContext_AsTritonContext(self)->getSymbolicVariableFromId(PyLong_AsUsize(symVarId)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getSymbolicVariableFromName(PyObject* self, PyObject* symVarName) {
+        if (!PyString_Check(symVarName))
+          return PyErr_Format(PyExc_TypeError, "getSymbolicVariableFromName(): Expects a string as argument.");
+
+        try {
+          std::string arg = PyString_AsString(symVarName);
+          return PySymbolicVariable(PyTritonContext_AsTritonContext(self)->getSymbolicVariableFromName(arg));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getSymbolicVariables(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          const auto& variables = PyTritonContext_AsTritonContext(self)->getSymbolicVariables();
+
+          ret = xPyDict_New();
+          for (auto sv: variables)
+            xPyDict_SetItem(ret, PyLong_FromUsize(sv.first), PySymbolicVariable(sv.second));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getTaintedMemory(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+        triton::usize size = 0, index = 0;
+
+        try {
+          std::set<triton::uint64> addresses = PyTritonContext_AsTritonContext(self)->getTaintedMemory();
 
           size = addresses.size();
           ret = xPyList_New(size);
@@ -1651,6 +2181,29 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_getTaintedMemoryRanges(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+        triton::usize index = 0;
+
+        try {
+          auto ranges = PyTritonContext_AsTritonContext(self)->getTaintedMemoryRanges();
+
+          ret = xPyList_New(ranges.size());
+          for (const auto& range : ranges) {
+            PyObject* item = xPyTuple_New(2);
+            PyTuple_SetItem(item, 0, PyLong_FromUint64(range.first));
+            PyTuple_SetItem(item, 1, PyLong_FromUsize(range.second));
+            PyList_SetItem(ret, index++, item);
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* TritonContext_getTaintedRegisters(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
         triton::usize size = 0, index = 0;
@@ -1857,12 +2410,51 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_isSat(PyObject* self, PyObject* node) {
+      static PyObject* TritonContext_isSat(PyObject* self, PyObject* args) {
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+        PyObject* node    = nullptr;
+        PyObject* status  = nullptr;
+        PyObject* timeout = nullptr;
+        bool sat          = false;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOO", &node, &status, &timeout);
+
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "isSat(): Expects a AstNode as first argument.");
+
+        if (status != nullptr && !PyBool_Check(status))
+          return PyErr_Format(PyExc_TypeError, "isSat(): Expects a boolean as second argument.");
+
+        if (timeout != nullptr && !PyLong_Check(timeout) && !PyInt_Check(timeout))
+          return PyErr_Format(PyExc_TypeError, "isSat(): Expects an integer as third argument.");
+
+        try {
+          sat = PyTritonContext_AsTritonContext(self)->isSat(PyAstNode_AsAstNode(node), &st, (timeout != nullptr) ? PyLong_AsUint32(timeout) : 0);
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        if (status != nullptr && PyObject_IsTrue(status)) {
+          PyObject* tuple = xPyTuple_New(2);
+          PyTuple_SetItem(tuple, 0, PyBool_FromLong(sat));
+          PyTuple_SetItem(tuple, 1, PyLong_FromUint32(st));
+          return tuple;
+        }
+
+        if (sat == true)
+          Py_RETURN_TRUE;
+        Py_RETURN_FALSE;
+      }
+
+
+      static PyObject* TritonContext_isSessionSat(PyObject* self, PyObject* node) {
         if (!PyAstNode_Check(node))
-          return PyErr_Format(PyExc_TypeError, "isSat(): Expects a AstNode as argument.");
+          return PyErr_Format(PyExc_TypeError, "isSessionSat(): Expects a AstNode as argument.");
 
         try {
-          if (PyTritonContext_AsTritonContext(self)->isSat(PyAstNode_AsAstNode(node)) == true)
+          if (PyTritonContext_AsTritonContext(self)->isSessionSat(PyAstNode_AsAstNode(node)) == true)
             Py_RETURN_TRUE;
           Py_RETURN_FALSE;
         }
@@ -1978,6 +2570,19 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_popSolverScope(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->popSolverScope();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_processing(PyObject* self, PyObject* inst) {
         if (!PyInstruction_Check(inst))
           return PyErr_Format(PyExc_TypeError, "processing(): Expects an Instruction as argument.");
@@ -1993,6 +2598,19 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_pushSolverScope(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->pushSolverScope();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_removeAllCallbacks(PyObject* self, PyObject* noarg) {
         try {
           PyTritonContext_AsTritonContext(self)->removeAllCallbacks();
@@ -2070,6 +2688,19 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_resetSolverSession(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->resetSolverSession();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_setArchitecture(PyObject* self, PyObject* arg) {
         if (!PyLong_Check(arg) && !PyInt_Check(arg))
           return PyErr_Format(PyExc_TypeError, "setArchitecture(): Expects an ARCH as argument.");
@@ -2272,6 +2903,180 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_setConcreteVariableValues(PyObject* self, PyObject* values) {
+        std::map<triton::usize, triton::uint512> vmap;
+        PyObject* key   = nullptr;
+        PyObject* value = nullptr;
+        Py_ssize_t pos  = 0;
+
+        if (values == nullptr || !PyDict_Check(values))
+          return PyErr_Format(PyExc_TypeError, "setConcreteVariableValues(): Expects a dict as argument.");
+
+        while (PyDict_Next(values, &pos, &key, &value)) {
+          if (PySymbolicVariable_Check(key))
+            vmap[PySymbolicVariable_AsSymbolicVariable(key)->getId()] = PyLong_AsUint512(value);
+          else if (PyLong_Check(key) || PyInt_Check(key))
+            vmap[PyLong_AsUsize(key)] = PyLong_AsUint512(value);
+          else
+            return PyErr_Format(PyExc_TypeError, "setConcreteVariableValues(): Keys must be SymbolicVariable or integer.");
+        }
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setConcreteVariableValues(vmap);
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setDisassemblyCacheSize(PyObject* self, PyObject* size) {
+        if (!PyLong_Check(size) && !PyInt_Check(size))
+          return PyErr_Format(PyExc_TypeError, "setDisassemblyCacheSize(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setDisassemblyCacheSize(PyLong_AsUsize(size));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setSolver(PyObject* self, PyObject* solver) {
+        if (!PyLong_Check(solver) && !PyInt_Check(solver))
+          return PyErr_Format(PyExc_TypeError, "setSolver(): Expects a SOLVER as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setSolver(static_cast<triton::engines::solver::solver_e>(PyLong_AsUint32(solver)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setSolverMemoryLimit(PyObject* self, PyObject* limit) {
+        if (!PyLong_Check(limit) && !PyInt_Check(limit))
+          return PyErr_Format(PyExc_TypeError, "setSolverMemoryLimit(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setSolverMemoryLimit(PyLong_AsUint32(limit));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setSolverModelReuseSize(PyObject* self, PyObject* size) {
+        if (!PyLong_Check(size) && !PyInt_Check(size))
+          return PyErr_Format(PyExc_TypeError, "setSolverModelReuseSize(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setSolverModelReuseSize(PyLong_AsUsize(size));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setSolverQueryCacheFile(PyObject* self, PyObject* path) {
+        if (!PyString_Check(path))
+          return PyErr_Format(PyExc_TypeError, "setSolverQueryCacheFile(): Expects a string as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setSolverQueryCacheFile(PyString_AsString(path));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setSolverQueryCacheSize(PyObject* self, PyObject* size) {
+        if (!PyLong_Check(size) && !PyInt_Check(size))
+          return PyErr_Format(PyExc_TypeError, "setSolverQueryCacheSize(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setSolverQueryCacheSize(PyLong_AsUsize(size));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setSolverQueryRecordingDirectory(PyObject* self, PyObject* path) {
+        if (!PyString_Check(path))
+          return PyErr_Format(PyExc_TypeError, "setSolverQueryRecordingDirectory(): Expects a string as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setSolverQueryRecordingDirectory(PyString_AsString(path));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setSolverQueryStatsSize(PyObject* self, PyObject* size) {
+        if (!PyLong_Check(size) && !PyInt_Check(size))
+          return PyErr_Format(PyExc_TypeError, "setSolverQueryStatsSize(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setSolverQueryStatsSize(PyLong_AsUsize(size));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setSolverTimeout(PyObject* self, PyObject* timeout) {
+        if (!PyLong_Check(timeout) && !PyInt_Check(timeout))
+          return PyErr_Format(PyExc_TypeError, "setSolverTimeout(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setSolverTimeout(PyLong_AsUint32(timeout));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_setTaintMemory(PyObject* self, PyObject* args) {
         PyObject* mem  = nullptr;
         PyObject* flag = nullptr;
@@ -2514,6 +3319,62 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_taintMemoryRange(PyObject* self, PyObject* args) {
+        PyObject* baseAddr = nullptr;
+        PyObject* size     = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &baseAddr, &size) == false)
+          return PyErr_Format(PyExc_TypeError, "taintMemoryRange(): Invalid number of arguments");
+
+        if (baseAddr == nullptr || (!PyLong_Check(baseAddr) && !PyInt_Check(baseAddr)))
+          return PyErr_Format(PyExc_TypeError, "taintMemoryRange(): Expects an integer as first argument.");
+
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "taintMemoryRange(): Expects an integer as second argument.");
+
+        try {
+          if (PyTritonContext_AsTritonContext(self)->taintMemoryRange(PyLong_AsUint64(baseAddr), PyLong_AsUsize(size)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_taintMemoryWithLabel(PyObject* self, PyObject* args) {
+        PyObject* mem   = nullptr;
+        PyObject* label = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &mem, &label);
+
+        if (mem == nullptr || (!PyMemoryAccess_Check(mem) && !PyLong_Check(mem) && !PyInt_Check(mem)))
+          return PyErr_Format(PyExc_TypeError, "taintMemoryWithLabel(): Expects a MemoryAccess or an integer as first argument.");
+
+        if (label == nullptr || (!PyLong_Check(label) && !PyInt_Check(label)))
+          return PyErr_Format(PyExc_TypeError, "taintMemoryWithLabel(): Expects an integer as second argument.");
+
+        try {
+          triton::arch::MemoryAccess access;
+
+          if (PyMemoryAccess_Check(mem))
+            access = *PyMemoryAccess_AsMemoryAccess(mem);
+          else
+            access = triton::arch::MemoryAccess(PyLong_AsUint64(mem), BYTE_SIZE);
+
+          if (PyTritonContext_AsTritonContext(self)->taintMemoryWithLabel(access, PyLong_AsUint32(label)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* TritonContext_taintRegister(PyObject* self, PyObject* reg) {
         if (!PyRegister_Check(reg))
           return PyErr_Format(PyExc_TypeError, "taintRegister(): Expects a Register as argument.");
@@ -2529,6 +3390,30 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_taintRegisterWithLabel(PyObject* self, PyObject* args) {
+        PyObject* reg   = nullptr;
+        PyObject* label = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &reg, &label);
+
+        if (reg == nullptr || !PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "taintRegisterWithLabel(): Expects a Register as first argument.");
+
+        if (label == nullptr || (!PyLong_Check(label) && !PyInt_Check(label)))
+          return PyErr_Format(PyExc_TypeError, "taintRegisterWithLabel(): Expects an integer as second argument.");
+
+        try {
+          if (PyTritonContext_AsTritonContext(self)->taintRegisterWithLabel(*PyRegister_AsRegister(reg), PyLong_AsUint32(label)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* TritonContext_taintUnionMemoryImmediate(PyObject* self, PyObject* mem) {
         if (!PyMemoryAccess_Check(mem))
           return PyErr_Format(PyExc_TypeError, "taintUnionMemoryImmediate(): Expects a MemoryAccess as argument.");
@@ -2707,6 +3592,31 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_untaintMemoryRange(PyObject* self, PyObject* args) {
+        PyObject* baseAddr = nullptr;
+        PyObject* size     = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &baseAddr, &size) == false)
+          return PyErr_Format(PyExc_TypeError, "untaintMemoryRange(): Invalid number of arguments");
+
+        if (baseAddr == nullptr || (!PyLong_Check(baseAddr) && !PyInt_Check(baseAddr)))
+          return PyErr_Format(PyExc_TypeError, "untaintMemoryRange(): Expects an integer as first argument.");
+
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "untaintMemoryRange(): Expects an integer as second argument.");
+
+        try {
+          if (PyTritonContext_AsTritonContext(self)->untaintMemoryRange(PyLong_AsUint64(baseAddr), PyLong_AsUsize(size)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* TritonContext_untaintRegister(PyObject* self, PyObject* reg) {
         if (!PyRegister_Check(reg))
           return PyErr_Format(PyExc_TypeError, "untaintRegister(): Expects a Register as argument.");
@@ -2763,10 +3673,14 @@ namespace triton {
       //! TritonContext methods.
       PyMethodDef TritonContext_callbacks[] = {
         {"addCallback",                         (PyCFunction)TritonContext_addCallback,                            METH_VARARGS,       ""},
+        {"addSolverConstraint",                 (PyCFunction)TritonContext_addSolverConstraint,                    METH_O,             ""},
         {"assignSymbolicExpressionToMemory",    (PyCFunction)TritonContext_assignSymbolicExpressionToMemory,       METH_VARARGS,       ""},
         {"assignSymbolicExpressionToRegister",  (PyCFunction)TritonContext_assignSymbolicExpressionToRegister,     METH_VARARGS,       ""},
         {"buildSemantics",                      (PyCFunction)TritonContext_buildSemantics,                         METH_O,             ""},
+        {"clearDisassemblyCache",               (PyCFunction)TritonContext_clearDisassemblyCache,                  METH_NOARGS,        ""},
         {"clearPathConstraints",                (PyCFunction)TritonContext_clearPathConstraints,                   METH_NOARGS,        ""},
+        {"clearSolverQueryCache",               (PyCFunction)TritonContext_clearSolverQueryCache,                  METH_NOARGS,        ""},
+        {"clearSolverQueryStats",               (PyCFunction)TritonContext_clearSolverQueryStats,                  METH_NOARGS,        ""},
         {"concretizeAllMemory",                 (PyCFunction)TritonContext_concretizeAllMemory,                    METH_NOARGS,        ""},
         {"concretizeAllRegister",               (PyCFunction)TritonContext_concretizeAllRegister,                  METH_NOARGS,        ""},
         {"concretizeMemory",                    (PyCFunction)TritonContext_concretizeMemory,                       METH_O,             ""},
@@ -2787,15 +3701,20 @@ namespace triton {
         {"getArchitecture",                     (PyCFunction)TritonContext_getArchitecture,                        METH_NOARGS,        ""},
         {"getAstContext",                       (PyCFunction)TritonContext_getAstContext,                          METH_NOARGS,        ""},
         {"getAstRepresentationMode",            (PyCFunction)TritonContext_getAstRepresentationMode,               METH_NOARGS,        ""},
+        {"getBatchModels",                      (PyCFunction)TritonContext_getBatchModels,                         METH_VARARGS,       ""},
         {"getConcreteMemoryAreaValue",          (PyCFunction)TritonContext_getConcreteMemoryAreaValue,             METH_VARARGS,       ""},
         {"getConcreteMemoryValue",              (PyCFunction)TritonContext_getConcreteMemoryValue,                 METH_O,             ""},
         {"getConcreteRegisterValue",            (PyCFunction)TritonContext_getConcreteRegisterValue,               METH_O,             ""},
         {"getConcreteVariableValue",            (PyCFunction)TritonContext_getConcreteVariableValue,               METH_O,             ""},
+        {"getDisassemblyCacheHits",             (PyCFunction)TritonContext_getDisassemblyCacheHits,                METH_NOARGS,        ""},
+        {"getDisassemblyCacheMisses",           (PyCFunction)TritonContext_getDisassemblyCacheMisses,              METH_NOARGS,        ""},
+        {"getDisassemblyCacheSize",             (PyCFunction)TritonContext_getDisassemblyCacheSize,                METH_NOARGS,        ""},
         {"getGprBitSize",                       (PyCFunction)TritonContext_getGprBitSize,                          METH_NOARGS,        ""},
         {"getGprSize",                          (PyCFunction)TritonContext_getGprSize,                             METH_NOARGS,        ""},
         {"getImmediateAst",                     (PyCFunction)TritonContext_getImmediateAst,                        METH_O,             ""},
         {"getMemoryAst",                        (PyCFunction)TritonContext_getMemoryAst,                           METH_O,             ""},
-        {"getModel",                            (PyCFunction)TritonContext_getModel,                               METH_O,             ""},
+        {"getMemoryTaintLabels",                (PyCFunction)TritonContext_getMemoryTaintLabels,                   METH_O,             ""},
+        {"getModel",                            (PyCFunction)TritonContext_getModel,                               METH_VARARGS,       ""},
         {"getModels",                           (PyCFunction)TritonContext_getModels,                              METH_VARARGS,       ""},
         {"getParentRegister",                   (PyCFunction)TritonContext_getParentRegister,                      METH_O,             ""},
         {"getParentRegisters",                  (PyCFunction)TritonContext_getParentRegisters,                     METH_NOARGS,        ""},
@@ -2803,6 +3722,19 @@ namespace triton {
         {"getPathConstraintsAst",               (PyCFunction)TritonContext_getPathConstraintsAst,                  METH_NOARGS,        ""},
         {"getRegister",                         (PyCFunction)TritonContext_getRegister,                            METH_O,             ""},
         {"getRegisterAst",                      (PyCFunction)TritonContext_getRegisterAst,                         METH_O,             ""},
+        {"getRegisterTaintLabels",              (PyCFunction)TritonContext_getRegisterTaintLabels,                 METH_O,             ""},
+        {"getSessionModel",                     (PyCFunction)TritonContext_getSessionModel,                        METH_O,             ""},
+        {"getSolver",                           (PyCFunction)TritonContext_getSolver,                              METH_NOARGS,        ""},
+        {"getSolverMemoryLimit",                (PyCFunction)TritonContext_getSolverMemoryLimit,                   METH_NOARGS,        ""},
+        {"getSolverModelReuseHits",             (PyCFunction)TritonContext_getSolverModelReuseHits,                METH_NOARGS,        ""},
+        {"getSolverQueryCacheHits",             (PyCFunction)TritonContext_getSolverQueryCacheHits,                METH_NOARGS,        ""},
+        {"getSolverQueryCacheMisses",           (PyCFunction)TritonContext_getSolverQueryCacheMisses,              METH_NOARGS,        ""},
+        {"getSolverQueryCacheTimeSaved",        (PyCFunction)TritonContext_getSolverQueryCacheTimeSaved,           METH_NOARGS,        ""},
+        {"getSolverQueryRecordingDirectory",    (PyCFunction)TritonContext_getSolverQueryRecordingDirectory,       METH_NOARGS,        ""},
+        {"getSolverQueryStats",                 (PyCFunction)TritonContext_getSolverQueryStats,                    METH_NOARGS,        ""},
+        {"getSolverRecordedQueries",            (PyCFunction)TritonContext_getSolverRecordedQueries,               METH_NOARGS,        ""},
+        {"getSolverRecordingFailures",          (PyCFunction)TritonContext_getSolverRecordingFailures,             METH_NOARGS,        ""},
+        {"getSolverTimeout",                    (PyCFunction)TritonContext_getSolverTimeout,                       METH_NOARGS,        ""},
         {"getSymbolicExpressionFromId",         (PyCFunction)TritonContext_getSymbolicExpressionFromId,            METH_O,             ""},
         {"getSymbolicExpressions",              (PyCFunction)TritonContext_getSymbolicExpressions,                 METH_NOARGS,        ""},
         {"getSymbolicMemory",                   (PyCFunction)TritonContext_getSymbolicMemory,                      METH_VARARGS,       ""},
@@ -2814,6 +3746,7 @@ namespace triton {
         {"getSymbolicVariableFromName",         (PyCFunction)TritonContext_getSymbolicVariableFromName,            METH_O,             ""},
         {"getSymbolicVariables",                (PyCFunction)TritonContext_getSymbolicVariables,                   METH_NOARGS,        ""},
         {"getTaintedMemory",                    (PyCFunction)TritonContext_getTaintedMemory,                       METH_NOARGS,        ""},
+        {"getTaintedMemoryRanges",              (PyCFunction)TritonContext_getTaintedMemoryRanges,                 METH_NOARGS,        ""},
         {"getTaintedRegisters",                 (PyCFunction)TritonContext_getTaintedRegisters,                    METH_NOARGS,        ""},
         {"getTaintedSymbolicExpressions",       (PyCFunction)TritonContext_getTaintedSymbolicExpressions,          METH_NOARGS,        ""},
         {"isArchitectureValid",                 (PyCFunction)TritonContext_isArchitectureValid,                    METH_NOARGS,        ""},
@@ -2826,22 +3759,36 @@ namespace triton {
         {"isRegisterSymbolized",                (PyCFunction)TritonContext_isRegisterSymbolized,                   METH_O,             ""},
         {"isRegisterTainted",                   (PyCFunction)TritonContext_isRegisterTainted,                      METH_O,             ""},
         {"isRegisterValid",                     (PyCFunction)TritonContext_isRegisterValid,                        METH_O,             ""},
-        {"isSat",                               (PyCFunction)TritonContext_isSat,                                  METH_O     ,        ""},
+        {"isSat",                               (PyCFunction)TritonContext_isSat,                                  METH_VARARGS,       ""},
+        {"isSessionSat",                        (PyCFunction)TritonContext_isSessionSat,                           METH_O,             ""},
         {"isSymbolicEngineEnabled",             (PyCFunction)TritonContext_isSymbolicEngineEnabled,                METH_NOARGS,        ""},
         {"isSymbolicExpressionIdExists",        (PyCFunction)TritonContext_isSymbolicExpressionIdExists,           METH_O,             ""},
         {"isTaintEngineEnabled",                (PyCFunction)TritonContext_isTaintEngineEnabled,                   METH_NOARGS,        ""},
         {"newSymbolicExpression",               (PyCFunction)TritonContext_newSymbolicExpression,                  METH_VARARGS,       ""},
         {"newSymbolicVariable",                 (PyCFunction)TritonContext_newSymbolicVariable,                    METH_VARARGS,       ""},
+        {"popSolverScope",                      (PyCFunction)TritonContext_popSolverScope,                         METH_NOARGS,        ""},
         {"processing",                          (PyCFunction)TritonContext_processing,                             METH_O,             ""},
+        {"pushSolverScope",                     (PyCFunction)TritonContext_pushSolverScope,                        METH_NOARGS,        ""},
         {"removeAllCallbacks",                  (PyCFunction)TritonContext_removeAllCallbacks,                     METH_NOARGS,        ""},
         {"removeCallback",                      (PyCFunction)TritonContext_removeCallback,                         METH_VARARGS,       ""},
         {"reset",                               (PyCFunction)TritonContext_reset,                                  METH_NOARGS,        ""},
+        {"resetSolverSession",                  (PyCFunction)TritonContext_resetSolverSession,                     METH_NOARGS,        ""},
         {"setArchitecture",                     (PyCFunction)TritonContext_setArchitecture,                        METH_O,             ""},
         {"setAstRepresentationMode",            (PyCFunction)TritonContext_setAstRepresentationMode,               METH_O,             ""},
         {"setConcreteMemoryAreaValue",          (PyCFunction)TritonContext_setConcreteMemoryAreaValue,             METH_VARARGS,       ""},
         {"setConcreteMemoryValue",              (PyCFunction)TritonContext_setConcreteMemoryValue,                 METH_VARARGS,       ""},
         {"setConcreteRegisterValue",            (PyCFunction)TritonContext_setConcreteRegisterValue,               METH_VARARGS,       ""},
         {"setConcreteVariableValue",            (PyCFunction)TritonContext_setConcreteVariableValue,               METH_VARARGS,       ""},
+        {"setConcreteVariableValues",           (PyCFunction)TritonContext_setConcreteVariableValues,              METH_O,             ""},
+        {"setDisassemblyCacheSize",             (PyCFunction)TritonContext_setDisassemblyCacheSize,                METH_O,             ""},
+        {"setSolver",                           (PyCFunction)TritonContext_setSolver,                              METH_O,             ""},
+        {"setSolverMemoryLimit",                (PyCFunction)TritonContext_setSolverMemoryLimit,                   METH_O,             ""},
+        {"setSolverModelReuseSize",             (PyCFunction)TritonContext_setSolverModelReuseSize,                METH_O,             ""},
+        {"setSolverQueryCacheFile",             (PyCFunction)TritonContext_setSolverQueryCacheFile,                METH_O,             ""},
+        {"setSolverQueryCacheSize",             (PyCFunction)TritonContext_setSolverQueryCacheSize,                METH_O,             ""},
+        {"setSolverQueryRecordingDirectory",    (PyCFunction)TritonContext_setSolverQueryRecordingDirectory,       METH_O,             ""},
+        {"setSolverQueryStatsSize",             (PyCFunction)TritonContext_setSolverQueryStatsSize,                METH_O,             ""},
+        {"setSolverTimeout",                    (PyCFunction)TritonContext_setSolverTimeout,                       METH_O,             ""},
         {"setTaintMemory",                      (PyCFunction)TritonContext_setTaintMemory,                         METH_VARARGS,       ""},
         {"setTaintRegister",                    (PyCFunction)TritonContext_setTaintRegister,                       METH_VARARGS,       ""},
         {"simplify",                            (PyCFunction)TritonContext_simplify,                               METH_VARARGS,       ""},
@@ -2853,7 +3800,10 @@ namespace triton {
         {"taintAssignmentRegisterMemory",       (PyCFunction)TritonContext_taintAssignmentRegisterMemory,          METH_VARARGS,       ""},
         {"taintAssignmentRegisterRegister",     (PyCFunction)TritonContext_taintAssignmentRegisterRegister,        METH_VARARGS,       ""},
         {"taintMemory",                         (PyCFunction)TritonContext_taintMemory,                            METH_O,             ""},
+        {"taintMemoryRange",                    (PyCFunction)TritonContext_taintMemoryRange,                       METH_VARARGS,       ""},
+        {"taintMemoryWithLabel",                (PyCFunction)TritonContext_taintMemoryWithLabel,                   METH_VARARGS,       ""},
         {"taintRegister",                       (PyCFunction)TritonContext_taintRegister,                          METH_O,             ""},
+        {"taintRegisterWithLabel",              (PyCFunction)TritonContext_taintRegisterWithLabel,                 METH_VARARGS,       ""},
         {"taintUnionMemoryImmediate",           (PyCFunction)TritonContext_taintUnionMemoryImmediate,              METH_O,             ""},
         {"taintUnionMemoryMemory",              (PyCFunction)TritonContext_taintUnionMemoryMemory,                 METH_VARARGS,       ""},
         {"taintUnionMemoryRegister",            (PyCFunction)TritonContext_taintUnionMemoryRegister,               METH_VARARGS,       ""},
@@ -2862,6 +3812,7 @@ namespace triton {
         {"taintUnionRegisterRegister",          (PyCFunction)TritonContext_taintUnionRegisterRegister,             METH_VARARGS,       ""},
         {"unmapMemory",                         (PyCFunction)TritonContext_unmapMemory,                            METH_VARARGS,       ""},
         {"untaintMemory",                       (PyCFunction)TritonContext_untaintMemory,                          METH_O,             ""},
+        {"untaintMemoryRange",                  (PyCFunction)TritonContext_untaintMemoryRange,                     METH_VARARGS,       ""},
         {"untaintRegister",                     (PyCFunction)TritonContext_untaintRegister,                        METH_O,             ""},
         {nullptr,                               nullptr,                                                           0,                  nullptr}
       };
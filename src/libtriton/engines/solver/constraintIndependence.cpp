@@ -0,0 +1,156 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <unordered_map>
+
+#include <triton/astContext.hpp>
+#include <triton/constraintIndependence.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/symbolicExpression.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      ConstraintIndependence::ConstraintIndependence(const triton::ast::SharedAbstractNode& node) {
+        std::unordered_map<const triton::ast::AbstractNode*, triton::usize> owner;
+        std::vector<std::pair<triton::usize, triton::engines::symbolic::SharedSymbolicVariable>> variables;
+        std::vector<triton::usize> parents;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("ConstraintIndependence::ConstraintIndependence(): node cannot be null.");
+
+        auto conjuncts = ConstraintIndependence::getConjuncts(node);
+
+        /* Union-find on the conjuncts */
+        auto find = [&parents](triton::usize i) {
+          while (parents[i] != i) {
+            parents[i] = parents[parents[i]];
+            i = parents[i];
+          }
+          return i;
+        };
+
+        /*
+         *  Each symbolized node is expanded by the first conjunct which reaches it.
+         *  A conjunct which reaches it later is merged with the first one, so the
+         *  whole slicing is linear in the size of the DAG.
+         */
+        for (triton::usize i = 0; i < conjuncts.size(); i++) {
+          parents.push_back(i);
+          triton::ast::postOrderTraversal(conjuncts[i], true /* unroll */,
+            [&](const triton::ast::SharedAbstractNode& n) {
+              if (n->getType() == triton::ast::VARIABLE_NODE)
+                variables.push_back(std::make_pair(i, reinterpret_cast<triton::ast::VariableNode*>(n.get())->getSymbolicVariable()));
+            },
+            [&](const triton::ast::SharedAbstractNode& n) {
+              if (n->isSymbolized() == false)
+                return true;
+              auto it = owner.find(n.get());
+              if (it == owner.end()) {
+                owner[n.get()] = i;
+                return false;
+              }
+              parents[find(i)] = find(it->second);
+              return true;
+            }
+          );
+        }
+
+        /* A partition is solved if one of its conjuncts is false with the concrete values */
+        std::vector<bool> solved(conjuncts.size(), false);
+        this->partitions = 0;
+        for (triton::usize i = 0; i < conjuncts.size(); i++) {
+          if (find(i) == i)
+            this->partitions++;
+          if (conjuncts[i]->evaluate() == 0)
+            solved[find(i)] = true;
+        }
+
+        for (triton::usize i = 0; i < conjuncts.size(); i++) {
+          if (solved[find(i)])
+            this->constraints.push_back(conjuncts[i]);
+        }
+
+        for (const auto& item : variables) {
+          const auto& var = item.second;
+          if (solved[find(item.first)] == false)
+            this->concreteModel[var->getId()] = SolverModel(var, node->getContext().getVariableValue(var->getId()));
+        }
+
+        if (this->constraints.size() == 1)
+          this->query = this->constraints.front();
+        else if (this->constraints.size() > 1)
+          this->query = node->getContext().land(this->constraints);
+
+        this->conjuncts = conjuncts.size();
+      }
+
+
+      std::vector<triton::ast::SharedAbstractNode> ConstraintIndependence::getConjuncts(const triton::ast::SharedAbstractNode& node) {
+        std::vector<triton::ast::SharedAbstractNode> conjuncts;
+        std::vector<triton::ast::SharedAbstractNode> worklist = {node};
+
+        /* Path constraints are left-deep chains, so we use a worklist */
+        while (worklist.empty() == false) {
+          auto n = worklist.back();
+          worklist.pop_back();
+
+          if (n->getType() == triton::ast::REFERENCE_NODE) {
+            worklist.push_back(reinterpret_cast<triton::ast::ReferenceNode*>(n.get())->getSymbolicExpression()->getAst());
+            continue;
+          }
+
+          if (n->getType() == triton::ast::LAND_NODE) {
+            const auto& children = n->getChildren();
+            for (auto it = children.rbegin(); it != children.rend(); it++)
+              worklist.push_back(*it);
+            continue;
+          }
+
+          conjuncts.push_back(n);
+        }
+
+        return conjuncts;
+      }
+
+
+      triton::ast::SharedAbstractNode ConstraintIndependence::getQuery(void) const {
+        return this->query;
+      }
+
+
+      const std::vector<triton::ast::SharedAbstractNode>& ConstraintIndependence::getConstraints(void) const {
+        return this->constraints;
+      }
+
+
+      const std::map<triton::uint32, SolverModel>& ConstraintIndependence::getConcreteModel(void) const {
+        return this->concreteModel;
+      }
+
+
+      triton::usize ConstraintIndependence::getNumberOfPartitions(void) const {
+        return this->partitions;
+      }
+
+
+      triton::usize ConstraintIndependence::getNumberOfConjuncts(void) const {
+        return this->conjuncts;
+      }
+
+
+      void ConstraintIndependence::complete(std::map<triton::uint32, SolverModel>& model) const {
+        for (const auto& item : this->concreteModel)
+          model.insert(item);
+      }
+
+    };
+  };
+};
@@ -0,0 +1,720 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <random>
+#include <set>
+#include <unordered_map>
+
+#include <triton/exceptions.hpp>
+#include <triton/localSearchSolver.hpp>
+#include <triton/symbolicExpression.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      /* Returns the mask of a value of `size` bits */
+      static inline triton::uint64 mask64(triton::uint32 size) {
+        return (size >= 64) ? std::numeric_limits<triton::uint64>::max() : ((static_cast<triton::uint64>(1) << size) - 1);
+      }
+
+
+      /* Saturating addition of two distances */
+      static inline triton::uint64 addDistance(triton::uint64 a, triton::uint64 b) {
+        triton::uint64 r = a + b;
+        return (r < a) ? std::numeric_limits<triton::uint64>::max() : r;
+      }
+
+
+      /* Sign extension of a value of `size` bits */
+      static inline triton::sint64 sx64(triton::uint64 v, triton::uint32 size) {
+        if (size >= 64)
+          return static_cast<triton::sint64>(v);
+        return static_cast<triton::sint64>(v << (64 - size)) >> (64 - size);
+      }
+
+
+      CompiledConstraint::CompiledConstraint() {
+        this->root = 0;
+      }
+
+
+      triton::uint32 CompiledConstraint::newSlot(triton::uint32 size, triton::uint64 value) {
+        this->values.push_back(value);
+        this->sizes.push_back(size);
+        this->distances.push_back(value ? std::make_pair<triton::uint64, triton::uint64>(0, 1) : std::make_pair<triton::uint64, triton::uint64>(1, 0));
+        return static_cast<triton::uint32>(this->values.size() - 1);
+      }
+
+
+      void CompiledConstraint::addToDictionary(triton::uint64 value, triton::uint32 size) {
+        /* The dictionary is tried on each variable, so it is kept small */
+        if (this->dictionary.size() >= 256)
+          return;
+
+        for (triton::uint64 v : {value, value + 1, value - 1})
+          this->dictionary.push_back(v & mask64(size));
+
+        /* Constraints on input bytes often compare their concatenation to a constant */
+        for (triton::uint32 i = 8; i < size; i += 8)
+          this->dictionary.push_back((value >> i) & 0xff);
+
+        std::sort(this->dictionary.begin(), this->dictionary.end());
+        this->dictionary.erase(std::unique(this->dictionary.begin(), this->dictionary.end()), this->dictionary.end());
+      }
+
+
+      bool CompiledConstraint::compile(const triton::ast::SharedAbstractNode& node) {
+        std::unordered_map<const triton::ast::AbstractNode*, triton::uint32> slots;
+        bool supported = true;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("CompiledConstraint::compile(): node cannot be null.");
+
+        /* The nodes which are not symbolized are skipped by the traversal, they are constants */
+        auto slot = [&](const triton::ast::SharedAbstractNode& n) -> triton::uint32 {
+          auto it = slots.find(n.get());
+          if (it != slots.end())
+            return it->second;
+          if (n->getBitvectorSize() > 64) {
+            supported = false;
+            return 0;
+          }
+          triton::uint64 value = n->evaluate().convert_to<triton::uint64>();
+          if (n->isLogical() == false)
+            this->addToDictionary(value, n->getBitvectorSize());
+          return slots[n.get()] = this->newSlot(n->getBitvectorSize(), value);
+        };
+
+        triton::ast::postOrderTraversal(node, true /* unroll */,
+          [&](const triton::ast::SharedAbstractNode& n) {
+            const auto& children = n->getChildren();
+            Instruction ins;
+
+            if (supported == false)
+              return;
+
+            if (n->getBitvectorSize() > 64) {
+              supported = false;
+              return;
+            }
+
+            ins.type  = n->getType();
+            ins.size  = n->getBitvectorSize();
+            ins.imm   = 0;
+            ins.args  = static_cast<triton::uint32>(this->operands.size());
+            ins.nargs = 0;
+
+            switch (n->getType()) {
+              case triton::ast::REFERENCE_NODE:
+                slots[n.get()] = slot(reinterpret_cast<triton::ast::ReferenceNode*>(n.get())->getSymbolicExpression()->getAst());
+                return;
+
+              case triton::ast::VARIABLE_NODE: {
+                auto var = reinterpret_cast<triton::ast::VariableNode*>(n.get())->getSymbolicVariable();
+                slots[n.get()] = this->newSlot(ins.size, n->evaluate().convert_to<triton::uint64>());
+                this->variables.push_back(std::make_pair(var, slots[n.get()]));
+                return;
+              }
+
+              /* Integer operands are immediates */
+              case triton::ast::BVROL_NODE:
+              case triton::ast::BVROR_NODE:
+                ins.imm = reinterpret_cast<triton::ast::IntegerNode*>(children[1].get())->getInteger().convert_to<triton::uint32>() % ins.size;
+                this->operands.push_back(slot(children[0]));
+                break;
+
+              case triton::ast::EXTRACT_NODE:
+                ins.imm = reinterpret_cast<triton::ast::IntegerNode*>(children[1].get())->getInteger().convert_to<triton::uint32>();
+                this->operands.push_back(slot(children[2]));
+                break;
+
+              case triton::ast::SX_NODE:
+              case triton::ast::ZX_NODE:
+                this->operands.push_back(slot(children[1]));
+                break;
+
+              case triton::ast::ASSERT_NODE:
+              case triton::ast::BVADD_NODE:
+              case triton::ast::BVAND_NODE:
+              case triton::ast::BVASHR_NODE:
+              case triton::ast::BVLSHR_NODE:
+              case triton::ast::BVMUL_NODE:
+              case triton::ast::BVNAND_NODE:
+              case triton::ast::BVNEG_NODE:
+              case triton::ast::BVNOR_NODE:
+              case triton::ast::BVNOT_NODE:
+              case triton::ast::BVOR_NODE:
+              case triton::ast::BVSDIV_NODE:
+              case triton::ast::BVSGE_NODE:
+              case triton::ast::BVSGT_NODE:
+              case triton::ast::BVSHL_NODE:
+              case triton::ast::BVSLE_NODE:
+              case triton::ast::BVSLT_NODE:
+              case triton::ast::BVSMOD_NODE:
+              case triton::ast::BVSREM_NODE:
+              case triton::ast::BVSUB_NODE:
+              case triton::ast::BVUDIV_NODE:
+              case triton::ast::BVUGE_NODE:
+              case triton::ast::BVUGT_NODE:
+              case triton::ast::BVULE_NODE:
+              case triton::ast::BVULT_NODE:
+              case triton::ast::BVUREM_NODE:
+              case triton::ast::BVXNOR_NODE:
+              case triton::ast::BVXOR_NODE:
+              case triton::ast::CONCAT_NODE:
+              case triton::ast::DISTINCT_NODE:
+              case triton::ast::EQUAL_NODE:
+              case triton::ast::IFF_NODE:
+              case triton::ast::ITE_NODE:
+              case triton::ast::LAND_NODE:
+              case triton::ast::LNOT_NODE:
+              case triton::ast::LOR_NODE:
+                for (const auto& child : children)
+                  this->operands.push_back(slot(child));
+                break;
+
+              default:
+                supported = false;
+                return;
+            }
+
+            ins.nargs = static_cast<triton::uint32>(this->operands.size()) - ins.args;
+            ins.dst   = this->newSlot(ins.size, 0);
+            slots[n.get()] = ins.dst;
+            this->code.push_back(ins);
+          },
+          [](const triton::ast::SharedAbstractNode& n) {
+            return n->isSymbolized() == false;
+          }
+        );
+
+        if (supported)
+          this->root = slot(node);
+
+        return supported;
+      }
+
+
+      const std::vector<std::pair<triton::engines::symbolic::SharedSymbolicVariable, triton::uint32>>& CompiledConstraint::getVariables(void) const {
+        return this->variables;
+      }
+
+
+      const std::vector<triton::uint64>& CompiledConstraint::getDictionary(void) const {
+        return this->dictionary;
+      }
+
+
+      std::vector<triton::uint64> CompiledConstraint::getConcreteAssignment(void) const {
+        std::vector<triton::uint64> assignment;
+
+        for (const auto& var : this->variables)
+          assignment.push_back(this->values[var.second]);
+
+        return assignment;
+      }
+
+
+      triton::uint64 CompiledConstraint::run(const std::vector<triton::uint64>& assignment) {
+        std::vector<triton::uint64>& v = this->values;
+        std::vector<std::pair<triton::uint64, triton::uint64>>& d = this->distances;
+
+        for (triton::usize i = 0; i < this->variables.size(); i++) {
+          triton::uint32 s = this->variables[i].second;
+          v[s] = assignment[i] & mask64(this->sizes[s]);
+          d[s] = v[s] ? std::make_pair<triton::uint64, triton::uint64>(0, 1) : std::make_pair<triton::uint64, triton::uint64>(1, 0);
+        }
+
+        for (const auto& ins : this->code) {
+          const triton::uint32* a = &this->operands[ins.args];
+          triton::uint64 mask     = mask64(ins.size);
+          triton::uint64 r        = 0;
+          bool distance           = false;
+
+          /* Distances of the unsigned comparisons x < y and x <= y */
+          auto ult = [&](triton::uint64 x, triton::uint64 y) {
+            d[ins.dst] = (x < y) ? std::make_pair(static_cast<triton::uint64>(0), y - x) : std::make_pair(addDistance(x - y, 1), static_cast<triton::uint64>(0));
+            distance   = true;
+            return x < y;
+          };
+
+          auto ule = [&](triton::uint64 x, triton::uint64 y) {
+            d[ins.dst] = (x <= y) ? std::make_pair(static_cast<triton::uint64>(0), addDistance(y - x, 1)) : std::make_pair(x - y, static_cast<triton::uint64>(0));
+            distance   = true;
+            return x <= y;
+          };
+
+          /* Signed comparisons are unsigned ones with the sign bit flipped */
+          auto sign = [&](triton::uint64 x) {
+            return x ^ (static_cast<triton::uint64>(1) << (this->sizes[a[0]] - 1));
+          };
+
+          switch (ins.type) {
+            case triton::ast::ASSERT_NODE:  r = v[a[0]]; d[ins.dst] = d[a[0]]; distance = true; break;
+            case triton::ast::BVADD_NODE:   r = (v[a[0]] + v[a[1]]) & mask; break;
+            case triton::ast::BVAND_NODE:   r = v[a[0]] & v[a[1]]; break;
+            case triton::ast::BVMUL_NODE:   r = (v[a[0]] * v[a[1]]) & mask; break;
+            case triton::ast::BVNAND_NODE:  r = ~(v[a[0]] & v[a[1]]) & mask; break;
+            case triton::ast::BVNEG_NODE:   r = (~v[a[0]] + 1) & mask; break;
+            case triton::ast::BVNOR_NODE:   r = ~(v[a[0]] | v[a[1]]) & mask; break;
+            case triton::ast::BVNOT_NODE:   r = ~v[a[0]] & mask; break;
+            case triton::ast::BVOR_NODE:    r = v[a[0]] | v[a[1]]; break;
+            case triton::ast::BVSUB_NODE:   r = (v[a[0]] - v[a[1]]) & mask; break;
+            case triton::ast::BVXNOR_NODE:  r = ~(v[a[0]] ^ v[a[1]]) & mask; break;
+            case triton::ast::BVXOR_NODE:   r = v[a[0]] ^ v[a[1]]; break;
+            case triton::ast::BVUGE_NODE:   r = ule(v[a[1]], v[a[0]]); break;
+            case triton::ast::BVUGT_NODE:   r = ult(v[a[1]], v[a[0]]); break;
+            case triton::ast::BVULE_NODE:   r = ule(v[a[0]], v[a[1]]); break;
+            case triton::ast::BVULT_NODE:   r = ult(v[a[0]], v[a[1]]); break;
+            case triton::ast::BVSGE_NODE:   r = ule(sign(v[a[1]]), sign(v[a[0]])); break;
+            case triton::ast::BVSGT_NODE:   r = ult(sign(v[a[1]]), sign(v[a[0]])); break;
+            case triton::ast::BVSLE_NODE:   r = ule(sign(v[a[0]]), sign(v[a[1]])); break;
+            case triton::ast::BVSLT_NODE:   r = ult(sign(v[a[0]]), sign(v[a[1]])); break;
+            case triton::ast::ITE_NODE:     r = v[a[0]] ? v[a[1]] : v[a[2]]; break;
+            case triton::ast::ZX_NODE:      r = v[a[0]]; break;
+
+            case triton::ast::DISTINCT_NODE:
+            case triton::ast::EQUAL_NODE: {
+              triton::uint64 m = mask64(this->sizes[a[0]]);
+              triton::uint64 x = v[a[0]];
+              triton::uint64 y = v[a[1]];
+              triton::uint64 e = std::min((x - y) & m, (y - x) & m);
+              d[ins.dst] = (x == y) ? std::make_pair<triton::uint64, triton::uint64>(0, 1) : std::make_pair(e, static_cast<triton::uint64>(0));
+              if (ins.type == triton::ast::DISTINCT_NODE)
+                d[ins.dst] = std::make_pair(d[ins.dst].second, d[ins.dst].first);
+              r = (ins.type == triton::ast::EQUAL_NODE) ? (x == y) : (x != y);
+              distance = true;
+              break;
+            }
+
+            case triton::ast::BVSHL_NODE:
+              r = (v[a[1]] >= ins.size) ? 0 : ((v[a[0]] << v[a[1]]) & mask);
+              break;
+
+            case triton::ast::BVLSHR_NODE:
+              r = (v[a[1]] >= ins.size) ? 0 : (v[a[0]] >> v[a[1]]);
+              break;
+
+            case triton::ast::BVASHR_NODE: {
+              triton::sint64 x = sx64(v[a[0]], ins.size);
+              r = static_cast<triton::uint64>(x >> std::min<triton::uint64>(v[a[1]], 63)) & mask;
+              break;
+            }
+
+            case triton::ast::BVROL_NODE:
+              r = ins.imm ? (((v[a[0]] << ins.imm) | (v[a[0]] >> (ins.size - ins.imm))) & mask) : v[a[0]];
+              break;
+
+            case triton::ast::BVROR_NODE:
+              r = ins.imm ? (((v[a[0]] >> ins.imm) | (v[a[0]] << (ins.size - ins.imm))) & mask) : v[a[0]];
+              break;
+
+            case triton::ast::BVSDIV_NODE: {
+              triton::sint64 x = sx64(v[a[0]], ins.size);
+              triton::sint64 y = sx64(v[a[1]], ins.size);
+              if (y == 0)
+                r = (x < 0) ? 1 : mask;
+              else if (y == -1)
+                r = (0 - v[a[0]]) & mask;
+              else
+                r = static_cast<triton::uint64>(x / y) & mask;
+              break;
+            }
+
+            case triton::ast::BVSMOD_NODE: {
+              triton::sint64 x = sx64(v[a[0]], ins.size);
+              triton::sint64 y = sx64(v[a[1]], ins.size);
+              if (y == 0)
+                r = v[a[0]];
+              else if (y == -1)
+                r = 0;
+              else {
+                triton::sint64 m = x % y;
+                if (m != 0 && ((m < 0) != (y < 0)))
+                  m += y;
+                r = static_cast<triton::uint64>(m) & mask;
+              }
+              break;
+            }
+
+            case triton::ast::BVSREM_NODE: {
+              triton::sint64 x = sx64(v[a[0]], ins.size);
+              triton::sint64 y = sx64(v[a[1]], ins.size);
+              if (y == 0)
+                r = v[a[0]];
+              else if (y == -1)
+                r = 0;
+              else
+                r = static_cast<triton::uint64>(x % y) & mask;
+              break;
+            }
+
+            case triton::ast::BVUDIV_NODE:
+              r = (v[a[1]] == 0) ? mask : (v[a[0]] / v[a[1]]);
+              break;
+
+            case triton::ast::BVUREM_NODE:
+              r = (v[a[1]] == 0) ? v[a[0]] : (v[a[0]] % v[a[1]]);
+              break;
+
+            case triton::ast::CONCAT_NODE:
+              for (triton::uint32 i = 0; i < ins.nargs; i++)
+                r = (this->sizes[a[i]] >= 64) ? v[a[i]] : ((r << this->sizes[a[i]]) | v[a[i]]);
+              break;
+
+            case triton::ast::EXTRACT_NODE:
+              r = (v[a[0]] >> ins.imm) & mask;
+              break;
+
+            case triton::ast::SX_NODE:
+              r = static_cast<triton::uint64>(sx64(v[a[0]], this->sizes[a[0]])) & mask;
+              break;
+
+            case triton::ast::IFF_NODE: {
+              const auto& p = d[a[0]];
+              const auto& q = d[a[1]];
+              d[ins.dst] = std::make_pair(
+                std::min(addDistance(p.first, q.first), addDistance(p.second, q.second)),
+                std::min(addDistance(p.first, q.second), addDistance(p.second, q.first))
+              );
+              r = ((v[a[0]] != 0) == (v[a[1]] != 0));
+              distance = true;
+              break;
+            }
+
+            /* A conjunction is as far from true as the sum of its conjuncts */
+            case triton::ast::LAND_NODE: {
+              std::pair<triton::uint64, triton::uint64> dist(0, std::numeric_limits<triton::uint64>::max());
+              r = 1;
+              for (triton::uint32 i = 0; i < ins.nargs; i++) {
+                r = r && v[a[i]];
+                dist.first  = addDistance(dist.first, d[a[i]].first);
+                dist.second = std::min(dist.second, d[a[i]].second);
+              }
+              d[ins.dst] = dist;
+              distance = true;
+              break;
+            }
+
+            /* A disjunction is as far from true as its closest disjunct */
+            case triton::ast::LOR_NODE: {
+              std::pair<triton::uint64, triton::uint64> dist(std::numeric_limits<triton::uint64>::max(), 0);
+              r = 0;
+              for (triton::uint32 i = 0; i < ins.nargs; i++) {
+                r = r || v[a[i]];
+                dist.first  = std::min(dist.first, d[a[i]].first);
+                dist.second = addDistance(dist.second, d[a[i]].second);
+              }
+              d[ins.dst] = dist;
+              distance = true;
+              break;
+            }
+
+            case triton::ast::LNOT_NODE:
+              r = !v[a[0]];
+              d[ins.dst] = std::make_pair(d[a[0]].second, d[a[0]].first);
+              distance = true;
+              break;
+
+            default:
+              throw triton::exceptions::SolverEngine("CompiledConstraint::run(): Invalid instruction.");
+          }
+
+          v[ins.dst] = r;
+          if (distance == false)
+            d[ins.dst] = r ? std::make_pair<triton::uint64, triton::uint64>(0, 1) : std::make_pair<triton::uint64, triton::uint64>(1, 0);
+        }
+
+        return d[this->root].first;
+      }
+
+
+      LocalSearchSolver::LocalSearchSolver(triton::uint32 budget) {
+        this->budget    = budget;
+        this->hits      = 0;
+        this->fallbacks = 0;
+      }
+
+
+      std::list<std::map<triton::uint32, SolverModel>> LocalSearchSolver::search(CompiledConstraint& program, triton::uint32 limit, triton::uint32 budget) {
+        std::list<std::map<triton::uint32, SolverModel>> models;
+        std::set<std::vector<triton::uint64>> found;
+        std::mt19937_64 rng(0);
+
+        const auto& variables  = program.getVariables();
+        const auto& dictionary = program.getDictionary();
+        const auto  initial    = program.getConcreteAssignment();
+        const auto  deadline   = std::chrono::steady_clock::now() + std::chrono::milliseconds(budget);
+
+        /* The models already found do not satisfy the search anymore */
+        auto cost = [&](const std::vector<triton::uint64>& assignment) {
+          triton::uint64 d = program.run(assignment);
+          return (d == 0 && found.count(assignment)) ? 1 : d;
+        };
+
+        std::vector<triton::uint64> current = initial;
+        triton::uint64 best  = cost(current);
+        triton::usize  stuck = 0;
+
+        while (found.size() < limit) {
+          bool improved = false;
+
+          if (best == 0) {
+            std::map<triton::uint32, SolverModel> model;
+            for (triton::usize i = 0; i < variables.size(); i++)
+              model[variables[i].first->getId()] = SolverModel(variables[i].first, current[i]);
+            found.insert(current);
+            models.push_back(model);
+            best = cost(current);
+            continue;
+          }
+
+          /* A constant constraint does not depend on the assignment */
+          if (variables.empty() || std::chrono::steady_clock::now() >= deadline)
+            break;
+
+          /* Moves one variable at a time to its best neighbour */
+          for (triton::usize i = 0; i < variables.size() && best; i++) {
+            triton::uint32 size  = variables[i].first->getSize();
+            triton::uint64 mask  = mask64(size);
+            triton::uint64 value = current[i];
+            triton::uint64 next  = value;
+
+            auto neighbour = [&](triton::uint64 candidate) {
+              candidate &= mask;
+              if (candidate == value)
+                return;
+              current[i] = candidate;
+              triton::uint64 d = cost(current);
+              if (d < best) {
+                best = d;
+                next = candidate;
+              }
+            };
+
+            for (triton::uint32 b = 0; b < size; b++) {
+              neighbour(value ^ (static_cast<triton::uint64>(1) << b));
+              neighbour(value + (static_cast<triton::uint64>(1) << b));
+              neighbour(value - (static_cast<triton::uint64>(1) << b));
+            }
+
+            for (triton::uint64 c : dictionary)
+              neighbour(c);
+
+            current[i] = next;
+            if (next == value)
+              continue;
+
+            /* Keeps going in the same direction while it gets closer */
+            triton::uint64 delta = next - value;
+            while (best) {
+              delta <<= 1;
+              current[i] = (next + delta) & mask;
+              triton::uint64 d = cost(current);
+              if (d >= best || delta == 0) {
+                current[i] = next;
+                break;
+              }
+              best = d;
+              next = current[i];
+            }
+
+            improved = true;
+            if (std::chrono::steady_clock::now() >= deadline)
+              break;
+          }
+
+          /* A local minimum, perturbs one variable or restarts from the concrete values */
+          if (improved == false && best) {
+            if (++stuck % 16 == 0)
+              current = initial;
+            triton::usize i = rng() % variables.size();
+            if ((rng() & 1) && dictionary.size())
+              current[i] = dictionary[rng() % dictionary.size()];
+            else
+              current[i] = rng();
+            current[i] &= mask64(variables[i].first->getSize());
+            best = cost(current);
+          }
+        }
+
+        return models;
+      }
+
+
+      std::list<std::map<triton::uint32, SolverModel>> LocalSearchSolver::solve(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::uint32 timeout, triton::uint32 memoryLimit, SolverQueryStats& stats) const {
+        std::list<std::map<triton::uint32, SolverModel>> ret;
+        CompiledConstraint program;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("LocalSearchSolver::solve(): node cannot be null.");
+
+        const triton::ast::SharedAbstractNode& onode = (node->getType() == triton::ast::ASSERT_NODE) ? node->getChildren()[0] : node;
+        if (onode->isLogical() == false)
+          throw triton::exceptions::SolverEngine("LocalSearchSolver::solve(): Must be a logical node.");
+
+        stats.hash  = node->getHash();
+        stats.limit = limit;
+
+        auto start    = std::chrono::steady_clock::now();
+        bool compiled = program.compile(onode);
+        auto searched = std::chrono::steady_clock::now();
+
+        stats.conversionTime = std::chrono::duration_cast<std::chrono::microseconds>(searched - start).count();
+
+        if (compiled) {
+          triton::uint32 budget = (timeout && timeout < this->budget) ? timeout : this->budget;
+          triton::uint32 wanted = std::max<triton::uint32>(limit, 1);
+
+          /* A model without variable means that the constraint is constant and true */
+          ret = LocalSearchSolver::search(program, wanted, budget);
+
+          /* The models are checked against the AST itself, a model rejected by the AST goes to the fallback */
+          for (auto it = ret.begin(); it != ret.end();) {
+            std::map<triton::usize, triton::uint512> assignment;
+            for (const auto& item : *it)
+              assignment[item.first] = item.second.getValue();
+            if (triton::ast::evaluate(onode, assignment) == 0)
+              it = ret.erase(it);
+            else
+              it++;
+          }
+
+          if (ret.size() >= wanted) {
+            this->hits++;
+            stats.status      = triton::engines::solver::SAT;
+            stats.solvingTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - searched).count();
+            if (limit == 0 || program.getVariables().empty())
+              ret.clear();
+            return ret;
+          }
+        }
+
+        #ifdef Z3_INTERFACE
+        {
+          SolverQueryStats fallback;
+          triton::uint32 remaining = 0;
+
+          if (timeout) {
+            auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+            remaining = (elapsed < timeout) ? static_cast<triton::uint32>(timeout - elapsed) : 1;
+          }
+
+          this->fallbacks++;
+          ret = this->z3.solve(node, limit, remaining, memoryLimit, fallback);
+
+          stats.status          = fallback.status;
+          stats.conversionTime += fallback.conversionTime;
+          stats.solvingTime     = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - searched).count() - fallback.conversionTime;
+        }
+        #else
+        /* The search cannot prove that there is no (other) model */
+        stats.status      = ret.empty() ? triton::engines::solver::UNKNOWN : triton::engines::solver::SAT;
+        stats.solvingTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - searched).count();
+        if (limit == 0)
+          ret.clear();
+        #endif
+
+        return ret;
+      }
+
+
+      std::list<std::map<triton::uint32, SolverModel>> LocalSearchSolver::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit) const {
+        SolverQueryStats stats;
+
+        if (limit == 0)
+          return std::list<std::map<triton::uint32, SolverModel>>{};
+
+        return this->solve(node, limit, 0, 0, stats);
+      }
+
+
+      std::map<triton::uint32, SolverModel> LocalSearchSolver::getModel(const triton::ast::SharedAbstractNode& node) const {
+        std::map<triton::uint32, SolverModel> ret;
+
+        auto models = this->getModels(node, 1);
+        if (models.size() > 0)
+          ret = models.front();
+
+        return ret;
+      }
+
+
+      bool LocalSearchSolver::isSat(const triton::ast::SharedAbstractNode& node) const {
+        SolverQueryStats stats;
+
+        this->solve(node, 0, 0, 0, stats);
+
+        return stats.status == triton::engines::solver::SAT;
+      }
+
+
+      std::string LocalSearchSolver::getName(void) const {
+        return "local-search";
+      }
+
+
+      void LocalSearchSolver::setBudget(triton::uint32 budget) {
+        this->budget = budget;
+      }
+
+
+      triton::uint32 LocalSearchSolver::getBudget(void) const {
+        return this->budget;
+      }
+
+
+      triton::usize LocalSearchSolver::getHits(void) const {
+        return this->hits;
+      }
+
+
+      triton::usize LocalSearchSolver::getFallbacks(void) const {
+        return this->fallbacks;
+      }
+
+
+      #ifdef Z3_INTERFACE
+      void LocalSearchSolver::push(void) {
+        this->z3.push();
+      }
+
+
+      void LocalSearchSolver::pop(void) {
+        this->z3.pop();
+      }
+
+
+      void LocalSearchSolver::addConstraint(const triton::ast::SharedAbstractNode& node) {
+        this->z3.addConstraint(node);
+      }
+
+
+      void LocalSearchSolver::resetSession(void) {
+        this->z3.resetSession();
+      }
+
+
+      std::map<triton::uint32, SolverModel> LocalSearchSolver::getSessionModel(const triton::ast::SharedAbstractNode& node) {
+        return this->z3.getSessionModel(node);
+      }
+
+
+      bool LocalSearchSolver::isSessionSat(const triton::ast::SharedAbstractNode& node) {
+        return this->z3.isSessionSat(node);
+      }
+      #endif
+
+    };
+  };
+};
@@ -0,0 +1,398 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include <triton/exceptions.hpp>
+#include <triton/solverCache.hpp>
+#include <triton/symbolicExpression.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      SolverCache::SolverCache() {
+        this->fileLines = 0;
+        this->hits      = 0;
+        this->maxSize   = 65536;
+        this->misses    = 0;
+        this->timeSaved = 0;
+      }
+
+
+      triton::uint64 SolverCache::hashKey(const std::string& key) {
+        triton::uint64 hash = 0xcbf29ce484222325;
+
+        for (unsigned char c : key)
+          hash = (hash ^ c) * 0x100000001b3;
+
+        return hash;
+      }
+
+
+      SolverCache::Query SolverCache::canonicalize(const triton::ast::SharedAbstractNode& node) {
+        std::unordered_map<const triton::ast::AbstractNode*, triton::usize> index;
+        std::unordered_map<triton::usize, triton::usize> variables;
+        Query query;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverCache::canonicalize(): node cannot be null.");
+
+        /*
+         *  Each node is written once, in post order, as its kind, its payload
+         *  and the indexes of its children. References are transparent.
+         */
+        triton::ast::postOrderTraversal(node, true /* unroll */, [&](const triton::ast::SharedAbstractNode& n) {
+          if (n->getType() == triton::ast::REFERENCE_NODE) {
+            index[n.get()] = index.at(reinterpret_cast<triton::ast::ReferenceNode*>(n.get())->getSymbolicExpression()->getAst().get());
+            return;
+          }
+
+          triton::usize id = index.size();
+          index[n.get()] = id;
+          query.key += std::to_string(n->getType());
+
+          switch (n->getType()) {
+            case triton::ast::INTEGER_NODE:
+              query.key += "#" + reinterpret_cast<triton::ast::IntegerNode*>(n.get())->getInteger().convert_to<std::string>();
+              break;
+
+            case triton::ast::STRING_NODE: {
+              const std::string& value = reinterpret_cast<triton::ast::StringNode*>(n.get())->getString();
+              query.key += "\"" + std::to_string(value.size()) + ":" + value;
+              break;
+            }
+
+            case triton::ast::VARIABLE_NODE: {
+              const auto& var = reinterpret_cast<triton::ast::VariableNode*>(n.get())->getSymbolicVariable();
+              auto it = variables.find(var->getId());
+              if (it == variables.end()) {
+                it = variables.insert(std::make_pair(var->getId(), query.variables.size())).first;
+                query.variables.push_back(var);
+              }
+              query.key += "$" + std::to_string(it->second) + ":" + std::to_string(var->getSize());
+              break;
+            }
+
+            default:
+              break;
+          }
+
+          for (const auto& child : n->getChildren())
+            query.key += "," + std::to_string(index.at(child.get()));
+
+          query.key += ";";
+        });
+
+        query.hash = SolverCache::hashKey(query.key);
+
+        return query;
+      }
+
+
+      std::map<triton::uint32, SolverModel> SolverCache::getModel(const Query& query, const CanonicalModel& model) {
+        std::map<triton::uint32, SolverModel> ret;
+
+        for (const auto& item : model) {
+          const auto& var = query.variables.at(item.first);
+          ret[var->getId()] = SolverModel(var, item.second);
+        }
+
+        return ret;
+      }
+
+
+      SolverCache::CanonicalModel SolverCache::getCanonicalModel(const Query& query, const std::map<triton::uint32, SolverModel>& model) {
+        CanonicalModel ret;
+
+        for (triton::uint32 index = 0; index < query.variables.size(); index++) {
+          auto it = model.find(query.variables[index]->getId());
+          if (it != model.end())
+            ret.push_back(std::make_pair(index, it->second.getValue()));
+        }
+
+        return ret;
+      }
+
+
+      SolverCache::Entry* SolverCache::find(const Query& query) {
+        auto it = this->index.find(query.hash);
+
+        /* The hash may collide, the canonical form confirms the hit */
+        if (it == this->index.end() || it->second->key != query.key)
+          return nullptr;
+
+        this->entries.splice(this->entries.begin(), this->entries, it->second);
+
+        return &(*it->second);
+      }
+
+
+      SolverCache::Entry& SolverCache::insert(const std::string& key, triton::uint64 hash) {
+        auto it = this->index.find(hash);
+
+        if (it != this->index.end()) {
+          /* Another constraint with the same hash is replaced */
+          if (it->second->key != key) {
+            *it->second     = Entry();
+            it->second->key  = key;
+            it->second->hash = hash;
+          }
+          this->entries.splice(this->entries.begin(), this->entries, it->second);
+          return *it->second;
+        }
+
+        this->entries.emplace_front();
+        this->entries.front().key  = key;
+        this->entries.front().hash = hash;
+        this->index[hash] = this->entries.begin();
+        this->evict();
+
+        return this->entries.front();
+      }
+
+
+      void SolverCache::evict(void) {
+        while (this->entries.size() > std::max<triton::usize>(this->maxSize, 1)) {
+          this->index.erase(this->entries.back().hash);
+          this->entries.pop_back();
+        }
+      }
+
+
+      bool SolverCache::isSat(const Query& query, bool& sat) {
+        Entry* entry = this->find(query);
+
+        if (entry == nullptr || entry->satKnown == false) {
+          this->misses++;
+          return false;
+        }
+
+        this->hits++;
+        this->timeSaved += entry->time;
+        sat = entry->sat;
+
+        return true;
+      }
+
+
+      bool SolverCache::getModels(const Query& query, triton::uint32 limit, std::list<std::map<triton::uint32, SolverModel>>& models) {
+        Entry* entry = this->find(query);
+
+        if (entry == nullptr || (entry->exhausted == false && entry->limit < limit)) {
+          this->misses++;
+          return false;
+        }
+
+        this->hits++;
+        this->timeSaved += entry->time;
+
+        for (const auto& model : entry->models) {
+          if (models.size() >= limit)
+            break;
+          models.push_back(SolverCache::getModel(query, model));
+        }
+
+        return true;
+      }
+
+
+      void SolverCache::setSat(const Query& query, bool sat, triton::uint64 time) {
+        Entry& entry = this->insert(query.key, query.hash);
+
+        entry.satKnown = true;
+        entry.sat      = sat;
+        entry.time     = time;
+
+        if (sat == false) {
+          entry.exhausted = true;
+          entry.models.clear();
+        }
+
+        this->save(entry);
+      }
+
+
+      void SolverCache::setModels(const Query& query, triton::uint32 limit, const std::list<std::map<triton::uint32, SolverModel>>& models, triton::uint64 time) {
+        Entry& entry = this->insert(query.key, query.hash);
+
+        entry.models.clear();
+        for (const auto& model : models)
+          entry.models.push_back(SolverCache::getCanonicalModel(query, model));
+
+        entry.limit     = limit;
+        entry.exhausted = (models.size() < limit);
+        entry.time      = time;
+
+        if (models.size()) {
+          entry.satKnown = true;
+          entry.sat      = true;
+        }
+
+        this->save(entry);
+      }
+
+
+      void SolverCache::write(std::ostream& stream, const Entry& entry) {
+        stream << entry.key << "\t" << entry.satKnown << " " << entry.sat << " " << entry.exhausted << " " << entry.limit << " " << entry.time << "\t";
+        for (triton::usize i = 0; i < entry.models.size(); i++) {
+          if (i)
+            stream << ";";
+          for (triton::usize j = 0; j < entry.models[i].size(); j++) {
+            if (j)
+              stream << ",";
+            stream << entry.models[i][j].first << "=" << entry.models[i][j].second.convert_to<std::string>();
+          }
+        }
+        stream << "\n";
+      }
+
+
+      void SolverCache::save(const Entry& entry) {
+        if (this->path.empty())
+          return;
+
+        /* A line per entry, the last one wins when loading */
+        if (entry.key.find_first_of("\t\n") != std::string::npos)
+          return;
+
+        /* The superseded lines outnumber the live entries, the entry is written by the compaction */
+        if (this->fileLines >= 2 * this->entries.size()) {
+          this->compact();
+          return;
+        }
+
+        std::ofstream file(this->path, std::ios::app);
+        if (!file)
+          throw triton::exceptions::SolverEngine("SolverCache::save(): Cannot open " + this->path);
+
+        SolverCache::write(file, entry);
+        this->fileLines++;
+      }
+
+
+      void SolverCache::compact(void) {
+        std::string tmp = this->path + ".tmp";
+
+        {
+          std::ofstream file(tmp, std::ios::trunc);
+          if (!file)
+            throw triton::exceptions::SolverEngine("SolverCache::compact(): Cannot open " + tmp);
+
+          /* The least recently used first, so the loading keeps the same order */
+          this->fileLines = 0;
+          for (auto it = this->entries.rbegin(); it != this->entries.rend(); it++) {
+            if (it->key.find_first_of("\t\n") != std::string::npos)
+              continue;
+            SolverCache::write(file, *it);
+            this->fileLines++;
+          }
+        }
+
+        if (std::rename(tmp.c_str(), this->path.c_str()) != 0)
+          throw triton::exceptions::SolverEngine("SolverCache::compact(): Cannot rename " + tmp);
+      }
+
+
+      void SolverCache::load(void) {
+        std::ifstream file(this->path);
+        std::string line;
+
+        this->fileLines = 0;
+        while (std::getline(file, line)) {
+          this->fileLines++;
+
+          auto tab1 = line.find('\t');
+          auto tab2 = line.find('\t', tab1 + 1);
+          if (tab1 == std::string::npos || tab2 == std::string::npos)
+            continue;
+
+          Entry entry;
+          std::istringstream header(line.substr(tab1 + 1, tab2 - tab1 - 1));
+          if (!(header >> entry.satKnown >> entry.sat >> entry.exhausted >> entry.limit >> entry.time))
+            continue;
+
+          try {
+            std::istringstream models(line.substr(tab2 + 1));
+            std::string model;
+            while (std::getline(models, model, ';')) {
+              std::istringstream values(model);
+              std::string value;
+              CanonicalModel cmodel;
+              while (std::getline(values, value, ',')) {
+                auto eq = value.find('=');
+                if (eq == std::string::npos)
+                  continue;
+                triton::uint512 number = 0;
+                std::istringstream(value.substr(eq + 1)) >> number;
+                cmodel.push_back(std::make_pair(static_cast<triton::uint32>(std::stoul(value.substr(0, eq))), number));
+              }
+              entry.models.push_back(cmodel);
+            }
+          }
+          /* Skips a corrupted line */
+          catch (const std::exception&) {
+            continue;
+          }
+
+          entry.key  = line.substr(0, tab1);
+          entry.hash = SolverCache::hashKey(entry.key);
+          this->insert(entry.key, entry.hash) = entry;
+        }
+      }
+
+
+      void SolverCache::setFile(const std::string& path) {
+        this->path      = path;
+        this->fileLines = 0;
+        if (!this->path.empty())
+          this->load();
+      }
+
+
+      void SolverCache::setMaxSize(triton::usize size) {
+        this->maxSize = size;
+        this->evict();
+      }
+
+
+      triton::usize SolverCache::getHits(void) const {
+        return this->hits;
+      }
+
+
+      triton::usize SolverCache::getMisses(void) const {
+        return this->misses;
+      }
+
+
+      triton::uint64 SolverCache::getTimeSaved(void) const {
+        return this->timeSaved;
+      }
+
+
+      triton::usize SolverCache::size(void) const {
+        return this->entries.size();
+      }
+
+
+      void SolverCache::clear(void) {
+        this->entries.clear();
+        this->index.clear();
+        this->hits      = 0;
+        this->misses    = 0;
+        this->timeSaved = 0;
+      }
+
+    };
+  };
+};
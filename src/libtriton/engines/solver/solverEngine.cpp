@@ -5,8 +5,17 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <set>
+#include <sstream>
+
+#include <triton/astContext.hpp>
+#include <triton/astEnums.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/solverEngine.hpp>
+#include <triton/symbolicExpression.hpp>
 
 
 
@@ -14,8 +23,17 @@ namespace triton {
   namespace engines {
     namespace solver {
 
-      SolverEngine::SolverEngine() {
-        this->kind = triton::engines::solver::SOLVER_INVALID;
+      SolverEngine::SolverEngine(const triton::modes::Modes* modes) {
+        this->kind               = triton::engines::solver::SOLVER_INVALID;
+        this->modes              = modes;
+        this->recentModelsSize   = 16;
+        this->queryStatsSize     = 4096;
+        this->modelReuseHits     = 0;
+        this->timeout            = 0;
+        this->memoryLimit        = 0;
+        this->recordedQueries    = 0;
+        this->recordingFailures  = 0;
+        this->recordingDirectory = ".";
         #ifdef Z3_INTERFACE
         /* By default we initialized the z3 solver */
         this->setSolver(triton::engines::solver::SOLVER_Z3);
@@ -38,6 +56,13 @@ namespace triton {
       void SolverEngine::setSolver(triton::engines::solver::solver_e kind) {
         /* Allocate and init the good solver */
         switch (kind) {
+          case triton::engines::solver::SOLVER_LOCAL_SEARCH:
+            /* init the new instance */
+            this->solver.reset(new(std::nothrow) triton::engines::solver::LocalSearchSolver());
+            if (this->solver == nullptr)
+              throw triton::exceptions::SolverEngine("SolverEngine::setSolver(): Not enough memory.");
+            break;
+
           #ifdef Z3_INTERFACE
           case triton::engines::solver::SOLVER_Z3:
             /* init the new instance */
@@ -76,24 +101,364 @@ namespace triton {
       }
 
 
-      std::map<triton::uint32, SolverModel> SolverEngine::getModel(const triton::ast::SharedAbstractNode& node) const {
-        if (!this->solver)
+      bool SolverEngine::isCacheEnabled(void) const {
+        return this->modes != nullptr && this->modes->isModeEnabled(triton::modes::SOLVER_QUERY_CACHE);
+      }
+
+
+      bool SolverEngine::isModelReuseEnabled(void) const {
+        return this->modes != nullptr && this->modes->isModeEnabled(triton::modes::SOLVER_MODEL_REUSE);
+      }
+
+
+      bool SolverEngine::reuseModel(const triton::ast::SharedAbstractNode& node, std::map<triton::uint32, SolverModel>& model) const {
+        std::vector<triton::engines::symbolic::SharedSymbolicVariable> variables;
+
+        if (this->recentModels.empty())
+          return false;
+
+        /* Only the symbolized sub-ASTs lead to a variable */
+        triton::ast::postOrderTraversal(node, true /* unroll */,
+          [&variables](const triton::ast::SharedAbstractNode& n) {
+            if (n->getType() == triton::ast::VARIABLE_NODE)
+              variables.push_back(reinterpret_cast<triton::ast::VariableNode*>(n.get())->getSymbolicVariable());
+          },
+          [](const triton::ast::SharedAbstractNode& n) {
+            return n->isSymbolized() == false;
+          }
+        );
+
+        /* An empty model means UNSAT */
+        if (variables.empty())
+          return false;
+
+        for (auto it = this->recentModels.begin(); it != this->recentModels.end(); it++) {
+          /* Only the variables of the constraint are substituted */
+          std::map<triton::usize, triton::uint512> assignment;
+          for (const auto& var : variables) {
+            auto m = it->find(var->getId());
+            if (m != it->end())
+              assignment[var->getId()] = m->second.getValue();
+          }
+
+          if (triton::ast::evaluate(node, assignment) == 0)
+            continue;
+
+          /* The variables which are not in the recent model keep their concrete value */
+          model.clear();
+          for (const auto& var : variables) {
+            auto m = it->find(var->getId());
+            if (m != it->end())
+              model[var->getId()] = m->second;
+            else
+              model[var->getId()] = SolverModel(var, node->getContext().getVariableValue(var->getId()));
+          }
+
+          this->recentModels.splice(this->recentModels.begin(), this->recentModels, it);
+          this->modelReuseHits++;
+          return true;
+        }
+
+        return false;
+      }
+
+
+      void SolverEngine::recordModel(const std::map<triton::uint32, SolverModel>& model) const {
+        if (!this->isModelReuseEnabled() || model.empty())
+          return;
+
+        this->recentModels.push_front(model);
+        while (this->recentModels.size() > this->recentModelsSize)
+          this->recentModels.pop_back();
+      }
+
+
+      bool SolverEngine::isQueryStatsEnabled(void) const {
+        return this->modes != nullptr && this->modes->isModeEnabled(triton::modes::SOLVER_QUERY_STATS);
+      }
+
+
+      std::list<std::map<triton::uint32, SolverModel>> SolverEngine::solve(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::uint32 timeout, triton::engines::solver::status_e& status) const {
+        SolverQueryStats stats;
+
+        auto models = this->solver->solve(node, limit, timeout ? timeout : this->timeout, this->memoryLimit, stats);
+        status = stats.status;
+
+        this->processQueryStats(node, stats, timeout ? timeout : this->timeout);
+
+        return models;
+      }
+
+
+      void SolverEngine::processQueryStats(const triton::ast::SharedAbstractNode& node, triton::engines::solver::SolverQueryStats& stats, triton::uint32 timeout) const {
+        if (node != nullptr && (this->isQueryStatsEnabled() || this->isQueryRecordingEnabled())) {
+          triton::ast::postOrderTraversal(node, true /* unroll */, [&stats](const triton::ast::SharedAbstractNode&) {
+            stats.astSize++;
+          });
+        }
+
+        if (this->isQueryStatsEnabled()) {
+          this->queryStats.push_back(stats);
+          while (this->queryStats.size() > this->queryStatsSize)
+            this->queryStats.pop_front();
+        }
+
+        /* The query is already solved, a recording failure is counted and does not lose its result */
+        if (node != nullptr && this->isQueryRecordingEnabled()) {
+          try {
+            this->recordQuery(node, stats, timeout);
+          }
+          catch (const triton::exceptions::Exception&) {
+            this->recordingFailures++;
+          }
+        }
+      }
+
+
+      bool SolverEngine::isQueryRecordingEnabled(void) const {
+        return this->modes != nullptr && this->modes->isModeEnabled(triton::modes::SOLVER_QUERY_RECORDING);
+      }
+
+
+      void SolverEngine::recordQuery(const triton::ast::SharedAbstractNode& node, const triton::engines::solver::SolverQueryStats& stats, triton::uint32 timeout) const {
+        static const char* names[] = {"UNSAT", "SAT", "TIMEOUT", "OUTOFMEM", "UNKNOWN"};
+        std::vector<triton::engines::symbolic::SharedSymbolicVariable> variables;
+        std::vector<triton::engines::symbolic::SharedSymbolicExpression> references;
+        std::set<triton::usize> seen;
+        char name[32];
+
+        /* The references are defined after the references of their ASTs */
+        triton::ast::postOrderTraversal(node, true /* unroll */, [&](const triton::ast::SharedAbstractNode& n) {
+          if (n->getType() == triton::ast::VARIABLE_NODE)
+            variables.push_back(reinterpret_cast<triton::ast::VariableNode*>(n.get())->getSymbolicVariable());
+          else if (n->getType() == triton::ast::REFERENCE_NODE) {
+            const auto& expr = reinterpret_cast<triton::ast::ReferenceNode*>(n.get())->getSymbolicExpression();
+            if (seen.insert(expr->getId()).second)
+              references.push_back(expr);
+          }
+        });
+
+        std::snprintf(name, sizeof(name), "query-%06lu.smt2", static_cast<unsigned long>(this->recordedQueries));
+        std::string path = this->recordingDirectory + "/" + name;
+        std::ostringstream query;
+
+        query << "; solver: " << this->getName() << std::endl;
+        query << "; limit: " << stats.limit << std::endl;
+        query << "; timeout: " << timeout << std::endl;
+        query << "; memory-limit: " << this->memoryLimit << std::endl;
+        query << "; status: " << names[stats.status] << std::endl;
+        query << "; ast-size: " << stats.astSize << std::endl;
+        query << "; conversion-time: " << stats.conversionTime << std::endl;
+        query << "; solving-time: " << stats.solvingTime << std::endl;
+        query << "(set-logic QF_BV)" << std::endl;
+
+        /* The file is in SMT-LIB2 whatever the representation mode of the context, which is restored in any case */
+        auto& ctxt = node->getContext();
+        auto mode  = ctxt.getRepresentationMode();
+        ctxt.setRepresentationMode(triton::ast::representations::SMT_REPRESENTATION);
+
+        try {
+          for (const auto& var : variables)
+            query << "(declare-fun " << (var->getAlias().empty() ? var->getName() : var->getAlias()) << " () (_ BitVec " << var->getSize() << "))" << std::endl;
+
+          for (const auto& expr : references) {
+            const auto& ast = expr->getAst();
+            query << "(define-fun ref!" << expr->getId() << " () ";
+            if (ast->isLogical())
+              query << "Bool";
+            else
+              query << "(_ BitVec " << ast->getBitvectorSize() << ")";
+            query << " " << ast << ")" << std::endl;
+          }
+
+          query << "(assert " << node << ")" << std::endl;
+          query << "(check-sat)" << std::endl;
+        }
+        catch (...) {
+          ctxt.setRepresentationMode(mode);
+          throw;
+        }
+        ctxt.setRepresentationMode(mode);
+
+        std::ofstream output(path);
+        if (!output)
+          throw triton::exceptions::SolverEngine("SolverEngine::recordQuery(): Cannot open " + path);
+
+        output << query.str();
+        output.close();
+        if (!output)
+          throw triton::exceptions::SolverEngine("SolverEngine::recordQuery(): Cannot write " + path);
+
+        this->recordedQueries++;
+      }
+
+
+      std::map<triton::uint32, SolverModel> SolverEngine::getModel(const triton::ast::SharedAbstractNode& node, bool independence, triton::engines::solver::status_e* status, triton::uint32 timeout) const {
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+
+        if (status == nullptr)
+          status = &st;
+
+        if (!this->solver) {
+          *status = triton::engines::solver::UNKNOWN;
+          return std::map<triton::uint32, SolverModel>{};
+        }
+
+        if (independence && node != nullptr) {
+          ConstraintIndependence slice(node);
+          std::map<triton::uint32, SolverModel> model;
+          *status = triton::engines::solver::SAT;
+          if (slice.getQuery() != nullptr) {
+            model = this->getModel(slice.getQuery(), false, status, timeout);
+            /* UNSAT, timeout or out of memory */
+            if (model.empty())
+              return model;
+          }
+          slice.complete(model);
+          return model;
+        }
+
+        if (this->isModelReuseEnabled() && node != nullptr) {
+          std::map<triton::uint32, SolverModel> model;
+          if (this->reuseModel(node, model)) {
+            *status = triton::engines::solver::SAT;
+            return model;
+          }
+        }
+
+        /* A model is the first one of getModels() */
+        std::list<std::map<triton::uint32, SolverModel>> models;
+
+        if (!this->isCacheEnabled() || node == nullptr) {
+          models = this->solve(node, 1, timeout, *status);
+        }
+        else {
+          auto query = SolverCache::canonicalize(node);
+          if (this->cache.getModels(query, 1, models)) {
+            *status = models.empty() ? triton::engines::solver::UNSAT : triton::engines::solver::SAT;
+          }
+          else {
+            auto start = std::chrono::steady_clock::now();
+            models     = this->solve(node, 1, timeout, *status);
+            auto time  = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+            /* A query which reached a limit may succeed later */
+            if (*status == triton::engines::solver::SAT || *status == triton::engines::solver::UNSAT)
+              this->cache.setModels(query, 1, models, time);
+          }
+        }
+
+        if (models.empty())
           return std::map<triton::uint32, SolverModel>{};
-        return this->solver->getModel(node);
+
+        this->recordModel(models.front());
+        return models.front();
       }
 
 
-      std::list<std::map<triton::uint32, SolverModel>> SolverEngine::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit) const {
-        if (!this->solver)
+      std::list<std::map<triton::uint32, SolverModel>> SolverEngine::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, bool independence, triton::engines::solver::status_e* status, triton::uint32 timeout) const {
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+
+        if (status == nullptr)
+          status = &st;
+
+        if (!this->solver) {
+          *status = triton::engines::solver::UNKNOWN;
           return std::list<std::map<triton::uint32, SolverModel>>{};
-        return this->solver->getModels(node, limit);
+        }
+
+        if (independence && node != nullptr) {
+          ConstraintIndependence slice(node);
+          std::list<std::map<triton::uint32, SolverModel>> models;
+          if (slice.getQuery() == nullptr) {
+            /* The concrete values are the only model with the other variables fixed */
+            *status = triton::engines::solver::SAT;
+            if (limit)
+              models.push_back(slice.getConcreteModel());
+            return models;
+          }
+          models = this->getModels(slice.getQuery(), limit, false, status, timeout);
+          for (auto& model : models)
+            slice.complete(model);
+          return models;
+        }
+
+        if (!this->isCacheEnabled() || node == nullptr || limit == 0)
+          return this->solve(node, limit, timeout, *status);
+
+        auto query = SolverCache::canonicalize(node);
+        std::list<std::map<triton::uint32, SolverModel>> models;
+        if (this->cache.getModels(query, limit, models)) {
+          *status = models.empty() ? triton::engines::solver::UNSAT : triton::engines::solver::SAT;
+        }
+        else {
+          auto start = std::chrono::steady_clock::now();
+          models     = this->solve(node, limit, timeout, *status);
+          auto time  = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+          /* A query which reached a limit may succeed later */
+          if (*status == triton::engines::solver::SAT || *status == triton::engines::solver::UNSAT)
+            this->cache.setModels(query, limit, models, time);
+        }
+
+        return models;
       }
 
 
-      bool SolverEngine::isSat(const triton::ast::SharedAbstractNode& node) const {
-        if (!this->solver)
+      bool SolverEngine::isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout) const {
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+
+        if (status == nullptr)
+          status = &st;
+
+        if (!this->solver) {
+          *status = triton::engines::solver::UNKNOWN;
           return false;
-        return this->solver->isSat(node);
+        }
+
+        if (this->isModelReuseEnabled() && node != nullptr) {
+          std::map<triton::uint32, SolverModel> model;
+          if (this->reuseModel(node, model)) {
+            *status = triton::engines::solver::SAT;
+            return true;
+          }
+        }
+
+        if (!this->isCacheEnabled() || node == nullptr) {
+          this->solve(node, 0, timeout, *status);
+          return *status == triton::engines::solver::SAT;
+        }
+
+        auto query = SolverCache::canonicalize(node);
+        bool sat   = false;
+        if (this->cache.isSat(query, sat)) {
+          *status = sat ? triton::engines::solver::SAT : triton::engines::solver::UNSAT;
+        }
+        else {
+          auto start = std::chrono::steady_clock::now();
+          this->solve(node, 0, timeout, *status);
+          auto time  = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+          sat        = (*status == triton::engines::solver::SAT);
+          /* A query which reached a limit may succeed later */
+          if (*status == triton::engines::solver::SAT || *status == triton::engines::solver::UNSAT)
+            this->cache.setSat(query, sat, time);
+        }
+
+        return sat;
+      }
+
+
+      std::vector<std::map<triton::uint32, SolverModel>> SolverEngine::getBatchModels(const std::vector<triton::ast::SharedAbstractNode>& nodes, triton::uint32 workers, triton::uint32 timeout) const {
+        std::vector<triton::engines::solver::SolverQueryStats> stats;
+
+        if (!this->solver)
+          return std::vector<std::map<triton::uint32, SolverModel>>(nodes.size());
+
+        auto models = this->solver->getBatchModels(nodes, workers, timeout ? timeout : this->timeout, this->memoryLimit, stats);
+
+        /* The queries are logged in the order of `nodes`, once the workers are done */
+        for (triton::usize index = 0; index < nodes.size() && index < stats.size(); index++)
+          this->processQueryStats(nodes[index], stats[index], timeout ? timeout : this->timeout);
+
+        return models;
       }
 
 
@@ -103,6 +468,146 @@ namespace triton {
         return this->solver->getName();
       }
 
+
+      triton::usize SolverEngine::getCacheHits(void) const {
+        return this->cache.getHits();
+      }
+
+
+      triton::usize SolverEngine::getCacheMisses(void) const {
+        return this->cache.getMisses();
+      }
+
+
+      triton::uint64 SolverEngine::getCacheTimeSaved(void) const {
+        return this->cache.getTimeSaved();
+      }
+
+
+      void SolverEngine::clearCache(void) {
+        this->cache.clear();
+      }
+
+
+      void SolverEngine::setCacheFile(const std::string& path) {
+        this->cache.setFile(path);
+      }
+
+
+      void SolverEngine::setCacheSize(triton::usize size) {
+        this->cache.setMaxSize(size);
+      }
+
+
+      triton::usize SolverEngine::getModelReuseHits(void) const {
+        return this->modelReuseHits;
+      }
+
+
+      void SolverEngine::setModelReuseSize(triton::usize size) {
+        this->recentModelsSize = size;
+        while (this->recentModels.size() > this->recentModelsSize)
+          this->recentModels.pop_back();
+      }
+
+
+      void SolverEngine::setTimeout(triton::uint32 timeout) {
+        this->timeout = timeout;
+      }
+
+
+      triton::uint32 SolverEngine::getTimeout(void) const {
+        return this->timeout;
+      }
+
+
+      void SolverEngine::setMemoryLimit(triton::uint32 limit) {
+        this->memoryLimit = limit;
+      }
+
+
+      triton::uint32 SolverEngine::getMemoryLimit(void) const {
+        return this->memoryLimit;
+      }
+
+
+      const std::deque<triton::engines::solver::SolverQueryStats>& SolverEngine::getQueryStats(void) const {
+        return this->queryStats;
+      }
+
+
+      void SolverEngine::clearQueryStats(void) {
+        this->queryStats.clear();
+      }
+
+
+      void SolverEngine::setQueryStatsSize(triton::usize size) {
+        this->queryStatsSize = size;
+        while (this->queryStats.size() > this->queryStatsSize)
+          this->queryStats.pop_front();
+      }
+
+
+      void SolverEngine::setRecordingDirectory(const std::string& path) {
+        this->recordingDirectory = path;
+      }
+
+
+      const std::string& SolverEngine::getRecordingDirectory(void) const {
+        return this->recordingDirectory;
+      }
+
+
+      triton::usize SolverEngine::getRecordedQueries(void) const {
+        return this->recordedQueries;
+      }
+
+
+      triton::usize SolverEngine::getRecordingFailures(void) const {
+        return this->recordingFailures;
+      }
+
+
+      void SolverEngine::push(void) {
+        if (!this->solver)
+          throw triton::exceptions::SolverEngine("SolverEngine::push(): Solver undefined.");
+        this->solver->push();
+      }
+
+
+      void SolverEngine::pop(void) {
+        if (!this->solver)
+          throw triton::exceptions::SolverEngine("SolverEngine::pop(): Solver undefined.");
+        this->solver->pop();
+      }
+
+
+      void SolverEngine::addConstraint(const triton::ast::SharedAbstractNode& node) {
+        if (!this->solver)
+          throw triton::exceptions::SolverEngine("SolverEngine::addConstraint(): Solver undefined.");
+        this->solver->addConstraint(node);
+      }
+
+
+      void SolverEngine::resetSession(void) {
+        if (this->solver)
+          this->solver->resetSession();
+      }
+
+
+      std::map<triton::uint32, SolverModel> SolverEngine::getSessionModel(const triton::ast::SharedAbstractNode& node) {
+        if (!this->solver)
+          return std::map<triton::uint32, SolverModel>{};
+        return this->solver->getSessionModel(node);
+      }
+
+
+      bool SolverEngine::isSessionSat(const triton::ast::SharedAbstractNode& node) {
+        if (!this->solver)
+          return false;
+        return this->solver->isSessionSat(node);
+      }
+
     };
   };
 };
@@ -7,7 +7,13 @@
 
 #include <z3++.h>
 #include <z3_api.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <mutex>
 #include <string>
+#include <thread>
 
 #include <triton/astContext.hpp>
 #include <triton/exceptions.hpp>
@@ -39,69 +45,122 @@ namespace triton {
       }
 
 
-      std::list<std::map<triton::uint32, SolverModel>> Z3Solver::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit) const {
-        std::list<std::map<triton::uint32, SolverModel>> ret;
-        triton::ast::SharedAbstractNode onode = node;
-        triton::ast::TritonToZ3Ast z3Ast{false};
+      const triton::ast::SharedAbstractNode& Z3Solver::getConstraint(const triton::ast::SharedAbstractNode& node, const char* where) {
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine(std::string(where) + ": node cannot be null.");
 
-        try {
-          if (onode == nullptr)
-            throw triton::exceptions::SolverEngine("Z3Solver::getModels(): node cannot be null.");
+        /* Z3 does not need an assert() as root node */
+        const triton::ast::SharedAbstractNode& onode = (node->getType() == triton::ast::ASSERT_NODE) ? node->getChildren()[0] : node;
 
-          /* Z3 does not need an assert() as root node */
-          if (node->getType() == triton::ast::ASSERT_NODE)
-            onode = node->getChildren()[0];
+        if (onode->isLogical() == false)
+          throw triton::exceptions::SolverEngine(std::string(where) + ": Must be a logical node.");
 
-          if (onode->isLogical() == false)
-            throw triton::exceptions::SolverEngine("Z3Solver::getModels(): Must be a logical node.");
+        return onode;
+      }
 
-          z3::expr      expr = z3Ast.convert(onode);
-          z3::context&  ctx  = expr.ctx();
-          z3::solver    solver(ctx);
 
-          /* Create a solver and add the expression */
-          solver.add(expr);
+      std::map<triton::uint32, SolverModel> Z3Solver::extractModel(const z3::model& m, triton::ast::TritonToZ3Ast& z3Ast, z3::expr_vector* args) {
+        std::map<triton::uint32, SolverModel> smodel;
+        z3::context& ctx = m.ctx();
 
-          /* Check if it is sat */
-          while (solver.check() == z3::sat && limit >= 1) {
+        /* Traversing the model */
+        for (triton::uint32 i = 0; i < m.size(); i++) {
 
-            /* Get model */
-            z3::model m = solver.get_model();
+          /* Get the z3 variable */
+          z3::func_decl z3Variable = m[i];
 
-            /* Traversing the model */
-            std::map<triton::uint32, SolverModel> smodel;
-            z3::expr_vector args(ctx);
-            for (triton::uint32 i = 0; i < m.size(); i++) {
+          /* Get the name as std::string from a z3 variable */
+          std::string varName = z3Variable.name().str();
 
-              /* Get the z3 variable */
-              z3::func_decl z3Variable = m[i];
+          /* Get z3 expr */
+          z3::expr exp = m.get_const_interp(z3Variable);
 
-              /* Get the name as std::string from a z3 variable */
-              std::string varName = z3Variable.name().str();
+          /* Get the size of a z3 expr */
+          triton::uint32 bvSize = exp.get_sort().bv_size();
 
-              /* Get z3 expr */
-              z3::expr exp = m.get_const_interp(z3Variable);
+          /* Get the value of a z3 expr */
+          std::string svalue = Z3_get_numeral_string(ctx, exp);
 
-              /* Get the size of a z3 expr */
-              triton::uint32 bvSize = exp.get_sort().bv_size();
+          /* Convert a string value to a integer value */
+          triton::uint512 value = triton::uint512(svalue);
 
-              /* Get the value of a z3 expr */
-              std::string svalue = Z3_get_numeral_string(ctx, exp);
+          /* Create a triton model */
+          SolverModel trionModel = SolverModel(z3Ast.variables[varName], value);
 
-              /* Convert a string value to a integer value */
-              triton::uint512 value = triton::uint512(svalue);
+          /* Map the result */
+          smodel[trionModel.getId()] = trionModel;
 
-              /* Create a triton model */
-              SolverModel trionModel = SolverModel(z3Ast.variables[varName], value);
+          /* Uniq result */
+          if (args != nullptr && exp.get_sort().is_bv())
+            args->push_back(ctx.bv_const(varName.c_str(), bvSize) != ctx.bv_val(svalue.c_str(), bvSize));
+        }
 
-              /* Map the result */
-              smodel[trionModel.getId()] = trionModel;
+        return smodel;
+      }
 
-              /* Uniq result */
-              if (exp.get_sort().is_bv())
-                args.push_back(ctx.bv_const(varName.c_str(), bvSize) != ctx.bv_val(svalue.c_str(), bvSize));
 
-            }
+      void Z3Solver::setLimits(z3::solver& solver, triton::uint32 timeout, triton::uint32 memoryLimit) {
+        if (timeout == 0 && memoryLimit == 0)
+          return;
+
+        z3::params p(solver.ctx());
+        if (timeout)
+          p.set("timeout", timeout);
+        if (memoryLimit)
+          p.set("max_memory", memoryLimit);
+        solver.set(p);
+      }
+
+
+      triton::engines::solver::status_e Z3Solver::getStatus(z3::solver& solver, z3::check_result result) {
+        switch (result) {
+          case z3::sat:
+            return triton::engines::solver::SAT;
+
+          case z3::unsat:
+            return triton::engines::solver::UNSAT;
+
+          default: {
+            std::string reason = solver.reason_unknown();
+            if (reason == "timeout" || reason == "canceled")
+              return triton::engines::solver::TIMEOUT;
+            if (reason.find("memory") != std::string::npos)
+              return triton::engines::solver::OUTOFMEM;
+            return triton::engines::solver::UNKNOWN;
+          }
+        }
+      }
+
+
+      std::list<std::map<triton::uint32, SolverModel>> Z3Solver::solve(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::uint32 timeout, triton::uint32 memoryLimit, SolverQueryStats& stats) const {
+        std::list<std::map<triton::uint32, SolverModel>> ret;
+        triton::ast::TritonToZ3Ast z3Ast{false};
+
+        const triton::ast::SharedAbstractNode& onode = Z3Solver::getConstraint(node, "Z3Solver::solve()");
+
+        stats.hash  = (node != nullptr) ? node->getHash() : 0;
+        stats.limit = limit;
+
+        auto start = std::chrono::steady_clock::now();
+
+        try {
+          z3::expr      expr = z3Ast.convert(onode);
+          z3::context&  ctx  = expr.ctx();
+          z3::solver    solver(ctx);
+
+          stats.conversionTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+          start = std::chrono::steady_clock::now();
+
+          /* Create a solver and add the expression */
+          Z3Solver::setLimits(solver, timeout, memoryLimit);
+          solver.add(expr);
+
+          /* Check if it is sat */
+          while ((stats.status = Z3Solver::getStatus(solver, solver.check())) == triton::engines::solver::SAT && limit >= 1) {
+
+            /* Get model */
+            z3::expr_vector args(ctx);
+            auto smodel = Z3Solver::extractModel(solver.get_model(), z3Ast, &args);
 
             /* Escape last models */
             solver.add(triton::engines::solver::mk_or(args));
@@ -113,38 +172,42 @@ namespace triton {
             /* Decrement the limit */
             limit--;
           }
+
+          /* The last check only tells if there are other models */
+          if (ret.size())
+            stats.status = triton::engines::solver::SAT;
         }
         catch (const z3::exception& e) {
-          throw triton::exceptions::SolverEngine(std::string("Z3Solver::getModels(): ") + e.msg());
+          std::string msg = e.msg();
+          if (msg.find("memory") == std::string::npos)
+            throw triton::exceptions::SolverEngine("Z3Solver::solve(): " + msg);
+          stats.status = triton::engines::solver::OUTOFMEM;
         }
 
+        stats.solvingTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
         return ret;
       }
 
 
-      bool Z3Solver::isSat(const triton::ast::SharedAbstractNode& node) const {
-        triton::ast::TritonToZ3Ast z3Ast{false};
+      std::list<std::map<triton::uint32, SolverModel>> Z3Solver::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit) const {
+        SolverQueryStats stats;
 
-        if (node == nullptr)
-          throw triton::exceptions::SolverEngine("Z3Solver::isSat(): node cannot be null.");
+        Z3Solver::getConstraint(node, "Z3Solver::getModels()");
+        if (limit == 0)
+          return std::list<std::map<triton::uint32, SolverModel>>{};
 
-        if (node->isLogical() == false)
-          throw triton::exceptions::SolverEngine("Z3Solver::isSat(): Must be a logical node.");
+        return this->solve(node, limit, 0, 0, stats);
+      }
 
-        try {
-          z3::expr      expr = z3Ast.convert(node);
-          z3::context&  ctx  = expr.ctx();
-          z3::solver    solver(ctx);
 
-          /* Create a solver and add the expression */
-          solver.add(expr);
+      bool Z3Solver::isSat(const triton::ast::SharedAbstractNode& node) const {
+        SolverQueryStats stats;
 
-          /* Check if it is sat */
-          return solver.check() == z3::sat;
-        }
-        catch (const z3::exception& e) {
-          throw triton::exceptions::SolverEngine(std::string("Z3Solver::isSat(): ") + e.msg());
-        }
+        Z3Solver::getConstraint(node, "Z3Solver::isSat()");
+        this->solve(node, 0, 0, 0, stats);
+
+        return stats.status == triton::engines::solver::SAT;
       }
 
 
@@ -160,6 +223,63 @@ namespace triton {
       }
 
 
+      std::vector<std::map<triton::uint32, SolverModel>> Z3Solver::getBatchModels(const std::vector<triton::ast::SharedAbstractNode>& nodes, triton::uint32 workers, triton::uint32 timeout, triton::uint32 memoryLimit, std::vector<SolverQueryStats>& stats) const {
+        std::vector<std::map<triton::uint32, SolverModel>> ret(nodes.size());
+        std::vector<std::thread> pool;
+        std::atomic<triton::usize> next(0);
+        std::exception_ptr error = nullptr;
+        std::mutex errorMutex;
+
+        /* Checks the constraints before starting the workers */
+        for (const auto& node : nodes)
+          Z3Solver::getConstraint(node, "Z3Solver::getBatchModels()");
+
+        /* Each worker only writes the statistics of its queries */
+        stats.assign(nodes.size(), SolverQueryStats());
+
+        if (workers == 0)
+          workers = std::max(std::thread::hardware_concurrency(), 1u);
+        workers = static_cast<triton::uint32>(std::min<triton::usize>(workers, nodes.size()));
+
+        /*
+         *  Each worker takes the next query and solves it on its own z3's context.
+         *  The conversion only reads the Triton's nodes, nothing is shared between
+         *  the workers except the index of the next query and the results.
+         */
+        auto worker = [&]() {
+          try {
+            for (triton::usize index = next++; index < nodes.size(); index = next++) {
+              auto models = this->solve(nodes[index], 1, timeout, memoryLimit, stats[index]);
+              if (models.size())
+                ret[index] = models.front();
+            }
+          }
+          catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (error == nullptr)
+              error = std::current_exception();
+            /* Stops the other workers */
+            next = nodes.size();
+          }
+        };
+
+        for (triton::uint32 i = 1; i < workers; i++)
+          pool.emplace_back(worker);
+
+        /* The calling thread is a worker too */
+        if (workers)
+          worker();
+
+        for (auto& thread : pool)
+          thread.join();
+
+        if (error)
+          std::rethrow_exception(error);
+
+        return ret;
+      }
+
+
       triton::ast::SharedAbstractNode Z3Solver::simplify(const triton::ast::SharedAbstractNode& node) const {
         if (node == nullptr)
           throw triton::exceptions::AstTranslations("Z3Solver::simplify(): node cannot be null.");
@@ -213,6 +333,120 @@ namespace triton {
         return "z3";
       }
 
+
+      void Z3Solver::initSession(void) {
+        if (this->session != nullptr)
+          return;
+
+        this->sessionAst.reset(new(std::nothrow) triton::ast::TritonToZ3Ast(false));
+        if (this->sessionAst == nullptr)
+          throw triton::exceptions::SolverEngine("Z3Solver::initSession(): Not enough memory.");
+
+        this->session.reset(new(std::nothrow) z3::solver(this->sessionAst->getContext()));
+        if (this->session == nullptr)
+          throw triton::exceptions::SolverEngine("Z3Solver::initSession(): Not enough memory.");
+      }
+
+
+      void Z3Solver::push(void) {
+        try {
+          this->initSession();
+          this->session->push();
+        }
+        catch (const z3::exception& e) {
+          throw triton::exceptions::SolverEngine(std::string("Z3Solver::push(): ") + e.msg());
+        }
+      }
+
+
+      void Z3Solver::pop(void) {
+        if (this->session == nullptr || Z3_solver_get_num_scopes(this->session->ctx(), *this->session) == 0)
+          throw triton::exceptions::SolverEngine("Z3Solver::pop(): No scope to pop.");
+
+        try {
+          this->session->pop();
+          this->sessionAst->clearCache();
+        }
+        catch (const z3::exception& e) {
+          throw triton::exceptions::SolverEngine(std::string("Z3Solver::pop(): ") + e.msg());
+        }
+      }
+
+
+      void Z3Solver::addConstraint(const triton::ast::SharedAbstractNode& node) {
+        const triton::ast::SharedAbstractNode& onode = Z3Solver::getConstraint(node, "Z3Solver::addConstraint()");
+
+        try {
+          this->initSession();
+          this->session->add(this->sessionAst->convert(onode));
+        }
+        catch (const z3::exception& e) {
+          throw triton::exceptions::SolverEngine(std::string("Z3Solver::addConstraint(): ") + e.msg());
+        }
+      }
+
+
+      void Z3Solver::resetSession(void) {
+        /* The solver must be released before its context */
+        this->session.reset();
+        this->sessionAst.reset();
+      }
+
+
+      std::map<triton::uint32, SolverModel> Z3Solver::getSessionModel(const triton::ast::SharedAbstractNode& node) {
+        std::map<triton::uint32, SolverModel> ret;
+        const triton::ast::SharedAbstractNode& onode = Z3Solver::getConstraint(node, "Z3Solver::getSessionModel()");
+
+        try {
+          this->initSession();
+
+          /* The constraint only lives during this query */
+          this->session->push();
+          try {
+            this->session->add(this->sessionAst->convert(onode));
+            if (this->session->check() == z3::sat)
+              ret = Z3Solver::extractModel(this->session->get_model(), *this->sessionAst, nullptr);
+          }
+          catch (...) {
+            this->session->pop();
+            throw;
+          }
+          this->session->pop();
+        }
+        catch (const z3::exception& e) {
+          throw triton::exceptions::SolverEngine(std::string("Z3Solver::getSessionModel(): ") + e.msg());
+        }
+
+        return ret;
+      }
+
+
+      bool Z3Solver::isSessionSat(const triton::ast::SharedAbstractNode& node) {
+        bool ret = false;
+        const triton::ast::SharedAbstractNode& onode = Z3Solver::getConstraint(node, "Z3Solver::isSessionSat()");
+
+        try {
+          this->initSession();
+
+          /* The constraint only lives during this query */
+          this->session->push();
+          try {
+            this->session->add(this->sessionAst->convert(onode));
+            ret = (this->session->check() == z3::sat);
+          }
+          catch (...) {
+            this->session->pop();
+            throw;
+          }
+          this->session->pop();
+        }
+        catch (const z3::exception& e) {
+          throw triton::exceptions::SolverEngine(std::string("Z3Solver::isSessionSat(): ") + e.msg());
+        }
+
+        return ret;
+      }
+
     };
   };
 };
@@ -5,6 +5,7 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
 #include <cstring>
 #include <new>
 
@@ -48,10 +49,10 @@ namespace triton {
           astCtxt(other.astCtxt),
           modes(other.modes) {
 
-        this->alignedMemoryReference      = other.alignedMemoryReference;
         this->architecture                = other.architecture;
         this->callbacks                   = other.callbacks;
         this->enableFlag                  = other.enableFlag;
+        this->lazyReg                     = other.lazyReg;
         this->memoryReference             = other.memoryReference;
         this->numberOfRegisters           = other.numberOfRegisters;
         this->symbolicExpressions         = other.symbolicExpressions;
@@ -66,11 +67,11 @@ namespace triton {
         triton::engines::symbolic::SymbolicSimplification::operator=(other);
         triton::engines::symbolic::PathManager::operator=(other);
 
-        this->alignedMemoryReference      = other.alignedMemoryReference;
         this->architecture                = other.architecture;
         this->astCtxt                     = other.astCtxt;
         this->callbacks                   = other.callbacks;
         this->enableFlag                  = other.enableFlag;
+        this->lazyReg                     = other.lazyReg;
         this->memoryReference             = other.memoryReference;
         this->modes                       = other.modes;
         this->numberOfRegisters           = other.numberOfRegisters;
@@ -96,6 +97,7 @@ namespace triton {
           return;
 
         this->symbolicReg[parentId] = nullptr;
+        this->lazyReg.erase(parentId);
       }
 
 
@@ -103,6 +105,7 @@ namespace triton {
       void SymbolicEngine::concretizeAllRegister(void) {
         for (triton::uint32 i = 0; i < this->numberOfRegisters; i++)
           this->symbolicReg[i] = nullptr;
+        this->lazyReg.clear();
       }
 
 
@@ -112,11 +115,7 @@ namespace triton {
        * before symbolic processing.
        */
       void SymbolicEngine::concretizeMemory(const triton::arch::MemoryAccess& mem) {
-        triton::uint64 addr = mem.getAddress();
-        triton::uint32 size = mem.getSize();
-
-        for (triton::uint32 index = 0; index < size; index++)
-          this->concretizeMemory(addr+index);
+        this->removeMemoryReference(mem.getAddress(), mem.getSize());
       }
 
 
@@ -126,83 +125,172 @@ namespace triton {
        * before symbolic processing.
        */
       void SymbolicEngine::concretizeMemory(triton::uint64 addr) {
-        this->memoryReference.erase(addr);
-        if (this->modes.isModeEnabled(triton::modes::ALIGNED_MEMORY))
-          this->removeAlignedMemory(addr, BYTE_SIZE);
+        this->removeMemoryReference(addr, BYTE_SIZE);
       }
 
 
       /* Same as concretizeMemory but with all address memory */
       void SymbolicEngine::concretizeAllMemory(void) {
         this->memoryReference.clear();
-        this->alignedMemoryReference.clear();
       }
 
 
-      /* Gets an aligned entry. */
-      const SharedSymbolicExpression& SymbolicEngine::getAlignedMemory(triton::uint64 address, triton::uint32 size) {
-        if (this->isAlignedMemory(address, size))
-          return this->alignedMemoryReference[std::make_pair(address, size)];
-        throw triton::exceptions::SymbolicEngine("SymbolicEngine::getAlignedMemory(): memory not found");
+      /* Returns the memory range containing the address */
+      std::map<triton::uint64, MemoryRange>::const_iterator SymbolicEngine::findMemoryRange(triton::uint64 addr) const {
+        auto it = this->memoryReference.upper_bound(addr);
+
+        if (it == this->memoryReference.begin())
+          return this->memoryReference.end();
+
+        --it;
+        if (addr - it->first < it->second.size)
+          return it;
+
+        return this->memoryReference.end();
       }
 
 
-      /* Checks if the aligned memory is recored. */
-      bool SymbolicEngine::isAlignedMemory(triton::uint64 address, triton::uint32 size) {
-        if (this->alignedMemoryReference.find(std::make_pair(address, size)) != this->alignedMemoryReference.end())
-          return true;
-        return false;
+      /* Splits the memory range containing the address. Both parts keep the same expression. */
+      void SymbolicEngine::splitMemoryRange(triton::uint64 addr) {
+        auto it = this->findMemoryRange(addr);
+
+        if (it == this->memoryReference.end() || it->first == addr)
+          return;
+
+        triton::uint32 delta = static_cast<triton::uint32>(addr - it->first);
+        MemoryRange& low     = this->memoryReference[it->first];
+        MemoryRange high     = {low.size - delta, low.offset + delta, low.expr, low.slices};
+
+        low.size = delta;
+        this->memoryReference[addr] = high;
       }
 
 
-      /* Adds an aligned memory */
-      void SymbolicEngine::addAlignedMemory(triton::uint64 address, triton::uint32 size, const SharedSymbolicExpression& expr) {
-        this->removeAlignedMemory(address, size);
-        if (!(this->modes.isModeEnabled(triton::modes::ONLY_ON_SYMBOLIZED) && expr->getAst()->isSymbolized() == false))
-          this->alignedMemoryReference[std::make_pair(address, size)] = expr;
+      /* Adds a symbolic memory reference on the range [addr:size] */
+      void SymbolicEngine::addMemoryReference(triton::uint64 addr, triton::uint32 size, const SharedSymbolicExpression& expr) {
+        this->removeMemoryReference(addr, size);
+        this->memoryReference[addr] = {size, 0, expr, {}};
       }
 
 
-      /* Removes an aligned memory */
-      void SymbolicEngine::removeAlignedMemory(triton::uint64 address, triton::uint32 size) {
-        /* Remove overloaded positive ranges */
-        for (triton::uint32 index = 0; index < size; index++) {
-          this->alignedMemoryReference.erase(std::make_pair(address+index, BYTE_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, WORD_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, DWORD_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, QWORD_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, DQWORD_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, QQWORD_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, DQQWORD_SIZE));
+      /* Removes the symbolic memory references of the range [addr:size] */
+      void SymbolicEngine::removeMemoryReference(triton::uint64 addr, triton::uint32 size) {
+        if (size == 0 || this->memoryReference.empty())
+          return;
+
+        /* Only the ranges partially overlapped are sliced */
+        this->splitMemoryRange(addr);
+        this->splitMemoryRange(addr + size);
+
+        auto first = this->memoryReference.lower_bound(addr);
+        auto last  = this->memoryReference.lower_bound(addr + size);
+
+        /* The range wraps around the address space */
+        if (addr + size < addr)
+          last = this->memoryReference.end();
+
+        this->memoryReference.erase(first, last);
+      }
+
+
+      /* Returns the AST of [offset:size] bytes of a memory range */
+      triton::ast::SharedAbstractNode SymbolicEngine::getMemoryRangeAst(const MemoryRange& range, triton::uint32 offset, triton::uint32 size) const {
+        triton::ast::SharedAbstractNode node = this->astCtxt.reference(range.expr);
+        triton::uint32 low                   = (range.offset + offset) * BYTE_SIZE_BIT;
+        triton::uint32 high                  = low + (size * BYTE_SIZE_BIT) - 1;
+
+        /* The access matches the whole expression, returns it without slicing */
+        if (low == 0 && high + 1 == node->getBitvectorSize())
+          return node;
+
+        return this->astCtxt.extract(high, low, node);
+      }
+
+
+      /* Returns an expression of [offset:size] bytes of a memory range. The range keeps its expression and the slice is built only once. */
+      SharedSymbolicExpression SymbolicEngine::getMemoryRangeExpression(triton::uint64 addr, const MemoryRange& range, triton::uint32 offset, triton::uint32 size) const {
+        /* The slice is the whole expression */
+        if (range.offset + offset == 0 && size * BYTE_SIZE_BIT == range.expr->getAst()->getBitvectorSize())
+          return range.expr;
+
+        /* The slice has already been returned */
+        auto slice = range.slices.find({range.offset + offset, size});
+        if (slice != range.slices.end()) {
+          slice->second->isTainted = range.expr->isTainted;
+          return slice->second;
         }
 
-        /* Remove overloaded negative ranges */
-        for (triton::uint32 index = 1; index < DQQWORD_SIZE; index++) {
-          if (index < WORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, WORD_SIZE));
-          if (index < DWORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, DWORD_SIZE));
-          if (index < QWORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, QWORD_SIZE));
-          if (index < DQWORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, DQWORD_SIZE));
-          if (index < QQWORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, QQWORD_SIZE));
-          if (index < DQQWORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, DQQWORD_SIZE));
+        triton::usize id = this->getUniqueSymExprId();
+        SharedSymbolicExpression se = std::make_shared<SymbolicExpression>(this->processSimplification(this->getMemoryRangeAst(range, offset, size)), id, MEMORY_EXPRESSION, "Memory reference");
+        if (se == nullptr)
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::getMemoryRangeExpression(): not enough memory");
+
+        /* A range split by a partial store may not have the size of a memory access */
+        switch (size) {
+          case BYTE_SIZE:
+          case WORD_SIZE:
+          case DWORD_SIZE:
+          case QWORD_SIZE:
+          case DQWORD_SIZE:
+          case QQWORD_SIZE:
+          case DQQWORD_SIZE:
+            se->setOriginMemory(triton::arch::MemoryAccess(addr + offset, size));
+            break;
+          default:
+            break;
         }
+
+        se->isTainted = range.expr->isTainted;
+        this->symbolicExpressions[id] = se;
+        range.slices[{range.offset + offset, size}] = se;
+
+        return se;
       }
 
 
       /* Returns the reference memory if it's referenced otherwise returns nullptr */
       SharedSymbolicExpression SymbolicEngine::getSymbolicMemory(triton::uint64 addr) const {
-        auto it = this->memoryReference.find(addr);
+        auto it = this->findMemoryRange(addr);
+        if (it == this->memoryReference.end())
+          return nullptr;
+
+        /* Slice the byte */
+        return this->getMemoryRangeExpression(it->first, it->second, static_cast<triton::uint32>(addr - it->first), BYTE_SIZE);
+      }
+
+
+      /* Returns the expression of the memory range containing the address otherwise returns nullptr */
+      SharedSymbolicExpression SymbolicEngine::getSymbolicMemoryRange(triton::uint64 addr) const {
+        auto it = this->findMemoryRange(addr);
         if (it != this->memoryReference.end())
-          return it->second;
+          return it->second.expr;
         return nullptr;
       }
 
 
+      /* Sets the taint of the memory ranges of [addr:size]. Slices of an expression get their own expression, so the other slices keep their taint. */
+      void SymbolicEngine::setMemoryRangesTaint(triton::uint64 addr, triton::uint32 size, bool flag) {
+        if (size == 0 || this->memoryReference.empty())
+          return;
+
+        this->splitMemoryRange(addr);
+        this->splitMemoryRange(addr + size);
+
+        auto it = this->memoryReference.lower_bound(addr);
+        for (; it != this->memoryReference.end() && it->first - addr < size; it++) {
+          MemoryRange& range = it->second;
+          if (range.expr->isTainted == flag)
+            continue;
+          if (range.offset != 0 || range.size * BYTE_SIZE_BIT != range.expr->getAst()->getBitvectorSize()) {
+            range.expr   = this->getMemoryRangeExpression(it->first, range, 0, range.size);
+            range.offset = 0;
+            range.slices.clear();
+          }
+          range.expr->isTainted = flag;
+        }
+      }
+
+
       /* Returns the symbolic variable otherwise raises an exception */
       const SharedSymbolicVariable& SymbolicEngine::getSymbolicVariableFromId(triton::usize symVarId) const {
         auto it = this->symbolicVariables.find(symVarId);
@@ -240,6 +328,9 @@ namespace triton {
         if (!this->architecture->isRegisterValid(parentId))
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::getSymbolicRegister(): Invalid Register");
 
+        if (!this->lazyReg.empty())
+          this->buildLazyRegister(parentId);
+
         return this->symbolicReg.at(parentId);
       }
 
@@ -278,7 +369,7 @@ namespace triton {
       /* Creates a new symbolic expression */
       /* Get an unique id.
        * Mainly used when a new symbolic expression is created */
-      triton::usize SymbolicEngine::getUniqueSymExprId(void) {
+      triton::usize SymbolicEngine::getUniqueSymExprId(void) const {
         return this->uniqueSymExprId++;
       }
 
@@ -325,13 +416,12 @@ namespace triton {
           }
 
           /* Concretize the memory if it exists */
-          for (auto it = this->memoryReference.begin(); it != memoryReference.end(); it++) {
-            if (it->second && it->second->getId() == symExprId) {
-              this->concretizeMemory(it->first);
-              return;
-            }
+          for (auto it = this->memoryReference.begin(); it != this->memoryReference.end();) {
+            if (it->second.expr->getId() == symExprId)
+              it = this->memoryReference.erase(it);
+            else
+              it++;
           }
-          // FIXME: Also try to remove it from alignedMemory
           // FIXME: Remove it from ast context too
         }
       }
@@ -375,21 +465,17 @@ namespace triton {
       /* Slices all expressions from a given one */
       std::map<triton::usize, SharedSymbolicExpression> SymbolicEngine::sliceExpressions(const SharedSymbolicExpression& expr) {
         std::map<triton::usize, SharedSymbolicExpression> exprs;
-        std::deque<triton::ast::SharedAbstractNode> worklist;
 
         if (expr == nullptr)
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::sliceExpressions(): expr cannot be null.");
 
         exprs[expr->getId()] = expr;
-        triton::ast::nodesExtraction(&worklist, expr->getAst(), true /* unroll */, false /* revert */);
-
-        for (auto&& n : worklist) {
+        triton::ast::postOrderTraversal(expr->getAst(), true /* unroll */, [&exprs](const triton::ast::SharedAbstractNode& n) {
           if (n->getType() == triton::ast::REFERENCE_NODE) {
-            auto expr = reinterpret_cast<triton::ast::ReferenceNode*>(n.get())->getSymbolicExpression();
-            auto eid  = expr->getId();
-            exprs[eid] = expr;
+            const auto& expr = reinterpret_cast<triton::ast::ReferenceNode*>(n.get())->getSymbolicExpression();
+            exprs[expr->getId()] = expr;
           }
-        }
+        });
 
         return exprs;
       }
@@ -421,6 +507,9 @@ namespace triton {
       std::map<triton::arch::register_e, SharedSymbolicExpression> SymbolicEngine::getSymbolicRegisters(void) const {
         std::map<triton::arch::register_e, SharedSymbolicExpression> ret;
 
+        while (!this->lazyReg.empty())
+          this->buildLazyRegister(this->lazyReg.begin()->first);
+
         for (triton::uint32 it = 0; it < this->numberOfRegisters; it++) {
           if (this->symbolicReg[it] != nullptr) {
             ret[triton::arch::register_e(it)] = this->symbolicReg[it];
@@ -432,8 +521,13 @@ namespace triton {
 
 
       /* Returns the map of symbolic memory defined */
-      const std::map<triton::uint64, SharedSymbolicExpression>& SymbolicEngine::getSymbolicMemory(void) const {
-        return this->memoryReference;
+      std::map<triton::uint64, SharedSymbolicExpression> SymbolicEngine::getSymbolicMemory(void) const {
+        std::map<triton::uint64, SharedSymbolicExpression> ret;
+
+        for (const auto& item : this->memoryReference)
+          ret[item.first] = this->getMemoryRangeExpression(item.first, item.second, 0, item.second.size);
+
+        return ret;
       }
 
 
@@ -473,33 +567,10 @@ namespace triton {
         /* Setup the concrete value to the symbolic variable */
         this->setConcreteVariableValue(symVar, cv);
 
-        /* Record the aligned symbolic variable for a symbolic optimization */
-        if (this->modes.isModeEnabled(triton::modes::ALIGNED_MEMORY)) {
-          const SharedSymbolicExpression& se = this->newSymbolicExpression(symVarNode, MEMORY_EXPRESSION, "aligned Byte reference");
-          this->addAlignedMemory(memAddr, symVarSize, se);
-        }
-
-        /*  Split expression in bytes */
-        for (triton::sint32 index = symVarSize-1; index >= 0; index--) {
-          triton::uint32 high = ((BYTE_SIZE_BIT * (index + 1)) - 1);
-          triton::uint32 low  = ((BYTE_SIZE_BIT * (index + 1)) - BYTE_SIZE_BIT);
-
-          /* Isolate the good part of the symbolic variable */
-          const triton::ast::SharedAbstractNode& tmp = this->astCtxt.extract(high, low, symVarNode);
-
-          /* Check if the memory address is already defined */
-          SharedSymbolicExpression se = this->getSymbolicMemory(memAddr+index);
-          if (se == nullptr) {
-            se = this->newSymbolicExpression(tmp, MEMORY_EXPRESSION, "Byte reference");
-            /* Add the new memory reference */
-            this->addMemoryReference(memAddr+index, se);
-          }
-          else {
-            se->setAst(tmp);
-          }
-          /* Defines the origin of the expression */
-          se->setOriginMemory(triton::arch::MemoryAccess(memAddr+index, BYTE_SIZE));
-        }
+        /* A new memory reference is created, the previous expression may still be used by other ranges and registers */
+        const SharedSymbolicExpression& se = this->newSymbolicExpression(symVarNode, MEMORY_EXPRESSION, "Memory reference");
+        se->setOriginMemory(triton::arch::MemoryAccess(memAddr, symVarSize));
+        this->addMemoryReference(memAddr, symVarSize, se);
 
         return symVar;
       }
@@ -516,6 +587,9 @@ namespace triton {
         if (reg.isMutable() == false)
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::convertRegisterToSymbolicVariable(): This register is immutable");
 
+        /* A lazy expression is replaced by the variable, no need to build it */
+        this->lazyReg.erase(parent.getId());
+
         /* Get the symbolic expression */
         const SharedSymbolicExpression& expression = this->getSymbolicRegister(reg);
 
@@ -655,55 +729,53 @@ namespace triton {
       triton::ast::SharedAbstractNode SymbolicEngine::getMemoryAst(const triton::arch::MemoryAccess& mem) {
         std::list<triton::ast::SharedAbstractNode> opVec;
 
-        triton::ast::SharedAbstractNode tmp       = nullptr;
         triton::uint64 address                    = mem.getAddress();
         triton::uint32 size                       = mem.getSize();
+        triton::uint32 index                      = 0;
         triton::uint8 concreteValue[DQQWORD_SIZE] = {0};
         triton::uint512 value                     = this->architecture->getConcreteMemoryValue(mem);
 
         triton::utils::fromUintToBuffer(value, concreteValue);
 
         /*
-         * Symbolic optimization
-         * If the memory access is aligned, don't split the memory.
+         * Iterate on the memory ranges overlapped by the access. Symbolic ranges
+         * are sliced only if the access partially overlaps them, an access which
+         * exactly matches a store returns the stored expression.
          */
-        if (this->modes.isModeEnabled(triton::modes::ALIGNED_MEMORY) && this->isAlignedMemory(address, size)) {
-          triton::ast::SharedAbstractNode anode = this->getAlignedMemory(address, size)->getAst();
-          return anode;
-        }
-
-        /* Iterate on every memory cells to use their symbolic or concrete values */
-        while (size) {
-          const SharedSymbolicExpression& symMem = this->getSymbolicMemory(address + size - 1);
-          /* Check if the memory cell is already symbolic */
-          if (symMem != nullptr) {
-            tmp = this->astCtxt.reference(symMem);
-            opVec.push_back(this->astCtxt.extract((BYTE_SIZE_BIT - 1), 0, tmp));
+        auto it = this->findMemoryRange(address);
+        if (it == this->memoryReference.end())
+          it = this->memoryReference.lower_bound(address);
+
+        while (index < size) {
+          /* The memory cell is symbolic */
+          if (it != this->memoryReference.end() && it->first <= address + index) {
+            triton::uint32 offset = static_cast<triton::uint32>(address + index - it->first);
+            triton::uint32 count  = std::min(it->second.size - offset, size - index);
+            opVec.push_front(this->getMemoryRangeAst(it->second, offset, count));
+            index += count;
+            it++;
           }
-          /* Otherwise, use the concerte value */
+          /* Otherwise, use the concrete value until the next symbolic range */
           else {
-            tmp = this->astCtxt.bv(concreteValue[size - 1], BYTE_SIZE_BIT);
-            opVec.push_back(this->astCtxt.extract((BYTE_SIZE_BIT - 1), 0, tmp));
+            triton::uint32 count = size - index;
+            triton::uint512 cv   = 0;
+
+            if (it != this->memoryReference.end() && it->first - (address + index) < count)
+              count = static_cast<triton::uint32>(it->first - (address + index));
+
+            for (triton::uint32 i = index + count; i > index; i--)
+              cv = (cv << BYTE_SIZE_BIT) | concreteValue[i - 1];
+
+            opVec.push_front(this->astCtxt.bv(cv, count * BYTE_SIZE_BIT));
+            index += count;
           }
-          size--;
         }
 
-        /* Concatenate all memory cell to create a bit vector with the appropriate memory access */
-        switch (opVec.size()) {
-          case DQQWORD_SIZE:
-          case QQWORD_SIZE:
-          case DQWORD_SIZE:
-          case QWORD_SIZE:
-          case DWORD_SIZE:
-          case WORD_SIZE:
-            tmp = this->astCtxt.concat(opVec);
-            break;
-          case BYTE_SIZE:
-            tmp = opVec.front();
-            break;
-        }
+        /* Concatenate all parts to create a bit vector with the appropriate memory access */
+        if (opVec.size() == 1)
+          return opVec.front();
 
-        return tmp;
+        return this->astCtxt.concat(opVec);
       }
 
 
@@ -783,59 +855,15 @@ namespace triton {
 
       /* Returns the new symbolic memory expression */
       const SharedSymbolicExpression& SymbolicEngine::createSymbolicMemoryExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, const triton::arch::MemoryAccess& mem, const std::string& comment) {
-        std::list<triton::ast::SharedAbstractNode> ret;
-        triton::ast::SharedAbstractNode tmp = nullptr;
-        SharedSymbolicExpression se         = nullptr;
-        triton::uint64 address              = mem.getAddress();
-        triton::uint32 writeSize            = mem.getSize();
-
-        /* Record the aligned memory for a symbolic optimization */
-        if (this->modes.isModeEnabled(triton::modes::ALIGNED_MEMORY)) {
-          const SharedSymbolicExpression& aligned = this->newSymbolicExpression(node, MEMORY_EXPRESSION, "Aligned Byte reference - " + comment);
-          this->addAlignedMemory(address, writeSize, aligned);
-        }
+        /* The whole store is assigned to a single expression */
+        const SharedSymbolicExpression& se = this->newSymbolicExpression(node, MEMORY_EXPRESSION, comment);
+        se->setOriginMemory(mem);
 
-        /*
-         * As the x86's memory can be accessed without alignment, each byte of the
-         * memory must be assigned to an unique reference.
-         */
-        while (writeSize) {
-          triton::uint32 high = ((writeSize * BYTE_SIZE_BIT) - 1);
-          triton::uint32 low  = ((writeSize * BYTE_SIZE_BIT) - BYTE_SIZE_BIT);
-          /* Extract each byte of the memory */
-          tmp = this->astCtxt.extract(high, low, node);
-          /* Assign each byte to a new symbolic expression */
-          se = this->newSymbolicExpression(tmp, MEMORY_EXPRESSION, "Byte reference - " + comment);
-          /* Set the origin of the symbolic expression */
-          se->setOriginMemory(triton::arch::MemoryAccess(((address + writeSize) - 1), BYTE_SIZE));
-          /* ret is the for the final expression */
-          ret.push_back(tmp);
-          /* add the symbolic expression to the instruction */
-          inst.addSymbolicExpression(se);
-          /* Assign memory with little endian */
-          this->addMemoryReference((address + writeSize) - 1, se);
-          /* continue */
-          writeSize--;
-        }
-
-        /* If there is only one reference, we return the symbolic expression */
-        if (ret.size() == 1) {
-          /* Synchronize the concrete state */
-          this->architecture->setConcreteMemoryValue(mem, tmp->evaluate());
-          /* Define the memory store */
-          inst.setStoreAccess(mem, node);
-          /* It will return se */
-          return inst.symbolicExpressions.back();
-        }
-
-        /* Otherwise, we return the concatenation of all symbolic expressions */
-        tmp = this->astCtxt.concat(ret);
+        /* Assign the memory range */
+        this->addMemoryReference(mem.getAddress(), mem.getSize(), se);
 
         /* Synchronize the concrete state */
-        this->architecture->setConcreteMemoryValue(mem, tmp->evaluate());
-
-        se = this->newSymbolicExpression(tmp, MEMORY_EXPRESSION, "Temporary concatenation reference - " + comment);
-        se->setOriginMemory(triton::arch::MemoryAccess(address, mem.getSize()));
+        this->architecture->setConcreteMemoryValue(mem, node->evaluate());
 
         /* Set explicit write of the memory access */
         inst.setStoreAccess(mem, node);
@@ -912,6 +940,48 @@ namespace triton {
       }
 
 
+      /* Assigns a lazy expression to a flag */
+      void SymbolicEngine::createLazySymbolicFlagExpression(const std::function<triton::ast::SharedAbstractNode(void)>& builder, const triton::arch::Register& flag, const triton::uint512& value, bool isTainted, const std::string& comment) {
+        if (!this->architecture->isFlag(flag))
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::createLazySymbolicFlagExpression(): The register must be a flag.");
+
+        if (flag.isMutable()) {
+          this->symbolicReg[flag.getId()] = nullptr;
+          this->lazyReg[flag.getId()] = {builder, comment, isTainted};
+          /* Synchronize the concrete state */
+          this->architecture->setConcreteRegisterValue(flag, value);
+        }
+      }
+
+
+      /* Builds the symbolic expression of a lazy register */
+      void SymbolicEngine::buildLazyRegister(triton::uint32 id) const {
+        auto it = this->lazyReg.find(id);
+        if (it == this->lazyReg.end())
+          return;
+
+        LazyExpression lazy = std::move(it->second);
+        this->lazyReg.erase(it);
+
+        const triton::ast::SharedAbstractNode& node = lazy.builder();
+
+        /* Keep the register concrete if the expression would have been removed */
+        if (this->modes.isModeEnabled(triton::modes::ONLY_ON_SYMBOLIZED) && node->isSymbolized() == false)
+          return;
+
+        /* Same as newSymbolicExpression(), the lazy registers are built from the const getters */
+        triton::usize exprId = this->getUniqueSymExprId();
+        SharedSymbolicExpression se = std::make_shared<SymbolicExpression>(this->processSimplification(node), exprId, REGISTER_EXPRESSION, lazy.comment);
+        if (se == nullptr)
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::buildLazyRegister(): not enough memory");
+
+        this->symbolicExpressions[exprId] = se;
+        se->setOriginRegister(this->architecture->getRegister(static_cast<triton::arch::register_e>(id)));
+        se->isTainted = lazy.isTainted;
+        this->symbolicReg[id] = se;
+      }
+
+
       /* Returns the new symbolic volatile expression */
       const SharedSymbolicExpression& SymbolicEngine::createSymbolicVolatileExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, const std::string& comment) {
         const SharedSymbolicExpression& se = this->newSymbolicExpression(node, VOLATILE_EXPRESSION, comment);
@@ -919,12 +989,6 @@ namespace triton {
       }
 
 
-      /* Adds and assign a new memory reference */
-      void SymbolicEngine::addMemoryReference(triton::uint64 mem, const SharedSymbolicExpression& expr) {
-        this->memoryReference[mem] = expr;
-      }
-
-
       /* Assigns a symbolic expression to a register */
       void SymbolicEngine::assignSymbolicExpressionToRegister(const SharedSymbolicExpression& se, const triton::arch::Register& reg) {
         const triton::ast::SharedAbstractNode& node = se->getAst();
@@ -946,6 +1010,7 @@ namespace triton {
         if (reg.isMutable()) {
           /* Assign if this register is mutable */
           this->symbolicReg[id] = se;
+          this->lazyReg.erase(id);
           /* Synchronize the concrete state */
           this->architecture->setConcreteRegisterValue(reg, node->evaluate());
         }
@@ -955,35 +1020,18 @@ namespace triton {
       /* Assigns a symbolic expression to a memory */
       void SymbolicEngine::assignSymbolicExpressionToMemory(const SharedSymbolicExpression& se, const triton::arch::MemoryAccess& mem) {
         const triton::ast::SharedAbstractNode& node = se->getAst();
-        triton::uint64 address                      = mem.getAddress();
-        triton::uint32 writeSize                    = mem.getSize();
 
         /* Check if the size of the symbolic expression is equal to the memory access */
         if (node->getBitvectorSize() != mem.getBitSize())
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::assignSymbolicExpressionToMemory(): The size of the symbolic expression is not equal to the memory access.");
 
-        /* Record the aligned memory for a symbolic optimization */
-        if (this->modes.isModeEnabled(triton::modes::ALIGNED_MEMORY))
-          this->addAlignedMemory(address, writeSize, se);
+        /* The expression may be shared with registers, the memory gets its own expression */
+        const SharedSymbolicExpression& memExpr = this->newSymbolicExpression(node, MEMORY_EXPRESSION, "Memory reference");
+        memExpr->setOriginMemory(mem);
+        memExpr->isTainted = se->isTainted;
 
-        /*
-         * As the x86's memory can be accessed without alignment, each byte of the
-         * memory must be assigned to an unique reference.
-         */
-        while (writeSize) {
-          triton::uint32 high = ((writeSize * BYTE_SIZE_BIT) - 1);
-          triton::uint32 low  = ((writeSize * BYTE_SIZE_BIT) - BYTE_SIZE_BIT);
-          /* Extract each byte of the memory */
-          const triton::ast::SharedAbstractNode& tmp = this->astCtxt.extract(high, low, node);
-          /* For each byte create a new symbolic expression */
-          const SharedSymbolicExpression& byteRef = this->newSymbolicExpression(tmp, MEMORY_EXPRESSION, "Byte reference");
-          /* Set the origin of the symbolic expression */
-          byteRef->setOriginMemory(triton::arch::MemoryAccess(((address + writeSize) - 1), BYTE_SIZE));
-          /* Assign memory with little endian */
-          this->addMemoryReference((address + writeSize) - 1, byteRef);
-          /* continue */
-          writeSize--;
-        }
+        /* Assign the memory range */
+        this->addMemoryReference(mem.getAddress(), mem.getSize(), memExpr);
       }
 
 
@@ -1015,13 +1063,13 @@ namespace triton {
 
       /* Returns true if memory cell expressions contain symbolic variables. */
       bool SymbolicEngine::isMemorySymbolized(triton::uint64 addr, triton::uint32 size) const {
-        for (triton::uint32 i = 0; i < size; i++) {
-          const SharedSymbolicExpression& expr = this->getSymbolicMemory(addr + i);
+        auto it = this->findMemoryRange(addr);
 
-          if(expr == nullptr)
-            continue;
+        if (it == this->memoryReference.end())
+          it = this->memoryReference.lower_bound(addr);
 
-          if (expr->isSymbolized())
+        for (; it != this->memoryReference.end() && (it->first <= addr || it->first - addr < size); it++) {
+          if (it->second.expr->isSymbolized())
             return true;
         }
 
@@ -1099,12 +1147,17 @@ namespace triton {
 
 
       const triton::uint512& SymbolicEngine::getConcreteVariableValue(const SharedSymbolicVariable& symVar) const {
-        return this->astCtxt.getVariableValue(symVar->getName());
+        return this->astCtxt.getVariableValue(symVar->getId());
       }
 
 
       void SymbolicEngine::setConcreteVariableValue(const SharedSymbolicVariable& symVar, const triton::uint512& value) {
-        this->astCtxt.updateVariable(symVar->getName(), value);
+        this->astCtxt.updateVariable(symVar->getId(), value);
+      }
+
+
+      void SymbolicEngine::setConcreteVariableValues(const std::map<triton::usize, triton::uint512>& values) {
+        this->astCtxt.updateVariables(values);
       }
 
     }; /* symbolic namespace */
@@ -5,7 +5,9 @@
 **  This program is under the terms of the BSD License.
 */
 
-#include <list>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 #include <triton/exceptions.hpp>
 #include <triton/symbolicSimplification.hpp>
 
@@ -173,32 +175,80 @@ namespace triton {
 
 
       triton::ast::SharedAbstractNode SymbolicSimplification::processSimplification(const triton::ast::SharedAbstractNode& node) const {
-        std::list<triton::ast::SharedAbstractNode> worklist;
+        std::vector<triton::ast::SharedAbstractNode> worklist;
+        std::unordered_map<triton::ast::SharedAbstractNode, triton::ast::SharedAbstractNode> simplified;
+        std::unordered_map<triton::ast::SharedAbstractNode, triton::ast::SharedAbstractNode> rebuilt;
+        std::unordered_set<triton::ast::SharedAbstractNode> changed;
         triton::ast::SharedAbstractNode snode = node;
 
         if (node == nullptr)
           throw triton::exceptions::SymbolicSimplification("SymbolicSimplification::processSimplification(): node cannot be null.");
 
-        if (this->callbacks) {
+        if (this->callbacks && this->callbacks->isDefined) {
+          auto simplify = [&](const triton::ast::SharedAbstractNode& child) -> const triton::ast::SharedAbstractNode& {
+            auto it = simplified.find(child);
+            if (it == simplified.end())
+              it = simplified.insert(std::make_pair(child, this->callbacks->processCallbacks(triton::callbacks::SYMBOLIC_SIMPLIFICATION, child))).first;
+            return it->second;
+          };
+
           snode = this->callbacks->processCallbacks(triton::callbacks::SYMBOLIC_SIMPLIFICATION, node);
           /*
            *  We use a worklist strategy to avoid recursive calls
            *  and so stack overflow when going through a big AST.
+           *  The shared subtrees are walked once and the callbacks
+           *  are called once per node. A node is rebuilt once all
+           *  its simplified children are rebuilt, interned nodes
+           *  are shared by unrelated trees so they are copied
+           *  instead of being modified.
            */
           worklist.push_back(snode);
           while (worklist.size()) {
-            auto ast = worklist.front();
-            worklist.pop_front();
+            auto ast = worklist.back();
+            if (rebuilt.find(ast) != rebuilt.end()) {
+              worklist.pop_back();
+              continue;
+            }
+
+            bool ready = true;
+            for (auto& child : ast->getChildren()) {
+              /* Don't apply simplification on nodes like String, Integer, etc. */
+              if (child->getBitvectorSize()) {
+                auto& schild = simplify(child);
+                if (rebuilt.find(schild) == rebuilt.end()) {
+                  worklist.push_back(schild);
+                  ready = false;
+                }
+              }
+            }
+            if (!ready)
+              continue;
+            worklist.pop_back();
+
+            auto result = ast;
+            bool modified = false;
             for (triton::uint32 index = 0; index < ast->getChildren().size(); index++) {
               auto child = ast->getChildren()[index];
-              /* Don't apply simplification on nodes like String, Integer, etc. */
               if (child->getBitvectorSize()) {
-                auto schild = this->callbacks->processCallbacks(triton::callbacks::SYMBOLIC_SIMPLIFICATION, child);
-                ast->setChild(index, schild);
-                worklist.push_back(schild);
+                auto& schild = rebuilt[simplify(child)];
+                if (schild != child) {
+                  if (result == ast && ast->isInterned())
+                    result = triton::ast::shallowCopy(ast.get());
+                  result->setChild(index, schild);
+                }
+                modified |= (schild != child || changed.find(schild) != changed.end());
               }
             }
+
+            /* Children are rebuilt first, so the node is initialized once */
+            if (modified) {
+              result->init(false);
+              changed.insert(result);
+            }
+            rebuilt[ast] = result;
           }
+
+          snode = rebuilt[snode];
         }
 
         return snode;
@@ -0,0 +1,285 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <bitset>
+#include <cstring>
+#include <new>
+
+#include <triton/exceptions.hpp>
+#include <triton/shadowMemory.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace taint {
+
+      ShadowMemory::ShadowMemory() {
+        this->lastBase = 0;
+        this->lastPage = nullptr;
+      }
+
+
+      ShadowMemory::ShadowMemory(const ShadowMemory& other) {
+        this->copy(other);
+      }
+
+
+      ShadowMemory& ShadowMemory::operator=(const ShadowMemory& other) {
+        this->copy(other);
+        return *this;
+      }
+
+
+      void ShadowMemory::copy(const ShadowMemory& other) {
+        this->pages.clear();
+        this->lastBase = 0;
+        this->lastPage = nullptr;
+
+        for (const auto& item : other.pages) {
+          std::unique_ptr<Page> page(new(std::nothrow) Page());
+          if (page == nullptr)
+            throw triton::exceptions::TaintEngine("ShadowMemory::copy(): Not enough memory.");
+
+          std::memcpy(page->bits, item.second->bits, sizeof(page->bits));
+          page->count = item.second->count;
+
+          if (item.second->labels != nullptr) {
+            page->labels.reset(new(std::nothrow) triton::uint32[SHADOW_PAGE_SIZE]);
+            if (page->labels == nullptr)
+              throw triton::exceptions::TaintEngine("ShadowMemory::copy(): Not enough memory.");
+            std::memcpy(page->labels.get(), item.second->labels.get(), SHADOW_PAGE_SIZE * sizeof(triton::uint32));
+          }
+
+          this->pages.emplace(item.first, std::move(page));
+        }
+      }
+
+
+      ShadowMemory::Page* ShadowMemory::findPage(triton::uint64 addr) const {
+        triton::uint64 base = addr & ~(SHADOW_PAGE_SIZE - 1);
+
+        if (this->lastPage != nullptr && this->lastBase == base)
+          return this->lastPage;
+
+        auto it = this->pages.find(base);
+        if (it == this->pages.end())
+          return nullptr;
+
+        this->lastBase = base;
+        this->lastPage = it->second.get();
+
+        return this->lastPage;
+      }
+
+
+      ShadowMemory::Page* ShadowMemory::getPage(triton::uint64 addr) {
+        Page* page = this->findPage(addr);
+
+        if (page == nullptr) {
+          /* Value-initialized, the bitmap is zeroed */
+          page = new(std::nothrow) Page();
+          if (page == nullptr)
+            throw triton::exceptions::TaintEngine("ShadowMemory::getPage(): Not enough memory.");
+
+          this->lastBase = addr & ~(SHADOW_PAGE_SIZE - 1);
+          this->lastPage = page;
+          this->pages.emplace(this->lastBase, std::unique_ptr<Page>(page));
+        }
+
+        return page;
+      }
+
+
+      bool ShadowMemory::isTainted(triton::uint64 baseAddr, triton::usize size) const {
+        while (size) {
+          triton::uint64 offset = baseAddr & (SHADOW_PAGE_SIZE - 1);
+          triton::usize chunk   = static_cast<triton::usize>(std::min<triton::uint64>(size, SHADOW_PAGE_SIZE - offset));
+          const Page* page      = this->findPage(baseAddr);
+
+          if (page != nullptr) {
+            for (triton::uint64 i = offset, end = offset + chunk; i < end;) {
+              triton::uint64 bit  = i % 64;
+              triton::uint64 n    = std::min<triton::uint64>(64 - bit, end - i);
+              triton::uint64 mask = (n == 64 ? ~0ULL : ((1ULL << n) - 1)) << bit;
+              if (page->bits[i / 64] & mask)
+                return true;
+              i += n;
+            }
+          }
+
+          baseAddr += chunk;
+          size     -= chunk;
+        }
+
+        return false;
+      }
+
+
+      void ShadowMemory::taint(triton::uint64 baseAddr, triton::usize size) {
+        while (size) {
+          triton::uint64 offset = baseAddr & (SHADOW_PAGE_SIZE - 1);
+          triton::usize chunk   = static_cast<triton::usize>(std::min<triton::uint64>(size, SHADOW_PAGE_SIZE - offset));
+          Page* page            = this->getPage(baseAddr);
+
+          for (triton::uint64 i = offset, end = offset + chunk; i < end;) {
+            triton::uint64 bit  = i % 64;
+            triton::uint64 n    = std::min<triton::uint64>(64 - bit, end - i);
+            triton::uint64 mask = (n == 64 ? ~0ULL : ((1ULL << n) - 1)) << bit;
+            triton::uint64& w   = page->bits[i / 64];
+
+            page->count += std::bitset<64>(mask & ~w).count();
+            w |= mask;
+            i += n;
+          }
+
+          baseAddr += chunk;
+          size     -= chunk;
+        }
+      }
+
+
+      void ShadowMemory::untaint(triton::uint64 baseAddr, triton::usize size) {
+        while (size) {
+          triton::uint64 offset = baseAddr & (SHADOW_PAGE_SIZE - 1);
+          triton::usize chunk   = static_cast<triton::usize>(std::min<triton::uint64>(size, SHADOW_PAGE_SIZE - offset));
+          Page* page            = this->findPage(baseAddr);
+
+          if (page != nullptr) {
+            for (triton::uint64 i = offset, end = offset + chunk; i < end;) {
+              triton::uint64 bit  = i % 64;
+              triton::uint64 n    = std::min<triton::uint64>(64 - bit, end - i);
+              triton::uint64 mask = (n == 64 ? ~0ULL : ((1ULL << n) - 1)) << bit;
+              triton::uint64& w   = page->bits[i / 64];
+
+              page->count -= std::bitset<64>(mask & w).count();
+              w &= ~mask;
+              i += n;
+            }
+
+            /* Untainted bytes have the empty set */
+            if (page->labels != nullptr)
+              std::memset(page->labels.get() + offset, 0x00, chunk * sizeof(triton::uint32));
+
+            if (page->count == 0) {
+              this->pages.erase(baseAddr & ~(SHADOW_PAGE_SIZE - 1));
+              this->lastPage = nullptr;
+            }
+          }
+
+          baseAddr += chunk;
+          size     -= chunk;
+        }
+      }
+
+
+      void ShadowMemory::setLabels(triton::uint64 baseAddr, triton::usize size, triton::uint32 set) {
+        while (size) {
+          triton::uint64 offset = baseAddr & (SHADOW_PAGE_SIZE - 1);
+          triton::usize chunk   = static_cast<triton::usize>(std::min<triton::uint64>(size, SHADOW_PAGE_SIZE - offset));
+          Page* page            = (set != 0) ? this->getPage(baseAddr) : this->findPage(baseAddr);
+
+          if (page != nullptr && page->labels == nullptr && set != 0) {
+            /* Value-initialized, every byte has the empty set */
+            page->labels.reset(new(std::nothrow) triton::uint32[SHADOW_PAGE_SIZE]());
+            if (page->labels == nullptr)
+              throw triton::exceptions::TaintEngine("ShadowMemory::setLabels(): Not enough memory.");
+          }
+
+          if (page != nullptr && page->labels != nullptr)
+            std::fill(page->labels.get() + offset, page->labels.get() + offset + chunk, set);
+
+          baseAddr += chunk;
+          size     -= chunk;
+        }
+      }
+
+
+      triton::uint32 ShadowMemory::getLabels(triton::uint64 addr) const {
+        const Page* page = this->findPage(addr);
+
+        if (page == nullptr || page->labels == nullptr)
+          return 0;
+
+        return page->labels[addr & (SHADOW_PAGE_SIZE - 1)];
+      }
+
+
+      std::vector<std::pair<triton::uint64, triton::usize>> ShadowMemory::getRanges(void) const {
+        std::vector<std::pair<triton::uint64, triton::usize>> ranges;
+        std::vector<triton::uint64> bases;
+
+        for (const auto& item : this->pages)
+          bases.push_back(item.first);
+        std::sort(bases.begin(), bases.end());
+
+        /* Adjacent runs are merged, even across pages */
+        auto add = [&ranges](triton::uint64 addr, triton::usize size) {
+          if (!ranges.empty() && ranges.back().first + ranges.back().second == addr)
+            ranges.back().second += size;
+          else
+            ranges.push_back(std::make_pair(addr, size));
+        };
+
+        for (auto base : bases) {
+          const Page* page = this->pages.at(base).get();
+          for (triton::uint64 i = 0; i < SHADOW_PAGE_SIZE / 64; i++) {
+            triton::uint64 w = page->bits[i];
+            if (w == 0)
+              continue;
+            if (w == ~0ULL) {
+              add(base + i * 64, 64);
+              continue;
+            }
+            for (triton::uint64 bit = 0; bit < 64; bit++) {
+              if ((w >> bit) & 1)
+                add(base + i * 64 + bit, 1);
+            }
+          }
+        }
+
+        return ranges;
+      }
+
+
+      std::set<triton::uint64> ShadowMemory::getAddresses(void) const {
+        std::set<triton::uint64> addresses;
+
+        for (const auto& range : this->getRanges()) {
+          for (triton::usize i = 0; i < range.second; i++)
+            addresses.insert(addresses.end(), range.first + i);
+        }
+
+        return addresses;
+      }
+
+
+      triton::usize ShadowMemory::getNumberOfTaintedBytes(void) const {
+        triton::usize count = 0;
+
+        for (const auto& item : this->pages)
+          count += item.second->count;
+
+        return count;
+      }
+
+
+      triton::usize ShadowMemory::getNumberOfPages(void) const {
+        return this->pages.size();
+      }
+
+
+      void ShadowMemory::clear(void) {
+        this->pages.clear();
+        this->lastBase = 0;
+        this->lastPage = nullptr;
+      }
+
+    }; /* taint namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
@@ -5,6 +5,9 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <set>
+
+#include <triton/cpuSize.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/taintEngine.hpp>
 
@@ -14,11 +17,28 @@ namespace triton {
   namespace engines {
     namespace taint {
 
+      /* Returns the mask of the bytes of a register in its parent register */
+      static inline triton::uint64 getRegisterByteMask(const triton::arch::Register& reg) {
+        triton::uint32 low  = reg.getLow() / BYTE_SIZE_BIT;
+        triton::uint32 size = reg.getHigh() / BYTE_SIZE_BIT - low + 1;
+        return (size >= 64 ? ~0ULL : ((1ULL << size) - 1)) << low;
+      }
+
+
+      /* Returns the mask of the bytes of the parent register written by an assignment, as the symbolic engine does */
+      static inline triton::uint64 getRegisterWriteMask(const triton::arch::Register& reg) {
+        if (reg.getSize() == BYTE_SIZE || reg.getSize() == WORD_SIZE)
+          return getRegisterByteMask(reg);
+        return ~0ULL;
+      }
+
+
       TaintEngine::TaintEngine(triton::modes::Modes& modes, triton::engines::symbolic::SymbolicEngine* symbolicEngine, triton::arch::CpuInterface& cpu)
         : modes(modes),
           symbolicEngine(symbolicEngine),
           cpu(cpu),
-          enableFlag(true) {
+          enableFlag(true),
+          taintedRegisters(triton::arch::ID_REG_LAST_ITEM, 0) {
 
         if (this->symbolicEngine == nullptr)
           throw triton::exceptions::TaintEngine("TaintEngine::TaintEngine(): The symbolicEngine TaintEngine cannot be null.");
@@ -32,6 +52,8 @@ namespace triton {
         this->symbolicEngine   = other.symbolicEngine;
         this->taintedMemory    = other.taintedMemory;
         this->taintedRegisters = other.taintedRegisters;
+        this->labels           = other.labels;
+        this->registerLabels   = other.registerLabels;
       }
 
 
@@ -42,6 +64,8 @@ namespace triton {
         this->symbolicEngine   = other.symbolicEngine;
         this->taintedMemory    = other.taintedMemory;
         this->taintedRegisters = other.taintedRegisters;
+        this->labels           = other.labels;
+        this->registerLabels   = other.registerLabels;
         return *this;
       }
 
@@ -57,8 +81,14 @@ namespace triton {
 
 
       /* Returns the tainted addresses */
-      const std::set<triton::uint64>& TaintEngine::getTaintedMemory(void) const {
-        return this->taintedMemory;
+      std::set<triton::uint64> TaintEngine::getTaintedMemory(void) const {
+        return this->taintedMemory.getAddresses();
+      }
+
+
+      /* Returns the tainted memory ranges */
+      std::vector<std::pair<triton::uint64, triton::usize>> TaintEngine::getTaintedMemoryRanges(void) const {
+        return this->taintedMemory.getRanges();
       }
 
 
@@ -66,23 +96,50 @@ namespace triton {
       std::set<const triton::arch::Register*> TaintEngine::getTaintedRegisters(void) const {
         std::set<const triton::arch::Register*> res;
 
-        for (auto id : this->taintedRegisters)
-          res.insert(&this->cpu.getRegister(id));
+        for (triton::uint32 id = triton::arch::ID_REG_INVALID + 1; id < triton::arch::ID_REG_LAST_ITEM; id++) {
+          if (this->taintedRegisters[id])
+            res.insert(&this->cpu.getRegister(static_cast<triton::arch::register_e>(id)));
+        }
 
         return res;
       }
 
 
-      /* Returns true of false if the memory address is currently tainted */
-      bool TaintEngine::isMemoryTainted(const triton::arch::MemoryAccess& mem, bool mode) const {
+      /* Returns the labels which reach the memory */
+      std::vector<triton::uint32> TaintEngine::getMemoryTaintLabels(const triton::arch::MemoryAccess& mem) const {
+        std::set<triton::uint32> res;
         triton::uint64 addr = mem.getAddress();
-        triton::uint32 size = mem.getSize();
 
-        for (triton::uint32 index = 0; index < size; index++) {
-          if (this->taintedMemory.find(addr+index) != this->taintedMemory.end())
-            return TAINTED;
+        for (triton::uint32 i = 0; i < mem.getSize(); i++) {
+          for (auto label : this->labels.getLabels(this->taintedMemory.getLabels(addr + i)))
+            res.insert(label);
+        }
+
+        /* Spread the taint through pointers if the mode is enabled */
+        if (this->modes.isModeEnabled(triton::modes::TAINT_THROUGH_POINTERS)) {
+          for (auto label : this->getRegisterTaintLabels(mem.getConstBaseRegister()))
+            res.insert(label);
+          for (auto label : this->getRegisterTaintLabels(mem.getConstIndexRegister()))
+            res.insert(label);
+          for (auto label : this->getRegisterTaintLabels(mem.getConstSegmentRegister()))
+            res.insert(label);
         }
 
+        return std::vector<triton::uint32>(res.begin(), res.end());
+      }
+
+
+      /* Returns the labels which reach the register */
+      std::vector<triton::uint32> TaintEngine::getRegisterTaintLabels(const triton::arch::Register& reg) const {
+        return this->labels.getLabels(this->getRegisterLabelSet(reg));
+      }
+
+
+      /* Returns true of false if the memory address is currently tainted */
+      bool TaintEngine::isMemoryTainted(const triton::arch::MemoryAccess& mem, bool mode) const {
+        if (this->taintedMemory.isTainted(mem.getAddress(), mem.getSize()))
+          return TAINTED;
+
         /* Spread the taint through pointers if the mode is enabled */
         if (mode && this->modes.isModeEnabled(triton::modes::TAINT_THROUGH_POINTERS)) {
           if (this->isRegisterTainted(mem.getConstBaseRegister()))
@@ -99,10 +156,8 @@ namespace triton {
 
       /* Returns true of false if the address is currently tainted */
       bool TaintEngine::isMemoryTainted(triton::uint64 addr, triton::uint32 size) const {
-        for (triton::uint32 index = 0; index < size; index++) {
-          if (this->taintedMemory.find(addr+index) != this->taintedMemory.end())
-            return TAINTED;
-        }
+        if (this->taintedMemory.isTainted(addr, size))
+          return TAINTED;
 
         return !TAINTED;
       }
@@ -110,7 +165,7 @@ namespace triton {
 
       /* Returns true of false if the register is currently tainted */
       bool TaintEngine::isRegisterTainted(const triton::arch::Register& reg) const {
-        if (this->taintedRegisters.find(reg.getParent()) != this->taintedRegisters.end())
+        if (this->taintedRegisters[reg.getParent()] & getRegisterByteMask(reg))
           return TAINTED;
 
         return !TAINTED;
@@ -133,7 +188,7 @@ namespace triton {
       bool TaintEngine::taintRegister(const triton::arch::Register& reg) {
         if (!this->isEnabled())
           return this->isRegisterTainted(reg);
-        this->taintedRegisters.insert(reg.getParent());
+        this->taintedRegisters[reg.getParent()] |= getRegisterByteMask(reg);
 
         return TAINTED;
       }
@@ -143,12 +198,27 @@ namespace triton {
       bool TaintEngine::untaintRegister(const triton::arch::Register& reg) {
         if (!this->isEnabled())
           return this->isRegisterTainted(reg);
-        this->taintedRegisters.erase(reg.getParent());
+        this->taintedRegisters[reg.getParent()] &= ~getRegisterByteMask(reg);
+        if (this->taintedRegisters[reg.getParent()] == 0)
+          this->registerLabels.erase(reg.getParent());
 
         return !TAINTED;
       }
 
 
+      /* Taint the register with a label */
+      bool TaintEngine::taintRegisterWithLabel(const triton::arch::Register& reg, triton::uint32 label) {
+        if (!this->isEnabled())
+          return this->isRegisterTainted(reg);
+
+        this->taintRegister(reg);
+        if (this->isLabelTrackingEnabled())
+          this->setRegisterLabelSet(reg, this->labels.join(this->getRegisterLabelSet(reg), this->labels.getSet(label)));
+
+        return TAINTED;
+      }
+
+
       /* Sets the flag (taint or untaint) to an abstract operand (Register or Memory). */
       bool TaintEngine::setTaint(const triton::arch::OperandWrapper& op, bool flag) {
         switch (op.getType()) {
@@ -193,14 +263,21 @@ namespace triton {
 
       /* Taint the memory */
       bool TaintEngine::taintMemory(const triton::arch::MemoryAccess& mem) {
-        triton::uint64 addr = mem.getAddress();
-        triton::uint32 size = mem.getSize();
+        if (!this->isEnabled())
+          return this->isMemoryTainted(mem);
+        this->taintedMemory.taint(mem.getAddress(), mem.getSize());
+        return TAINTED;
+      }
 
+
+      /* Taint the memory with a label */
+      bool TaintEngine::taintMemoryWithLabel(const triton::arch::MemoryAccess& mem, triton::uint32 label) {
         if (!this->isEnabled())
           return this->isMemoryTainted(mem);
 
-        for (triton::uint32 index = 0; index < size; index++)
-          this->taintedMemory.insert(addr+index);
+        this->taintMemory(mem);
+        if (this->isLabelTrackingEnabled())
+          this->joinMemoryLabelSet(mem.getAddress(), mem.getSize(), this->labels.getSet(label));
 
         return TAINTED;
       }
@@ -210,22 +287,25 @@ namespace triton {
       bool TaintEngine::taintMemory(triton::uint64 addr) {
         if (!this->isEnabled())
           return this->isMemoryTainted(addr);
-        this->taintedMemory.insert(addr);
+        this->taintedMemory.taint(addr);
+        return TAINTED;
+      }
+
+
+      /* Taint the memory range */
+      bool TaintEngine::taintMemoryRange(triton::uint64 baseAddr, triton::usize size) {
+        if (!this->isEnabled())
+          return this->taintedMemory.isTainted(baseAddr, size);
+        this->taintedMemory.taint(baseAddr, size);
         return TAINTED;
       }
 
 
       /* Untaint the memory */
       bool TaintEngine::untaintMemory(const triton::arch::MemoryAccess& mem) {
-        triton::uint64 addr = mem.getAddress();
-        triton::uint32 size = mem.getSize();
-
         if (!this->isEnabled())
           return this->isMemoryTainted(mem);
-
-        for (triton::uint32 index = 0; index < size; index++)
-          this->taintedMemory.erase(addr+index);
-
+        this->taintedMemory.untaint(mem.getAddress(), mem.getSize());
         return !TAINTED;
       }
 
@@ -234,7 +314,16 @@ namespace triton {
       bool TaintEngine::untaintMemory(triton::uint64 addr) {
         if (!this->isEnabled())
           return this->isMemoryTainted(addr);
-        this->taintedMemory.erase(addr);
+        this->taintedMemory.untaint(addr);
+        return !TAINTED;
+      }
+
+
+      /* Untaint the memory range */
+      bool TaintEngine::untaintMemoryRange(triton::uint64 baseAddr, triton::usize size) {
+        if (!this->isEnabled())
+          return this->taintedMemory.isTainted(baseAddr, size);
+        this->taintedMemory.untaint(baseAddr, size);
         return !TAINTED;
       }
 
@@ -300,13 +389,8 @@ namespace triton {
 
         flag = this->unionMemoryImmediate(memDst);
 
-        /* Taint each byte of reference expression */
-        for (triton::uint32 i = 0; i != writeSize; i++) {
-          const triton::engines::symbolic::SharedSymbolicExpression& byte = this->symbolicEngine->getSymbolicMemory(memAddrDst + i);
-          if (byte == nullptr)
-            continue;
-          byte->isTainted = flag;
-        }
+        /* Taint the expressions of the memory ranges written */
+        this->symbolicEngine->setMemoryRangesTaint(memAddrDst, writeSize, flag);
 
         return flag;
       }
@@ -315,18 +399,12 @@ namespace triton {
       bool TaintEngine::taintUnionMemoryMemory(const triton::arch::MemoryAccess& memDst, const triton::arch::MemoryAccess& memSrc) {
         bool flag = triton::engines::taint::UNTAINTED;
         triton::uint64 memAddrDst = memDst.getAddress();
-        triton::uint64 memAddrSrc = memSrc.getAddress();
         triton::uint32 writeSize  = memDst.getSize();
 
         flag = this->unionMemoryMemory(memDst, memSrc);
 
-        /* Taint each byte of reference expression */
-        for (triton::uint32 i = 0; i != writeSize; i++) {
-          const triton::engines::symbolic::SharedSymbolicExpression& byte = this->symbolicEngine->getSymbolicMemory(memAddrDst + i);
-          if (byte == nullptr)
-            continue;
-          byte->isTainted = this->isMemoryTainted(memAddrDst + i) | this->isMemoryTainted(memAddrSrc + i);
-        }
+        /* Taint the expressions of the memory ranges written */
+        this->symbolicEngine->setMemoryRangesTaint(memAddrDst, writeSize, flag);
 
         return flag;
       }
@@ -339,13 +417,8 @@ namespace triton {
 
         flag = this->unionMemoryRegister(memDst, regSrc);
 
-        /* Taint each byte of reference expression */
-        for (triton::uint32 i = 0; i != writeSize; i++) {
-          const triton::engines::symbolic::SharedSymbolicExpression& byte = this->symbolicEngine->getSymbolicMemory(memAddrDst + i);
-          if (byte == nullptr)
-            continue;
-          byte->isTainted = flag;
-        }
+        /* Taint the expressions of the memory ranges written */
+        this->symbolicEngine->setMemoryRangesTaint(memAddrDst, writeSize, flag);
 
         return flag;
       }
@@ -373,13 +446,8 @@ namespace triton {
 
         flag = this->assignmentMemoryImmediate(memDst);
 
-        /* Taint each byte of reference expression */
-        for (triton::uint32 i = 0; i != writeSize; i++) {
-          const triton::engines::symbolic::SharedSymbolicExpression& byte = this->symbolicEngine->getSymbolicMemory(memAddrDst + i);
-          if (byte == nullptr)
-            continue;
-          byte->isTainted = flag;
-        }
+        /* Taint the expressions of the memory ranges written */
+        this->symbolicEngine->setMemoryRangesTaint(memAddrDst, writeSize, flag);
 
         return flag;
       }
@@ -388,18 +456,12 @@ namespace triton {
       bool TaintEngine::taintAssignmentMemoryMemory(const triton::arch::MemoryAccess& memDst, const triton::arch::MemoryAccess& memSrc) {
         bool flag = triton::engines::taint::UNTAINTED;
         triton::uint64 memAddrDst = memDst.getAddress();
-        triton::uint64 memAddrSrc = memSrc.getAddress();
         triton::uint32 writeSize  = memDst.getSize();
 
         flag = this->assignmentMemoryMemory(memDst, memSrc);
 
-        /* Taint each byte of reference expression */
-        for (triton::uint32 i = 0; i != writeSize; i++) {
-          const triton::engines::symbolic::SharedSymbolicExpression& byte = this->symbolicEngine->getSymbolicMemory(memAddrDst + i);
-          if (byte == nullptr)
-            continue;
-          byte->isTainted = this->isMemoryTainted(memAddrSrc + i);
-        }
+        /* Taint the expressions of the memory ranges written */
+        this->symbolicEngine->setMemoryRangesTaint(memAddrDst, writeSize, flag);
 
         return flag;
       }
@@ -412,13 +474,8 @@ namespace triton {
 
         flag = this->assignmentMemoryRegister(memDst, regSrc);
 
-        /* Taint each byte of reference expression */
-        for (triton::uint32 i = 0; i != writeSize; i++) {
-          const triton::engines::symbolic::SharedSymbolicExpression& byte = this->symbolicEngine->getSymbolicMemory(memAddrDst + i);
-          if (byte == nullptr)
-            continue;
-          byte->isTainted = flag;
-        }
+        /* Taint the expressions of the memory ranges written */
+        this->symbolicEngine->setMemoryRangesTaint(memAddrDst, writeSize, flag);
 
         return flag;
       }
@@ -439,17 +496,90 @@ namespace triton {
       }
 
 
+      void TaintEngine::assignRegisterTaint(const triton::arch::Register& reg, bool flag) {
+        triton::uint64& mask = this->taintedRegisters[reg.getParent()];
+
+        mask &= ~getRegisterWriteMask(reg);
+        if (flag == TAINTED)
+          mask |= getRegisterByteMask(reg);
+
+        if (mask == 0)
+          this->registerLabels.erase(reg.getParent());
+      }
+
+
+      bool TaintEngine::isLabelTrackingEnabled(void) const {
+        return this->isEnabled() && this->modes.isModeEnabled(triton::modes::TAINT_LABELS);
+      }
+
+
+      triton::uint32 TaintEngine::getRegisterLabelSet(const triton::arch::Register& reg) const {
+        auto it = this->registerLabels.find(reg.getParent());
+        if (it == this->registerLabels.end())
+          return 0;
+        return it->second;
+      }
+
+
+      void TaintEngine::setRegisterLabelSet(const triton::arch::Register& reg, triton::uint32 set) {
+        /* Labels are kept per parent register, the other tainted bytes keep theirs */
+        if (this->taintedRegisters[reg.getParent()] & ~getRegisterByteMask(reg))
+          set = this->labels.join(this->getRegisterLabelSet(reg), set);
+
+        if (set == 0)
+          this->registerLabels.erase(reg.getParent());
+        else
+          this->registerLabels[reg.getParent()] = set;
+      }
+
+
+      triton::uint32 TaintEngine::getPointerLabelSet(const triton::arch::MemoryAccess& mem) {
+        triton::uint32 set = 0;
+
+        if (this->modes.isModeEnabled(triton::modes::TAINT_THROUGH_POINTERS)) {
+          set = this->labels.join(set, this->getRegisterLabelSet(mem.getConstBaseRegister()));
+          set = this->labels.join(set, this->getRegisterLabelSet(mem.getConstIndexRegister()));
+          set = this->labels.join(set, this->getRegisterLabelSet(mem.getConstSegmentRegister()));
+        }
+
+        return set;
+      }
+
+
+      triton::uint32 TaintEngine::getMemoryLabelSet(const triton::arch::MemoryAccess& mem) {
+        triton::uint32 set  = this->getPointerLabelSet(mem);
+        triton::uint64 addr = mem.getAddress();
+
+        for (triton::uint32 i = 0; i < mem.getSize(); i++)
+          set = this->labels.join(set, this->taintedMemory.getLabels(addr + i));
+
+        return set;
+      }
+
+
+      void TaintEngine::joinMemoryLabelSet(triton::uint64 addr, triton::usize size, triton::uint32 set) {
+        if (set == 0)
+          return;
+
+        for (triton::usize i = 0; i < size; i++)
+          this->taintedMemory.setLabels(addr + i, 1, this->labels.join(this->taintedMemory.getLabels(addr + i), set));
+      }
+
+
       /* reg <- reg  */
       bool TaintEngine::assignmentRegisterRegister(const triton::arch::Register& regDst, const triton::arch::Register& regSrc) {
         if (!this->isEnabled())
           return this->isRegisterTainted(regDst);
 
         if (this->isRegisterTainted(regSrc)) {
-          this->taintRegister(regDst);
+          triton::uint32 set = this->getRegisterLabelSet(regSrc);
+          this->assignRegisterTaint(regDst, TAINTED);
+          if (this->isLabelTrackingEnabled())
+            this->setRegisterLabelSet(regDst, set);
           return TAINTED;
         }
 
-        this->untaintRegister(regDst);
+        this->assignRegisterTaint(regDst, !TAINTED);
         return !TAINTED;
       }
 
@@ -458,7 +588,7 @@ namespace triton {
       bool TaintEngine::assignmentRegisterImmediate(const triton::arch::Register& regDst) {
         if (!this->isEnabled())
           return this->isRegisterTainted(regDst);
-        this->untaintRegister(regDst);
+        this->assignRegisterTaint(regDst, !TAINTED);
         return !TAINTED;
       }
 
@@ -469,11 +599,13 @@ namespace triton {
           return this->isRegisterTainted(regDst);
 
         if (this->isMemoryTainted(memSrc)) {
-          this->taintRegister(regDst);
+          this->assignRegisterTaint(regDst, TAINTED);
+          if (this->isLabelTrackingEnabled())
+            this->setRegisterLabelSet(regDst, this->getMemoryLabelSet(memSrc));
           return TAINTED;
         }
 
-        this->untaintRegister(regDst);
+        this->assignRegisterTaint(regDst, !TAINTED);
         return !TAINTED;
       }
 
@@ -490,7 +622,10 @@ namespace triton {
 
         for (triton::uint32 offset = 0; offset < readSize; offset++) {
           if (this->isMemoryTainted(addrSrc+offset)) {
+            triton::uint32 set = this->taintedMemory.getLabels(addrSrc+offset);
             this->taintMemory(addrDst+offset);
+            if (this->isLabelTrackingEnabled())
+              this->taintedMemory.setLabels(addrDst+offset, 1, set);
             isTainted = TAINTED;
           }
           else
@@ -501,6 +636,8 @@ namespace triton {
         if (this->modes.isModeEnabled(triton::modes::TAINT_THROUGH_POINTERS)) {
           if (this->isMemoryTainted(memSrc)) {
             this->taintMemory(memDst);
+            if (this->isLabelTrackingEnabled())
+              this->joinMemoryLabelSet(memDst.getAddress(), memDst.getSize(), this->getPointerLabelSet(memSrc));
             isTainted = TAINTED;
           }
         }
@@ -526,6 +663,8 @@ namespace triton {
         /* Check source */
         if (this->isRegisterTainted(regSrc)) {
           this->taintMemory(memDst);
+          if (this->isLabelTrackingEnabled())
+            this->taintedMemory.setLabels(memDst.getAddress(), memDst.getSize(), this->getRegisterLabelSet(regSrc));
           return TAINTED;
         }
 
@@ -550,6 +689,8 @@ namespace triton {
 
         if (this->isRegisterTainted(regSrc)) {
           this->taintRegister(regDst);
+          if (this->isLabelTrackingEnabled())
+            this->setRegisterLabelSet(regDst, this->labels.join(this->getRegisterLabelSet(regDst), this->getRegisterLabelSet(regSrc)));
           return TAINTED;
         }
 
@@ -571,6 +712,8 @@ namespace triton {
         for (triton::uint32 offset = 0; offset < writeSize; offset++) {
           if (this->isMemoryTainted(addrSrc+offset)) {
             this->taintMemory(addrDst+offset);
+            if (this->isLabelTrackingEnabled())
+              this->joinMemoryLabelSet(addrDst+offset, 1, this->taintedMemory.getLabels(addrSrc+offset));
             isTainted = TAINTED;
           }
         }
@@ -579,6 +722,8 @@ namespace triton {
         if (this->modes.isModeEnabled(triton::modes::TAINT_THROUGH_POINTERS)) {
           if (this->isMemoryTainted(memSrc)) {
             this->taintMemory(memDst);
+            if (this->isLabelTrackingEnabled())
+              this->joinMemoryLabelSet(memDst.getAddress(), memDst.getSize(), this->getPointerLabelSet(memSrc));
             isTainted = TAINTED;
           }
         }
@@ -599,6 +744,8 @@ namespace triton {
 
         if (this->isMemoryTainted(memSrc)) {
           this->taintRegister(regDst);
+          if (this->isLabelTrackingEnabled())
+            this->setRegisterLabelSet(regDst, this->labels.join(this->getRegisterLabelSet(regDst), this->getMemoryLabelSet(memSrc)));
           return TAINTED;
         }
 
@@ -626,6 +773,8 @@ namespace triton {
 
         if (this->isRegisterTainted(regSrc)) {
           this->taintMemory(memDst);
+          if (this->isLabelTrackingEnabled())
+            this->joinMemoryLabelSet(memDst.getAddress(), memDst.getSize(), this->getRegisterLabelSet(regSrc));
           return TAINTED;
         }
 
@@ -0,0 +1,107 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <iterator>
+
+#include <triton/exceptions.hpp>
+#include <triton/taintLabels.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace taint {
+
+      triton::usize TaintLabels::Hash::operator()(const std::vector<triton::uint32>& labels) const {
+        triton::uint64 hash = 0xcbf29ce484222325;
+
+        for (auto label : labels) {
+          hash ^= label;
+          hash *= 0x100000001b3;
+        }
+
+        return static_cast<triton::usize>(hash);
+      }
+
+
+      TaintLabels::TaintLabels() {
+        this->clear();
+      }
+
+
+      triton::uint32 TaintLabels::intern(const std::vector<triton::uint32>& labels) {
+        auto it = this->ids.find(labels);
+        if (it != this->ids.end())
+          return it->second;
+
+        if (this->sets.size() >= 0xffffffff)
+          throw triton::exceptions::TaintEngine("TaintLabels::intern(): Too many sets of labels.");
+
+        triton::uint32 id = static_cast<triton::uint32>(this->sets.size());
+        this->sets.push_back(labels);
+        this->ids.emplace(labels, id);
+
+        return id;
+      }
+
+
+      triton::uint32 TaintLabels::getSet(triton::uint32 label) {
+        return this->intern(std::vector<triton::uint32>{label});
+      }
+
+
+      triton::uint32 TaintLabels::join(triton::uint32 set1, triton::uint32 set2) {
+        if (set1 >= this->sets.size() || set2 >= this->sets.size())
+          throw triton::exceptions::TaintEngine("TaintLabels::join(): Invalid set.");
+
+        if (set1 == set2 || set2 == 0)
+          return set1;
+
+        if (set1 == 0)
+          return set2;
+
+        triton::uint64 key = (static_cast<triton::uint64>(std::min(set1, set2)) << 32) | std::max(set1, set2);
+        auto it = this->unions.find(key);
+        if (it != this->unions.end())
+          return it->second;
+
+        std::vector<triton::uint32> labels;
+        std::set_union(this->sets[set1].begin(), this->sets[set1].end(), this->sets[set2].begin(), this->sets[set2].end(), std::back_inserter(labels));
+
+        triton::uint32 id = this->intern(labels);
+        this->unions[key] = id;
+
+        return id;
+      }
+
+
+      const std::vector<triton::uint32>& TaintLabels::getLabels(triton::uint32 set) const {
+        if (set >= this->sets.size())
+          throw triton::exceptions::TaintEngine("TaintLabels::getLabels(): Invalid set.");
+        return this->sets[set];
+      }
+
+
+      triton::usize TaintLabels::getNumberOfSets(void) const {
+        return this->sets.size();
+      }
+
+
+      void TaintLabels::clear(void) {
+        this->sets.clear();
+        this->ids.clear();
+        this->unions.clear();
+
+        /* The empty set is always 0 */
+        this->sets.push_back(std::vector<triton::uint32>{});
+        this->ids.emplace(std::vector<triton::uint32>{}, 0);
+      }
+
+    }; /* taint namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
@@ -8,7 +8,6 @@
 #ifndef TRITON_AARCH64CPU_HPP
 #define TRITON_AARCH64CPU_HPP
 
-#include <map>
 #include <set>
 #include <vector>
 
@@ -18,6 +17,7 @@
 #include <triton/dllexport.hpp>
 #include <triton/instruction.hpp>
 #include <triton/memoryAccess.hpp>
+#include <triton/pagedMemory.hpp>
 #include <triton/register.hpp>
 #include <triton/tritonTypes.hpp>
 #include <triton/aarch64Specifications.hpp>
@@ -61,14 +61,15 @@ namespace triton {
           //! Copies a AArch64Cpu class.
           void copy(const AArch64Cpu& other);
 
+          //! The capstone handle (csh), opened once for the lifetime of the CPU.
+          triton::usize handle;
+
+          //! Opens and configures the capstone handle.
+          void disassInit(void);
+
         protected:
-          /*! \brief map of address -> concrete value
-           *
-           * \details
-           * **item1**: memory address<br>
-           * **item2**: concrete value
-           */
-          std::map<triton::uint64, triton::uint8> memory;
+          //! The concrete memory (page table backed).
+          triton::arch::PagedMemory memory;
 
           //! Concrete value of x0
           triton::uint8 x0[QWORD_SIZE];
@@ -177,6 +178,9 @@ namespace triton {
           TRITON_EXPORT triton::uint8 getConcreteMemoryValue(triton::uint64 addr, bool execCallbacks=true) const;
           TRITON_EXPORT void clear(void);
           TRITON_EXPORT void disassembly(triton::arch::Instruction& inst) const;
+
+          //! Returns the capstone handle (csh) of the CPU.
+          TRITON_EXPORT triton::usize getHandle(void) const;
           TRITON_EXPORT void setConcreteMemoryAreaValue(triton::uint64 baseAddr, const std::vector<triton::uint8>& values);
           TRITON_EXPORT void setConcreteMemoryAreaValue(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size);
           TRITON_EXPORT void setConcreteMemoryValue(const triton::arch::MemoryAccess& mem, const triton::uint512& value);
@@ -198,6 +198,21 @@ namespace triton {
         //! [**architecture api**] - Disassembles the instruction and setup operands. You must define an architecture before. \sa processing().
         TRITON_EXPORT void disassembly(triton::arch::Instruction& inst) const;
 
+        //! [**architecture api**] - Returns the number of disassembly requests served by the decoded instructions cache. \sa triton::modes::DISASSEMBLY_CACHE.
+        TRITON_EXPORT triton::usize getDisassemblyCacheHits(void) const;
+
+        //! [**architecture api**] - Returns the number of disassembly requests which went through the disassembler. \sa triton::modes::DISASSEMBLY_CACHE.
+        TRITON_EXPORT triton::usize getDisassemblyCacheMisses(void) const;
+
+        //! [**architecture api**] - Clears the decoded instructions cache and its counters.
+        TRITON_EXPORT void clearDisassemblyCache(void);
+
+        //! [**architecture api**] - Sets the max number of decoded instructions kept in the cache. The least recently used ones are evicted.
+        TRITON_EXPORT void setDisassemblyCacheSize(triton::usize size);
+
+        //! [**architecture api**] - Returns the max number of decoded instructions kept in the cache.
+        TRITON_EXPORT triton::usize getDisassemblyCacheSize(void) const;
+
 
 
         /* Processing API ================================================================================ */
@@ -310,7 +325,7 @@ namespace triton {
         //! [**symbolic api**] - Returns the map of symbolic registers defined.
         TRITON_EXPORT std::map<triton::arch::register_e, triton::engines::symbolic::SharedSymbolicExpression> getSymbolicRegisters(void) const;
 
-        //! [**symbolic api**] - Returns the map (<Addr : SymExpr>) of symbolic memory defined.
+        //! [**symbolic api**] - Returns the map (<Addr : SymExpr>) of symbolic memory ranges defined.
         TRITON_EXPORT std::map<triton::uint64, triton::engines::symbolic::SharedSymbolicExpression> getSymbolicMemory(void) const;
 
         //! [**symbolic api**] - Returns the shared symbolic expression corresponding to the memory address.
@@ -469,6 +484,9 @@ namespace triton {
         //! [**symbolic api**] - Sets the concrete value of a symbolic variable.
         TRITON_EXPORT void setConcreteVariableValue(const triton::engines::symbolic::SharedSymbolicVariable& symVar, const triton::uint512& value);
 
+        //! [**symbolic api**] - Sets the concrete values of several symbolic variables (symbolic variable id -> value). Each affected node is re-evaluated once.
+        TRITON_EXPORT void setConcreteVariableValues(const std::map<triton::usize, triton::uint512>& values);
+
 
 
         /* Solver engine API ============================================================================= */
@@ -482,8 +500,13 @@ namespace triton {
          * \details
          * **item1**: symbolic variable id<br>
          * **item2**: model
+         *
+         * If `independence` is true, the constraint is sliced into independent partitions and only the
+         * partitions which do not hold with the concrete values are sent to the solver. The other variables
+         * keep their concrete values. If `status` is not null, it receives the status of the query (an empty
+         * model means UNSAT, TIMEOUT or OUTOFMEM). A `timeout` in milliseconds overrides the solver timeout if not 0.
          */
-        TRITON_EXPORT std::map<triton::uint32, triton::engines::solver::SolverModel> getModel(const triton::ast::SharedAbstractNode& node) const;
+        TRITON_EXPORT std::map<triton::uint32, triton::engines::solver::SolverModel> getModel(const triton::ast::SharedAbstractNode& node, bool independence=false, triton::engines::solver::status_e* status=nullptr, triton::uint32 timeout=0) const;
 
         /*!
          * \brief [**solver api**] - Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned.
@@ -491,11 +514,104 @@ namespace triton {
          * \details
          * **item1**: symbolic variable id<br>
          * **item2**: model
+         *
+         * If `independence` is true, only the partitions which do not hold with the concrete values are solved,
+         * see getModel(). `status` and `timeout` are the same as getModel().
+         */
+        TRITON_EXPORT std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, bool independence=false, triton::engines::solver::status_e* status=nullptr, triton::uint32 timeout=0) const;
+
+        //! Returns true if an expression is satisfiable. `status` and `timeout` are the same as getModel().
+        TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status=nullptr, triton::uint32 timeout=0) const;
+
+        /*!
+         * \brief [**solver api**] - Computes a model for each constraint of `nodes`, the queries are solved concurrently.
+         *
+         * \details `workers` is the number of threads (0 means one per core) and `timeout` the max time of each
+         * query in milliseconds (0 means the solver timeout). Results are in the same order as `nodes`, an empty
+         * model means UNSAT, timeout or out of memory. The ASTs must not be modified until the call returns.
+         */
+        TRITON_EXPORT std::vector<std::map<triton::uint32, triton::engines::solver::SolverModel>> getBatchModels(const std::vector<triton::ast::SharedAbstractNode>& nodes, triton::uint32 workers=0, triton::uint32 timeout=0) const;
+
+        //! [**solver api**] - Sets the default max time of a solver query in milliseconds (0 means no limit).
+        TRITON_EXPORT void setSolverTimeout(triton::uint32 timeout);
+
+        //! [**solver api**] - Returns the default max time of a solver query in milliseconds.
+        TRITON_EXPORT triton::uint32 getSolverTimeout(void) const;
+
+        //! [**solver api**] - Sets the max memory of the solver in megabytes (0 means no limit).
+        TRITON_EXPORT void setSolverMemoryLimit(triton::uint32 limit);
+
+        //! [**solver api**] - Returns the max memory of the solver in megabytes.
+        TRITON_EXPORT triton::uint32 getSolverMemoryLimit(void) const;
+
+        //! [**solver api**] - Returns the statistics of the solver queries, the oldest first (SOLVER_QUERY_STATS mode).
+        TRITON_EXPORT const std::deque<triton::engines::solver::SolverQueryStats>& getSolverQueryStats(void) const;
+
+        //! [**solver api**] - Clears the statistics of the solver queries.
+        TRITON_EXPORT void clearSolverQueryStats(void);
+
+        //! [**solver api**] - Sets the max number of statistics of solver queries kept (4096 by default), the oldest ones are dropped first.
+        TRITON_EXPORT void setSolverQueryStatsSize(triton::usize size);
+
+        //! [**solver api**] - Sets the directory where the queries are recorded (SOLVER_QUERY_RECORDING mode). Files of a previous recording are overwritten.
+        TRITON_EXPORT void setSolverQueryRecordingDirectory(const std::string& path);
+
+        //! [**solver api**] - Returns the directory where the queries are recorded.
+        TRITON_EXPORT const std::string& getSolverQueryRecordingDirectory(void) const;
+
+        //! [**solver api**] - Returns the number of queries recorded.
+        TRITON_EXPORT triton::usize getSolverRecordedQueries(void) const;
+
+        //! [**solver api**] - Returns the number of queries which could not be recorded. Their results are returned anyway.
+        TRITON_EXPORT triton::usize getSolverRecordingFailures(void) const;
+
+        //! [**solver api**] - Returns the number of queries served by the solver query cache (SOLVER_QUERY_CACHE mode).
+        TRITON_EXPORT triton::usize getSolverQueryCacheHits(void) const;
+
+        //! [**solver api**] - Returns the number of queries of the solver query cache sent to the solver.
+        TRITON_EXPORT triton::usize getSolverQueryCacheMisses(void) const;
+
+        //! [**solver api**] - Returns the solver time saved by the solver query cache in microseconds.
+        TRITON_EXPORT triton::uint64 getSolverQueryCacheTimeSaved(void) const;
+
+        //! [**solver api**] - Clears the solver query cache and its counters.
+        TRITON_EXPORT void clearSolverQueryCache(void);
+
+        //! [**solver api**] - Uses a file to store the solver query cache, so results survive across runs. An empty path disables the file store.
+        TRITON_EXPORT void setSolverQueryCacheFile(const std::string& path);
+
+        //! [**solver api**] - Sets the max number of entries of the solver query cache (65536 by default), the least recently used ones are dropped first.
+        TRITON_EXPORT void setSolverQueryCacheSize(triton::usize size);
+
+        //! [**solver api**] - Returns the number of queries answered by a recent model (SOLVER_MODEL_REUSE mode).
+        TRITON_EXPORT triton::usize getSolverModelReuseHits(void) const;
+
+        //! [**solver api**] - Sets the max number of recent models tried before the solver (16 by default).
+        TRITON_EXPORT void setSolverModelReuseSize(triton::usize size);
+
+        //! [**solver api**] - Creates a new scope in the incremental solver session.
+        TRITON_EXPORT void pushSolverScope(void);
+
+        //! [**solver api**] - Removes the last scope of the incremental solver session and its constraints.
+        TRITON_EXPORT void popSolverScope(void);
+
+        //! [**solver api**] - Adds a constraint to the current scope of the incremental solver session.
+        TRITON_EXPORT void addSolverConstraint(const triton::ast::SharedAbstractNode& node);
+
+        //! [**solver api**] - Removes all scopes and constraints of the incremental solver session.
+        TRITON_EXPORT void resetSolverSession(void);
+
+        /*!
+         * \brief [**solver api**] - Computes and returns a model from a symbolic constraint and the constraints of the incremental solver session.
+         *
+         * \details
+         * **item1**: symbolic variable id<br>
+         * **item2**: model
          */
-        TRITON_EXPORT std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit) const;
+        TRITON_EXPORT std::map<triton::uint32, triton::engines::solver::SolverModel> getSessionModel(const triton::ast::SharedAbstractNode& node);
 
-        //! Returns true if an expression is satisfiable.
-        TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node) const;
+        //! [**solver api**] - Returns true if an expression is satisfiable with the constraints of the incremental solver session.
+        TRITON_EXPORT bool isSessionSat(const triton::ast::SharedAbstractNode& node);
 
         //! Returns the kind of solver as triton::engines::solver::solver_e.
         TRITON_EXPORT triton::engines::solver::solver_e getSolver(void) const;
@@ -528,12 +644,21 @@ namespace triton {
         //! [**taint api**] - Returns the instance of the taint engine.
         TRITON_EXPORT triton::engines::taint::TaintEngine* getTaintEngine(void);
 
-        //! [**taint api**] - Returns the tainted addresses.
-        TRITON_EXPORT const std::set<triton::uint64>& getTaintedMemory(void) const;
+        //! [**taint api**] - Returns the tainted addresses. The set is built from the taint bitmap, see getTaintedMemoryRanges() for large taints.
+        TRITON_EXPORT std::set<triton::uint64> getTaintedMemory(void) const;
+
+        //! [**taint api**] - Returns the tainted memory ranges as (base address, size), sorted by address.
+        TRITON_EXPORT std::vector<std::pair<triton::uint64, triton::usize>> getTaintedMemoryRanges(void) const;
 
         //! [**taint api**] - Returns the tainted registers.
         TRITON_EXPORT std::set<const triton::arch::Register*> getTaintedRegisters(void) const;
 
+        //! [**taint api**] - Returns the sorted labels which reach a memory (see TAINT_LABELS).
+        TRITON_EXPORT std::vector<triton::uint32> getMemoryTaintLabels(const triton::arch::MemoryAccess& mem) const;
+
+        //! [**taint api**] - Returns the sorted labels which reach a register (see TAINT_LABELS).
+        TRITON_EXPORT std::vector<triton::uint32> getRegisterTaintLabels(const triton::arch::Register& reg) const;
+
         //! [**taint api**] - Enables or disables the taint engine.
         TRITON_EXPORT void enableTaintEngine(bool flag);
 
@@ -567,15 +692,27 @@ namespace triton {
         //! [**taint api**] - Taints a memory. Returns TAINTED if the memory has been tainted correctly. Otherwise it returns the last defined state.
         TRITON_EXPORT bool taintMemory(const triton::arch::MemoryAccess& mem);
 
+        //! [**taint api**] - Taints the memory range `[baseAddr:size]`. Returns TAINTED if the range has been tainted correctly. Otherwise it returns the last defined state.
+        TRITON_EXPORT bool taintMemoryRange(triton::uint64 baseAddr, triton::usize size);
+
+        //! [**taint api**] - Taints a memory and, if TAINT_LABELS is enabled, adds a label to its bytes. Returns TAINTED if the memory has been tainted correctly. Otherwise it returns the last defined state.
+        TRITON_EXPORT bool taintMemoryWithLabel(const triton::arch::MemoryAccess& mem, triton::uint32 label);
+
         //! [**taint api**] - Taints a register. Returns TAINTED if the register has been tainted correctly. Otherwise it returns the last defined state.
         TRITON_EXPORT bool taintRegister(const triton::arch::Register& reg);
 
+        //! [**taint api**] - Taints a register and, if TAINT_LABELS is enabled, adds a label to it. Returns TAINTED if the register has been tainted correctly. Otherwise it returns the last defined state.
+        TRITON_EXPORT bool taintRegisterWithLabel(const triton::arch::Register& reg, triton::uint32 label);
+
         //! [**taint api**] - Untaints an address. Returns !TAINTED if the address has been untainted correctly. Otherwise it returns the last defined state.
         TRITON_EXPORT bool untaintMemory(triton::uint64 addr);
 
         //! [**taint api**] - Untaints a memory. Returns !TAINTED if the memory has been untainted correctly. Otherwise it returns the last defined state.
         TRITON_EXPORT bool untaintMemory(const triton::arch::MemoryAccess& mem);
 
+        //! [**taint api**] - Untaints the memory range `[baseAddr:size]`. Returns !TAINTED if the range has been untainted correctly. Otherwise it returns the last defined state.
+        TRITON_EXPORT bool untaintMemoryRange(triton::uint64 baseAddr, triton::usize size);
+
         //! [**taint api**] - Untaints a register. Returns !TAINTED if the register has been untainted correctly. Otherwise it returns the last defined state.
         TRITON_EXPORT bool untaintRegister(const triton::arch::Register& reg);
 
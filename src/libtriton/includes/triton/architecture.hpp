@@ -8,9 +8,12 @@
 #ifndef TRITON_ARCHITECTURE_H
 #define TRITON_ARCHITECTURE_H
 
+#include <list>
+#include <memory>
 #include <set>
+#include <string>
+#include <unordered_map>
 #include <vector>
-#include <memory>
 
 #include <triton/archEnums.hpp>
 #include <triton/callbacks.hpp>
@@ -18,6 +21,7 @@
 #include <triton/dllexport.hpp>
 #include <triton/instruction.hpp>
 #include <triton/memoryAccess.hpp>
+#include <triton/modes.hpp>
 #include <triton/register.hpp>
 #include <triton/tritonTypes.hpp>
 
@@ -45,6 +49,27 @@ namespace triton {
         //! Callbacks API
         triton::callbacks::Callbacks* callbacks;
 
+        //! Modes API
+        const triton::modes::Modes* modes;
+
+        //! The decoded instructions (DISASSEMBLY_CACHE mode) keyed by address + opcode bytes, the most recently used first.
+        mutable std::list<std::pair<std::string, triton::arch::Instruction>> disassCacheEntries;
+
+        //! Index of the decoded instructions by key.
+        mutable std::unordered_map<std::string, std::list<std::pair<std::string, triton::arch::Instruction>>::iterator> disassCache;
+
+        //! The max number of decoded instructions kept in the cache.
+        triton::usize disassCacheSize;
+
+        //! Evicts the least recently used decoded instructions above the max size of the cache.
+        void evictDisassemblyCache(void) const;
+
+        //! Number of disassembly requests served by the cache.
+        mutable triton::usize disassCacheHits;
+
+        //! Number of disassembly requests which went through the disassembler.
+        mutable triton::usize disassCacheMisses;
+
       protected:
         //! The kind of architecture used.
         triton::arch::architecture_e arch;
@@ -54,7 +79,7 @@ namespace triton {
 
       public:
         //! Constructor.
-        TRITON_EXPORT Architecture(triton::callbacks::Callbacks* callbacks=nullptr);
+        TRITON_EXPORT Architecture(triton::callbacks::Callbacks* callbacks=nullptr, const triton::modes::Modes* modes=nullptr);
 
         //! Returns true if the register ID is a flag.
         TRITON_EXPORT bool isFlag(triton::arch::register_e regId) const;
@@ -125,6 +150,21 @@ namespace triton {
         //! Disassembles the instruction according to the architecture.
         TRITON_EXPORT void disassembly(triton::arch::Instruction& inst) const;
 
+        //! Returns the number of disassembly requests served by the cache.
+        TRITON_EXPORT triton::usize getDisassemblyCacheHits(void) const;
+
+        //! Returns the number of disassembly requests which went through the disassembler.
+        TRITON_EXPORT triton::usize getDisassemblyCacheMisses(void) const;
+
+        //! Clears the decoded instructions cache and its counters.
+        TRITON_EXPORT void clearDisassemblyCache(void);
+
+        //! Sets the max number of decoded instructions kept in the cache. The least recently used ones are evicted.
+        TRITON_EXPORT void setDisassemblyCacheSize(triton::usize size);
+
+        //! Returns the max number of decoded instructions kept in the cache.
+        TRITON_EXPORT triton::usize getDisassemblyCacheSize(void) const;
+
         //! Builds the instruction semantics according to the architecture. Returns true if the instruction is supported.
         TRITON_EXPORT bool buildSemantics(triton::arch::Instruction& inst);
 
@@ -140,6 +180,9 @@ namespace triton {
         //! Returns the concrete value of a register.
         TRITON_EXPORT triton::uint512 getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks=true) const;
 
+        //! Returns the effective address of a memory access from the concrete registers, as SymbolicEngine::initLeaAst() computes it.
+        TRITON_EXPORT triton::uint64 getConcreteMemoryAddress(const triton::arch::MemoryAccess& mem) const;
+
         /*!
          * \brief [**architecture api**] - Sets the concrete value of a memory cell.
          *
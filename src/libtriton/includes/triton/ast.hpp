@@ -9,6 +9,7 @@
 #define TRITON_AST_H
 
 #include <deque>
+#include <functional>
 #include <list>
 #include <map>
 #include <memory>
@@ -69,15 +70,35 @@ namespace triton {
         //! The children of the node.
         std::vector<SharedAbstractNode> children;
 
-        // This structure counter the number of use of a given parent as a node may have
-        // multiple time the same parent: eg. xor rax rax
-        std::map<AbstractNode*, std::pair<triton::uint32, WeakAbstractNode>> parents;
+        //! A parent of the node.
+        struct Parent {
+          //! The parent node.
+          AbstractNode* node;
+
+          //! The number of uses of the node by its parent, as a node may have multiple time the same parent: eg. xor rax rax
+          triton::uint32 count;
+
+          //! A weak reference to the parent node.
+          WeakAbstractNode weak;
+        };
+
+        //! The parents of the node. Most nodes have only a few parents, so they are kept in a flat vector.
+        std::vector<Parent> parents;
 
         //! The size of the node.
         triton::uint32 size;
 
-        //! The value of the tree from this root node.
-        triton::uint512 eval;
+        //! The value of the tree from this root node, the low 64 bits if it does not fit in 64 bits.
+        triton::uint64 eval;
+
+        //! The value of the tree from this root node if it does not fit in 64 bits, nullptr otherwise.
+        std::shared_ptr<triton::uint512> wideEval;
+
+        //! The hash of the tree from this root node. Computed once in init() from the children hashes (forced odd so that deep products never collapse to zero).
+        triton::uint64 hash;
+
+        //! The deep level of the tree from this root node (1 for leaves).
+        triton::uint32 level;
 
         //! True if the tree contains a symbolic variable.
         bool symbolized;
@@ -85,9 +106,39 @@ namespace triton {
         //! True if it's a logical node.
         bool logical;
 
+        //! True while the node is scheduled for a re-evaluation by initParents().
+        bool dirty;
+
+        //! True once the node is registered as parent of its children.
+        bool linked;
+
+        //! True if the node is shared through the unique table of its context (AST_HASH_CONSING). Such a node is immutable.
+        bool interned;
+
+        //! True if the node is a shared constant of its context (AST_CONSTANT_FOLDING). Its value never changes, so its parents are not recorded.
+        bool sharedConstant;
+
         //! Contect use to create this node
         AstContext& ctxt;
 
+        //! Returns the vector mask on 64 bits according the size of the node (size <= 64).
+        triton::uint64 getBitvectorMask64(void) const;
+
+        //! Re-evaluates all the nodes depending on the `count` given nodes (which are not re-evaluated).
+        static void initParents(AbstractNode* const* nodes, triton::usize count);
+
+        //! Registers the node as parent of its children. Done once, at the first initialization of the node.
+        void linkChildren(void);
+
+        //! Sets the value of the node.
+        void setEval(const triton::uint512& value);
+
+        //! Sets the value of the node (native 64-bit evaluation).
+        void setEval(triton::uint64 value);
+
+        //! Evaluates an AST with the given values of the symbolic variables through copies of the nodes.
+        friend triton::uint512 evaluate(const SharedAbstractNode& node, const std::map<triton::usize, triton::uint512>& assignment);
+
       public:
         //! Constructor.
         TRITON_EXPORT AbstractNode(triton::ast::ast_e type, AstContext& ctxt);
@@ -116,19 +167,46 @@ namespace triton {
         //! Returns true if it's a logical node.
         TRITON_EXPORT bool isLogical(void) const;
 
-        //! Returns true if the current tree is equal to the second one.
+        //! Returns true if the node is shared through the unique table of its context. Its children cannot be changed.
+        TRITON_EXPORT bool isInterned(void) const;
+
+        //! Sets the interned flag of the node.
+        TRITON_EXPORT void setInterned(bool flag);
+
+        //! Returns true if the node is a shared constant of its context. Such a node is interned and has no parents.
+        TRITON_EXPORT bool isSharedConstant(void) const;
+
+        //! Sets the shared constant flag of the node.
+        TRITON_EXPORT void setSharedConstant(bool flag);
+
+        //! Returns true if the current tree is structurally equal to the second one.
         TRITON_EXPORT bool equalTo(const SharedAbstractNode&) const;
 
         //! Evaluates the tree.
         TRITON_EXPORT virtual triton::uint512 evaluate(void) const;
 
-        //! Initializes parents.
+        //! Evaluates the tree on 64 bits. Only the low 64 bits are returned if the value does not fit in 64 bits.
+        TRITON_EXPORT triton::uint64 evaluate64(void) const;
+
+        //! Returns the memory footprint (in bytes) of the node, its control block, children and parents vectors included.
+        TRITON_EXPORT triton::usize getMemorySize(void) const;
+
+        //! Returns the hash of the tree. The hash is cached, so this is a constant-time operation.
+        TRITON_EXPORT triton::uint64 getHash(void) const;
+
+        //! Returns the deep level of the tree.
+        TRITON_EXPORT triton::uint32 getLevel(void) const;
+
+        //! Re-evaluates all the nodes depending on this node. Each of them is initialized once, in topological order.
         void initParents(void);
 
+        //! Re-evaluates all the nodes depending on the given nodes (which are not re-evaluated). Each of them is initialized once, in topological order.
+        TRITON_EXPORT static void initParents(const std::vector<AbstractNode*>& nodes);
+
         //! Returns the children of the node.
         TRITON_EXPORT std::vector<SharedAbstractNode>& getChildren(void);
 
-        //! Returns the parents of node or an empty set if there is still no parent defined.
+        //! Returns the parents of node or an empty set if there is still no parent defined (always empty for a shared constant).
         TRITON_EXPORT std::vector<SharedAbstractNode> getParents(void);
 
         //! Removes a parent node.
@@ -146,17 +224,17 @@ namespace triton {
         //! Adds a child.
         TRITON_EXPORT void addChild(const SharedAbstractNode& child);
 
-        //! Sets a child at an index.
+        //! Sets a child at an index. Throws if the node is interned, modify a shallowCopy() of it instead.
         TRITON_EXPORT void setChild(triton::uint32 index, const SharedAbstractNode& child);
 
         //! Returns the string representation of the node.
         TRITON_EXPORT std::string str(void) const;
 
-        //! Init stuffs like size and eval.
-        TRITON_EXPORT virtual void init(void) = 0;
+        //! Init stuffs like size and eval. Parents are re-initialized if `withParents` is true.
+        TRITON_EXPORT virtual void init(bool withParents=true) = 0;
 
-        //! Returns the has of the tree. The hash is computed recursively on the whole tree.
-        TRITON_EXPORT virtual triton::uint512 hash(triton::uint32 deep) const = 0;
+        //! Init the hash of the node from the hashes of its children.
+        TRITON_EXPORT virtual void initHash(void) = 0;
     };
 
 
@@ -164,8 +242,8 @@ namespace triton {
     class AssertNode : public AbstractNode {
       public:
         TRITON_EXPORT AssertNode(const SharedAbstractNode& expr);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -173,8 +251,8 @@ namespace triton {
     class BvaddNode : public AbstractNode {
       public:
         TRITON_EXPORT BvaddNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -182,8 +260,8 @@ namespace triton {
     class BvandNode : public AbstractNode {
       public:
         TRITON_EXPORT BvandNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -191,8 +269,8 @@ namespace triton {
     class BvashrNode : public AbstractNode {
       public:
         TRITON_EXPORT BvashrNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -200,8 +278,8 @@ namespace triton {
     class BvlshrNode : public AbstractNode {
       public:
         TRITON_EXPORT BvlshrNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -209,8 +287,8 @@ namespace triton {
     class BvmulNode : public AbstractNode {
       public:
         TRITON_EXPORT BvmulNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -218,8 +296,8 @@ namespace triton {
     class BvnandNode : public AbstractNode {
       public:
         TRITON_EXPORT BvnandNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -227,8 +305,8 @@ namespace triton {
     class BvnegNode : public AbstractNode {
       public:
         TRITON_EXPORT BvnegNode(const SharedAbstractNode& expr);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -236,8 +314,8 @@ namespace triton {
     class BvnorNode : public AbstractNode {
       public:
         TRITON_EXPORT BvnorNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -245,8 +323,8 @@ namespace triton {
     class BvnotNode : public AbstractNode {
       public:
         TRITON_EXPORT BvnotNode(const SharedAbstractNode& expr1);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -254,8 +332,8 @@ namespace triton {
     class BvorNode : public AbstractNode {
       public:
         TRITON_EXPORT BvorNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -264,8 +342,8 @@ namespace triton {
       public:
         TRITON_EXPORT BvrolNode(const SharedAbstractNode& expr, triton::uint32 rot);
         TRITON_EXPORT BvrolNode(const SharedAbstractNode& expr, const SharedAbstractNode& rot);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -274,8 +352,8 @@ namespace triton {
       public:
         TRITON_EXPORT BvrorNode(const SharedAbstractNode& expr, triton::uint32 rot);
         TRITON_EXPORT BvrorNode(const SharedAbstractNode& expr, const SharedAbstractNode& rot);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -283,8 +361,8 @@ namespace triton {
     class BvsdivNode : public AbstractNode {
       public:
         TRITON_EXPORT BvsdivNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -292,8 +370,8 @@ namespace triton {
     class BvsgeNode : public AbstractNode {
       public:
         TRITON_EXPORT BvsgeNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -301,8 +379,8 @@ namespace triton {
     class BvsgtNode : public AbstractNode {
       public:
         TRITON_EXPORT BvsgtNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -310,8 +388,8 @@ namespace triton {
     class BvshlNode : public AbstractNode {
       public:
         TRITON_EXPORT BvshlNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -319,8 +397,8 @@ namespace triton {
     class BvsleNode : public AbstractNode {
       public:
         TRITON_EXPORT BvsleNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -328,8 +406,8 @@ namespace triton {
     class BvsltNode : public AbstractNode {
       public:
         TRITON_EXPORT BvsltNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -337,8 +415,8 @@ namespace triton {
     class BvsmodNode : public AbstractNode {
       public:
         TRITON_EXPORT BvsmodNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -346,8 +424,8 @@ namespace triton {
     class BvsremNode : public AbstractNode {
       public:
         TRITON_EXPORT BvsremNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -355,8 +433,8 @@ namespace triton {
     class BvsubNode : public AbstractNode {
       public:
         TRITON_EXPORT BvsubNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -364,8 +442,8 @@ namespace triton {
     class BvudivNode : public AbstractNode {
       public:
         TRITON_EXPORT BvudivNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -373,8 +451,8 @@ namespace triton {
     class BvugeNode : public AbstractNode {
       public:
         TRITON_EXPORT BvugeNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -382,8 +460,8 @@ namespace triton {
     class BvugtNode : public AbstractNode {
       public:
         TRITON_EXPORT BvugtNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -391,8 +469,8 @@ namespace triton {
     class BvuleNode : public AbstractNode {
       public:
         TRITON_EXPORT BvuleNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -400,8 +478,8 @@ namespace triton {
     class BvultNode : public AbstractNode {
       public:
         TRITON_EXPORT BvultNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -409,8 +487,8 @@ namespace triton {
     class BvuremNode : public AbstractNode {
       public:
         TRITON_EXPORT BvuremNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -418,8 +496,8 @@ namespace triton {
     class BvxnorNode : public AbstractNode {
       public:
         TRITON_EXPORT BvxnorNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -427,8 +505,8 @@ namespace triton {
     class BvxorNode : public AbstractNode {
       public:
         TRITON_EXPORT BvxorNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -436,8 +514,8 @@ namespace triton {
     class BvNode : public AbstractNode {
       public:
         TRITON_EXPORT BvNode(triton::uint512 value, triton::uint32 size, AstContext& ctxt);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -450,8 +528,8 @@ namespace triton {
             this->addChild(expr);
         }
 
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -465,8 +543,8 @@ namespace triton {
         }
 
         TRITON_EXPORT ConcatNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -474,8 +552,8 @@ namespace triton {
     class DeclareNode : public AbstractNode {
       public:
         TRITON_EXPORT DeclareNode(const SharedAbstractNode& var);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -483,8 +561,8 @@ namespace triton {
     class DistinctNode : public AbstractNode {
       public:
         TRITON_EXPORT DistinctNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -492,8 +570,8 @@ namespace triton {
     class EqualNode : public AbstractNode {
       public:
         TRITON_EXPORT EqualNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -501,8 +579,8 @@ namespace triton {
     class ExtractNode : public AbstractNode {
       public:
         TRITON_EXPORT ExtractNode(triton::uint32 high, triton::uint32 low, const SharedAbstractNode& expr);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -510,8 +588,8 @@ namespace triton {
     class IffNode : public AbstractNode {
       public:
         TRITON_EXPORT IffNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -522,8 +600,8 @@ namespace triton {
 
       public:
         TRITON_EXPORT IntegerNode(triton::uint512 value, AstContext& ctxt);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
         TRITON_EXPORT triton::uint512 getInteger(void);
     };
 
@@ -532,8 +610,8 @@ namespace triton {
     class IteNode : public AbstractNode {
       public:
         TRITON_EXPORT IteNode(const SharedAbstractNode& ifExpr, const SharedAbstractNode& thenExpr, const SharedAbstractNode& elseExpr);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -547,8 +625,8 @@ namespace triton {
         }
 
         TRITON_EXPORT LandNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -556,8 +634,8 @@ namespace triton {
     class LetNode : public AbstractNode {
       public:
         TRITON_EXPORT LetNode(std::string alias, const SharedAbstractNode& expr2, const SharedAbstractNode& expr3);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -565,8 +643,8 @@ namespace triton {
     class LnotNode : public AbstractNode {
       public:
         TRITON_EXPORT LnotNode(const SharedAbstractNode& expr);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -580,8 +658,8 @@ namespace triton {
         }
 
         TRITON_EXPORT LorNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -592,8 +670,8 @@ namespace triton {
 
       public:
         TRITON_EXPORT ReferenceNode(const triton::engines::symbolic::SharedSymbolicExpression& expr);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
         TRITON_EXPORT const triton::engines::symbolic::SharedSymbolicExpression& getSymbolicExpression(void) const;
     };
 
@@ -605,8 +683,8 @@ namespace triton {
 
       public:
         TRITON_EXPORT StringNode(std::string value, AstContext& ctxt);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
         TRITON_EXPORT std::string getString(void);
     };
 
@@ -615,8 +693,8 @@ namespace triton {
     class SxNode : public AbstractNode {
       public:
         TRITON_EXPORT SxNode(triton::uint32 sizeExt, const SharedAbstractNode& expr);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
 
@@ -627,8 +705,8 @@ namespace triton {
 
       public:
         TRITON_EXPORT VariableNode(const triton::engines::symbolic::SharedSymbolicVariable& symVar, AstContext& ctxt);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
         TRITON_EXPORT const triton::engines::symbolic::SharedSymbolicVariable& getSymbolicVariable(void);
     };
 
@@ -638,34 +716,52 @@ namespace triton {
       public:
         //! Create a zero extend of expr to sizeExt bits
         TRITON_EXPORT ZxNode(triton::uint32 sizeExt, const SharedAbstractNode& expr);
-        TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+        TRITON_EXPORT void init(bool withParents=true);
+        TRITON_EXPORT void initHash(void);
     };
 
-    //! Custom hash2n function for hash routine.
-    triton::uint512 hash2n(triton::uint512 hash, triton::uint32 n);
+    //! Mixes a value into a 64-bit hash (splitmix64 finalizer), the result depends on the order of the values.
+    triton::uint64 hashMix(triton::uint64 seed, triton::uint64 value);
 
     //! Custom rotate left function for hash routine.
-    triton::uint512 rotl(triton::uint512 value, triton::uint32 shift);
+    triton::uint64 rotl(triton::uint64 value, triton::uint32 shift);
+
+    //! Folds a value into a 64-bit hash.
+    triton::uint64 fold64(triton::uint512 value);
 
     //! Custom modular sign extend for bitwise operation.
     triton::sint512 modularSignExtend(AbstractNode* node);
 
+    //! Sign extends a value of `size` bits (up to 64) to 64 bits.
+    triton::sint64 signExtend64(triton::uint64 value, triton::uint32 size);
+
     //! Displays the node in ast representation.
     TRITON_EXPORT std::ostream& operator<<(std::ostream& stream, AbstractNode* node);
 
     //! AST C++ API - Duplicates the AST
     TRITON_EXPORT SharedAbstractNode newInstance(AbstractNode* node, bool unroll=false);
 
+    //! AST C++ API - Returns a copy of the node which shares the children of the original one. The copy is not interned, so its children can be changed.
+    TRITON_EXPORT SharedAbstractNode shallowCopy(AbstractNode* node);
+
     //! AST C++ API - Unrolls the SSA form of a given AST.
     TRITON_EXPORT SharedAbstractNode unrollAst(const SharedAbstractNode& node);
 
-    //! Returns all nodes of an AST. If `unroll` is true, references are unrolled. If `revert` is true, children are on top of list.
+    //! Post order traversal of an AST. `visit` is called once per node, after all its children. If `unroll` is true, references are unrolled. Nodes for which `skip` returns true are neither visited nor traversed.
+    TRITON_EXPORT void postOrderTraversal(const SharedAbstractNode& node, bool unroll, const std::function<void(const SharedAbstractNode&)>& visit, const std::function<bool(const SharedAbstractNode&)>& skip=nullptr);
+
+    //! Returns the node and all its children sorted topologically. If `unroll` is true, references are unrolled. If `revert` is true, children are on top of list.
+    TRITON_EXPORT std::vector<SharedAbstractNode> childrenExtraction(const SharedAbstractNode& node, bool unroll, bool revert);
+
+    //! Returns all nodes of an AST. If `unroll` is true, references are unrolled. If `revert` is true, children are on top of list. Prefer childrenExtraction().
     TRITON_EXPORT void nodesExtraction(std::deque<SharedAbstractNode>* output, const SharedAbstractNode& node, bool unroll, bool revert);
 
     //! Returns a deque of collected matched nodes via a depth-first pre order traversal.
     TRITON_EXPORT std::deque<SharedAbstractNode> lookingForNodes(const SharedAbstractNode& node, triton::ast::ast_e match=ANY_NODE);
 
+    //! Evaluates an AST with the given values of the symbolic variables (id -> value). Other variables keep their concrete value. Neither the AST nor its context is modified.
+    TRITON_EXPORT triton::uint512 evaluate(const SharedAbstractNode& node, const std::map<triton::usize, triton::uint512>& assignment);
+
   /*! @} End of ast namespace */
   };
 /*! @} End of triton namespace */
@@ -8,11 +8,15 @@
 #ifndef TRITON_AST_CONTEXT_H
 #define TRITON_AST_CONTEXT_H
 
+#include <array>
 #include <map>
+#include <tuple>
+#include <unordered_map>
 #include <vector>
 
 #include <triton/ast.hpp>
 #include <triton/astRepresentation.hpp>
+#include <triton/cpuSize.hpp>
 #include <triton/dllexport.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/modes.hpp>
@@ -55,8 +59,70 @@ namespace triton {
         //! String formater for ast
         triton::ast::representations::AstRepresentation astRepresentation;
 
-        //! Map a concrete value and ast node for a variable name.
-        std::map<std::string, std::pair<triton::ast::SharedAbstractNode, triton::uint512>> valueMapping;
+        //! Concrete value and ast node of variables, indexed by the symbolic variable id.
+        std::vector<std::pair<triton::ast::SharedAbstractNode, triton::uint512>> valueMapping;
+
+        //! Map of variable name -> symbolic variable id.
+        std::unordered_map<std::string, triton::usize> variableNames;
+
+        //! Unique table of nodes (hash-consing). Nodes are weakly referenced and indexed by their hash.
+        std::unordered_multimap<triton::uint64, triton::ast::WeakAbstractNode> uniqueTable;
+
+        //! The size of the unique table from which expired entries are swept.
+        triton::usize uniqueTableThreshold;
+
+        //! The shared constants 0, 1 and -1 of each size (AST_CONSTANT_FOLDING), indexed by size.
+        std::vector<std::array<triton::ast::SharedAbstractNode, 3>> constants;
+
+        //! Scratch storage of AbstractNode::initParents(), kept between calls to reuse its capacity.
+        std::vector<triton::ast::SharedAbstractNode> initOrder;
+
+        //! Scratch storage of AbstractNode::initParents(): the DFS stack of (node, next parent index).
+        std::vector<std::pair<triton::ast::AbstractNode*, triton::usize>> initStack;
+
+        //! The key of a memoized rewriting: the node type, the high and low bits of an extract and the operands.
+        using RewriteKey = std::tuple<triton::uint32, triton::uint32, triton::uint32, const AbstractNode*, const AbstractNode*, const AbstractNode*>;
+
+        //! A memoized rewriting (AST_IDIOM_REWRITING): the operands with their hash when it was done, and the rewritten node.
+        struct Rewrite {
+          std::array<std::pair<triton::ast::WeakAbstractNode, triton::uint64>, 3> operands;
+          triton::ast::WeakAbstractNode node;
+        };
+
+        //! The memoized rewritings of the builders. The operands and the rewritten nodes are weakly referenced.
+        std::map<RewriteKey, Rewrite> rewrites;
+
+        //! The number of memoized rewritings from which expired entries are swept.
+        triton::usize rewritesThreshold;
+
+        //! Returns the slot of a shared constant, nullptr if the value is not 0, 1 or -1 or if AST_CONSTANT_FOLDING is disabled.
+        SharedAbstractNode* getConstantSlot(const triton::uint512& value, triton::uint32 size);
+
+        //! Returns true if both nodes have the same type, the same size, the same number of children and the same payload.
+        bool isSameLabel(AbstractNode* node1, AbstractNode* node2) const;
+
+        //! Returns true if both nodes have the same type, the same payload and the same children instances.
+        bool isSameNode(const SharedAbstractNode& node1, const SharedAbstractNode& node2) const;
+
+        //! Removes the expired entries of the unique table.
+        void sweepUniqueTable(void);
+
+        //! Returns the memoized rewriting of a key, nullptr if there is none or if one of its operands has changed.
+        SharedAbstractNode getRewrite(const RewriteKey& key);
+
+        //! Memoizes the rewriting of a key.
+        void setRewrite(const RewriteKey& key, const std::array<SharedAbstractNode, 3>& operands, const SharedAbstractNode& node);
+
+        //! Removes the expired entries of the memoized rewritings.
+        void sweepRewrites(void);
+
+        //! Returns the rewriting of extract(high, low, expr), nullptr if no rule applies.
+        SharedAbstractNode rewriteExtract(triton::uint32 high, triton::uint32 low, const SharedAbstractNode& expr);
+
+        //! Returns the rewriting of ite(ifExpr, thenExpr, elseExpr), nullptr if no rule applies.
+        SharedAbstractNode rewriteIte(const SharedAbstractNode& ifExpr, const SharedAbstractNode& thenExpr, const SharedAbstractNode& elseExpr);
+
+        friend class AbstractNode;
 
       public:
         //! Constructor
@@ -71,6 +137,27 @@ namespace triton {
         //! Operator
         TRITON_EXPORT AstContext& operator=(const AstContext& other);
 
+        //! Returns the unique instance of a structurally identical node if AST_HASH_CONSING is enabled, otherwise returns the node itself.
+        TRITON_EXPORT SharedAbstractNode getUniqueNode(const SharedAbstractNode& node);
+
+        //! Returns the constant of a bitvector node whose children are not symbolized if AST_CONSTANT_FOLDING is enabled, otherwise returns its unique node.
+        TRITON_EXPORT SharedAbstractNode foldNode(const SharedAbstractNode& node);
+
+        //! Returns true if both trees are structurally identical. The references are compared by expression, not followed.
+        TRITON_EXPORT bool isSameTree(const SharedAbstractNode& node1, const SharedAbstractNode& node2) const;
+
+        //! Returns extract(high1, low2, A) if the nodes are extract(high1, low1, A) and extract(low1 - 1, low2, A), otherwise nullptr.
+        TRITON_EXPORT SharedAbstractNode mergeExtracts(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
+
+        //! Returns the number of live nodes in the unique table.
+        TRITON_EXPORT triton::usize getUniqueTableSize(void);
+
+        //! Returns the census of an AST (node type -> number of nodes). References are followed.
+        TRITON_EXPORT std::map<triton::ast::ast_e, triton::usize> getNodeCensus(const SharedAbstractNode& node) const;
+
+        //! Returns the memory footprint (in bytes) of the nodes of an AST. References are followed.
+        TRITON_EXPORT triton::usize getNodeMemorySize(const SharedAbstractNode& node) const;
+
         //! AST C++ API - assert node builder
         TRITON_EXPORT SharedAbstractNode assert_(const SharedAbstractNode& expr);
 
@@ -182,7 +269,7 @@ namespace triton {
           if (node == nullptr)
             throw triton::exceptions::Ast("Node builders - Not enough memory");
           node->init();
-          return node;
+          return this->getUniqueNode(node);
         }
 
         //! AST C++ API - concat node builder
@@ -190,11 +277,25 @@ namespace triton {
 
         //! AST C++ API - concat node builder
         template <typename T> SharedAbstractNode concat(const T& exprs) {
+          if (this->modes.isModeEnabled(triton::modes::AST_IDIOM_REWRITING)) {
+            /* Rewriting: Merges the adjacent extractions of a same node */
+            std::vector<SharedAbstractNode> merged;
+            for (const auto& expr : exprs) {
+              SharedAbstractNode node = merged.empty() ? nullptr : this->mergeExtracts(merged.back(), expr);
+              if (node != nullptr)
+                merged.back() = node;
+              else
+                merged.push_back(expr);
+            }
+            if (merged.size() < exprs.size())
+              return (merged.size() == 1) ? merged.front() : this->concat(merged);
+          }
+
           SharedAbstractNode node = std::make_shared<ConcatNode>(exprs, *this);
           if (node == nullptr)
             throw triton::exceptions::Ast("Node builders - Not enough memory");
           node->init();
-          return node;
+          return this->foldNode(node);
         }
 
         //! AST C++ API - declare node builder
@@ -227,7 +328,7 @@ namespace triton {
           if (node == nullptr)
             throw triton::exceptions::Ast("Node builders - Not enough memory");
           node->init();
-          return node;
+          return this->getUniqueNode(node);
         }
 
         //! AST C++ API - let node builder
@@ -245,7 +346,7 @@ namespace triton {
           if (node == nullptr)
             throw triton::exceptions::Ast("Node builders - Not enough memory");
           node->init();
-          return node;
+          return this->getUniqueNode(node);
         }
 
         //! AST C++ API - reference node builder
@@ -264,16 +365,19 @@ namespace triton {
         TRITON_EXPORT SharedAbstractNode zx(triton::uint32 sizeExt, const SharedAbstractNode& expr);
 
         //! Initializes a variable in the context
-        TRITON_EXPORT void initVariable(const std::string& name, const triton::uint512& value, const SharedAbstractNode& node);
+        TRITON_EXPORT void initVariable(const triton::engines::symbolic::SharedSymbolicVariable& symVar, const triton::uint512& value, const SharedAbstractNode& node);
 
         //! Updates a variable value in this context
-        TRITON_EXPORT void updateVariable(const std::string& name, const triton::uint512& value);
+        TRITON_EXPORT void updateVariable(triton::usize id, const triton::uint512& value);
+
+        //! Updates several variable values in this context. Each affected node is re-evaluated once.
+        TRITON_EXPORT void updateVariables(const std::map<triton::usize, triton::uint512>& values);
 
         //! Gets a variable node from its name.
         SharedAbstractNode getVariableNode(const std::string& name);
 
-        //! Gets a variable value from its name.
-        TRITON_EXPORT const triton::uint512& getVariableValue(const std::string& varName) const;
+        //! Gets a variable value from its symbolic variable id.
+        TRITON_EXPORT const triton::uint512& getVariableValue(triton::usize id) const;
 
         //! Sets the representation mode for this astContext
         TRITON_EXPORT void setRepresentationMode(triton::uint32 mode);
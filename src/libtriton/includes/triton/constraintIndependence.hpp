@@ -0,0 +1,101 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_CONSTRAINTINDEPENDENCE_HPP
+#define TRITON_CONSTRAINTINDEPENDENCE_HPP
+
+#include <map>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! \class ConstraintIndependence
+       *  \brief Slices a conjunction of constraints into independent partitions.
+       *
+       *  \details The conjuncts of a `land` chain are grouped by the symbolic variables they
+       *  transitively share. A partition which holds with the current concrete values of its
+       *  variables (e.g. the branches already taken on a path) does not need to be solved: its
+       *  variables keep their concrete values. Only the other partitions (e.g. the one of a
+       *  negated branch) are sent to the solver.
+       */
+      class ConstraintIndependence {
+        private:
+          //! The conjuncts which must be solved.
+          std::vector<triton::ast::SharedAbstractNode> constraints;
+
+          //! The conjunction of the conjuncts which must be solved (null if there is none).
+          triton::ast::SharedAbstractNode query;
+
+          //! The concrete values of the variables which are not solved.
+          std::map<triton::uint32, SolverModel> concreteModel;
+
+          //! The number of partitions.
+          triton::usize partitions;
+
+          //! The number of conjuncts.
+          triton::usize conjuncts;
+
+          //! Returns the conjuncts of a `land` chain.
+          static std::vector<triton::ast::SharedAbstractNode> getConjuncts(const triton::ast::SharedAbstractNode& node);
+
+        public:
+          //! Constructor. Slices the constraint `node`.
+          TRITON_EXPORT ConstraintIndependence(const triton::ast::SharedAbstractNode& node);
+
+          //! Returns the conjunction of the partitions which must be solved, or null if the concrete values are already a model.
+          TRITON_EXPORT triton::ast::SharedAbstractNode getQuery(void) const;
+
+          //! Returns the conjuncts which must be solved.
+          TRITON_EXPORT const std::vector<triton::ast::SharedAbstractNode>& getConstraints(void) const;
+
+          //! Returns the concrete values of the variables which are not solved.
+          TRITON_EXPORT const std::map<triton::uint32, SolverModel>& getConcreteModel(void) const;
+
+          //! Returns the number of independent partitions.
+          TRITON_EXPORT triton::usize getNumberOfPartitions(void) const;
+
+          //! Returns the number of conjuncts.
+          TRITON_EXPORT triton::usize getNumberOfConjuncts(void) const;
+
+          //! Completes a model of the query with the concrete values of the other variables.
+          TRITON_EXPORT void complete(std::map<triton::uint32, SolverModel>& model) const;
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_CONSTRAINTINDEPENDENCE_HPP */
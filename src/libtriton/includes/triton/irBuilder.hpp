@@ -15,6 +15,8 @@
 #include <triton/semanticsInterface.hpp>
 #include <triton/symbolicEngine.hpp>
 #include <triton/taintEngine.hpp>
+#include <triton/x86ConcreteSemantics.hpp>
+#include <triton/x86TaintSemantics.hpp>
 
 
 
@@ -52,6 +54,18 @@ namespace triton {
         //! Taint engine API
         triton::engines::taint::TaintEngine* taintEngine;
 
+        //! x86 taint-only builder (TAINT_FAST_PATH).
+        triton::arch::x86::x86TaintSemantics* x86TaintIsa;
+
+        //! x86 native interpreter of the concrete instructions (CONCRETE_FAST_PATH).
+        triton::arch::x86::x86ConcreteSemantics* x86ConcreteIsa;
+
+        //! Returns true if only the taint of the instruction is spread, from the transfer table.
+        bool isTaintFastPath(const triton::arch::Instruction& inst) const;
+
+        //! Returns true if the instruction may be executed natively when its operands are concrete.
+        bool isConcreteFastPath(const triton::arch::Instruction& inst) const;
+
         //! Removes all symbolic expressions of an instruction.
         void removeSymbolicExpressions(triton::arch::Instruction& inst);
 
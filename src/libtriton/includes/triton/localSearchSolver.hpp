@@ -0,0 +1,236 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_LOCALSEARCHSOLVER_HPP
+#define TRITON_LOCALSEARCHSOLVER_HPP
+
+#include <list>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/astEnums.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/solverInterface.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/solverQueryStats.hpp>
+#include <triton/symbolicVariable.hpp>
+#include <triton/tritonTypes.hpp>
+#ifdef Z3_INTERFACE
+  #include <triton/z3Solver.hpp>
+#endif
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! \class CompiledConstraint
+       *  \brief A logical constraint compiled to a flat program on 64-bit values.
+       *
+       *  \details Each symbolized node of the constraint is an instruction writing a slot, the nodes
+       *  which are not symbolized are constant slots. Besides the value of the constraint, the program
+       *  computes a distance to true: 0 if the constraint holds, and the farther the operands of the
+       *  comparisons are from satisfying them, the bigger the distance.
+       */
+      class CompiledConstraint {
+        private:
+          //! An instruction of the program.
+          struct Instruction {
+            //! The kind of node.
+            triton::ast::ast_e type;
+
+            //! The size of the result in bits.
+            triton::uint32 size;
+
+            //! The slot of the result.
+            triton::uint32 dst;
+
+            //! The index of the first operand in `operands`.
+            triton::uint32 args;
+
+            //! The number of operands.
+            triton::uint32 nargs;
+
+            //! The immediate of extract (low bit) and rotations.
+            triton::uint32 imm;
+          };
+
+          //! The instructions in post order.
+          std::vector<Instruction> code;
+
+          //! The operand slots of the instructions.
+          std::vector<triton::uint32> operands;
+
+          //! The values of the slots.
+          std::vector<triton::uint64> values;
+
+          //! The sizes of the slots in bits.
+          std::vector<triton::uint32> sizes;
+
+          //! The distances to true and to false of the logical slots.
+          std::vector<std::pair<triton::uint64, triton::uint64>> distances;
+
+          //! The symbolic variables of the constraint and their slots.
+          std::vector<std::pair<triton::engines::symbolic::SharedSymbolicVariable, triton::uint32>> variables;
+
+          //! The constants of the constraint and their bytes, used as candidate values.
+          std::vector<triton::uint64> dictionary;
+
+          //! The slot of the constraint.
+          triton::uint32 root;
+
+          //! Adds a slot and returns its index.
+          triton::uint32 newSlot(triton::uint32 size, triton::uint64 value);
+
+          //! Adds a constant to the dictionary.
+          void addToDictionary(triton::uint64 value, triton::uint32 size);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT CompiledConstraint();
+
+          //! Compiles a logical constraint. Returns false if it has unsupported nodes or nodes larger than 64 bits.
+          TRITON_EXPORT bool compile(const triton::ast::SharedAbstractNode& node);
+
+          //! Returns the symbolic variables of the constraint.
+          TRITON_EXPORT const std::vector<std::pair<triton::engines::symbolic::SharedSymbolicVariable, triton::uint32>>& getVariables(void) const;
+
+          //! Returns the constants of the constraint and their bytes.
+          TRITON_EXPORT const std::vector<triton::uint64>& getDictionary(void) const;
+
+          //! Returns the current concrete values of the variables.
+          TRITON_EXPORT std::vector<triton::uint64> getConcreteAssignment(void) const;
+
+          //! Runs the program with the values of the variables (in the order of getVariables()) and returns the distance to true.
+          TRITON_EXPORT triton::uint64 run(const std::vector<triton::uint64>& assignment);
+      };
+
+
+      //! \class LocalSearchSolver
+      /*! \brief Solver engine searching a model with a local search on the compiled constraint.
+       *
+       *  \details Starting from the concrete values, the search moves one variable at a time (bit flips,
+       *  additions of powers of two, constants of the constraint) toward a smaller distance to true,
+       *  and perturbs the assignment when it is stuck. A local search cannot prove that a constraint is
+       *  UNSAT, so when no model is found within the time budget, or if the constraint cannot be compiled,
+       *  the query is sent to z3. Without z3, the status of such a query is UNKNOWN. The models found
+       *  are checked against the AST before being returned, a model that the AST rejects is dropped and
+       *  the query goes to z3 as well.
+       */
+      class LocalSearchSolver : public SolverInterface {
+        private:
+          //! The time budget of the search in milliseconds.
+          triton::uint32 budget;
+
+          //! The number of queries solved by the search.
+          mutable triton::usize hits;
+
+          //! The number of queries sent to the fallback solver.
+          mutable triton::usize fallbacks;
+
+          #ifdef Z3_INTERFACE
+          //! The fallback solver.
+          triton::engines::solver::Z3Solver z3;
+          #endif
+
+          //! Searches at most `limit` distinct models of a compiled constraint for `budget` milliseconds.
+          static std::list<std::map<triton::uint32, SolverModel>> search(CompiledConstraint& program, triton::uint32 limit, triton::uint32 budget);
+
+        public:
+          //! Constructor. The `budget` is the max time of the search in milliseconds before the fallback.
+          TRITON_EXPORT LocalSearchSolver(triton::uint32 budget=50);
+
+          //! Computes and returns a model from a symbolic constraint.
+          /*! \brief map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::map<triton::uint32, SolverModel> getModel(const triton::ast::SharedAbstractNode& node) const;
+
+          //! Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned.
+          /*! \brief list of map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::list<std::map<triton::uint32, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit) const;
+
+          //! Returns true if an expression is satisfiable.
+          TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node) const;
+
+          //! Checks a symbolic constraint and computes at most `limit` models (0 means only the satisfiability) within the time (ms) and memory (MB) limits.
+          TRITON_EXPORT std::list<std::map<triton::uint32, SolverModel>> solve(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::uint32 timeout, triton::uint32 memoryLimit, SolverQueryStats& stats) const;
+
+          //! Returns the name of this solver.
+          TRITON_EXPORT std::string getName(void) const;
+
+          //! Sets the time budget of the search in milliseconds.
+          TRITON_EXPORT void setBudget(triton::uint32 budget);
+
+          //! Returns the time budget of the search in milliseconds.
+          TRITON_EXPORT triton::uint32 getBudget(void) const;
+
+          //! Returns the number of queries solved by the search.
+          TRITON_EXPORT triton::usize getHits(void) const;
+
+          //! Returns the number of queries sent to the fallback solver.
+          TRITON_EXPORT triton::usize getFallbacks(void) const;
+
+          #ifdef Z3_INTERFACE
+          //! Creates a new scope in the incremental session of the fallback solver.
+          TRITON_EXPORT void push(void);
+
+          //! Removes the last scope of the incremental session and its constraints.
+          TRITON_EXPORT void pop(void);
+
+          //! Adds a constraint to the current scope of the incremental session.
+          TRITON_EXPORT void addConstraint(const triton::ast::SharedAbstractNode& node);
+
+          //! Removes all scopes and constraints of the incremental session.
+          TRITON_EXPORT void resetSession(void);
+
+          //! Computes and returns a model from a symbolic constraint and the constraints of the incremental session.
+          TRITON_EXPORT std::map<triton::uint32, SolverModel> getSessionModel(const triton::ast::SharedAbstractNode& node);
+
+          //! Returns true if an expression is satisfiable with the constraints of the incremental session.
+          TRITON_EXPORT bool isSessionSat(const triton::ast::SharedAbstractNode& node);
+          #endif
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_LOCALSEARCHSOLVER_HPP */
@@ -27,7 +27,7 @@ namespace triton {
 
     //! Enumerates all kinds of mode.
     enum mode_e {
-      ALIGNED_MEMORY,                 //!< [symbolic] Keep a map of aligned memory.
+      ALIGNED_MEMORY,                 //!< [symbolic] Deprecated, the symbolic memory is always recorded by ranges. Kept for compatibility.
       AST_OPTIMIZATIONS,              //!< [AST] Classical arithmetic optimisations to reduce the depth of the trees.
       CONCRETIZE_UNDEFINED_REGISTERS, //!< [symbolic] Concretize every registers tagged as undefined (see #750).
       ONLY_ON_SYMBOLIZED,             //!< [symbolic] Perform symbolic execution only on symbolized expressions.
@@ -35,6 +35,18 @@ namespace triton {
       PC_TRACKING_SYMBOLIC,           //!< [symbolic] Track path constraints only if they are symbolized.
       SYMBOLIZE_INDEX_ROTATION,       //!< [symbolic] Symbolize index rotation for bvrol and bvror (see #751). This mode increases the complexity of solving.
       TAINT_THROUGH_POINTERS,         //!< [taint] Spread the taint if an index pointer is already tainted (see #725).
+      AST_HASH_CONSING,               //!< [AST] Structurally identical nodes are shared through a unique table (hash-consing).
+      DISASSEMBLY_CACHE,              //!< [arch] Keep decoded instructions in a cache keyed by address and opcode bytes.
+      LAZY_FLAGS,                     //!< [symbolic] Build the ASTs of the x86 arithmetic flags only when they are read.
+      SOLVER_QUERY_CACHE,             //!< [solver] Keep the results of the solver queries in a cache keyed by the canonical form of the constraints.
+      SOLVER_MODEL_REUSE,             //!< [solver] Try the recent models on a constraint before sending it to the solver.
+      SOLVER_QUERY_STATS,             //!< [solver] Record the statistics (timings, AST size, status) of each query sent to the solver.
+      SOLVER_QUERY_RECORDING,         //!< [solver] Record each query sent to the solver as a self-contained SMT-LIB2 file with its timings.
+      TAINT_LABELS,                   //!< [taint] Track the set of labels of each tainted byte and register, see taintMemoryWithLabel().
+      TAINT_FAST_PATH,                //!< [taint] If the symbolic engine is disabled, spread the taint of common x86 instructions from a transfer table without building their semantics.
+      CONCRETE_FAST_PATH,             //!< [symbolic] With ONLY_ON_SYMBOLIZED or ONLY_ON_TAINTED, execute the common x86 instructions natively if none of their operands is symbolized or tainted.
+      AST_CONSTANT_FOLDING,           //!< [AST] The bitvector nodes whose children are not symbolized are built as constants.
+      AST_IDIOM_REWRITING,            //!< [AST] Rewrite the idioms of the lifting (extract, concat, ite, A ^ A, A - A) when a node is built.
     };
 
   /*! @} End of modes namespace */
@@ -0,0 +1,119 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_PAGEDMEMORY_H
+#define TRITON_PAGEDMEMORY_H
+
+#include <memory>
+#include <unordered_map>
+
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    //! The size of a memory page.
+    const triton::uint64 MEMORY_PAGE_SIZE = 0x1000;
+
+    /*! \class PagedMemory
+     *  \brief Sparse concrete memory backed by a page table.
+     *
+     *  \details Pages of MEMORY_PAGE_SIZE bytes are allocated on the first write. Each page
+     *  keeps a bitmap of its mapped bytes so that a byte is mapped only once it has been
+     *  written, like in the previous `std::map<uint64, uint8>` model. Unmapped bytes are read as zero.
+     */
+    class PagedMemory {
+      private:
+        //! A memory page.
+        struct Page {
+          //! The content of the page. Unmapped bytes are always zero.
+          triton::uint8 data[MEMORY_PAGE_SIZE];
+
+          //! The bitmap of mapped bytes.
+          triton::uint64 mapped[MEMORY_PAGE_SIZE / 64];
+
+          //! The number of mapped bytes.
+          triton::usize count;
+        };
+
+        //! Map of page base address -> page.
+        std::unordered_map<triton::uint64, std::unique_ptr<Page>> pages;
+
+        //! The base address of the last page accessed.
+        mutable triton::uint64 lastBase;
+
+        //! The last page accessed (nullptr if unknown).
+        mutable Page* lastPage;
+
+        //! Returns the page containing the address, nullptr if not allocated.
+        Page* findPage(triton::uint64 addr) const;
+
+        //! Returns the page containing the address, allocates it if needed.
+        Page* getPage(triton::uint64 addr);
+
+        //! Marks `size` bytes of a page as mapped from `offset`.
+        void map(Page* page, triton::uint64 offset, triton::usize size);
+
+        //! Copies a PagedMemory.
+        void copy(const PagedMemory& other);
+
+      public:
+        //! Constructor.
+        TRITON_EXPORT PagedMemory();
+
+        //! Constructor by copy.
+        TRITON_EXPORT PagedMemory(const PagedMemory& other);
+
+        //! Copies a PagedMemory.
+        TRITON_EXPORT PagedMemory& operator=(const PagedMemory& other);
+
+        //! Returns the byte at the address (zero if not mapped).
+        TRITON_EXPORT triton::uint8 read(triton::uint64 addr) const;
+
+        //! Reads `size` bytes from `addr` into `out`. Unmapped bytes are read as zero.
+        TRITON_EXPORT void read(triton::uint64 addr, triton::uint8* out, triton::usize size) const;
+
+        //! Writes a byte at the address.
+        TRITON_EXPORT void write(triton::uint64 addr, triton::uint8 value);
+
+        //! Writes `size` bytes from `in` at `addr`.
+        TRITON_EXPORT void write(triton::uint64 addr, const triton::uint8* in, triton::usize size);
+
+        //! Returns true if the range `[baseAddr:size]` is mapped.
+        TRITON_EXPORT bool isMapped(triton::uint64 baseAddr, triton::usize size=1) const;
+
+        //! Unmaps the range `[baseAddr:size]`. Pages without mapped bytes are released.
+        TRITON_EXPORT void unmap(triton::uint64 baseAddr, triton::usize size=1);
+
+        //! Returns the number of allocated pages.
+        TRITON_EXPORT triton::usize getNumberOfPages(void) const;
+
+        //! Clears the memory.
+        TRITON_EXPORT void clear(void);
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_PAGEDMEMORY_H */
@@ -85,6 +85,12 @@ namespace triton {
       //! Initializes the MODE python namespace.
       void initModeNamespace(PyObject* modeDict);
 
+      //! Initializes the SOLVER python namespace.
+      void initSolverNamespace(PyObject* solverDict);
+
+      //! Initializes the SOLVER_STATE python namespace.
+      void initSolverStateNamespace(PyObject* solverStateDict);
+
       //! Initializes the SYMBOLIC python namespace.
       void initSymbolicNamespace(PyObject* symbolicDict);
 
@@ -0,0 +1,136 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SHADOWMEMORY_H
+#define TRITON_SHADOWMEMORY_H
+
+#include <memory>
+#include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Taint namespace
+    namespace taint {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup taint
+     *  @{
+     */
+
+      //! The number of addresses covered by a shadow page.
+      const triton::uint64 SHADOW_PAGE_SIZE = 0x1000;
+
+      /*! \class ShadowMemory
+       *  \brief Sparse bitmap of the tainted bytes backed by a page table.
+       *
+       *  \details The first level is a table of pages keyed by base address, the second level is
+       *  a bitmap of SHADOW_PAGE_SIZE bits per page. Pages are allocated on the first taint and
+       *  released when they have no tainted byte left. Ranges are checked and updated 64 bytes at a time.
+       *  A page may also keep the id of the label set of each byte (see TaintLabels), untainted bytes have the empty set.
+       */
+      class ShadowMemory {
+        private:
+          //! A shadow page.
+          struct Page {
+            //! The bitmap of tainted bytes.
+            triton::uint64 bits[SHADOW_PAGE_SIZE / 64];
+
+            //! The number of tainted bytes.
+            triton::usize count;
+
+            //! The ids of the label sets of the bytes (nullptr until a label is set).
+            std::unique_ptr<triton::uint32[]> labels;
+          };
+
+          //! Map of page base address -> page.
+          std::unordered_map<triton::uint64, std::unique_ptr<Page>> pages;
+
+          //! The base address of the last page accessed.
+          mutable triton::uint64 lastBase;
+
+          //! The last page accessed (nullptr if unknown).
+          mutable Page* lastPage;
+
+          //! Returns the page containing the address, nullptr if not allocated.
+          Page* findPage(triton::uint64 addr) const;
+
+          //! Returns the page containing the address, allocates it if needed.
+          Page* getPage(triton::uint64 addr);
+
+          //! Copies a ShadowMemory.
+          void copy(const ShadowMemory& other);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT ShadowMemory();
+
+          //! Constructor by copy.
+          TRITON_EXPORT ShadowMemory(const ShadowMemory& other);
+
+          //! Copies a ShadowMemory.
+          TRITON_EXPORT ShadowMemory& operator=(const ShadowMemory& other);
+
+          //! Returns true if a byte of the range `[baseAddr:size]` is tainted.
+          TRITON_EXPORT bool isTainted(triton::uint64 baseAddr, triton::usize size=1) const;
+
+          //! Taints the range `[baseAddr:size]`.
+          TRITON_EXPORT void taint(triton::uint64 baseAddr, triton::usize size=1);
+
+          //! Untaints the range `[baseAddr:size]`. Pages without tainted bytes are released.
+          TRITON_EXPORT void untaint(triton::uint64 baseAddr, triton::usize size=1);
+
+          //! Sets the id of the label set of the bytes of the range `[baseAddr:size]`.
+          TRITON_EXPORT void setLabels(triton::uint64 baseAddr, triton::usize size, triton::uint32 set);
+
+          //! Returns the id of the label set of a byte.
+          TRITON_EXPORT triton::uint32 getLabels(triton::uint64 addr) const;
+
+          //! Returns the tainted ranges as (base address, size), sorted by address.
+          TRITON_EXPORT std::vector<std::pair<triton::uint64, triton::usize>> getRanges(void) const;
+
+          //! Returns the tainted addresses.
+          TRITON_EXPORT std::set<triton::uint64> getAddresses(void) const;
+
+          //! Returns the number of tainted bytes.
+          TRITON_EXPORT triton::usize getNumberOfTaintedBytes(void) const;
+
+          //! Returns the number of allocated pages.
+          TRITON_EXPORT triton::usize getNumberOfPages(void) const;
+
+          //! Clears the shadow memory.
+          TRITON_EXPORT void clear(void);
+      };
+
+    /*! @} End of taint namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SHADOWMEMORY_H */
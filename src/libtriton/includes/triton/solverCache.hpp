@@ -0,0 +1,206 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SOLVERCACHE_HPP
+#define TRITON_SOLVERCACHE_HPP
+
+#include <list>
+#include <map>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/symbolicVariable.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! \class SolverCache
+       *  \brief Cache of the solver results (SOLVER_QUERY_CACHE mode).
+       *
+       *  \details Queries are keyed by the canonical form of the constraint: the nodes are numbered
+       *  in post order, references are unrolled and the symbolic variables are renamed by order of
+       *  appearance. So two constraints which only differ by their variables share the same entry,
+       *  and the models are stored on the renamed variables. Entries are looked up by the hash of
+       *  the canonical form, the canonical form itself confirms a hit, so there is no false hit.
+       *  The cache keeps the most recently used entries (see setMaxSize()), and the file store is
+       *  rewritten with the live entries when the lines of the superseded ones outnumber them.
+       */
+      class SolverCache {
+        public:
+          //! The canonical form of a query.
+          struct Query {
+            //! The canonical key of the constraint.
+            std::string key;
+
+            //! The hash of the canonical key.
+            triton::uint64 hash;
+
+            //! The symbolic variables of the constraint, by order of appearance.
+            std::vector<triton::engines::symbolic::SharedSymbolicVariable> variables;
+          };
+
+        private:
+          //! A model on the renamed variables (index of the variable -> value).
+          using CanonicalModel = std::vector<std::pair<triton::uint32, triton::uint512>>;
+
+          //! An entry of the cache.
+          struct Entry {
+            //! The canonical key of the constraint.
+            std::string key;
+
+            //! The hash of the canonical key.
+            triton::uint64 hash = 0;
+
+            //! True if the satisfiability of the constraint is known.
+            bool satKnown = false;
+
+            //! True if the constraint is satisfiable.
+            bool sat = false;
+
+            //! True if all the models of the constraint are in `models`.
+            bool exhausted = false;
+
+            //! The number of models asked to the solver when `models` was computed.
+            triton::uint32 limit = 0;
+
+            //! The models found.
+            std::vector<CanonicalModel> models;
+
+            //! The time spent by the solver for this query (in microseconds).
+            triton::uint64 time = 0;
+          };
+
+          //! The entries of the cache, the most recently used first.
+          std::list<Entry> entries;
+
+          //! The entries of the cache, keyed by the hash of the canonical form of the constraints.
+          std::unordered_map<triton::uint64, std::list<Entry>::iterator> index;
+
+          //! The max number of entries.
+          triton::usize maxSize;
+
+          //! The file used to store the entries (empty if not file-backed).
+          std::string path;
+
+          //! The number of lines of the file store.
+          triton::usize fileLines;
+
+          //! The number of queries served by the cache.
+          triton::usize hits;
+
+          //! The number of queries sent to the solver.
+          triton::usize misses;
+
+          //! The solver time saved by the cache (in microseconds).
+          triton::uint64 timeSaved;
+
+          //! Returns the hash of a canonical key (FNV-1a).
+          static triton::uint64 hashKey(const std::string& key);
+
+          //! Returns the entry of a query and marks it as the most recently used. Returns nullptr if it is not in the cache.
+          Entry* find(const Query& query);
+
+          //! Returns the entry of a query, a new one is created if it is not in the cache.
+          Entry& insert(const std::string& key, triton::uint64 hash);
+
+          //! Removes the least recently used entries above the max size.
+          void evict(void);
+
+          //! Writes an entry to a stream.
+          static void write(std::ostream& stream, const Entry& entry);
+
+          //! Appends an entry to the file store.
+          void save(const Entry& entry);
+
+          //! Rewrites the file store with the entries of the cache.
+          void compact(void);
+
+          //! Loads the entries of the file store.
+          void load(void);
+
+          //! Returns the solver model from a canonical model.
+          static std::map<triton::uint32, SolverModel> getModel(const Query& query, const CanonicalModel& model);
+
+          //! Returns the canonical model from a solver model.
+          static CanonicalModel getCanonicalModel(const Query& query, const std::map<triton::uint32, SolverModel>& model);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT SolverCache();
+
+          //! Returns the canonical form of a constraint.
+          TRITON_EXPORT static Query canonicalize(const triton::ast::SharedAbstractNode& node);
+
+          //! Looks for the satisfiability of a query. Returns false if it is not in the cache.
+          TRITON_EXPORT bool isSat(const Query& query, bool& sat);
+
+          //! Looks for the `limit` first models of a query. Returns false if they are not in the cache.
+          TRITON_EXPORT bool getModels(const Query& query, triton::uint32 limit, std::list<std::map<triton::uint32, SolverModel>>& models);
+
+          //! Records the satisfiability of a query. `time` is the solving time in microseconds.
+          TRITON_EXPORT void setSat(const Query& query, bool sat, triton::uint64 time);
+
+          //! Records the models of a query computed with `limit`. `time` is the solving time in microseconds.
+          TRITON_EXPORT void setModels(const Query& query, triton::uint32 limit, const std::list<std::map<triton::uint32, SolverModel>>& models, triton::uint64 time);
+
+          //! Uses a file to store the entries. Entries already in the file are loaded. An empty path disables the file store.
+          TRITON_EXPORT void setFile(const std::string& path);
+
+          //! Sets the max number of entries (at least one is kept), the least recently used ones are dropped first.
+          TRITON_EXPORT void setMaxSize(triton::usize size);
+
+          //! Returns the number of queries served by the cache.
+          TRITON_EXPORT triton::usize getHits(void) const;
+
+          //! Returns the number of queries sent to the solver.
+          TRITON_EXPORT triton::usize getMisses(void) const;
+
+          //! Returns the solver time saved by the cache in microseconds.
+          TRITON_EXPORT triton::uint64 getTimeSaved(void) const;
+
+          //! Returns the number of entries.
+          TRITON_EXPORT triton::usize size(void) const;
+
+          //! Clears the entries and the counters. The file store is only rewritten by the next compaction.
+          TRITON_EXPORT void clear(void);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERCACHE_HPP */
@@ -8,16 +8,24 @@
 #ifndef TRITON_SOLVERENGINE_HPP
 #define TRITON_SOLVERENGINE_HPP
 
+#include <deque>
 #include <iostream>
 #include <list>
 #include <map>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <triton/ast.hpp>
+#include <triton/constraintIndependence.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/localSearchSolver.hpp>
+#include <triton/modes.hpp>
+#include <triton/solverCache.hpp>
 #include <triton/solverEnums.hpp>
 #include <triton/solverInterface.hpp>
 #include <triton/solverModel.hpp>
+#include <triton/solverQueryStats.hpp>
 #include <triton/tritonTypes.hpp>
 #ifdef Z3_INTERFACE
   #include <triton/z3Solver.hpp>
@@ -56,9 +64,72 @@ namespace triton {
           //! Instance to the real solver class.
           std::unique_ptr<triton::engines::solver::SolverInterface> solver;
 
+          //! Modes (may be null).
+          const triton::modes::Modes* modes;
+
+          //! The cache of the queries (SOLVER_QUERY_CACHE mode).
+          mutable triton::engines::solver::SolverCache cache;
+
+          //! Returns true if the queries go through the cache.
+          bool isCacheEnabled(void) const;
+
+          //! The last models returned, the most recently used first (SOLVER_MODEL_REUSE mode).
+          mutable std::list<std::map<triton::uint32, SolverModel>> recentModels;
+
+          //! The max number of recent models.
+          triton::usize recentModelsSize;
+
+          //! The number of queries answered by a recent model.
+          mutable triton::usize modelReuseHits;
+
+          //! Returns true if the recent models are tried before the solver.
+          bool isModelReuseEnabled(void) const;
+
+          //! Looks for a recent model which satisfies the constraint. Returns false if there is none.
+          bool reuseModel(const triton::ast::SharedAbstractNode& node, std::map<triton::uint32, SolverModel>& model) const;
+
+          //! Adds a model to the recent models.
+          void recordModel(const std::map<triton::uint32, SolverModel>& model) const;
+
+          //! The default max time of a query in milliseconds (0 means no limit).
+          triton::uint32 timeout;
+
+          //! The max memory of the solver in megabytes (0 means no limit).
+          triton::uint32 memoryLimit;
+
+          //! The statistics of the queries (SOLVER_QUERY_STATS mode).
+          mutable std::deque<triton::engines::solver::SolverQueryStats> queryStats;
+
+          //! The max number of statistics kept, the oldest ones are dropped first.
+          triton::usize queryStatsSize;
+
+          //! Returns true if the statistics of the queries are recorded.
+          bool isQueryStatsEnabled(void) const;
+
+          //! The directory where the queries are recorded (SOLVER_QUERY_RECORDING mode).
+          std::string recordingDirectory;
+
+          //! The number of queries recorded.
+          mutable triton::usize recordedQueries;
+
+          //! The number of queries which could not be recorded.
+          mutable triton::usize recordingFailures;
+
+          //! Returns true if the queries are recorded as SMT-LIB2 files.
+          bool isQueryRecordingEnabled(void) const;
+
+          //! Writes a query and its statistics to a self-contained SMT-LIB2 file of the recording directory. Throws if the file cannot be written.
+          void recordQuery(const triton::ast::SharedAbstractNode& node, const triton::engines::solver::SolverQueryStats& stats, triton::uint32 timeout) const;
+
+          //! Completes the statistics of a query solved with the given `timeout`, then logs and records it if enabled.
+          void processQueryStats(const triton::ast::SharedAbstractNode& node, triton::engines::solver::SolverQueryStats& stats, triton::uint32 timeout) const;
+
+          //! Sends a query to the solver with the limits and records its statistics. `timeout` overrides the default one if not 0.
+          std::list<std::map<triton::uint32, SolverModel>> solve(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::uint32 timeout, triton::engines::solver::status_e& status) const;
+
         public:
           //! Constructor.
-          TRITON_EXPORT SolverEngine();
+          TRITON_EXPORT SolverEngine(const triton::modes::Modes* modes=nullptr);
 
           //! Returns the kind of solver as triton::engines::solver::solver_e.
           TRITON_EXPORT triton::engines::solver::solver_e getSolver(void) const;
@@ -81,8 +152,13 @@ namespace triton {
            * \details
            * **item1**: symbolic variable id<br>
            * **item2**: model
+           *
+           * If `independence` is true, only the partitions of the constraint which do not hold with
+           * the concrete values are solved, see triton::engines::solver::ConstraintIndependence.
+           * If `status` is not null, it receives the status of the query. A `timeout` in milliseconds
+           * overrides the default one if not 0. An empty model means UNSAT, timeout or out of memory.
            */
-          TRITON_EXPORT std::map<triton::uint32, SolverModel> getModel(const triton::ast::SharedAbstractNode& node) const;
+          TRITON_EXPORT std::map<triton::uint32, SolverModel> getModel(const triton::ast::SharedAbstractNode& node, bool independence=false, triton::engines::solver::status_e* status=nullptr, triton::uint32 timeout=0) const;
 
           //! Computes and returns several models from a symbolic constraint. The `limit` is the max number of models returned.
           /*! \brief list of map of symbolic variable id -> model
@@ -90,14 +166,101 @@ namespace triton {
            * \details
            * **item1**: symbolic variable id<br>
            * **item2**: model
+           *
+           * If `independence` is true, only the partitions of the constraint which do not hold with
+           * the concrete values are solved, the other variables keep their concrete values.
+           * `status` and `timeout` are the same as getModel().
            */
-          TRITON_EXPORT std::list<std::map<triton::uint32, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit) const;
+          TRITON_EXPORT std::list<std::map<triton::uint32, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, bool independence=false, triton::engines::solver::status_e* status=nullptr, triton::uint32 timeout=0) const;
+
+          //! Returns true if an expression is satisfiable. `status` and `timeout` are the same as getModel().
+          TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status=nullptr, triton::uint32 timeout=0) const;
 
-          //! Returns true if an expression is satisfiable.
-          TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node) const;
+          //! Computes a model for each constraint of `nodes` on a pool of `workers` threads (0 means one per core). `timeout` is the max time of each query in milliseconds (0 means the default one).
+          /*!
+           * \details Results are in the same order as `nodes`, an empty model means UNSAT, timeout or out of memory.
+           * The queries do not go through the cache of the queries nor the recent models, and are not recorded
+           * in the statistics of the queries.
+           */
+          TRITON_EXPORT std::vector<std::map<triton::uint32, SolverModel>> getBatchModels(const std::vector<triton::ast::SharedAbstractNode>& nodes, triton::uint32 workers=0, triton::uint32 timeout=0) const;
 
           //! Returns the name of the solver.
           TRITON_EXPORT std::string getName(void) const;
+
+          //! Returns the number of queries served by the cache.
+          TRITON_EXPORT triton::usize getCacheHits(void) const;
+
+          //! Returns the number of queries of the cache sent to the solver.
+          TRITON_EXPORT triton::usize getCacheMisses(void) const;
+
+          //! Returns the solver time saved by the cache in microseconds.
+          TRITON_EXPORT triton::uint64 getCacheTimeSaved(void) const;
+
+          //! Clears the cache of the queries and its counters.
+          TRITON_EXPORT void clearCache(void);
+
+          //! Uses a file to store the cache of the queries. An empty path disables the file store.
+          TRITON_EXPORT void setCacheFile(const std::string& path);
+
+          //! Sets the max number of entries of the cache of the queries.
+          TRITON_EXPORT void setCacheSize(triton::usize size);
+
+          //! Returns the number of queries answered by a recent model.
+          TRITON_EXPORT triton::usize getModelReuseHits(void) const;
+
+          //! Sets the max number of recent models tried before the solver.
+          TRITON_EXPORT void setModelReuseSize(triton::usize size);
+
+          //! Sets the default max time of a query in milliseconds (0 means no limit).
+          TRITON_EXPORT void setTimeout(triton::uint32 timeout);
+
+          //! Returns the default max time of a query in milliseconds.
+          TRITON_EXPORT triton::uint32 getTimeout(void) const;
+
+          //! Sets the max memory of the solver in megabytes (0 means no limit).
+          TRITON_EXPORT void setMemoryLimit(triton::uint32 limit);
+
+          //! Returns the max memory of the solver in megabytes.
+          TRITON_EXPORT triton::uint32 getMemoryLimit(void) const;
+
+          //! Returns the statistics of the queries sent to the solver, the oldest first.
+          TRITON_EXPORT const std::deque<triton::engines::solver::SolverQueryStats>& getQueryStats(void) const;
+
+          //! Clears the statistics of the queries.
+          TRITON_EXPORT void clearQueryStats(void);
+
+          //! Sets the max number of statistics of queries kept, the oldest ones are dropped first.
+          TRITON_EXPORT void setQueryStatsSize(triton::usize size);
+
+          //! Sets the directory where the queries are recorded (the current directory by default). Files of a previous recording are overwritten.
+          TRITON_EXPORT void setRecordingDirectory(const std::string& path);
+
+          //! Returns the directory where the queries are recorded.
+          TRITON_EXPORT const std::string& getRecordingDirectory(void) const;
+
+          //! Returns the number of queries recorded.
+          TRITON_EXPORT triton::usize getRecordedQueries(void) const;
+
+          //! Returns the number of queries which could not be recorded. Their results are returned anyway.
+          TRITON_EXPORT triton::usize getRecordingFailures(void) const;
+
+          //! Creates a new scope in the incremental session.
+          TRITON_EXPORT void push(void);
+
+          //! Removes the last scope of the incremental session and its constraints.
+          TRITON_EXPORT void pop(void);
+
+          //! Adds a constraint to the current scope of the incremental session.
+          TRITON_EXPORT void addConstraint(const triton::ast::SharedAbstractNode& node);
+
+          //! Removes all scopes and constraints of the incremental session.
+          TRITON_EXPORT void resetSession(void);
+
+          //! Computes and returns a model from a symbolic constraint and the constraints of the incremental session.
+          TRITON_EXPORT std::map<triton::uint32, SolverModel> getSessionModel(const triton::ast::SharedAbstractNode& node);
+
+          //! Returns true if an expression is satisfiable with the constraints of the incremental session.
+          TRITON_EXPORT bool isSessionSat(const triton::ast::SharedAbstractNode& node);
       };
 
     /*! @} End of solver namespace */
@@ -35,13 +35,23 @@ namespace triton {
 
       /*! The different kind of solvers */
       enum solver_e {
-        SOLVER_INVALID = 0, /*!< invalid solver. */
-        SOLVER_CUSTOM,      /*!< custom solver. */
+        SOLVER_INVALID = 0,  /*!< invalid solver. */
+        SOLVER_CUSTOM,       /*!< custom solver. */
+        SOLVER_LOCAL_SEARCH, /*!< local search solver, z3 as fallback if available. */
         #ifdef Z3_INTERFACE
-        SOLVER_Z3,          /*!< z3 solver. */
+        SOLVER_Z3,           /*!< z3 solver. */
         #endif
       };
 
+      /*! The different status of a query */
+      enum status_e {
+        UNSAT = 0,  /*!< the constraint is not satisfiable. */
+        SAT,        /*!< the constraint is satisfiable. */
+        TIMEOUT,    /*!< the solver reached the time limit. */
+        OUTOFMEM,   /*!< the solver reached the memory limit. */
+        UNKNOWN,    /*!< the solver gave up. */
+      };
+
     /*! @} End of solver namespace */
     };
   /*! @} End of engines namespace */
@@ -8,12 +8,17 @@
 #ifndef TRITON_SOLVERINTERFACE_HPP
 #define TRITON_SOLVERINTERFACE_HPP
 
+#include <chrono>
 #include <list>
 #include <map>
+#include <vector>
 
 #include <triton/ast.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/solverEnums.hpp>
 #include <triton/solverModel.hpp>
+#include <triton/solverQueryStats.hpp>
 #include <triton/tritonTypes.hpp>
 
 
@@ -67,8 +72,81 @@ namespace triton {
           //! Returns true if an expression is satisfiable.
           TRITON_EXPORT virtual bool isSat(const triton::ast::SharedAbstractNode& node) const = 0;
 
+          //! Checks a symbolic constraint and computes at most `limit` models (0 means only the satisfiability).
+          /*!
+           * \details `timeout` is the max time of each check in milliseconds and `memoryLimit` the max memory
+           * of the solver in megabytes (0 means no limit). `stats` receives the status of the query and its
+           * timings. A query which reaches a limit is not an error, its status is TIMEOUT or OUTOFMEM.
+           * By default, the limits are ignored and the query is solved with isSat() or getModels().
+           */
+          TRITON_EXPORT virtual std::list<std::map<triton::uint32, SolverModel>> solve(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::uint32 timeout, triton::uint32 memoryLimit, SolverQueryStats& stats) const {
+            std::list<std::map<triton::uint32, SolverModel>> ret;
+            auto start = std::chrono::steady_clock::now();
+
+            stats.hash  = (node != nullptr) ? node->getHash() : 0;
+            stats.limit = limit;
+
+            if (limit == 0) {
+              stats.status = this->isSat(node) ? triton::engines::solver::SAT : triton::engines::solver::UNSAT;
+            }
+            else {
+              ret = this->getModels(node, limit);
+              stats.status = ret.empty() ? triton::engines::solver::UNSAT : triton::engines::solver::SAT;
+            }
+
+            stats.solvingTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+            return ret;
+          }
+
+          //! Computes a model for each constraint of `nodes`, results are in the same order. An empty model means UNSAT, timeout or out of memory.
+          /*!
+           * \details `workers` is the number of threads (0 means one per core), `timeout` the max time of each
+           * query in milliseconds and `memoryLimit` the max memory of the solver in megabytes (0 means no limit).
+           * `stats` receives the statistics of each query, in the same order. By default, the queries are solved
+           * one by one with solve() and `workers` is ignored.
+           */
+          TRITON_EXPORT virtual std::vector<std::map<triton::uint32, SolverModel>> getBatchModels(const std::vector<triton::ast::SharedAbstractNode>& nodes, triton::uint32 workers, triton::uint32 timeout, triton::uint32 memoryLimit, std::vector<SolverQueryStats>& stats) const {
+            std::vector<std::map<triton::uint32, SolverModel>> ret(nodes.size());
+            stats.assign(nodes.size(), SolverQueryStats());
+            for (triton::usize index = 0; index < nodes.size(); index++) {
+              auto models = this->solve(nodes[index], 1, timeout, memoryLimit, stats[index]);
+              if (models.size())
+                ret[index] = models.front();
+            }
+            return ret;
+          }
+
           //! Returns the name of the solver.
           TRITON_EXPORT virtual std::string getName(void) const = 0;
+
+          //! Creates a new scope in the incremental session.
+          TRITON_EXPORT virtual void push(void) {
+            throw triton::exceptions::SolverEngine("SolverInterface::push(): Incremental solving not supported by this solver.");
+          }
+
+          //! Removes the last scope of the incremental session and its constraints.
+          TRITON_EXPORT virtual void pop(void) {
+            throw triton::exceptions::SolverEngine("SolverInterface::pop(): Incremental solving not supported by this solver.");
+          }
+
+          //! Adds a constraint to the current scope of the incremental session.
+          TRITON_EXPORT virtual void addConstraint(const triton::ast::SharedAbstractNode& node) {
+            throw triton::exceptions::SolverEngine("SolverInterface::addConstraint(): Incremental solving not supported by this solver.");
+          }
+
+          //! Removes all scopes and constraints of the incremental session.
+          TRITON_EXPORT virtual void resetSession(void) {
+          }
+
+          //! Computes and returns a model from a symbolic constraint and the constraints of the incremental session.
+          TRITON_EXPORT virtual std::map<triton::uint32, SolverModel> getSessionModel(const triton::ast::SharedAbstractNode& node) {
+            throw triton::exceptions::SolverEngine("SolverInterface::getSessionModel(): Incremental solving not supported by this solver.");
+          }
+
+          //! Returns true if an expression is satisfiable with the constraints of the incremental session.
+          TRITON_EXPORT virtual bool isSessionSat(const triton::ast::SharedAbstractNode& node) {
+            throw triton::exceptions::SolverEngine("SolverInterface::isSessionSat(): Incremental solving not supported by this solver.");
+          }
       };
 
     /*! @} End of solver namespace */
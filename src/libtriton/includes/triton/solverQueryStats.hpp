@@ -0,0 +1,73 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SOLVERQUERYSTATS_HPP
+#define TRITON_SOLVERQUERYSTATS_HPP
+
+#include <triton/ast.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! \struct SolverQueryStats
+       *  \brief The statistics of a query sent to the solver.
+       */
+      struct SolverQueryStats {
+        //! The hash of the constraint (see AbstractNode::getHash()). The constraint itself is not kept alive.
+        triton::uint64 hash;
+
+        //! The max number of models asked (0 means only the satisfiability).
+        triton::uint32 limit;
+
+        //! The status of the query.
+        triton::engines::solver::status_e status;
+
+        //! The number of unique nodes of the constraint (0 if not computed).
+        triton::usize astSize;
+
+        //! The time spent to convert the constraint to the solver in microseconds.
+        triton::uint64 conversionTime;
+
+        //! The time spent by the solver in microseconds.
+        triton::uint64 solvingTime;
+
+        //! Constructor.
+        SolverQueryStats()
+          : hash(0), limit(0), status(triton::engines::solver::UNKNOWN), astSize(0), conversionTime(0), solvingTime(0) {
+        }
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERQUERYSTATS_HPP */
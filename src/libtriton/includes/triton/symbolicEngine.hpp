@@ -8,6 +8,7 @@
 #ifndef TRITON_SYMBOLICENGINE_H
 #define TRITON_SYMBOLICENGINE_H
 
+#include <functional>
 #include <list>
 #include <map>
 #include <memory>
@@ -53,6 +54,38 @@ namespace triton {
      *  @{
      */
 
+      /*! \brief A range of the symbolic memory.
+       *
+       * \details The range covers `size` bytes of `expr` starting at the byte `offset` of its AST.
+       * A store records a single range, ranges are only split when a new store partially overlaps them.
+       * A slice is built once per range and offset, so the getters always return the same expression for the same bytes.
+       */
+      struct MemoryRange {
+        //! The size of the range in bytes.
+        triton::uint32 size;
+
+        //! The offset (in bytes) of the range into the AST of the expression.
+        triton::uint32 offset;
+
+        //! The symbolic expression assigned to the range.
+        SharedSymbolicExpression expr;
+
+        //! The slices of `expr` already returned, keyed by their offset and size (in bytes) into its AST.
+        mutable std::map<std::pair<triton::uint32, triton::uint32>, SharedSymbolicExpression> slices;
+      };
+
+      //! A register expression whose AST is built when the register is read.
+      struct LazyExpression {
+        //! Builds the AST of the expression.
+        std::function<triton::ast::SharedAbstractNode(void)> builder;
+
+        //! The comment of the expression.
+        std::string comment;
+
+        //! True if the expression is tainted.
+        bool isTainted;
+      };
+
       //! \class SymbolicEngine
       /*! \brief The symbolic engine class. */
       class SymbolicEngine
@@ -67,7 +100,7 @@ namespace triton {
           triton::uint32 numberOfRegisters;
 
           //! Symbolic expressions id.
-          triton::usize uniqueSymExprId;
+          mutable triton::usize uniqueSymExprId;
 
           //! Symbolic variables id.
           triton::usize uniqueSymVarId;
@@ -88,24 +121,24 @@ namespace triton {
            */
           mutable std::unordered_map<triton::usize, WeakSymbolicExpression> symbolicExpressions;
 
-          /*! \brief map of address -> symbolic expression
+          /*! \brief map of address -> symbolic memory range
            *
            * \details
-           * **item1**: memory address<br>
-           * **item2**: shared symbolic expression
+           * **item1**: start address of the range<br>
+           * **item2**: symbolic memory range (ranges never overlap)
            */
-          std::map<triton::uint64, SharedSymbolicExpression> memoryReference;
+          std::map<triton::uint64, MemoryRange> memoryReference;
 
-          /*! \brief map of <address:size> -> symbolic expression.
+          //! Symbolic register state.
+          mutable std::vector<SharedSymbolicExpression> symbolicReg;
+
+          /*! \brief map of register -> lazy expression
            *
            * \details
-           * **item1**: <addr:size><br>
-           * **item2**: shared symbolic expression
+           * **item1**: parent register id<br>
+           * **item2**: expression built on the next read of the register
            */
-          std::map<std::pair<triton::uint64, triton::uint32>, SharedSymbolicExpression> alignedMemoryReference;
-
-          //! Symbolic register state.
-          std::vector<SharedSymbolicExpression> symbolicReg;
+          mutable std::unordered_map<triton::uint32, LazyExpression> lazyReg;
 
         private:
           //! Reference to the context managing ast nodes.
@@ -121,25 +154,31 @@ namespace triton {
           triton::modes::Modes& modes;
 
           //! Returns an unique symbolic expression id.
-          triton::usize getUniqueSymExprId(void);
+          triton::usize getUniqueSymExprId(void) const;
 
           //! Returns an unique symbolic variable id.
           triton::usize getUniqueSymVarId(void);
 
-          //! Gets an aligned entry.
-          const SharedSymbolicExpression& getAlignedMemory(triton::uint64 address, triton::uint32 size);
+          //! Adds a symbolic memory reference on the range `[addr:size]`.
+          void addMemoryReference(triton::uint64 addr, triton::uint32 size, const SharedSymbolicExpression& expr);
+
+          //! Removes the symbolic memory references of the range `[addr:size]`.
+          void removeMemoryReference(triton::uint64 addr, triton::uint32 size);
+
+          //! Splits the memory range containing the address so that a range starts at this address.
+          void splitMemoryRange(triton::uint64 addr);
 
-          //! Adds an aligned entry.
-          void addAlignedMemory(triton::uint64 address, triton::uint32 size, const SharedSymbolicExpression& expr);
+          //! Returns the memory range containing the address, end() if the address is concrete.
+          std::map<triton::uint64, MemoryRange>::const_iterator findMemoryRange(triton::uint64 addr) const;
 
-          //! Checks if the aligned memory is recored.
-          bool isAlignedMemory(triton::uint64 address, triton::uint32 size);
+          //! Returns the AST of `size` bytes of a memory range from the byte `offset`.
+          triton::ast::SharedAbstractNode getMemoryRangeAst(const MemoryRange& range, triton::uint32 offset, triton::uint32 size) const;
 
-          //! Removes an aligned entry.
-          void removeAlignedMemory(triton::uint64 address, triton::uint32 size);
+          //! Returns a symbolic expression of `size` bytes of a memory range from the byte `offset`. The range is not modified.
+          SharedSymbolicExpression getMemoryRangeExpression(triton::uint64 addr, const MemoryRange& range, triton::uint32 offset, triton::uint32 size) const;
 
-          //! Adds a symbolic memory reference.
-          void addMemoryReference(triton::uint64 mem, const SharedSymbolicExpression& expr);
+          //! Builds the symbolic expression of a register if it is lazy.
+          void buildLazyRegister(triton::uint32 id) const;
 
           //! Returns the AST corresponding to the shift operation. Mainly used for AArch64 operands.
           triton::ast::SharedAbstractNode getShiftAst(triton::arch::aarch64::shift_e type, triton::uint32 value, const triton::ast::SharedAbstractNode& node);
@@ -187,11 +226,17 @@ namespace triton {
           //! Returns the symbolic expression corresponding to an id.
           TRITON_EXPORT SharedSymbolicExpression getSymbolicExpressionFromId(triton::usize symExprId) const;
 
-          //! Returns the shared symbolic expression corresponding to the memory address.
+          //! Returns the shared symbolic expression corresponding to the memory address. The byte is sliced from its memory range, which is not modified.
           TRITON_EXPORT SharedSymbolicExpression getSymbolicMemory(triton::uint64 addr) const;
 
-          //! Returns the map (addr:expr) of all symbolic memory defined.
-          TRITON_EXPORT const std::map<triton::uint64, SharedSymbolicExpression>& getSymbolicMemory(void) const;
+          //! Returns the map (addr:expr) of all symbolic memory ranges defined.
+          TRITON_EXPORT std::map<triton::uint64, SharedSymbolicExpression> getSymbolicMemory(void) const;
+
+          //! Returns the shared symbolic expression of the memory range containing the address (nullptr if the address is concrete).
+          TRITON_EXPORT SharedSymbolicExpression getSymbolicMemoryRange(triton::uint64 addr) const;
+
+          //! Sets the taint of the memory ranges of `[addr:size]`. The ranges partially covered are split and their slices get their own expression.
+          TRITON_EXPORT void setMemoryRangesTaint(triton::uint64 addr, triton::uint32 size, bool flag);
 
           //! Returns the shared symbolic expression corresponding to the parent register.
           TRITON_EXPORT const SharedSymbolicExpression& getSymbolicRegister(const triton::arch::Register& reg) const;
@@ -247,6 +292,9 @@ namespace triton {
           //! Returns the new shared symbolic flag expression expression and links this expression to the instruction.
           TRITON_EXPORT const SharedSymbolicExpression& createSymbolicFlagExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, const triton::arch::Register& flag, const std::string& comment="");
 
+          //! Assigns a lazy expression to a flag. The AST is built by `builder` on the first read of the flag, `value` is its concrete value.
+          TRITON_EXPORT void createLazySymbolicFlagExpression(const std::function<triton::ast::SharedAbstractNode(void)>& builder, const triton::arch::Register& flag, const triton::uint512& value, bool isTainted, const std::string& comment="");
+
           //! Returns the new shared symbolic volatile expression expression and links this expression to the instruction.
           TRITON_EXPORT const SharedSymbolicExpression& createSymbolicVolatileExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, const std::string& comment="");
 
@@ -309,6 +357,9 @@ namespace triton {
 
           //! Sets the concrete value of a symbolic variable.
           TRITON_EXPORT void setConcreteVariableValue(const SharedSymbolicVariable& symVar, const triton::uint512& value);
+
+          //! Sets the concrete values of several symbolic variables (symbolic variable id -> value).
+          TRITON_EXPORT void setConcreteVariableValues(const std::map<triton::usize, triton::uint512>& values);
       };
 
     /*! @} End of symbolic namespace */
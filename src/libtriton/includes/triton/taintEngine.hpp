@@ -8,13 +8,18 @@
 #ifndef TRITON_TAINTENGINE_H
 #define TRITON_TAINTENGINE_H
 
+#include <map>
 #include <set>
+#include <utility>
+#include <vector>
 
 #include <triton/dllexport.hpp>
 #include <triton/memoryAccess.hpp>
 #include <triton/modes.hpp>
 #include <triton/register.hpp>
+#include <triton/shadowMemory.hpp>
 #include <triton/symbolicEngine.hpp>
+#include <triton/taintLabels.hpp>
 #include <triton/tritonTypes.hpp>
 
 
@@ -65,11 +70,17 @@ namespace triton {
           //! Defines if the taint engine is enabled or disabled.
           bool enableFlag;
 
-          //! The set of tainted addresses.
-          std::set<triton::uint64> taintedMemory;
+          //! The bitmap of tainted addresses.
+          triton::engines::taint::ShadowMemory taintedMemory;
 
-          //! The set of tainted registers. Currently it is an over approximation of the taint.
-          std::set<triton::arch::register_e> taintedRegisters;
+          //! The mask of the tainted bytes of each parent register, indexed by register id (a 512-bit register has 64 bytes).
+          std::vector<triton::uint64> taintedRegisters;
+
+          //! The table of the label sets (see TAINT_LABELS).
+          triton::engines::taint::TaintLabels labels;
+
+          //! Map of tainted parent register -> id of its label set. Registers without labels are not in the map.
+          std::map<triton::arch::register_e, triton::uint32> registerLabels;
 
         public:
           //! Constructor.
@@ -84,12 +95,21 @@ namespace triton {
           //! Enables or disables the taint engine.
           TRITON_EXPORT void enable(bool flag);
 
-          //! Returns the tainted addresses.
-          TRITON_EXPORT const std::set<triton::uint64>& getTaintedMemory(void) const;
+          //! Returns the tainted addresses. The set is built from the bitmap, see getTaintedMemoryRanges() for large taints.
+          TRITON_EXPORT std::set<triton::uint64> getTaintedMemory(void) const;
+
+          //! Returns the tainted memory ranges as (base address, size), sorted by address.
+          TRITON_EXPORT std::vector<std::pair<triton::uint64, triton::usize>> getTaintedMemoryRanges(void) const;
 
           //! Returns the tainted registers.
           TRITON_EXPORT std::set<const triton::arch::Register*> getTaintedRegisters(void) const;
 
+          //! Returns the sorted labels which reach a memory.
+          TRITON_EXPORT std::vector<triton::uint32> getMemoryTaintLabels(const triton::arch::MemoryAccess& mem) const;
+
+          //! Returns the sorted labels which reach a register.
+          TRITON_EXPORT std::vector<triton::uint32> getRegisterTaintLabels(const triton::arch::Register& reg) const;
+
           //! Returns true if the taint engine is enabled.
           TRITON_EXPORT bool isEnabled(void) const;
 
@@ -120,15 +140,27 @@ namespace triton {
           //! Taints a memory. Returns TAINTED if the memory has been tainted correctly. Otherwise it returns the last defined state.
           TRITON_EXPORT bool taintMemory(const triton::arch::MemoryAccess& mem);
 
+          //! Taints the memory range `[baseAddr:size]`. Returns TAINTED if the range has been tainted correctly. Otherwise it returns the last defined state.
+          TRITON_EXPORT bool taintMemoryRange(triton::uint64 baseAddr, triton::usize size);
+
+          //! Taints a memory and, if TAINT_LABELS is enabled, adds a label to its bytes. Returns TAINTED if the memory has been tainted correctly. Otherwise it returns the last defined state.
+          TRITON_EXPORT bool taintMemoryWithLabel(const triton::arch::MemoryAccess& mem, triton::uint32 label);
+
           //! Taints a register. Returns TAINTED if the register has been tainted correctly. Otherwise it returns the last defined state.
           TRITON_EXPORT bool taintRegister(const triton::arch::Register& reg);
 
+          //! Taints a register and, if TAINT_LABELS is enabled, adds a label to it. Returns TAINTED if the register has been tainted correctly. Otherwise it returns the last defined state.
+          TRITON_EXPORT bool taintRegisterWithLabel(const triton::arch::Register& reg, triton::uint32 label);
+
           //! Untaints an address. Returns !TAINTED if the address has been untainted correctly. Otherwise it returns the last defined state.
           TRITON_EXPORT bool untaintMemory(triton::uint64 addr);
 
           //! Untaints a memory. Returns !TAINTED if the memory has been untainted correctly. Otherwise it returns the last defined state.
           TRITON_EXPORT bool untaintMemory(const triton::arch::MemoryAccess& mem);
 
+          //! Untaints the memory range `[baseAddr:size]`. Returns !TAINTED if the range has been untainted correctly. Otherwise it returns the last defined state.
+          TRITON_EXPORT bool untaintMemoryRange(triton::uint64 baseAddr, triton::usize size);
+
           //! Untaints a register. Returns !TAINTED if the register has been untainted correctly. Otherwise it returns the last defined state.
           TRITON_EXPORT bool untaintRegister(const triton::arch::Register& reg);
 
@@ -175,6 +207,27 @@ namespace triton {
           TRITON_EXPORT bool taintAssignmentRegisterRegister(const triton::arch::Register& regDst, const triton::arch::Register& regSrc);
 
         private:
+          //! Sets the taint of the bytes written by an assignment to a register. Dword and larger writes clear the rest of the parent register.
+          void assignRegisterTaint(const triton::arch::Register& reg, bool flag);
+
+          //! Returns true if the label sets must be spread.
+          bool isLabelTrackingEnabled(void) const;
+
+          //! Returns the id of the label set of a register.
+          triton::uint32 getRegisterLabelSet(const triton::arch::Register& reg) const;
+
+          //! Sets the id of the label set of a register.
+          void setRegisterLabelSet(const triton::arch::Register& reg, triton::uint32 set);
+
+          //! Returns the id of the union of the label sets of the base, index and segment registers if TAINT_THROUGH_POINTERS is enabled. Otherwise returns the empty set.
+          triton::uint32 getPointerLabelSet(const triton::arch::MemoryAccess& mem);
+
+          //! Returns the id of the union of the label sets of the bytes of a memory and of its pointer registers.
+          triton::uint32 getMemoryLabelSet(const triton::arch::MemoryAccess& mem);
+
+          //! Joins a label set to each byte of the range `[addr:size]`.
+          void joinMemoryLabelSet(triton::uint64 addr, triton::usize size, triton::uint32 set);
+
           //! Spreads MemoryImmediate with union.
           bool unionMemoryImmediate(const triton::arch::MemoryAccess& memDst);
 
@@ -0,0 +1,95 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_TAINTLABELS_H
+#define TRITON_TAINTLABELS_H
+
+#include <unordered_map>
+#include <vector>
+
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Taint namespace
+    namespace taint {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup taint
+     *  @{
+     */
+
+      /*! \class TaintLabels
+       *  \brief The table of the label sets of the taint.
+       *
+       *  \details Each set of labels is interned once and referred to by a 32-bit id, the id 0 being
+       *  the empty set. So a tainted byte or register only keeps the id of its set, two sets are equal
+       *  iff their ids are equal, and the union of two sets is computed once and then memoized.
+       */
+      class TaintLabels {
+        private:
+          //! The hash of a set of labels.
+          struct Hash {
+            triton::usize operator()(const std::vector<triton::uint32>& labels) const;
+          };
+
+          //! The sorted labels of each set, indexed by id.
+          std::vector<std::vector<triton::uint32>> sets;
+
+          //! Map of labels -> id of the set.
+          std::unordered_map<std::vector<triton::uint32>, triton::uint32, Hash> ids;
+
+          //! The memoized unions, map of (smallest id << 32 | biggest id) -> id of the union.
+          std::unordered_map<triton::uint64, triton::uint32> unions;
+
+          //! Returns the id of a sorted set of labels, interns it if needed.
+          triton::uint32 intern(const std::vector<triton::uint32>& labels);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT TaintLabels();
+
+          //! Returns the id of the set made of a single label.
+          TRITON_EXPORT triton::uint32 getSet(triton::uint32 label);
+
+          //! Returns the id of the union of two sets.
+          TRITON_EXPORT triton::uint32 join(triton::uint32 set1, triton::uint32 set2);
+
+          //! Returns the sorted labels of a set.
+          TRITON_EXPORT const std::vector<triton::uint32>& getLabels(triton::uint32 set) const;
+
+          //! Returns the number of sets interned, the empty set included.
+          TRITON_EXPORT triton::usize getNumberOfSets(void) const;
+
+          //! Clears the table, only the empty set is left.
+          TRITON_EXPORT void clear(void);
+      };
+
+    /*! @} End of taint namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TAINTLABELS_H */
@@ -39,6 +39,26 @@ namespace triton {
         //! This flag define if the conversion is used to evaluated a node or not.
         bool isEval;
 
+        //! A symbolic expression converted by a previous call.
+        struct ConvertedReference {
+          //! The AST of the expression when it was converted.
+          triton::ast::SharedAbstractNode ast;
+
+          //! The hash of the AST when it was converted.
+          triton::uint64 hash;
+
+          //! The z3's expression of the AST.
+          z3::expr expr;
+        };
+
+        /*! \brief The symbolic expressions already converted, kept across calls when the conversion is not used to evaluate a node.
+         *
+         * \details
+         * **item1**: symbolic expression id<br>
+         * **item2**: converted expression
+         */
+        std::unordered_map<triton::usize, ConvertedReference> references;
+
         //! Returns the integer of the z3 expression (expr must be an int).
         triton::__uint getUintValue(const z3::expr& expr);
 
@@ -62,8 +82,14 @@ namespace triton {
         //! Constructor.
         TRITON_EXPORT TritonToZ3Ast(bool eval=true);
 
-        //! Converts to Z3's AST
+        //! Converts to Z3's AST. Each shared sub-AST is converted once per call and the symbolic expressions once per instance.
         TRITON_EXPORT z3::expr convert(const triton::ast::SharedAbstractNode& node);
+
+        //! Returns the z3's context used for the conversion.
+        TRITON_EXPORT z3::context& getContext(void);
+
+        //! Clears the symbolic expressions already converted.
+        TRITON_EXPORT void clearCache(void);
     };
 
   /*! @} End of ast namespace */
@@ -0,0 +1,144 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_X86CONCRETESEMANTICS_H
+#define TRITON_X86CONCRETESEMANTICS_H
+
+#include <triton/architecture.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/instruction.hpp>
+#include <triton/modes.hpp>
+#include <triton/semanticsInterface.hpp>
+#include <triton/symbolicEngine.hpp>
+#include <triton/taintEngine.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    //! The x86 namespace
+    namespace x86 {
+    /*!
+     *  \ingroup arch
+     *  \addtogroup x86
+     *  @{
+     */
+
+      /*! \class x86ConcreteSemantics
+          \brief The native x86 interpreter of the fully concrete instructions (see the CONCRETE_FAST_PATH mode).
+
+          \details With ONLY_ON_SYMBOLIZED or ONLY_ON_TAINTED, the expressions of an instruction whose operands are
+          neither symbolized nor tainted are removed right after being built. So the supported instructions are executed
+          natively instead: the registers, the memory and the flags are updated with the same values as x86Semantics
+          and the locations written are concretized, as they would be once their expressions are removed.
+          The taint-only fast path (see x86TaintSemantics) also executes its instructions through execute(). */
+      class x86ConcreteSemantics : public SemanticsInterface {
+        private:
+          //! Architecture API
+          triton::arch::Architecture* architecture;
+
+          //! Symbolic Engine API
+          triton::engines::symbolic::SymbolicEngine* symbolicEngine;
+
+          //! Taint Engine API
+          triton::engines::taint::TaintEngine* taintEngine;
+
+          //! The Modes API
+          triton::modes::Modes& modes;
+
+          //! True if the locations written are concretized.
+          bool concretize;
+
+          //! Returns true if the register is neither tainted nor symbolized (with ONLY_ON_SYMBOLIZED).
+          bool isConcrete(const triton::arch::Register& reg);
+
+          //! Returns true if the memory is neither tainted nor symbolized (with ONLY_ON_SYMBOLIZED).
+          bool isConcrete(const triton::arch::MemoryAccess& mem);
+
+          //! Returns true if all the locations read or written by the instruction are concrete.
+          bool isConcrete(const triton::arch::Instruction& inst);
+
+          //! Returns true if the condition of a conditional jump is true.
+          bool isConditionTaken(const triton::arch::Instruction& inst) const;
+
+          //! Returns the concrete value of an operand.
+          triton::uint64 read(const triton::arch::OperandWrapper& op) const;
+
+          //! Returns true if the instruction can be executed natively. Sets branch if it assigns the program counter.
+          bool isExecutable(const triton::arch::Instruction& inst, bool& branch) const;
+
+          //! Writes an operand and concretizes it.
+          void write(const triton::arch::OperandWrapper& op, triton::uint64 value);
+
+          //! Writes a register through its parent, as the symbolic engine does, and concretizes it.
+          void writeRegister(const triton::arch::Register& reg, triton::uint64 value);
+
+          //! Writes a flag and concretizes it.
+          void writeFlag(triton::arch::register_e flag, bool value);
+
+          //! Tags a flag as undefined.
+          void undefined(triton::arch::Instruction& inst, triton::arch::register_e flag);
+
+          //! Adds a delta to the stack pointer. Returns the new stack value.
+          triton::uint64 alignStack(triton::uint64 delta, bool sub);
+
+          //! Sets the flags of an addition.
+          void addFlags(triton::uint32 bitSize, triton::uint64 op1, triton::uint64 op2, triton::uint64 res, bool cf);
+
+          //! Sets the flags of a subtraction.
+          void subFlags(triton::uint32 bitSize, triton::uint64 op1, triton::uint64 op2, triton::uint64 res, bool cf);
+
+          //! Sets the PF, SF and ZF flags of a result.
+          void resultFlags(triton::uint32 bitSize, triton::uint64 res);
+
+          //! Sets the flags of a logical operation.
+          void logicFlags(triton::arch::Instruction& inst, triton::uint32 bitSize, triton::uint64 res);
+
+          //! Sets the program counter to the next instruction.
+          void controlFlow(const triton::arch::Instruction& inst);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT x86ConcreteSemantics(triton::arch::Architecture* architecture,
+                                             triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                                             triton::engines::taint::TaintEngine* taintEngine,
+                                             triton::modes::Modes& modes);
+
+          //! Returns true if the instruction can be executed natively once its operands are concrete.
+          TRITON_EXPORT bool isSupported(const triton::arch::Instruction& inst) const;
+
+          //! Returns true if the instruction can be executed natively, whatever the modes and its operands.
+          TRITON_EXPORT bool isExecutable(const triton::arch::Instruction& inst) const;
+
+          //! Executes the instruction natively, its memory operands must be initialized. The locations written are concretized if `concretize` is true.
+          TRITON_EXPORT void execute(triton::arch::Instruction& inst, bool concretize);
+
+          //! Executes the instruction natively. Returns false, without side effect, if it is not supported or not concrete.
+          TRITON_EXPORT bool buildSemantics(triton::arch::Instruction& inst);
+      };
+
+    /*! @} End of x86 namespace */
+    };
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_X86CONCRETESEMANTICS_H */
@@ -78,6 +78,13 @@ namespace triton {
           //! Aligns the stack (sub). Returns the new stack value.
           triton::uint64 alignSubStack_s(triton::arch::Instruction& inst, triton::uint32 delta);
 
+          //! Creates the symbolic expression of a flag. With LAZY_FLAGS, `semantics` is only called when the flag is read and `value` returns its concrete value.
+          template <typename S, typename V>
+          void flag_s(triton::arch::Instruction& inst, const triton::arch::Register& flag, const S& semantics, const V& value, bool isTainted, const std::string& comment);
+
+          //! Returns the concrete value of the bits `[high:low]` of an expression.
+          triton::uint512 extractValue(const triton::engines::symbolic::SharedSymbolicExpression& expr, triton::uint32 high, triton::uint32 low) const;
+
           //! Clears a flag.
           void clearFlag_s(triton::arch::Instruction& inst, const triton::arch::Register& flag, std::string comment="");
 
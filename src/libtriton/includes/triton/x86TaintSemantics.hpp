@@ -0,0 +1,156 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_X86TAINTSEMANTICS_H
+#define TRITON_X86TAINTSEMANTICS_H
+
+#include <vector>
+
+#include <triton/architecture.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/instruction.hpp>
+#include <triton/semanticsInterface.hpp>
+#include <triton/taintEngine.hpp>
+#include <triton/x86ConcreteSemantics.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    //! The x86 namespace
+    namespace x86 {
+    /*!
+     *  \ingroup arch
+     *  \addtogroup x86
+     *  @{
+     */
+
+      /*! \class x86TaintSemantics
+          \brief The taint-only x86 semantics (see the TAINT_FAST_PATH mode).
+
+          \details The taint of the supported instructions is spread from a transfer table indexed by the
+          instruction type, straight from the decoded operands. No AST is built. The taint engine is called in
+          the same order as in x86Semantics, so the taint is the same. As the taint engine must be enabled, the
+          flags and the program counter never add to the taint of the instruction. The instruction is then executed
+          by x86ConcreteSemantics, so the registers, the memory and the flags get the same values as with x86Semantics.
+          Like with x86Semantics once the symbolic engine is disabled, the load and store accesses and the registers
+          read and written are not recorded on the instruction. */
+      class x86TaintSemantics : public SemanticsInterface {
+        private:
+          //! The kinds of transfer.
+          enum transfer_e {
+            TRANSFER_INVALID = 0, //!< Not supported, the full semantics must be built.
+            TRANSFER_ASSIGN,      //!< dst = src
+            TRANSFER_BRANCH,      //!< pc = flags (Jcc)
+            TRANSFER_CALL,        //!< [sp] = imm, pc = src
+            TRANSFER_COMPARE,     //!< flags = dst | src, nothing is written
+            TRANSFER_JUMP,        //!< pc = src
+            TRANSFER_LEA,         //!< dst = base | index
+            TRANSFER_NOP,         //!< nothing is written
+            TRANSFER_POP,         //!< dst = [sp]
+            TRANSFER_PUSH,        //!< [sp] = src
+            TRANSFER_RET,         //!< pc = [sp]
+            TRANSFER_SELF,        //!< dst = dst | dst
+            TRANSFER_UNION,       //!< dst = dst | src
+            TRANSFER_UNION_CF,    //!< dst = dst | src | cf
+            TRANSFER_XCHG,        //!< dst = src, src = dst
+          };
+
+          //! The effects on a flag.
+          enum flag_e {
+            FLAG_KEEP = 0,        //!< The flag is not written.
+            FLAG_RESULT,          //!< The flag gets the taint of the result.
+            FLAG_CLEAR,           //!< The flag is cleared.
+            FLAG_UNDEFINED,       //!< The flag is undefined.
+          };
+
+          //! The number of flags of a transfer.
+          static const triton::uint32 NUMBER_OF_FLAGS = 6;
+
+          //! An entry of the transfer table.
+          struct Transfer {
+            //! The kind of transfer.
+            transfer_e kind;
+
+            //! The number of explicit operands.
+            triton::uint32 operands;
+
+            //! The effects on AF, CF, OF, PF, SF and ZF.
+            flag_e flags[NUMBER_OF_FLAGS];
+
+            //! The flags read by a conditional jump, ID_REG_INVALID if unused.
+            triton::arch::register_e conditions[3];
+          };
+
+          //! Architecture API
+          triton::arch::Architecture* architecture;
+
+          //! Taint Engine API
+          triton::engines::taint::TaintEngine* taintEngine;
+
+          //! The native interpreter which updates the concrete state.
+          triton::arch::x86::x86ConcreteSemantics* concreteIsa;
+
+          //! The transfer table indexed by instruction type.
+          std::vector<Transfer> table;
+
+          //! Adds an entry to the transfer table.
+          void addTransfer(triton::uint32 type, transfer_e kind, triton::uint32 operands, const char* flags="------",
+                           triton::arch::register_e c1=ID_REG_INVALID, triton::arch::register_e c2=ID_REG_INVALID, triton::arch::register_e c3=ID_REG_INVALID);
+
+          //! Initializes the transfer table.
+          void initTable(void);
+
+          //! Initializes the address of a memory operand from the concrete registers.
+          void initAddress(triton::arch::MemoryAccess& mem) const;
+
+          //! Returns true if the condition of a conditional jump is true.
+          bool isConditionTaken(const triton::arch::Instruction& inst) const;
+
+          //! Spreads the taint of the result to the flags.
+          void spreadFlags(triton::arch::Instruction& inst, const Transfer& transfer, bool result);
+
+          //! Untaints the program counter of a sequential instruction.
+          void controlFlow(void);
+
+          //! Aligns the stack. Returns the taint of the stack pointer.
+          bool alignStack(void);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT x86TaintSemantics(triton::arch::Architecture* architecture,
+                                          triton::engines::taint::TaintEngine* taintEngine,
+                                          triton::arch::x86::x86ConcreteSemantics* concreteIsa);
+
+          //! Returns true if the taint of the instruction can be spread from the transfer table and the instruction executed natively.
+          TRITON_EXPORT bool isSupported(const triton::arch::Instruction& inst) const;
+
+          //! Spreads the taint of the instruction. Returns false if the instruction is not supported.
+          TRITON_EXPORT bool buildSemantics(triton::arch::Instruction& inst);
+      };
+
+    /*! @} End of x86 namespace */
+    };
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_X86TAINTSEMANTICS_H */
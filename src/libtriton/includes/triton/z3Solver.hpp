@@ -10,12 +10,18 @@
 
 #include <list>
 #include <map>
+#include <memory>
 #include <string>
+#include <vector>
+#include <z3++.h>
 
 #include <triton/ast.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/solverEnums.hpp>
 #include <triton/solverInterface.hpp>
 #include <triton/solverModel.hpp>
+#include <triton/solverQueryStats.hpp>
+#include <triton/tritonToZ3Ast.hpp>
 #include <triton/tritonTypes.hpp>
 
 
@@ -44,6 +50,28 @@ namespace triton {
       //! \class Z3Solver
       /*! \brief Solver engine using z3. */
       class Z3Solver : public SolverInterface {
+        private:
+          //! The converter of the incremental session. It owns the z3's context and caches the converted symbolic expressions until the next pop() or resetSession().
+          std::unique_ptr<triton::ast::TritonToZ3Ast> sessionAst;
+
+          //! The z3's solver of the incremental session. Must be released before its context.
+          std::unique_ptr<z3::solver> session;
+
+          //! Initializes the incremental session if it is not.
+          void initSession(void);
+
+          //! Returns the root of a logical constraint given to the solver.
+          static const triton::ast::SharedAbstractNode& getConstraint(const triton::ast::SharedAbstractNode& node, const char* where);
+
+          //! Returns the Triton's model from a z3's model. If `args` is not null, it is filled with the negation of the model.
+          static std::map<triton::uint32, SolverModel> extractModel(const z3::model& m, triton::ast::TritonToZ3Ast& z3Ast, z3::expr_vector* args);
+
+          //! Sets the time (ms) and memory (MB) limits of a z3's solver, 0 means no limit.
+          static void setLimits(z3::solver& solver, triton::uint32 timeout, triton::uint32 memoryLimit);
+
+          //! Returns the status of a z3's check.
+          static triton::engines::solver::status_e getStatus(z3::solver& solver, z3::check_result result);
+
         public:
           //! Constructor.
           TRITON_EXPORT Z3Solver();
@@ -69,6 +97,17 @@ namespace triton {
           //! Returns true if an expression is satisfiable.
           TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node) const;
 
+          //! Checks a symbolic constraint and computes at most `limit` models (0 means only the satisfiability) within the time (ms) and memory (MB) limits.
+          TRITON_EXPORT std::list<std::map<triton::uint32, SolverModel>> solve(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::uint32 timeout, triton::uint32 memoryLimit, SolverQueryStats& stats) const;
+
+          //! Computes a model for each constraint of `nodes` on a pool of `workers` threads (0 means one per core). `timeout` (ms) and `memoryLimit` (MB) are the limits of each query (0 means no limit).
+          /*!
+           * \details Each worker converts and solves its queries on its own z3's context. The Triton's ASTs
+           * are only read during the conversion, so they must not be modified until the call returns.
+           * Results and `stats` are in the same order as `nodes`, an empty model means UNSAT, timeout or out of memory.
+           */
+          TRITON_EXPORT std::vector<std::map<triton::uint32, SolverModel>> getBatchModels(const std::vector<triton::ast::SharedAbstractNode>& nodes, triton::uint32 workers, triton::uint32 timeout, triton::uint32 memoryLimit, std::vector<SolverQueryStats>& stats) const;
+
           //! Converts a Triton's AST to a Z3's AST, perform a Z3 simplification and returns a Triton's AST.
           TRITON_EXPORT triton::ast::SharedAbstractNode simplify(const triton::ast::SharedAbstractNode& node) const;
 
@@ -77,6 +116,24 @@ namespace triton {
 
           //! Returns the name of this solver.
           TRITON_EXPORT std::string getName(void) const;
+
+          //! Creates a new scope in the incremental session.
+          TRITON_EXPORT void push(void);
+
+          //! Removes the last scope of the incremental session and its constraints.
+          TRITON_EXPORT void pop(void);
+
+          //! Adds a constraint to the current scope of the incremental session.
+          TRITON_EXPORT void addConstraint(const triton::ast::SharedAbstractNode& node);
+
+          //! Removes all scopes and constraints of the incremental session and releases its z3's context.
+          TRITON_EXPORT void resetSession(void);
+
+          //! Computes and returns a model from a symbolic constraint and the constraints of the incremental session.
+          TRITON_EXPORT std::map<triton::uint32, SolverModel> getSessionModel(const triton::ast::SharedAbstractNode& node);
+
+          //! Returns true if an expression is satisfiable with the constraints of the incremental session.
+          TRITON_EXPORT bool isSessionSat(const triton::ast::SharedAbstractNode& node);
       };
 
     /*! @} End of solver namespace */
@@ -828,3 +828,100 @@ class TestAstEval(unittest.TestCase):
         self.Triton.setConcreteVariableValue(self.sv1, 10)
         trv = final_node.evaluate()
         self.assertEqual(trv, 12)
+
+    def test_batch_update(self):
+        """Check evaluation of nodes after a batch variable update."""
+        sv1 = self.Triton.newSymbolicVariable(8)
+        sv2 = self.Triton.newSymbolicVariable(8)
+        v1 = self.astCtxt.variable(sv1)
+        v2 = self.astCtxt.variable(sv2)
+        expr = self.Triton.newSymbolicExpression(self.astCtxt.bvmul(v1, v2))
+        final_node = self.astCtxt.bvadd(self.astCtxt.reference(expr), self.astCtxt.bvsub(v1, v2))
+
+        self.Triton.setConcreteVariableValues({sv1: 10, sv2.getId(): 3})
+        self.assertEqual(self.Triton.getConcreteVariableValue(sv1), 10)
+        self.assertEqual(self.Triton.getConcreteVariableValue(sv2), 3)
+        self.assertEqual(final_node.evaluate(), 37)
+
+        self.Triton.setConcreteVariableValues({sv2: 200})
+        self.assertEqual(final_node.evaluate(), (10 * 200 + 10 - 200) & 0xff)
+
+        with self.assertRaises(TypeError):
+            self.Triton.setConcreteVariableValues({sv2.getId() + 1: 0})
+
+    def test_assignment(self):
+        """Check evaluation with an explicit assignment of the variables."""
+        a = self.astCtxt
+        ops2 = [a.bvadd, a.bvand, a.bvashr, a.bvlshr, a.bvmul, a.bvnand, a.bvnor, a.bvor, a.bvsdiv, a.bvshl, a.bvsmod, a.bvsrem, a.bvsub,
+                a.bvudiv, a.bvurem, a.bvxnor, a.bvxor, a.bvsge, a.bvsgt, a.bvsle, a.bvslt, a.bvuge, a.bvugt, a.bvule, a.bvult, a.distinct, a.equal]
+
+        for size in [8, 32, 64, 128]:
+            sx = self.Triton.newSymbolicVariable(size)
+            sy = self.Triton.newSymbolicVariable(size)
+            x = a.variable(sx)
+            y = a.variable(sy)
+            mask = (1 << size) - 1
+
+            nodes = [op(x, y) for op in ops2]
+            nodes += [a.bvneg(x), a.bvnot(x), a.bvrol(x, a.bv(3, size)), a.bvror(x, a.bv(5, size)), a.sx(8, x), a.zx(8, x), a.extract(size - 1, 1, x), a.concat([x, y])]
+            nodes += [a.ite(a.bvult(x, y), x, y), a.lnot(a.equal(x, y)), a.land([a.bvult(x, y), a.distinct(x, y)]), a.lor([a.equal(x, y), a.bvugt(x, y)])]
+            nodes += [a.iff(a.bvult(x, y), a.bvugt(y, x)), a.reference(self.Triton.newSymbolicExpression(a.bvadd(x, a.bv(1, size))))]
+
+            values = [(0, 0), (1, 0), (mask, 1), (mask, mask), (mask >> 1, 3), (1 << (size - 1), size - 1), (0x12345, size + 1), (3, mask - 2)]
+            for vx, vy in values:
+                for node in nodes:
+                    trv = node.evaluate({sx: vx, sy.getId(): vy})
+                    # The concrete values are not modified
+                    self.assertEqual(self.Triton.getConcreteVariableValue(sx), 0)
+                    self.assertEqual(node.evaluate({}), node.evaluate())
+                    self.Triton.setConcreteVariableValues({sx: vx & mask, sy: vy & mask})
+                    self.assertEqual(trv, node.evaluate())
+                    self.assertEqual(trv, self.Triton.evaluateAstViaZ3(node))
+                    self.Triton.setConcreteVariableValues({sx: 0, sy: 0})
+
+        # Variables which are not assigned keep their concrete value
+        self.Triton.setConcreteVariableValue(sy, 7)
+        self.assertEqual(a.bvadd(x, y).evaluate({sx: 1}), 8)
+
+        # Neither the AST nor its context is modified
+        node = a.bvmul(a.bvadd(x, y), y)
+        parents = len(x.getParents())
+        self.assertEqual(node.evaluate({sx: 3}), 70)
+        self.assertEqual(len(x.getParents()), parents)
+        self.assertEqual(node.evaluate(), 49)
+        self.assertEqual(self.Triton.getConcreteVariableValue(sx), 0)
+
+        with self.assertRaises(TypeError):
+            x.evaluate({"x": 1})
+
+    def test_trace_mutation(self):
+        """Check the re-evaluation of a long trace after the update of one input."""
+        prime = 0x100000001b3
+        mask = (1 << 64) - 1
+
+        vars = [self.Triton.newSymbolicVariable(8) for i in range(16)]
+        inputs = [self.astCtxt.variable(v) for v in vars]
+        values = [(i * 7 + 1) & 0xff for i in range(16)]
+        self.Triton.setConcreteVariableValues({v: values[i] for i, v in enumerate(vars)})
+
+        # s = ((s ^ b) * prime) + (s >> 7), every step reads the previous one twice
+        steps = 2000
+        expr = self.Triton.newSymbolicExpression(self.astCtxt.bv(0xcbf29ce484222325, 64))
+        for i in range(steps):
+            s = self.astCtxt.reference(expr)
+            b = self.astCtxt.zx(56, inputs[i % 16])
+            node = self.astCtxt.bvadd(self.astCtxt.bvmul(self.astCtxt.bvxor(s, b), self.astCtxt.bv(prime, 64)), self.astCtxt.bvlshr(s, self.astCtxt.bv(7, 64)))
+            expr = self.Triton.newSymbolicExpression(node)
+
+        def native():
+            s = 0xcbf29ce484222325
+            for i in range(steps):
+                s = (((s ^ values[i % 16]) * prime) + (s >> 7)) & mask
+            return s
+
+        self.assertEqual(expr.getAst().evaluate(), native())
+        for i in range(32):
+            index = i % 16
+            values[index] = (values[index] * 13 + 5) & 0xff
+            self.Triton.setConcreteVariableValue(vars[index], values[index])
+            self.assertEqual(expr.getAst().evaluate(), native())
@@ -402,6 +402,16 @@ class TestAstSimplification4(unittest.TestCase):
         n = self.ast.bvashr(b, a)
         self.assertTrue(self.proof(n == 0))
 
+    def test_same_tree(self):
+        # The values and the hashes of the operands may be the same, the trees are compared
+        a = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        c = self.ast.variable(self.ctx.newSymbolicVariable(1))
+        b = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        self.assertEqual(self.ast.bvor(a, b).getType(), AST_NODE.BVOR)
+        self.assertEqual(self.ast.bvsub(a, b).getType(), AST_NODE.BVSUB)
+        self.assertEqual(self.ast.bvxor(a, b).getType(), AST_NODE.BVXOR)
+        self.assertTrue(self.proof(self.ast.bvxor(self.ast.bvnot(a), self.ast.bvnot(a)) == 0))
+
     def test_lshr1(self):
         a = self.ast.variable(self.ctx.newSymbolicVariable(32))
         b = self.ast.bv(0, 32)
@@ -524,3 +534,260 @@ class TestAstSimplification4(unittest.TestCase):
         a = self.ast.variable(self.ctx.newSymbolicVariable(32))
         n = self.ast.bvxor(a, a)
         self.assertTrue(self.proof(n == 0))
+
+
+class TestAstSimplification5(unittest.TestCase):
+
+    """Testing the constant folding"""
+
+    def setUp(self):
+        self.ctx = TritonContext()
+        self.ctx.setArchitecture(ARCH.X86)
+        self.ctx.enableMode(MODE.AST_CONSTANT_FOLDING, True)
+        self.ast = self.ctx.getAstContext()
+
+    def test_arithmetic(self):
+        n = self.ast.bvadd(self.ast.bv(1, 32), self.ast.bvmul(self.ast.bv(3, 32), self.ast.bv(5, 32)))
+        self.assertEqual(n.getType(), AST_NODE.BV)
+        self.assertEqual(n.evaluate(), 16)
+        self.assertEqual(n.getBitvectorSize(), 32)
+
+    def test_bitvector(self):
+        a = self.ast.bv(0x12345678, 32)
+        n = self.ast.concat([self.ast.extract(7, 0, a), self.ast.zx(8, self.ast.bvnot(self.ast.bv(0, 8)))])
+        self.assertEqual(n.getType(), AST_NODE.BV)
+        self.assertEqual(n.evaluate(), 0x7800ff)
+        self.assertEqual(n.getBitvectorSize(), 24)
+
+    def test_ite(self):
+        c = self.ast.equal(self.ast.bv(1, 8), self.ast.bv(1, 8))
+        n = self.ast.ite(c, self.ast.bv(0x10, 8), self.ast.bv(0x20, 8))
+        self.assertEqual(c.getType(), AST_NODE.EQUAL)
+        self.assertEqual(n.getType(), AST_NODE.BV)
+        self.assertEqual(n.evaluate(), 0x10)
+
+    def test_symbolized(self):
+        a = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        n = self.ast.bvadd(a, self.ast.bvsub(self.ast.bv(3, 32), self.ast.bv(1, 32)))
+        self.assertEqual(n.getType(), AST_NODE.BVADD)
+        self.assertEqual(n.getChildren()[1].getType(), AST_NODE.BV)
+        self.assertEqual(n.getChildren()[1].evaluate(), 2)
+
+    def test_shared_constants(self):
+        var = self.ctx.newSymbolicVariable(32)
+        a = self.ast.variable(var)
+        one = self.ast.bv(1, 32)
+        nodes = [self.ast.bvadd(a, self.ast.bv(1, 32)) for _ in range(100)]
+        self.assertTrue(all(n.getChildren()[1].equalTo(one) for n in nodes))
+
+        # The shared constants do not record their parents and are immutable
+        self.assertEqual(len(one.getParents()), 0)
+        self.assertEqual(len(a.getParents()), 100)
+        with self.assertRaises(TypeError):
+            one.setChild(0, self.ast.bv(2, 32))
+
+        # The value of the variable is still spread
+        self.ctx.setConcreteVariableValue(var, 5)
+        self.assertTrue(all(n.evaluate() == 6 for n in nodes))
+
+    def test_disabled(self):
+        self.ctx.enableMode(MODE.AST_CONSTANT_FOLDING, False)
+        n = self.ast.bvadd(self.ast.bv(1, 32), self.ast.bv(2, 32))
+        self.assertEqual(n.getType(), AST_NODE.BVADD)
+        self.assertEqual(n.evaluate(), 3)
+
+
+class TestAstSimplification6(unittest.TestCase):
+
+    """Testing AST simplification of interned nodes"""
+
+    def setUp(self):
+        self.ctx = TritonContext()
+        self.ctx.setArchitecture(ARCH.X86_64)
+        self.ctx.enableMode(MODE.AST_HASH_CONSING, True)
+        self.ctx.addCallback(TestAstSimplification1.xor_1, CALLBACK.SYMBOLIC_SIMPLIFICATION)
+        self.ast = self.ctx.getAstContext()
+
+    def test_shared_nodes(self):
+        x = self.ast.variable(self.ctx.newSymbolicVariable(8))
+        y = self.ast.variable(self.ctx.newSymbolicVariable(8))
+
+        n1 = self.ast.bvadd(self.ast.bvxor(x, x), y)
+        n2 = self.ast.bvadd(self.ast.bvxor(x, x), y)
+        self.assertEqual(n1.getChildren()[0].getHash(), n2.getChildren()[0].getHash())
+        self.assertEqual(len(n1.getChildren()[0].getParents()), 1)
+
+        # Interned nodes are copied, not modified
+        s = self.ctx.simplify(n1)
+        self.assertEqual(str(s), "(bvadd (_ bv0 8) SymVar_1)")
+        self.assertEqual(str(n1), "(bvadd (bvxor SymVar_0 SymVar_0) SymVar_1)")
+        self.assertEqual(str(n2), "(bvadd (bvxor SymVar_0 SymVar_0) SymVar_1)")
+
+        with self.assertRaises(TypeError):
+            n1.setChild(0, y)
+
+    def test_not_shared_nodes(self):
+        self.ctx.enableMode(MODE.AST_HASH_CONSING, False)
+        x = self.ast.variable(self.ctx.newSymbolicVariable(8))
+        y = self.ast.variable(self.ctx.newSymbolicVariable(8))
+
+        n1 = self.ast.bvadd(self.ast.bvxor(x, x), y)
+        n1.setChild(1, x)
+        self.assertEqual(str(n1), "(bvadd (bvxor SymVar_0 SymVar_0) SymVar_0)")
+
+        # Nodes which are not interned are still simplified in place
+        s = self.ctx.simplify(n1)
+        self.assertEqual(str(s), "(bvadd (_ bv0 8) SymVar_0)")
+        self.assertEqual(str(n1), "(bvadd (_ bv0 8) SymVar_0)")
+        self.assertEqual(s.evaluate(), 0)
+
+
+class TestAstIdiomRewriting(unittest.TestCase):
+
+    """Testing the rewriting of the lifting idioms"""
+
+    def setUp(self):
+        self.ctx = TritonContext()
+        self.ctx.setArchitecture(ARCH.X86)
+        self.ast = self.ctx.getAstContext()
+        self.ctx.enableMode(MODE.AST_IDIOM_REWRITING, True)
+
+    def proof(self, n):
+        if self.ctx.isSat(self.ast.lnot(n)) == True:
+            return False
+        return True
+
+    def test_concat1(self):
+        a = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        n = self.ast.concat([self.ast.extract(31, 16, a), self.ast.extract(15, 8, a), self.ast.extract(7, 0, a)])
+        self.assertEqual(n.getType(), AST_NODE.VARIABLE)
+        self.assertTrue(self.proof(n == a))
+
+    def test_concat2(self):
+        a = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        n = self.ast.concat([self.ast.extract(23, 16, a), self.ast.extract(15, 8, a), self.ast.bv(0, 8)])
+        self.assertEqual(n.getChildren()[0].getType(), AST_NODE.EXTRACT)
+        self.assertTrue(self.proof(n == self.ast.concat([self.ast.extract(23, 8, a), self.ast.bv(0, 8)])))
+
+    def test_concat3(self):
+        a = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        n = self.ast.concat([self.ast.extract(15, 8, a), self.ast.extract(15, 8, a)])
+        self.assertEqual(n.getType(), AST_NODE.CONCAT)
+
+    def test_disabled(self):
+        self.ctx.enableMode(MODE.AST_IDIOM_REWRITING, False)
+        self.ctx.enableMode(MODE.AST_OPTIMIZATIONS, True)
+        a = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        b = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        self.assertEqual(self.ast.extract(39, 36, self.ast.concat([a, b])).getChildren()[2].getType(), AST_NODE.CONCAT)
+        self.assertEqual(self.ast.concat([self.ast.extract(31, 16, a), self.ast.extract(15, 0, a)]).getType(), AST_NODE.CONCAT)
+        self.assertEqual(self.ast.ite(self.ast.equal(b, self.ast.bv(0, 32)), a, a).getType(), AST_NODE.ITE)
+
+    def test_extract1(self):
+        a = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        b = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        n = self.ast.extract(39, 36, self.ast.concat([a, b]))
+        self.assertEqual(n.getChildren()[2].getType(), AST_NODE.VARIABLE)
+        self.assertTrue(self.proof(n == self.ast.extract(7, 4, a)))
+
+    def test_extract2(self):
+        a = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        b = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        n = self.ast.extract(35, 28, self.ast.concat([a, b]))
+        self.assertEqual(n.getChildren()[2].getType(), AST_NODE.CONCAT)
+
+    def test_extract3(self):
+        a = self.ast.variable(self.ctx.newSymbolicVariable(8))
+        self.assertTrue(self.proof(self.ast.extract(7, 4, self.ast.zx(24, a)) == self.ast.extract(7, 4, a)))
+        self.assertEqual(self.ast.extract(31, 8, self.ast.zx(24, a)).getType(), AST_NODE.BV)
+        n = self.ast.extract(15, 4, self.ast.zx(24, a))
+        self.assertEqual(n.getType(), AST_NODE.ZX)
+        self.assertTrue(self.proof(n == self.ast.extract(15, 4, self.ast.concat([self.ast.bv(0, 24), a]))))
+
+    def test_extract4(self):
+        a = self.ast.variable(self.ctx.newSymbolicVariable(8))
+        n = self.ast.extract(6, 2, self.ast.sx(24, a))
+        self.assertEqual(n.getChildren()[2].getType(), AST_NODE.VARIABLE)
+        self.assertEqual(self.ast.extract(15, 2, self.ast.sx(24, a)).getChildren()[2].getType(), AST_NODE.SX)
+
+    def test_extract5(self):
+        a = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        n = self.ast.extract(11, 4, self.ast.extract(23, 8, a))
+        self.assertEqual(n.getChildren()[2].getType(), AST_NODE.VARIABLE)
+        self.assertTrue(self.proof(n == self.ast.extract(19, 12, a)))
+
+    def test_extract6(self):
+        a = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        b = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        e = self.ctx.newSymbolicExpression(self.ast.concat([a, b]))
+        n = self.ast.extract(7, 0, self.ast.reference(e))
+        self.assertEqual(n.getChildren()[2].getType(), AST_NODE.REFERENCE)
+        self.assertTrue(self.proof(self.ast.unrollAst(n) == self.ast.extract(7, 0, b)))
+
+        # The reference is kept, so a new AST of the expression is taken into account
+        e.setAst(self.ast.concat([b, a]))
+        self.assertTrue(self.proof(self.ast.unrollAst(n) == self.ast.extract(7, 0, a)))
+
+    def test_ite1(self):
+        a = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        b = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        n = self.ast.ite(self.ast.equal(self.ast.bv(1, 8), self.ast.bv(1, 8)), a, b)
+        self.assertTrue(self.proof(n == a))
+        n = self.ast.ite(self.ast.equal(self.ast.bv(1, 8), self.ast.bv(2, 8)), a, b)
+        self.assertTrue(self.proof(n == b))
+
+    def test_ite2(self):
+        a = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        b = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        n = self.ast.ite(self.ast.equal(b, self.ast.bv(0, 32)), a, a)
+        self.assertTrue(self.proof(n == a))
+        n = self.ast.ite(self.ast.equal(b, self.ast.bv(0, 32)), a, b)
+        self.assertEqual(n.getType(), AST_NODE.ITE)
+
+    def test_ite3(self):
+        # The values and the hashes of the operands may be the same, the trees are compared
+        a = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        c = self.ast.variable(self.ctx.newSymbolicVariable(1))
+        b = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        cond = self.ast.equal(c, self.ast.bv(1, 1))
+        self.assertEqual(self.ast.ite(cond, a, b).getType(), AST_NODE.ITE)
+        self.assertEqual(self.ast.ite(cond, self.ast.bvsub(a, b), self.ast.bvsub(b, a)).getType(), AST_NODE.ITE)
+        n = self.ast.ite(cond, self.ast.bvadd(a, b), self.ast.bvadd(a, b))
+        self.assertEqual(n.getType(), AST_NODE.BVADD)
+        self.assertTrue(self.proof(n == self.ast.bvadd(a, b)))
+
+    def test_memoized(self):
+        a = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        b = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        c = self.ast.concat([a, b])
+        n1 = self.ast.extract(39, 36, c)
+        n2 = self.ast.extract(39, 36, c)
+        self.assertEqual(n1.getChildren()[2].getType(), AST_NODE.VARIABLE)
+        self.assertEqual(n1.getHash(), n2.getHash())
+        self.assertEqual(len(a.getParents()), 2)
+
+        # The operand is modified in place, the memoized rewriting is not used anymore
+        c.setChild(0, b)
+        n3 = self.ast.extract(39, 36, c)
+        self.assertTrue(self.proof(n3 == self.ast.extract(7, 4, b)))
+
+    def test_same_tree(self):
+        # The values and the hashes of the operands may be the same, the trees are compared
+        a = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        c = self.ast.variable(self.ctx.newSymbolicVariable(1))
+        b = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        self.assertEqual(self.ast.concat([self.ast.extract(15, 8, a), self.ast.extract(7, 0, b)]).getType(), AST_NODE.CONCAT)
+        self.assertEqual(self.ast.bvsub(a, b).getType(), AST_NODE.BVSUB)
+        self.assertEqual(self.ast.bvxor(a, b).getType(), AST_NODE.BVXOR)
+
+    def test_sub(self):
+        a = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        n = self.ast.bvsub(self.ast.bvnot(a), self.ast.bvnot(a))
+        self.assertEqual(n.getType(), AST_NODE.BV)
+        self.assertEqual(n.evaluate(), 0)
+
+    def test_xor(self):
+        a = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        n = self.ast.bvxor(self.ast.bvnot(a), self.ast.bvnot(a))
+        self.assertEqual(n.getType(), AST_NODE.BV)
+        self.assertEqual(n.evaluate(), 0)
@@ -48,3 +48,87 @@ class TestAstUtils(unittest.TestCase):
 
         l = self.astCtxt.lookingForNodes(n, AST_NODE.BV)
         self.assertEqual(len(l), 2)
+
+    def test_getNodeCensus(self):
+        n = ((self.v1 + self.v2) * (self.v1 + self.v2))
+
+        # The shared sub-expression is only counted once
+        c = self.astCtxt.getNodeCensus(n)
+        self.assertEqual(c[AST_NODE.BVMUL], 1)
+        self.assertEqual(c[AST_NODE.VARIABLE], 2)
+        self.assertGreaterEqual(c[AST_NODE.BVADD], 1)
+
+        # References are followed
+        e = self.ctx.newSymbolicExpression(n)
+        r = self.astCtxt.reference(e)
+        c = self.astCtxt.getNodeCensus(r)
+        self.assertEqual(c[AST_NODE.REFERENCE], 1)
+        self.assertEqual(c[AST_NODE.BVMUL], 1)
+
+        self.assertGreater(self.astCtxt.getNodeMemorySize(n), 0)
+        self.assertGreater(self.astCtxt.getNodeMemorySize(r), self.astCtxt.getNodeMemorySize(n))
+
+    def test_wide_evaluation(self):
+        self.ctx.setConcreteVariableValue(self.sv1, 0x80)
+        self.ctx.setConcreteVariableValue(self.sv2, 0x7f)
+
+        # Values larger than 64 bits
+        n = self.astCtxt.sx(120, self.v1)
+        self.assertEqual(n.evaluate(), (1 << 128) - 0x80)
+        n = self.astCtxt.concat([self.astCtxt.zx(64, self.v1), self.astCtxt.zx(56, self.v2)])
+        self.assertEqual(n.evaluate(), (0x80 << 64) | 0x7f)
+        n = self.astCtxt.extract(71, 64, n)
+        self.assertEqual(n.evaluate(), 0x80)
+
+        # Signed operations on small and 64-bit values
+        self.assertEqual(self.astCtxt.bvsdiv(self.v1, self.v2).evaluate(), 0xff)
+        self.assertEqual(self.astCtxt.bvsrem(self.v1, self.v2).evaluate(), 0xff)
+        a = self.astCtxt.sx(56, self.v1)
+        b = self.astCtxt.bv(3, 64)
+        self.assertEqual(self.astCtxt.bvsdiv(a, b).evaluate(), (1 << 64) - 42)
+        self.assertEqual(self.astCtxt.bvashr(a, b).evaluate(), (1 << 64) - 16)
+        self.assertEqual(self.astCtxt.bvslt(a, b).evaluate(), 1)
+
+    def test_hash_chains(self):
+        def chain(x, y, steps):
+            # ADC/SBB chains with their carry flag, every step shares the previous result
+            a = self.astCtxt
+            cf = a.bv(0, 1)
+            for i in range(steps):
+                if i & 1:
+                    res = a.bvsub(a.bvsub(x, y), a.zx(63, cf))
+                    cf = a.extract(63, 63, a.bvor(a.bvand(a.bvnot(x), y), a.bvand(a.bvxor(a.bvnot(x), y), res)))
+                else:
+                    res = a.bvadd(a.bvadd(x, y), a.zx(63, cf))
+                    cf = a.extract(63, 63, a.bvxor(a.bvand(x, y), a.bvand(a.bvxor(a.bvxor(x, y), res), a.bvxor(x, y))))
+                x, y = res, x
+            return a.concat([cf, x])
+
+        x = self.astCtxt.variable(self.ctx.newSymbolicVariable(64))
+        y = self.astCtxt.variable(self.ctx.newSymbolicVariable(64))
+
+        # The hash of a deep DAG is computed once per node
+        n1 = chain(x, y, 500)
+        n2 = chain(x, y, 500)
+        n3 = chain(y, x, 500)
+        self.assertTrue(n1.equalTo(n2))
+        self.assertEqual(n1.getHash(), n2.getHash())
+        self.assertFalse(n1.equalTo(n3))
+        self.assertNotEqual(n1.getHash(), n3.getHash())
+
+    def test_variable_hash(self):
+        # The variables whose names only differ by an even character must not collide
+        variables = [self.astCtxt.variable(self.ctx.newSymbolicVariable(8)) for i in range(16)]
+        hashes = set(v.getHash() for v in variables)
+        self.assertEqual(len(hashes), len(variables))
+
+        sv0 = self.ctx.getSymbolicVariableFromName('SymVar_0')
+        sv2 = self.ctx.getSymbolicVariableFromName('SymVar_2')
+        v0 = self.astCtxt.variable(sv0)
+        v2 = self.astCtxt.variable(sv2)
+        self.assertNotEqual(v0.getHash(), v2.getHash())
+        self.assertFalse(v0.equalTo(v2))
+        self.assertTrue(v0.equalTo(self.astCtxt.variable(sv0)))
+
+        # The concatenations of different variables compare unequal
+        self.assertFalse(self.astCtxt.concat([v0, v2]).equalTo(self.astCtxt.concat([v2, v0])))
@@ -4,7 +4,7 @@
 
 import unittest
 
-from triton import ARCH, TritonContext
+from triton import ARCH, CPUSIZE, MemoryAccess, TritonContext
 
 
 class TestX86ConcreteRegisterValue(unittest.TestCase):
@@ -176,3 +176,27 @@ class TestX8664ConcreteMemoryValue(unittest.TestCase):
         self.Triton.setConcreteMemoryAreaValue(0x1000, "\x11\x22\x33\x44\x55\x66")
         self.Triton.setConcreteMemoryAreaValue(0x1006, [0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc])
         self.assertEqual(self.Triton.getConcreteMemoryAreaValue(0x1000, 12), "\x11\x22\x33\x44\x55\x66\x77\x88\x99\xaa\xbb\xcc")
+
+    def test_cross_page_access(self):
+        base = 0x10ffc
+        mem  = MemoryAccess(base, CPUSIZE.QWORD)
+
+        self.Triton.setConcreteMemoryValue(mem, 0x1122334455667788)
+        self.assertEqual(self.Triton.getConcreteMemoryValue(mem), 0x1122334455667788)
+        self.assertEqual(self.Triton.getConcreteMemoryValue(base), 0x88)
+        self.assertEqual(self.Triton.getConcreteMemoryValue(base + 7), 0x11)
+        self.assertTrue(self.Triton.isMemoryMapped(base, 8))
+        self.assertFalse(self.Triton.isMemoryMapped(base, 9))
+        self.assertFalse(self.Triton.isMemoryMapped(base - 1, 8))
+
+        # Unmapping a part of the range keeps the rest
+        self.Triton.unmapMemory(base + 2, 4)
+        self.assertTrue(self.Triton.isMemoryMapped(base, 2))
+        self.assertTrue(self.Triton.isMemoryMapped(base + 6, 2))
+        self.assertFalse(self.Triton.isMemoryMapped(base + 2, 1))
+        self.assertEqual(self.Triton.getConcreteMemoryValue(mem), 0x1122000000007788)
+
+        mem = MemoryAccess(0x20000, CPUSIZE.DQQWORD)
+        self.Triton.setConcreteMemoryValue(mem, (1 << 511) | 0x42)
+        self.assertEqual(self.Triton.getConcreteMemoryValue(mem), (1 << 511) | 0x42)
+        self.assertEqual(self.Triton.getConcreteMemoryAreaValue(0x20000, 2), "\x42\x00")
@@ -129,3 +129,72 @@ class TestAArch64Disass(unittest.TestCase):
 
         self.assertEqual(op2.getExtendType(), EXTEND.AARCH64.SXTX)
         self.assertEqual(op2.getExtendSize(), 0)
+
+
+class TestDisassemblyCache(unittest.TestCase):
+
+    """Testing the decoded instructions cache."""
+
+    def setUp(self):
+        """Define the arch."""
+        self.ctx = TritonContext()
+        self.ctx.setArchitecture(ARCH.X86_64)
+        self.ctx.enableMode(MODE.DISASSEMBLY_CACHE, True)
+
+    def test_hit_miss(self):
+        for _ in range(3):
+            inst = Instruction("\x48\x01\xd8") # add rax, rbx
+            inst.setAddress(0x1000)
+            self.ctx.disassembly(inst)
+            self.assertEqual(inst.getDisassembly(), "add rax, rbx")
+            self.assertEqual(len(inst.getOperands()), 2)
+
+        self.assertEqual(self.ctx.getDisassemblyCacheMisses(), 1)
+        self.assertEqual(self.ctx.getDisassemblyCacheHits(), 2)
+
+        # Same opcode at another address
+        inst = Instruction("\x48\x01\xd8")
+        inst.setAddress(0x2000)
+        self.ctx.disassembly(inst)
+        self.assertEqual(self.ctx.getDisassemblyCacheMisses(), 2)
+
+        self.ctx.clearDisassemblyCache()
+        self.assertEqual(self.ctx.getDisassemblyCacheMisses(), 0)
+        self.assertEqual(self.ctx.getDisassemblyCacheHits(), 0)
+
+    def test_eviction(self):
+        self.assertEqual(self.ctx.getDisassemblyCacheSize(), 65536)
+        self.ctx.setDisassemblyCacheSize(2)
+        self.assertEqual(self.ctx.getDisassemblyCacheSize(), 2)
+
+        # The least recently used instruction is evicted
+        for addr in [0x1000, 0x2000, 0x1000, 0x3000, 0x1000, 0x2000]:
+            inst = Instruction("\x48\x01\xd8") # add rax, rbx
+            inst.setAddress(addr)
+            self.ctx.disassembly(inst)
+            self.assertEqual(inst.getDisassembly(), "add rax, rbx")
+
+        self.assertEqual(self.ctx.getDisassemblyCacheHits(), 2)
+        self.assertEqual(self.ctx.getDisassemblyCacheMisses(), 4)
+
+        # Nothing is kept without room
+        self.ctx.setDisassemblyCacheSize(0)
+        inst = Instruction("\x48\x01\xd8")
+        inst.setAddress(0x1000)
+        self.ctx.disassembly(inst)
+        self.assertEqual(self.ctx.getDisassemblyCacheHits(), 2)
+        self.assertEqual(self.ctx.getDisassemblyCacheMisses(), 5)
+
+        with self.assertRaises(TypeError):
+            self.ctx.setDisassemblyCacheSize("2")
+
+    def test_processing(self):
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rax, 1)
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rbx, 2)
+        for _ in range(4):
+            inst = Instruction("\x48\x01\xd8") # add rax, rbx
+            inst.setAddress(0x1000)
+            self.ctx.processing(inst)
+            self.assertEqual(len(inst.getSymbolicExpressions()), 8)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rax), 9)
+        self.assertEqual(self.ctx.getDisassemblyCacheHits(), 3)
@@ -5,7 +5,7 @@
 import unittest
 import random
 
-from triton import ARCH, REG, TritonContext
+from triton import ARCH, Instruction, MODE, REG, TritonContext
 
 
 class TestFlags(unittest.TestCase):
@@ -50,3 +50,118 @@ class TestFlags(unittest.TestCase):
             self.Triton.setConcreteRegisterValue(self.Triton.getRegister(reg), 0)
             values[registers.index(reg)] = 0
             self.assertListEqual([self.Triton.getConcreteRegisterValue(self.Triton.getRegister(r)) for r in registers], values)
+
+
+class TestLazyFlags(unittest.TestCase):
+
+    """Testing the lazy flags against the eager ones."""
+
+    CODE = [
+        "\x48\x01\xd8",  # add rax, rbx
+        "\x48\x11\xd8",  # adc rax, rbx
+        "\x48\x29\xd8",  # sub rax, rbx
+        "\x48\x19\xd8",  # sbb rax, rbx
+        "\x48\x39\xd8",  # cmp rax, rbx
+        "\x48\x31\xd8",  # xor rax, rbx
+        "\x48\x21\xd8",  # and rax, rbx
+        "\x48\x85\xd8",  # test rax, rbx
+        "\x48\xff\xc0",  # inc rax
+        "\x48\xff\xc8",  # dec rax
+        "\x01\xd8",      # add eax, ebx
+        "\x29\xd8",      # sub eax, ebx
+    ]
+
+    FLAGS = [REG.X86_64.AF, REG.X86_64.CF, REG.X86_64.OF, REG.X86_64.PF, REG.X86_64.SF, REG.X86_64.ZF]
+
+    def new_context(self, lazy):
+        """Returns a context with rbx symbolized."""
+        ctx = TritonContext()
+        ctx.setArchitecture(ARCH.X86_64)
+        ctx.enableMode(MODE.LAZY_FLAGS, lazy)
+        ctx.convertRegisterToSymbolicVariable(ctx.registers.rbx)
+        return ctx
+
+    def test_lazy_flags(self):
+        """Check that lazy flags have the same concrete and symbolic values."""
+        random.seed(0)
+
+        for _ in range(20):
+            rax = random.choice([0, 1, 0xffffffffffffffff, 0x8000000000000000, random.getrandbits(64)])
+            rbx = random.choice([0, 1, 0x7fffffffffffffff, random.getrandbits(64)])
+            eager = self.new_context(False)
+            lazy = self.new_context(True)
+            for ctx in [eager, lazy]:
+                ctx.setConcreteRegisterValue(ctx.registers.rax, rax)
+                ctx.setConcreteVariableValue(ctx.getSymbolicVariableFromId(0), rbx)
+
+            for opcode in self.CODE:
+                i1 = Instruction(opcode)
+                i2 = Instruction(opcode)
+                eager.processing(i1)
+                lazy.processing(i2)
+
+                # Flags are not part of the expressions of the instruction
+                self.assertLessEqual(len(i2.getSymbolicExpressions()), len(i1.getSymbolicExpressions()))
+
+                for flag in self.FLAGS:
+                    r1 = eager.getRegister(flag)
+                    r2 = lazy.getRegister(flag)
+                    self.assertEqual(eager.getConcreteRegisterValue(r1), lazy.getConcreteRegisterValue(r2))
+                    self.assertEqual(eager.getSymbolicRegisterValue(r1), lazy.getSymbolicRegisterValue(r2))
+                    self.assertEqual(eager.isRegisterSymbolized(r1), lazy.isRegisterSymbolized(r2))
+
+    def test_unread_flags(self):
+        """Check that flags which are never read are not built."""
+        ctx = self.new_context(True)
+        inst = Instruction("\x48\x01\xd8")  # add rax, rbx
+        ctx.processing(inst)
+
+        # Only rax and rip are built
+        self.assertEqual(len(inst.getSymbolicExpressions()), 2)
+        self.assertEqual(len(inst.getWrittenRegisters()), 2)
+        count = len(ctx.getSymbolicExpressions())
+
+        # Reading a flag builds its expression
+        self.assertTrue(ctx.isRegisterSymbolized(ctx.registers.zf))
+        self.assertEqual(len(ctx.getSymbolicExpressions()), count + 1)
+        self.assertEqual(ctx.getSymbolicRegister(ctx.registers.zf).getComment(), "Zero flag")
+
+    def test_overwritten_flags(self):
+        """Check that flags overwritten before being read are never built."""
+        code = [
+            "\x48\x01\xd8",  # add rax, rbx
+            "\x48\x29\xd8",  # sub rax, rbx
+            "\x48\x31\xd8",  # xor rax, rbx
+            "\x48\x39\xd8",  # cmp rax, rbx
+        ]
+
+        eager = self.new_context(False)
+        lazy = self.new_context(True)
+        for ctx in [eager, lazy]:
+            ctx.setConcreteRegisterValue(ctx.registers.rax, 0x8000000000000001)
+            ctx.setConcreteVariableValue(ctx.getSymbolicVariableFromId(0), 0x7fffffffffffffff)
+
+        # The instructions are kept alive, so are their expressions
+        insts = []
+        for opcode in code:
+            i1 = Instruction(opcode)
+            i2 = Instruction(opcode)
+            eager.processing(i1)
+            lazy.processing(i2)
+            insts.append(i2)
+
+        # Only rbx and the expressions of the instructions exist, no flag was built
+        count = len(lazy.getSymbolicExpressions())
+        self.assertEqual(count, 1 + sum([len(i.getSymbolicExpressions()) for i in insts]))
+        for i in insts:
+            for r, _ in i.getWrittenRegisters():
+                self.assertNotIn(r.getId(), self.FLAGS)
+
+        # Each flag is built once, from the last instruction which wrote it
+        for flag in self.FLAGS:
+            r1 = eager.getRegister(flag)
+            r2 = lazy.getRegister(flag)
+            self.assertEqual(eager.getConcreteRegisterValue(r1), lazy.getConcreteRegisterValue(r2))
+            self.assertEqual(eager.getSymbolicRegisterValue(r1), lazy.getSymbolicRegisterValue(r2))
+            self.assertEqual(eager.isRegisterSymbolized(r1), lazy.isRegisterSymbolized(r2))
+        self.assertEqual(len(lazy.getSymbolicExpressions()), count + len(self.FLAGS))
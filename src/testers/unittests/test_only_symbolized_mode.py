@@ -165,3 +165,138 @@ class TestOnlySymbolizedMode(unittest.TestCase):
         self.assertEqual(inst.getOperands()[1].getAddress(), 0x1337)
         self.assertIsNotNone(inst.getOperands()[1].getLeaAst())
 
+
+
+class TestConcreteFastPath(unittest.TestCase):
+
+    """Testing the native CONCRETE_FAST_PATH against the full semantics."""
+
+    STACK = 0x7fff0000
+    DATA  = 0x2000
+
+    # (initial values, symbolized registers, code)
+    SCENARIOS = [
+        # adc/sbb with a carry in
+        ({"rax": 0xffffffffffffffff, "rcx": 0, "cf": 1}, [], [
+            "\x48\x11\xC8",                 # adc rax, rcx
+            "\x48\x19\xC8",                 # sbb rax, rcx
+        ]),
+        ({"rax": 0x7fffffff, "rcx": 0x7fffffff, "cf": 1}, [], [
+            "\x11\xC8",                     # adc eax, ecx
+            "\x10\xC8",                     # adc al, cl
+            "\x19\xC8",                     # sbb eax, ecx
+            "\x18\xC8",                     # sbb al, cl
+        ]),
+        ({"rax": 0x0f, "rcx": 0x80, "cf": 1}, [], [
+            "\x10\xC8",                     # adc al, cl
+            "\x18\xE8",                     # sbb al, ch
+            "\x48\x19\xC8",                 # sbb rax, rcx
+        ]),
+        ({"rax": DATA, "rbx": 0xffffffffffffffff, "cf": 1}, [], [
+            "\x48\x11\x18",                 # adc [rax], rbx
+            "\x48\x19\x18",                 # sbb [rax], rbx
+        ]),
+        # neg/inc/dec on the AF/OF edges, inc/dec keep CF
+        ({"rax": 0x80, "rbx": 0x7f, "rcx": 0x0f, "rdx": 0x8000000000000000, "rsi": 0, "cf": 1}, [], [
+            "\xF6\xD8",                     # neg al
+            "\xFE\xC3",                     # inc bl
+            "\xFE\xC8",                     # dec al
+            "\xFF\xC1",                     # inc ecx
+            "\x48\xFF\xCA",                 # dec rdx
+            "\x48\xF7\xDA",                 # neg rdx
+            "\xF7\xDE",                     # neg esi
+            "\x48\xF7\xD9",                 # neg rcx
+            "\xF7\xD3",                     # not ebx
+            "\x66\xFF\xC9",                 # dec cx
+        ]),
+        ({"rax": 0x10, "rbx": 0xffffffffffffffff, "rcx": 0x8000, "cf": 0}, [], [
+            "\xFE\xC8",                     # dec al
+            "\x48\xFF\xC3",                 # inc rbx
+            "\x66\xF7\xD9",                 # neg cx
+            "\x66\xFF\xC9",                 # dec cx
+        ]),
+        # 8/16/32-bit partial writes
+        ({"rax": 0x1122334455667788, "rcx": 0xaabbccddeeff0011, "rsi": 0x0123456789abcdef}, [], [
+            "\x88\xCC",                     # mov ah, cl
+            "\x00\xE8",                     # add al, ch
+            "\x30\xE4",                     # xor ah, ah
+            "\x40\x88\xCE",                 # mov sil, cl
+            "\x66\x01\xC8",                 # add ax, cx
+            "\x66\x83\xC0\xFF",             # add ax, -1
+            "\x66\xF7\xD8",                 # neg ax
+            "\x01\xC8",                     # add eax, ecx
+            "\x83\xE9\x01",                 # sub ecx, 1
+            "\x89\xCE",                     # mov esi, ecx
+        ]),
+        # push/pop/call/ret
+        ({"rsp": STACK, "rax": DATA, "rbx": 0x41, "r8": 0x4242424242424242}, [], [
+            "\x53",                         # push rbx
+            "\x41\x50",                     # push r8
+            "\x59",                         # pop rcx
+            "\x5A",                         # pop rdx
+            "\xE8\x00\x00\x00\x00",         # call +0
+            "\xC3",                         # ret
+            "\x48\x89\x18",                 # mov [rax], rbx
+            "\x48\x01\x18",                 # add [rax], rbx
+            "\x48\x8B\x10",                 # mov rdx, [rax]
+            "\x52",                         # push rdx
+            "\x58",                         # pop rax
+        ]),
+        # A symbolized register only sends its users through the full semantics
+        ({"rsp": STACK, "rax": 0x10, "rbx": 0x41, "rdx": 0x7f, "cf": 1}, ["rdx"], [
+            "\x48\x11\xD8",                 # adc rax, rbx
+            "\x48\x01\xD3",                 # add rbx, rdx
+            "\xFE\xC2",                     # inc dl
+            "\x52",                         # push rdx
+            "\x59",                         # pop rcx
+            "\x48\x19\xC8",                 # sbb rax, rcx
+        ]),
+    ]
+
+    def run_scenario(self, fastPath, values, symbolized, code):
+        """Process the code and return the concrete and symbolic state."""
+        ctx = TritonContext()
+        ctx.setArchitecture(ARCH.X86_64)
+        ctx.enableMode(MODE.ONLY_ON_SYMBOLIZED, True)
+        ctx.enableMode(MODE.CONCRETE_FAST_PATH, fastPath)
+
+        for name, value in values.items():
+            ctx.setConcreteRegisterValue(getattr(ctx.registers, name), value)
+
+        for name in symbolized:
+            ctx.convertRegisterToSymbolicVariable(getattr(ctx.registers, name))
+
+        ctx.setConcreteRegisterValue(ctx.registers.rip, 0x1000)
+
+        for opcode in code:
+            inst = Instruction(opcode)
+            inst.setAddress(ctx.getConcreteRegisterValue(ctx.registers.rip))
+            self.assertTrue(ctx.processing(inst))
+
+        registers = sorted((r.getName(), ctx.getConcreteRegisterValue(r)) for r in ctx.getParentRegisters())
+        memory = (ctx.getConcreteMemoryAreaValue(self.STACK - 0x20, 0x40), ctx.getConcreteMemoryAreaValue(self.DATA, 0x10))
+        symbolic = sorted(r.getName() for r in ctx.getParentRegisters() if ctx.isRegisterSymbolized(r))
+        return registers, memory, symbolic
+
+    def test_fast_path(self):
+        """Check that the registers, the flags and the memory do not depend on CONCRETE_FAST_PATH."""
+        for values, symbolized, code in self.SCENARIOS:
+            full = self.run_scenario(False, values, symbolized, code)
+            fast = self.run_scenario(True, values, symbolized, code)
+            self.assertEqual(full, fast)
+
+    def test_native(self):
+        """Check that the concrete instructions do not build any symbolic expression."""
+        for values, symbolized, code in self.SCENARIOS:
+            if symbolized:
+                continue
+            ctx = TritonContext()
+            ctx.setArchitecture(ARCH.X86_64)
+            ctx.enableMode(MODE.ONLY_ON_SYMBOLIZED, True)
+            ctx.enableMode(MODE.CONCRETE_FAST_PATH, True)
+            for opcode in code:
+                inst = Instruction(opcode)
+                self.assertTrue(ctx.processing(inst))
+            # The full semantics would have consumed the first expression ids
+            se = ctx.newSymbolicExpression(ctx.getAstContext().bv(0, 8), "")
+            self.assertEqual(se.getId(), 0)
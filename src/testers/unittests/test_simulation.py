@@ -498,3 +498,53 @@ class TestSymbolicEngineAlignedOnlySymbolizedSymOpti(BaseTestSimulation, unittes
         self.Triton.enableMode(MODE.ONLY_ON_SYMBOLIZED, True)
         self.Triton.enableMode(MODE.AST_OPTIMIZATIONS, True)
         super(TestSymbolicEngineAlignedOnlySymbolizedSymOpti, self).setUp()
+
+
+class TestSymbolicEngineOnlySymbolizedConcreteFastPath(BaseTestSimulation, unittest.TestCase):
+
+    """Testing the symbolic emulation engine with ONLY_ON_SYMBOLIZED and CONCRETE_FAST_PATH."""
+
+    def setUp(self):
+        """Define the arch and modes."""
+        self.Triton = TritonContext()
+        self.Triton.setArchitecture(ARCH.X86_64)
+        self.Triton.enableMode(MODE.ONLY_ON_SYMBOLIZED, True)
+        self.Triton.enableMode(MODE.CONCRETE_FAST_PATH, True)
+        super(TestSymbolicEngineOnlySymbolizedConcreteFastPath, self).setUp()
+
+
+class TestSymbolicEngineConstantFolding(BaseTestSimulation, unittest.TestCase):
+
+    """Testing the symbolic emulation engine with AST_CONSTANT_FOLDING."""
+
+    def setUp(self):
+        """Define the arch and modes."""
+        self.Triton = TritonContext()
+        self.Triton.setArchitecture(ARCH.X86_64)
+        self.Triton.enableMode(MODE.AST_CONSTANT_FOLDING, True)
+        super(TestSymbolicEngineConstantFolding, self).setUp()
+
+
+class TestSymbolicEngineConstantFoldingSymOpti(BaseTestSimulation, unittest.TestCase):
+
+    """Testing the symbolic emulation engine with AST_CONSTANT_FOLDING and AST_OPTIMIZATIONS."""
+
+    def setUp(self):
+        """Define the arch and modes."""
+        self.Triton = TritonContext()
+        self.Triton.setArchitecture(ARCH.X86_64)
+        self.Triton.enableMode(MODE.AST_CONSTANT_FOLDING, True)
+        self.Triton.enableMode(MODE.AST_OPTIMIZATIONS, True)
+        super(TestSymbolicEngineConstantFoldingSymOpti, self).setUp()
+
+
+class TestSymbolicEngineIdiomRewriting(BaseTestSimulation, unittest.TestCase):
+
+    """Testing the symbolic emulation engine with AST_IDIOM_REWRITING."""
+
+    def setUp(self):
+        """Define the arch and modes."""
+        self.Triton = TritonContext()
+        self.Triton.setArchitecture(ARCH.X86_64)
+        self.Triton.enableMode(MODE.AST_IDIOM_REWRITING, True)
+        super(TestSymbolicEngineIdiomRewriting, self).setUp()
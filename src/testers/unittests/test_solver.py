@@ -0,0 +1,691 @@
+#!/usr/bin/env python2
+## -*- coding: utf-8 -*-
+"""Test the solver engine."""
+
+import os
+import tempfile
+import time
+import unittest
+from triton import *
+
+
+
+class TestSolverSession(unittest.TestCase):
+
+    """Testing the incremental solver session."""
+
+    def setUp(self):
+        self.ctx = TritonContext()
+        self.ctx.setArchitecture(ARCH.X86_64)
+        self.astCtxt = self.ctx.getAstContext()
+        self.vars = [self.ctx.newSymbolicVariable(8) for i in range(8)]
+        self.nodes = [self.astCtxt.variable(v) for v in self.vars]
+
+    def test_prefix_and_negated_branches(self):
+        # Emulates a path of 8 branches (x[i] == i + 1) and negates them one by one
+        branches = [self.astCtxt.equal(n, self.astCtxt.bv(i + 1, 8)) for i, n in enumerate(self.nodes)]
+
+        for i, branch in enumerate(branches):
+            model = self.ctx.getSessionModel(self.astCtxt.lnot(branch))
+            self.assertNotEqual(model[self.vars[i].getId()].getValue(), i + 1)
+            for j in range(i):
+                self.assertEqual(model[self.vars[j].getId()].getValue(), j + 1)
+            self.ctx.addSolverConstraint(branch)
+
+        # The negated branches are not kept in the session
+        self.assertTrue(self.ctx.isSessionSat(self.astCtxt.equal(self.nodes[7], self.astCtxt.bv(8, 8))))
+        self.assertFalse(self.ctx.isSessionSat(self.astCtxt.equal(self.nodes[0], self.astCtxt.bv(0, 8))))
+
+    def test_push_pop(self):
+        c1 = self.astCtxt.bvugt(self.nodes[0], self.astCtxt.bv(0x10, 8))
+        c2 = self.astCtxt.bvult(self.nodes[0], self.astCtxt.bv(0x10, 8))
+
+        self.ctx.addSolverConstraint(c1)
+        self.ctx.pushSolverScope()
+        self.ctx.addSolverConstraint(self.astCtxt.equal(self.nodes[1], self.nodes[0]))
+        model = self.ctx.getSessionModel(self.astCtxt.equal(self.nodes[1], self.astCtxt.bv(0x20, 8)))
+        self.assertEqual(model[self.vars[0].getId()].getValue(), 0x20)
+        self.assertFalse(self.ctx.isSessionSat(self.astCtxt.equal(self.nodes[1], self.astCtxt.bv(0x01, 8))))
+        self.ctx.popSolverScope()
+
+        # The scoped constraint is removed, not the first one
+        self.assertTrue(self.ctx.isSessionSat(self.astCtxt.equal(self.nodes[1], self.astCtxt.bv(0x01, 8))))
+        self.assertFalse(self.ctx.isSessionSat(c2))
+
+        # There is no more scope to pop
+        with self.assertRaises(TypeError):
+            self.ctx.popSolverScope()
+
+        # A reset removes all constraints
+        self.ctx.resetSolverSession()
+        self.assertTrue(self.ctx.isSessionSat(c2))
+
+    def test_references(self):
+        # The symbolic expressions are converted once per session
+        expr = self.ctx.newSymbolicExpression(self.astCtxt.bvadd(self.nodes[0], self.astCtxt.bv(1, 8)))
+        ref = self.astCtxt.reference(expr)
+
+        self.ctx.addSolverConstraint(self.astCtxt.bvugt(ref, self.astCtxt.bv(0x10, 8)))
+        model = self.ctx.getSessionModel(self.astCtxt.equal(ref, self.astCtxt.bv(0x20, 8)))
+        self.assertEqual(model[self.vars[0].getId()].getValue(), 0x1f)
+
+        # A new AST assigned to the expression is converted again
+        expr.setAst(self.astCtxt.bvadd(self.nodes[0], self.astCtxt.bv(2, 8)))
+        model = self.ctx.getSessionModel(self.astCtxt.equal(ref, self.astCtxt.bv(0x20, 8)))
+        self.assertEqual(model[self.vars[0].getId()].getValue(), 0x1e)
+
+    def test_session_is_independent(self):
+        c1 = self.astCtxt.equal(self.nodes[0], self.astCtxt.bv(1, 8))
+        c2 = self.astCtxt.equal(self.nodes[0], self.astCtxt.bv(2, 8))
+
+        self.ctx.addSolverConstraint(c1)
+        self.assertFalse(self.ctx.isSessionSat(c2))
+        self.assertTrue(self.ctx.isSat(c2))
+        self.assertEqual(len(self.ctx.getModel(c2)), 1)
+
+        # Must be a logical node
+        with self.assertRaises(TypeError):
+            self.ctx.addSolverConstraint(self.nodes[0])
+
+
+
+class TestSolverQueryCache(unittest.TestCase):
+
+    """Testing the solver query cache."""
+
+    def setUp(self):
+        self.ctx = TritonContext()
+        self.ctx.setArchitecture(ARCH.X86_64)
+        self.ctx.enableMode(MODE.SOLVER_QUERY_CACHE, True)
+        self.astCtxt = self.ctx.getAstContext()
+        self.vars = [self.ctx.newSymbolicVariable(8) for i in range(4)]
+        self.nodes = [self.astCtxt.variable(v) for v in self.vars]
+
+    def constraint(self, index):
+        n = self.nodes[index]
+        return self.astCtxt.land([self.astCtxt.equal(n * 3, self.astCtxt.bv(0x12, 8)), self.astCtxt.bvult(n, self.astCtxt.bv(0x80, 8))])
+
+    def test_hits(self):
+        m1 = self.ctx.getModel(self.constraint(0))
+        self.assertEqual(self.ctx.getSolverQueryCacheHits(), 0)
+        self.assertEqual(self.ctx.getSolverQueryCacheMisses(), 1)
+
+        m2 = self.ctx.getModel(self.constraint(0))
+        self.assertEqual(self.ctx.getSolverQueryCacheHits(), 1)
+        self.assertEqual(m1[self.vars[0].getId()].getValue(), m2[self.vars[0].getId()].getValue())
+
+        # Same constraint on another variable
+        m3 = self.ctx.getModel(self.constraint(1))
+        self.assertEqual(self.ctx.getSolverQueryCacheHits(), 2)
+        self.assertEqual(m3.keys(), [self.vars[1].getId()])
+        self.assertEqual(m3[self.vars[1].getId()].getValue(), m1[self.vars[0].getId()].getValue())
+        self.assertEqual(m3[self.vars[1].getId()].getVariable().getName(), self.vars[1].getName())
+
+        # The satisfiability is known from the model
+        self.assertTrue(self.ctx.isSat(self.constraint(2)))
+        self.assertEqual(self.ctx.getSolverQueryCacheHits(), 3)
+        self.assertEqual(self.ctx.getSolverQueryCacheMisses(), 1)
+
+        # Both variables are renamed by order of appearance
+        c = self.astCtxt.equal(self.nodes[0], self.nodes[1] + 1)
+        self.assertTrue(self.ctx.isSat(c))
+        self.assertTrue(self.ctx.isSat(self.astCtxt.equal(self.nodes[2], self.nodes[3] + 1)))
+        self.assertEqual(self.ctx.getSolverQueryCacheHits(), 4)
+        self.assertTrue(self.ctx.isSat(self.astCtxt.equal(self.nodes[3], self.nodes[2] + 1)))
+        self.assertEqual(self.ctx.getSolverQueryCacheHits(), 5)
+        self.assertTrue(self.ctx.isSat(self.astCtxt.equal(self.nodes[0], self.nodes[0] + 1)) == False)
+        self.assertEqual(self.ctx.getSolverQueryCacheMisses(), 3)
+
+        self.ctx.clearSolverQueryCache()
+        self.assertEqual(self.ctx.getSolverQueryCacheHits(), 0)
+        self.assertEqual(self.ctx.getSolverQueryCacheMisses(), 0)
+
+    def test_unsat_and_models(self):
+        unsat = self.astCtxt.land([self.astCtxt.equal(self.nodes[0], self.astCtxt.bv(1, 8)), self.astCtxt.equal(self.nodes[0], self.astCtxt.bv(2, 8))])
+        self.assertFalse(self.ctx.isSat(unsat))
+        self.assertEqual(self.ctx.getModel(unsat), {})
+        self.assertEqual(self.ctx.getModels(unsat, 10), [])
+        self.assertEqual(self.ctx.getSolverQueryCacheHits(), 2)
+
+        c = self.astCtxt.bvult(self.nodes[0], self.astCtxt.bv(3, 8))
+        self.assertEqual(len(self.ctx.getModels(c, 2)), 2)
+        self.assertEqual(len(self.ctx.getModels(c, 1)), 1)
+        self.assertEqual(self.ctx.getSolverQueryCacheHits(), 3)
+
+        # More models than computed, the solver is queried again
+        self.assertEqual(len(self.ctx.getModels(c, 10)), 3)
+        self.assertEqual(self.ctx.getSolverQueryCacheMisses(), 3)
+
+        # All the models are known
+        self.assertEqual(len(self.ctx.getModels(c, 20)), 3)
+        self.assertEqual(self.ctx.getSolverQueryCacheHits(), 4)
+
+    def test_file_store(self):
+        path = tempfile.mktemp()
+        try:
+            self.ctx.setSolverQueryCacheFile(path)
+            m1 = self.ctx.getModel(self.constraint(0))
+
+            ctx = TritonContext()
+            ctx.setArchitecture(ARCH.X86_64)
+            ctx.enableMode(MODE.SOLVER_QUERY_CACHE, True)
+            ctx.setSolverQueryCacheFile(path)
+            var = ctx.newSymbolicVariable(8)
+            astCtxt = ctx.getAstContext()
+            n = astCtxt.variable(var)
+            m2 = ctx.getModel(astCtxt.land([astCtxt.equal(n * 3, astCtxt.bv(0x12, 8)), astCtxt.bvult(n, astCtxt.bv(0x80, 8))]))
+            self.assertEqual(ctx.getSolverQueryCacheHits(), 1)
+            self.assertEqual(m2[var.getId()].getValue(), m1[self.vars[0].getId()].getValue())
+        finally:
+            if os.path.exists(path):
+                os.remove(path)
+
+    def test_size(self):
+        constraints = [self.astCtxt.equal(self.nodes[0], self.astCtxt.bv(i, 8)) for i in range(4)]
+        self.ctx.setSolverQueryCacheSize(2)
+
+        for c in constraints:
+            self.assertTrue(self.ctx.isSat(c))
+        self.assertEqual(self.ctx.getSolverQueryCacheMisses(), 4)
+
+        # Only the most recently used entries are kept
+        self.assertTrue(self.ctx.isSat(constraints[3]))
+        self.assertTrue(self.ctx.isSat(constraints[2]))
+        self.assertEqual(self.ctx.getSolverQueryCacheHits(), 2)
+        self.assertTrue(self.ctx.isSat(constraints[0]))
+        self.assertEqual(self.ctx.getSolverQueryCacheMisses(), 5)
+
+        # The file store is compacted to the live entries
+        path = tempfile.mktemp()
+        try:
+            self.ctx.setSolverQueryCacheFile(path)
+            for i in range(20):
+                self.ctx.isSat(constraints[i % 4])
+            with open(path) as f:
+                self.assertLessEqual(len(f.readlines()), 4)
+        finally:
+            if os.path.exists(path):
+                os.remove(path)
+
+    def test_disabled(self):
+        self.ctx.enableMode(MODE.SOLVER_QUERY_CACHE, False)
+        self.ctx.getModel(self.constraint(0))
+        self.ctx.getModel(self.constraint(0))
+        self.assertEqual(self.ctx.getSolverQueryCacheHits(), 0)
+        self.assertEqual(self.ctx.getSolverQueryCacheMisses(), 0)
+
+
+
+class TestConstraintIndependence(unittest.TestCase):
+
+    """Testing the constraint independence slicing."""
+
+    def setUp(self):
+        self.ctx = TritonContext()
+        self.ctx.setArchitecture(ARCH.X86_64)
+        self.astCtxt = self.ctx.getAstContext()
+        self.vars = [self.ctx.newSymbolicVariable(8) for i in range(8)]
+        self.nodes = [self.astCtxt.variable(v) for v in self.vars]
+        for i, v in enumerate(self.vars):
+            self.ctx.setConcreteVariableValue(v, 0x10 + i)
+
+    def path(self):
+        # The taken branches hold with the concrete values, x5 and x6 are related
+        pc = self.astCtxt.equal(self.astCtxt.bvtrue(), self.astCtxt.bvtrue())
+        for i in range(7):
+            pc = self.astCtxt.land([pc, self.astCtxt.bvuge(self.nodes[i], self.astCtxt.bv(0x10, 8))])
+        pc = self.astCtxt.land([pc, self.astCtxt.equal(self.nodes[6], self.nodes[5] + 1)])
+        return pc
+
+    def test_negated_branch(self):
+        c = self.astCtxt.land([self.path(), self.astCtxt.equal(self.nodes[5], self.astCtxt.bv(0x30, 8))])
+        model = self.ctx.getModel(c, True)
+        self.assertEqual(model[self.vars[5].getId()].getValue(), 0x30)
+        self.assertEqual(model[self.vars[6].getId()].getValue(), 0x31)
+        for i in range(5):
+            self.assertEqual(model[self.vars[i].getId()].getValue(), 0x10 + i)
+
+        # x7 is not in the constraint
+        self.assertFalse(self.vars[7].getId() in model)
+
+        # The model satisfies the whole constraint
+        for v in model.values():
+            self.ctx.setConcreteVariableValue(v.getVariable(), v.getValue())
+        self.assertEqual(c.evaluate(), 1)
+
+    def test_unsat(self):
+        c = self.astCtxt.land([self.path(), self.astCtxt.bvult(self.nodes[2], self.astCtxt.bv(0x10, 8))])
+        self.assertEqual(self.ctx.getModel(c, True), {})
+        self.assertEqual(self.ctx.getModels(c, 4, True), [])
+
+    def test_concrete_model(self):
+        model = self.ctx.getModel(self.path(), True)
+        self.assertEqual(len(model), 7)
+        for i in range(7):
+            self.assertEqual(model[self.vars[i].getId()].getValue(), 0x10 + i)
+
+    def test_models(self):
+        c = self.astCtxt.land([self.path(), self.astCtxt.bvugt(self.nodes[1], self.astCtxt.bv(0xfc, 8))])
+        models = self.ctx.getModels(c, 10, True)
+        self.assertEqual(len(models), 3)
+        self.assertEqual(sorted([m[self.vars[1].getId()].getValue() for m in models]), [0xfd, 0xfe, 0xff])
+        for m in models:
+            self.assertEqual(len(m), 7)
+            self.assertEqual(m[self.vars[0].getId()].getValue(), 0x10)
+
+        # Without slicing, all the variables are free
+        self.assertEqual(len(self.ctx.getModels(c, 10)), 10)
+
+    def test_arguments(self):
+        with self.assertRaises(TypeError):
+            self.ctx.getModel(self.path(), 1)
+        with self.assertRaises(TypeError):
+            self.ctx.getModels(self.path(), 1, 1)
+
+
+
+class TestSolverModelReuse(unittest.TestCase):
+
+    """Testing the reuse of the recent models."""
+
+    def setUp(self):
+        self.ctx = TritonContext()
+        self.ctx.setArchitecture(ARCH.X86_64)
+        self.ctx.enableMode(MODE.SOLVER_MODEL_REUSE, True)
+        self.astCtxt = self.ctx.getAstContext()
+        self.vars = [self.ctx.newSymbolicVariable(8) for i in range(4)]
+        self.nodes = [self.astCtxt.variable(v) for v in self.vars]
+
+    def test_reuse(self):
+        c1 = self.astCtxt.land([self.astCtxt.bvugt(self.nodes[0], self.astCtxt.bv(0x10, 8)), self.astCtxt.bvult(self.nodes[0], self.astCtxt.bv(0x20, 8))])
+        m1 = self.ctx.getModel(c1)
+        v0 = m1[self.vars[0].getId()].getValue()
+        self.assertEqual(self.ctx.getSolverModelReuseHits(), 0)
+
+        # The previous model satisfies a weaker constraint
+        c2 = self.astCtxt.bvugt(self.nodes[0], self.astCtxt.bv(0x08, 8))
+        m2 = self.ctx.getModel(c2)
+        self.assertEqual(self.ctx.getSolverModelReuseHits(), 1)
+        self.assertEqual(m2[self.vars[0].getId()].getValue(), v0)
+        self.assertTrue(self.ctx.isSat(c2))
+        self.assertEqual(self.ctx.getSolverModelReuseHits(), 2)
+
+        # The variables which are not in the recent model keep their concrete value
+        self.ctx.setConcreteVariableValue(self.vars[1], 0x42)
+        m3 = self.ctx.getModel(self.astCtxt.land([c2, self.astCtxt.equal(self.nodes[1], self.astCtxt.bv(0x42, 8))]))
+        self.assertEqual(self.ctx.getSolverModelReuseHits(), 3)
+        self.assertEqual(m3[self.vars[1].getId()].getValue(), 0x42)
+        self.assertEqual(len(m3), 2)
+
+        # The previous model does not satisfy the constraint
+        c4 = self.astCtxt.equal(self.nodes[0], self.astCtxt.bv(v0 + 1, 8))
+        m4 = self.ctx.getModel(c4)
+        self.assertEqual(self.ctx.getSolverModelReuseHits(), 3)
+        self.assertEqual(m4[self.vars[0].getId()].getValue(), v0 + 1)
+
+        # UNSAT is never answered by a recent model
+        self.assertFalse(self.ctx.isSat(self.astCtxt.land([c4, self.astCtxt.equal(self.nodes[0], self.astCtxt.bv(v0, 8))])))
+        self.assertEqual(self.ctx.getModel(self.astCtxt.land([c4, c1, self.astCtxt.lnot(c1)])), {})
+
+        # The concrete values are not modified
+        self.assertEqual(self.ctx.getConcreteVariableValue(self.vars[0]), 0)
+
+    def test_size(self):
+        self.ctx.setSolverModelReuseSize(1)
+        self.ctx.getModel(self.astCtxt.equal(self.nodes[0], self.astCtxt.bv(1, 8)))
+        self.ctx.getModel(self.astCtxt.equal(self.nodes[0], self.astCtxt.bv(2, 8)))
+
+        # The first model has been evicted
+        self.ctx.getModel(self.astCtxt.equal(self.nodes[0], self.astCtxt.bv(1, 8)))
+        self.assertEqual(self.ctx.getSolverModelReuseHits(), 0)
+
+        self.ctx.setSolverModelReuseSize(0)
+        self.ctx.getModel(self.astCtxt.equal(self.nodes[0], self.astCtxt.bv(1, 8)))
+        self.assertEqual(self.ctx.getSolverModelReuseHits(), 0)
+
+    def test_disabled(self):
+        self.ctx.enableMode(MODE.SOLVER_MODEL_REUSE, False)
+        c = self.astCtxt.equal(self.nodes[0], self.astCtxt.bv(1, 8))
+        self.ctx.getModel(c)
+        self.ctx.getModel(c)
+        self.assertEqual(self.ctx.getSolverModelReuseHits(), 0)
+
+
+
+class TestSolverBatch(unittest.TestCase):
+
+    """Testing the batch solving."""
+
+    def setUp(self):
+        self.ctx = TritonContext()
+        self.ctx.setArchitecture(ARCH.X86_64)
+        self.astCtxt = self.ctx.getAstContext()
+        self.vars = [self.ctx.newSymbolicVariable(32) for i in range(16)]
+        self.nodes = [self.astCtxt.variable(v) for v in self.vars]
+
+    def test_in_order(self):
+        queries = []
+        for i, n in enumerate(self.nodes):
+            queries.append(self.astCtxt.equal(n * self.astCtxt.bv(3, 32) + self.astCtxt.bv(i, 32), self.astCtxt.bv(0x1000 + i * 3, 32)))
+        # UNSAT
+        queries.append(self.astCtxt.land([self.astCtxt.bvult(self.nodes[0], self.astCtxt.bv(2, 32)), self.astCtxt.bvugt(self.nodes[0], self.astCtxt.bv(2, 32))]))
+
+        for workers in [1, 4, 0]:
+            models = self.ctx.getBatchModels(queries, workers)
+            self.assertEqual(len(models), len(queries))
+            for i, n in enumerate(self.vars):
+                self.assertEqual(models[i].keys(), [n.getId()])
+                self.assertEqual(models[i][n.getId()].getValue(), self.ctx.getModel(queries[i])[n.getId()].getValue())
+            self.assertEqual(models[-1], {})
+
+        self.assertEqual(self.ctx.getBatchModels([]), [])
+
+    def test_timeout(self):
+        # Factorization of the product of the two largest 32-bit primes
+        x = self.astCtxt.zx(32, self.nodes[0])
+        y = self.astCtxt.zx(32, self.nodes[1])
+        hard = self.astCtxt.land([
+            self.astCtxt.equal(x * y, self.astCtxt.bv(0xffffffea00000055, 64)),
+            self.astCtxt.bvugt(self.nodes[0], self.astCtxt.bv(1, 32)),
+            self.astCtxt.bvugt(self.nodes[1], self.astCtxt.bv(1, 32)),
+        ])
+        easy = self.astCtxt.equal(self.nodes[2], self.astCtxt.bv(1, 32))
+        start = time.time()
+        models = self.ctx.getBatchModels([hard, hard], 2, 100)
+        self.assertEqual(models, [{}, {}])
+        self.assertLess(time.time() - start, 10)
+
+        models = self.ctx.getBatchModels([easy], 1, 10000)
+        self.assertEqual(models[0][self.vars[2].getId()].getValue(), 1)
+
+    def test_stats_and_recording(self):
+        directory = tempfile.mkdtemp()
+        self.ctx.enableMode(MODE.SOLVER_QUERY_STATS, True)
+        self.ctx.enableMode(MODE.SOLVER_QUERY_RECORDING, True)
+        self.ctx.setSolverQueryRecordingDirectory(directory)
+
+        sat = self.astCtxt.equal(self.nodes[0], self.astCtxt.bv(1, 32))
+        unsat = self.astCtxt.land([self.astCtxt.bvult(self.nodes[1], self.astCtxt.bv(2, 32)), self.astCtxt.bvugt(self.nodes[1], self.astCtxt.bv(2, 32))])
+        self.ctx.getBatchModels([sat, unsat], 2)
+
+        # The batch queries are logged in order, like the other queries
+        stats = self.ctx.getSolverQueryStats()
+        self.assertEqual([s['limit'] for s in stats], [1, 1])
+        self.assertEqual([s['status'] for s in stats], [SOLVER_STATE.SAT, SOLVER_STATE.UNSAT])
+        self.assertEqual(self.ctx.getSolverRecordedQueries(), 2)
+        self.assertEqual(sorted(os.listdir(directory)), ["query-000000.smt2", "query-000001.smt2"])
+
+        for name in os.listdir(directory):
+            os.remove(os.path.join(directory, name))
+        os.rmdir(directory)
+
+    def test_arguments(self):
+        with self.assertRaises(TypeError):
+            self.ctx.getBatchModels(self.nodes[0])
+        with self.assertRaises(TypeError):
+            self.ctx.getBatchModels([self.nodes[0]])
+        with self.assertRaises(TypeError):
+            self.ctx.getBatchModels([1])
+
+
+class TestSolverLimits(unittest.TestCase):
+
+    """Testing the solver limits and the statistics of the queries."""
+
+    def setUp(self):
+        self.ctx = TritonContext()
+        self.ctx.setArchitecture(ARCH.X86_64)
+        self.astCtxt = self.ctx.getAstContext()
+        self.vars = [self.ctx.newSymbolicVariable(32) for i in range(4)]
+        self.nodes = [self.astCtxt.variable(v) for v in self.vars]
+        # Factorization of the product of the two largest 32-bit primes
+        x = self.astCtxt.zx(32, self.nodes[0])
+        y = self.astCtxt.zx(32, self.nodes[1])
+        self.hard = self.astCtxt.land([
+            self.astCtxt.equal(x * y, self.astCtxt.bv(0xffffffea00000055, 64)),
+            self.astCtxt.bvugt(self.nodes[0], self.astCtxt.bv(1, 32)),
+            self.astCtxt.bvugt(self.nodes[1], self.astCtxt.bv(1, 32)),
+        ])
+        self.easy = self.astCtxt.equal(self.nodes[2], self.astCtxt.bv(1, 32))
+        self.unsat = self.astCtxt.land([
+            self.astCtxt.bvult(self.nodes[3], self.astCtxt.bv(2, 32)),
+            self.astCtxt.bvugt(self.nodes[3], self.astCtxt.bv(2, 32)),
+        ])
+
+    def test_status(self):
+        model, status = self.ctx.getModel(self.easy, False, True)
+        self.assertEqual(status, SOLVER_STATE.SAT)
+        self.assertEqual(model[self.vars[2].getId()].getValue(), 1)
+
+        self.assertEqual(self.ctx.getModel(self.unsat, False, True), ({}, SOLVER_STATE.UNSAT))
+        self.assertEqual(self.ctx.getModels(self.unsat, 2, False, True), ([], SOLVER_STATE.UNSAT))
+        self.assertEqual(self.ctx.isSat(self.unsat, True), (False, SOLVER_STATE.UNSAT))
+        self.assertEqual(self.ctx.isSat(self.easy, True), (True, SOLVER_STATE.SAT))
+
+        # Without status, the results are unchanged
+        self.assertEqual(self.ctx.getModel(self.unsat), {})
+        self.assertFalse(self.ctx.isSat(self.unsat))
+
+    def test_timeout(self):
+        start = time.time()
+        self.assertEqual(self.ctx.getModel(self.hard, False, True, 100), ({}, SOLVER_STATE.TIMEOUT))
+        self.assertEqual(self.ctx.isSat(self.hard, True, 100), (False, SOLVER_STATE.TIMEOUT))
+        self.assertLess(time.time() - start, 10)
+
+        # The default timeout
+        self.assertEqual(self.ctx.getSolverTimeout(), 0)
+        self.ctx.setSolverTimeout(100)
+        self.assertEqual(self.ctx.getSolverTimeout(), 100)
+        self.assertEqual(self.ctx.getModels(self.hard, 2, False, True), ([], SOLVER_STATE.TIMEOUT))
+        self.assertEqual(self.ctx.getBatchModels([self.hard]), [{}])
+        self.assertEqual(self.ctx.isSat(self.easy, True), (True, SOLVER_STATE.SAT))
+
+    def test_timeout_not_cached(self):
+        self.ctx.enableMode(MODE.SOLVER_QUERY_CACHE, True)
+        self.ctx.setSolverTimeout(100)
+        self.assertEqual(self.ctx.isSat(self.hard, True), (False, SOLVER_STATE.TIMEOUT))
+        self.assertEqual(self.ctx.isSat(self.hard, True), (False, SOLVER_STATE.TIMEOUT))
+        self.assertEqual(self.ctx.getSolverQueryCacheHits(), 0)
+        self.assertEqual(self.ctx.getSolverQueryCacheMisses(), 2)
+
+        self.assertEqual(self.ctx.isSat(self.unsat, True), (False, SOLVER_STATE.UNSAT))
+        self.assertEqual(self.ctx.isSat(self.unsat, True), (False, SOLVER_STATE.UNSAT))
+        self.assertEqual(self.ctx.getSolverQueryCacheHits(), 1)
+
+    def test_memory_limit(self):
+        self.assertEqual(self.ctx.getSolverMemoryLimit(), 0)
+        self.ctx.setSolverMemoryLimit(1)
+        self.assertEqual(self.ctx.getSolverMemoryLimit(), 1)
+        self.assertEqual(self.ctx.getModel(self.hard, False, True, 5000), ({}, SOLVER_STATE.OUTOFMEM))
+
+    def test_stats(self):
+        self.ctx.getModel(self.easy)
+        self.assertEqual(self.ctx.getSolverQueryStats(), [])
+
+        self.ctx.enableMode(MODE.SOLVER_QUERY_STATS, True)
+        self.ctx.getModel(self.easy)
+        self.ctx.isSat(self.unsat)
+        self.ctx.getModels(self.hard, 4, False, False, 100)
+
+        stats = self.ctx.getSolverQueryStats()
+        self.assertEqual([s['limit'] for s in stats], [1, 0, 4])
+        self.assertEqual([s['status'] for s in stats], [SOLVER_STATE.SAT, SOLVER_STATE.UNSAT, SOLVER_STATE.TIMEOUT])
+        self.assertEqual(stats[2]['hash'], self.hard.getHash())
+        self.assertEqual(stats[0]['astSize'], 5)
+        self.assertGreater(stats[2]['astSize'], stats[1]['astSize'])
+        self.assertGreaterEqual(stats[2]['solvingTime'], 100000)
+        for s in stats:
+            self.assertGreaterEqual(s['conversionTime'], 0)
+
+        self.ctx.clearSolverQueryStats()
+        self.assertEqual(self.ctx.getSolverQueryStats(), [])
+
+    def test_stats_size(self):
+        self.ctx.enableMode(MODE.SOLVER_QUERY_STATS, True)
+        self.ctx.setSolverQueryStatsSize(2)
+        self.ctx.getModel(self.easy)
+        self.ctx.isSat(self.unsat)
+        self.ctx.isSat(self.easy)
+
+        # The oldest statistics are dropped first
+        stats = self.ctx.getSolverQueryStats()
+        self.assertEqual([s['hash'] for s in stats], [self.unsat.getHash(), self.easy.getHash()])
+
+        self.ctx.setSolverQueryStatsSize(1)
+        self.assertEqual([s['hash'] for s in self.ctx.getSolverQueryStats()], [self.easy.getHash()])
+
+    def test_arguments(self):
+        with self.assertRaises(TypeError):
+            self.ctx.getModel(self.easy, False, 1)
+        with self.assertRaises(TypeError):
+            self.ctx.getModel(self.easy, False, True, "1")
+        with self.assertRaises(TypeError):
+            self.ctx.isSat(self.easy, 1)
+        with self.assertRaises(TypeError):
+            self.ctx.setSolverTimeout("1")
+
+
+class TestSolverQueryRecording(unittest.TestCase):
+
+    """Testing the recording of the solver queries."""
+
+    def setUp(self):
+        self.ctx = TritonContext()
+        self.ctx.setArchitecture(ARCH.X86_64)
+        self.astCtxt = self.ctx.getAstContext()
+        self.directory = tempfile.mkdtemp()
+        self.x = self.astCtxt.variable(self.ctx.newSymbolicVariable(8))
+        self.y = self.astCtxt.variable(self.ctx.newSymbolicVariable(8))
+
+    def tearDown(self):
+        for name in os.listdir(self.directory):
+            os.remove(os.path.join(self.directory, name))
+        os.rmdir(self.directory)
+
+    def read(self, index):
+        with open(os.path.join(self.directory, "query-%06d.smt2" % index)) as f:
+            return f.read()
+
+    def test_disabled(self):
+        self.ctx.setSolverQueryRecordingDirectory(self.directory)
+        self.ctx.getModel(self.astCtxt.equal(self.x, self.astCtxt.bv(1, 8)))
+        self.assertEqual(self.ctx.getSolverRecordedQueries(), 0)
+        self.assertEqual(os.listdir(self.directory), [])
+
+    def test_failure(self):
+        self.ctx.enableMode(MODE.SOLVER_QUERY_RECORDING, True)
+        self.ctx.setSolverQueryRecordingDirectory(os.path.join(self.directory, "missing"))
+        self.ctx.setAstRepresentationMode(AST_REPRESENTATION.PYTHON)
+
+        # The model is returned even if the query cannot be recorded
+        model = self.ctx.getModel(self.astCtxt.equal(self.x, self.astCtxt.bv(1, 8)))
+        self.assertEqual(model[0].getValue(), 1)
+        self.assertEqual(self.ctx.getSolverRecordedQueries(), 0)
+        self.assertEqual(self.ctx.getSolverRecordingFailures(), 1)
+        self.assertEqual(self.ctx.getAstRepresentationMode(), AST_REPRESENTATION.PYTHON)
+
+    def test_directory(self):
+        self.assertEqual(self.ctx.getSolverQueryRecordingDirectory(), ".")
+        self.ctx.setSolverQueryRecordingDirectory(self.directory)
+        self.assertEqual(self.ctx.getSolverQueryRecordingDirectory(), self.directory)
+        with self.assertRaises(TypeError):
+            self.ctx.setSolverQueryRecordingDirectory(1)
+
+    def test_record(self):
+        self.ctx.enableMode(MODE.SOLVER_QUERY_RECORDING, True)
+        self.ctx.setSolverQueryRecordingDirectory(self.directory)
+
+        # The files are in SMT-LIB2 whatever the representation mode
+        self.ctx.setAstRepresentationMode(AST_REPRESENTATION.PYTHON)
+        expr = self.ctx.newSymbolicExpression(self.x + self.y)
+        ref = self.astCtxt.reference(expr)
+        self.ctx.getModel(self.astCtxt.equal(ref, self.astCtxt.bv(0x10, 8)))
+        self.ctx.isSat(self.astCtxt.land([self.astCtxt.bvult(self.x, self.astCtxt.bv(2, 8)), self.astCtxt.bvugt(self.x, self.astCtxt.bv(2, 8))]))
+        self.assertEqual(self.ctx.getAstRepresentationMode(), AST_REPRESENTATION.PYTHON)
+        self.assertEqual(self.ctx.getSolverRecordedQueries(), 2)
+        self.assertEqual(sorted(os.listdir(self.directory)), ["query-000000.smt2", "query-000001.smt2"])
+
+        query = self.read(0)
+        self.assertIn("; limit: 1\n", query)
+        self.assertIn("; status: SAT\n", query)
+        self.assertIn("; solving-time: ", query)
+        self.assertIn("(declare-fun SymVar_0 () (_ BitVec 8))", query)
+        self.assertIn("(declare-fun SymVar_1 () (_ BitVec 8))", query)
+        self.assertIn("(define-fun ref!%d () (_ BitVec 8) (bvadd SymVar_0 SymVar_1))" % expr.getId(), query)
+        self.assertIn("(assert (= ref!%d (_ bv16 8)))" % expr.getId(), query)
+        self.assertTrue(query.endswith("(check-sat)\n"))
+
+        query = self.read(1)
+        self.assertIn("; limit: 0\n", query)
+        self.assertIn("; status: UNSAT\n", query)
+        self.assertNotIn("SymVar_1", query)
+
+
+class TestLocalSearchSolver(unittest.TestCase):
+
+    """Testing the local search solver."""
+
+    def setUp(self):
+        self.ctx = TritonContext()
+        self.ctx.setArchitecture(ARCH.X86_64)
+        self.ctx.setSolver(SOLVER.LOCAL_SEARCH)
+        self.astCtxt = self.ctx.getAstContext()
+        self.vars = [self.ctx.newSymbolicVariable(8) for i in range(4)]
+        self.nodes = [self.astCtxt.variable(v) for v in self.vars]
+
+    def check(self, constraint, model):
+        self.assertNotEqual(model, {})
+        for v in model.values():
+            self.ctx.setConcreteVariableValue(v.getVariable(), v.getValue())
+        self.assertEqual(constraint.evaluate(), 1)
+
+    def test_solver(self):
+        self.assertEqual(self.ctx.getSolver(), SOLVER.LOCAL_SEARCH)
+        self.ctx.setSolver(SOLVER.Z3)
+        self.assertEqual(self.ctx.getSolver(), SOLVER.Z3)
+        self.ctx.setSolver(SOLVER.LOCAL_SEARCH)
+        self.assertEqual(self.ctx.getSolver(), SOLVER.LOCAL_SEARCH)
+
+    def test_magic(self):
+        constraint = self.astCtxt.equal(self.astCtxt.concat(self.nodes), self.astCtxt.bv(0x7f454c46, 32))
+        model = self.ctx.getModel(constraint)
+        self.assertEqual([model[v.getId()].getValue() for v in self.vars], [0x7f, 0x45, 0x4c, 0x46])
+
+    def test_operators(self):
+        a, b, c, d = self.nodes
+        constraints = [
+            self.astCtxt.equal(a * b + c, self.astCtxt.bv(0x42, 8)),
+            self.astCtxt.land([self.astCtxt.bvslt(a, self.astCtxt.bv(0xf0, 8)), self.astCtxt.bvugt(a, self.astCtxt.bv(0x80, 8))]),
+            self.astCtxt.lor([self.astCtxt.equal(a ^ b, self.astCtxt.bv(0x5a, 8)), self.astCtxt.equal(c, d)]),
+            self.astCtxt.lnot(self.astCtxt.bvule(self.astCtxt.bvurem(a, self.astCtxt.bv(10, 8)), self.astCtxt.bv(5, 8))),
+            self.astCtxt.distinct(self.astCtxt.bvrol(a, self.astCtxt.bv(3, 8)), self.astCtxt.bvshl(b, self.astCtxt.bv(1, 8))),
+            self.astCtxt.equal(self.astCtxt.sx(8, a) - self.astCtxt.zx(8, b), self.astCtxt.bv(0xff00, 16)),
+            self.astCtxt.equal(self.astCtxt.ite(self.astCtxt.bvsge(a, b), a, b), self.astCtxt.bv(0x33, 8)),
+            self.astCtxt.equal(self.astCtxt.extract(5, 2, a | b), self.astCtxt.bv(0xb, 4)),
+        ]
+        for constraint in constraints:
+            self.check(constraint, self.ctx.getModel(constraint))
+
+    def test_unsat(self):
+        constraint = self.astCtxt.land([
+            self.astCtxt.bvult(self.nodes[0], self.astCtxt.bv(2, 8)),
+            self.astCtxt.bvugt(self.nodes[0], self.astCtxt.bv(2, 8)),
+        ])
+        self.assertEqual(self.ctx.getModel(constraint, False, True), ({}, SOLVER_STATE.UNSAT))
+        self.assertEqual(self.ctx.isSat(constraint), False)
+
+    def test_models(self):
+        constraint = self.astCtxt.bvult(self.nodes[0], self.astCtxt.bv(4, 8))
+        models = self.ctx.getModels(constraint, 10)
+        self.assertEqual(sorted([m[self.vars[0].getId()].getValue() for m in models]), [0, 1, 2, 3])
+
+    def test_is_sat(self):
+        constraint = self.astCtxt.equal(self.nodes[0] + self.nodes[1], self.astCtxt.bv(0x10, 8))
+        self.assertEqual(self.ctx.isSat(constraint, True), (True, SOLVER_STATE.SAT))
+        self.assertTrue(self.ctx.isSat(self.astCtxt.equal(self.astCtxt.bv(1, 8), self.astCtxt.bv(1, 8))))
+
+    def test_arguments(self):
+        with self.assertRaises(TypeError):
+            self.ctx.setSolver("z3")
+        with self.assertRaises(TypeError):
+            self.ctx.setSolver(None)
@@ -4,7 +4,7 @@
 
 import unittest
 
-from triton import ARCH, Instruction, CPUSIZE, MemoryAccess, Immediate, TritonContext
+from triton import ARCH, AST_NODE, Instruction, CPUSIZE, MemoryAccess, Immediate, TritonContext
 
 
 class TestSymbolic(unittest.TestCase):
@@ -90,6 +90,170 @@ class TestSymbolic(unittest.TestCase):
             self.Triton.assignSymbolicExpressionToRegister(expr1, self.Triton.registers.rax)
 
 
+class TestSymbolicMemoryRanges(unittest.TestCase):
+
+    """Testing the range-based symbolic memory."""
+
+    def setUp(self):
+        """Define the arch."""
+        self.Triton = TritonContext()
+        self.Triton.setArchitecture(ARCH.X86_64)
+        self.astCtxt = self.Triton.getAstContext()
+
+    def test_exact_load(self):
+        """Check that a load which matches a store returns the stored expression."""
+        expr = self.Triton.newSymbolicExpression(self.astCtxt.bv(0x1122334455667788, CPUSIZE.QWORD_BIT))
+        mem = MemoryAccess(0x1000, CPUSIZE.QWORD)
+        self.Triton.assignSymbolicExpressionToMemory(expr, mem)
+
+        node = self.Triton.getMemoryAst(mem)
+        self.assertEqual(node.getType(), AST_NODE.REFERENCE)
+        self.assertTrue(node.getSymbolicExpression().isMemory())
+        self.assertEqual(node.evaluate(), 0x1122334455667788)
+
+        # The memory gets its own expression
+        self.assertNotEqual(node.getSymbolicExpression().getId(), expr.getId())
+        self.assertFalse(expr.isMemory())
+
+        # The store is recorded as a single range
+        self.assertEqual(len(self.Triton.getSymbolicMemory()), 1)
+
+    def test_partial_overlap(self):
+        """Check that a store partially overlapping a range only slices it."""
+        expr1 = self.Triton.newSymbolicExpression(self.astCtxt.bv(0x1122334455667788, CPUSIZE.QWORD_BIT))
+        expr2 = self.Triton.newSymbolicExpression(self.astCtxt.bv(0xaabbccdd, CPUSIZE.DWORD_BIT))
+        self.Triton.assignSymbolicExpressionToMemory(expr1, MemoryAccess(0x1000, CPUSIZE.QWORD))
+        self.Triton.assignSymbolicExpressionToMemory(expr2, MemoryAccess(0x1002, CPUSIZE.DWORD))
+
+        self.assertEqual(self.Triton.getSymbolicMemoryValue(MemoryAccess(0x1000, CPUSIZE.QWORD)), 0x1122aabbccdd7788)
+        self.assertEqual(self.Triton.getSymbolicMemoryValue(MemoryAccess(0x1001, CPUSIZE.WORD)), 0xdd77)
+        self.assertEqual(self.Triton.getSymbolicMemoryValue(MemoryAccess(0x1006, CPUSIZE.DWORD)), 0x1122)
+
+        self.assertEqual(sorted(self.Triton.getSymbolicMemory().keys()), [0x1000, 0x1002, 0x1006])
+        self.assertEqual(self.Triton.getSymbolicMemory(0x1007).getAst().evaluate(), 0x11)
+
+        self.Triton.concretizeMemory(MemoryAccess(0x1003, CPUSIZE.WORD))
+        self.assertFalse(self.Triton.isMemorySymbolized(MemoryAccess(0x1003, CPUSIZE.WORD)))
+        self.assertEqual(self.Triton.getSymbolicMemoryValue(MemoryAccess(0x1002, CPUSIZE.DWORD)), 0xaa0000dd)
+
+    def test_partial_store_leftover(self):
+        """Check that the ranges left by an overlapping partial store may have any size."""
+        expr1 = self.Triton.newSymbolicExpression(self.astCtxt.bv(0x1122334455667788, CPUSIZE.QWORD_BIT))
+        expr2 = self.Triton.newSymbolicExpression(self.astCtxt.bv(0xaa, CPUSIZE.BYTE_BIT))
+        self.Triton.assignSymbolicExpressionToMemory(expr1, MemoryAccess(0x1000, CPUSIZE.QWORD))
+        self.Triton.assignSymbolicExpressionToMemory(expr2, MemoryAccess(0x1005, CPUSIZE.BYTE))
+
+        # The leftovers are 5 and 2 bytes long
+        self.assertEqual(sorted(self.Triton.getSymbolicMemory().keys()), [0x1000, 0x1005, 0x1006])
+        self.assertEqual(self.Triton.getSymbolicMemory()[0x1000].getAst().evaluate(), 0x4455667788)
+        self.assertEqual(self.Triton.getSymbolicMemory()[0x1006].getAst().evaluate(), 0x1122)
+
+        self.assertEqual(self.Triton.getSymbolicMemoryValue(MemoryAccess(0x1000, CPUSIZE.QWORD)), 0x1122aa4455667788)
+        self.assertEqual(self.Triton.getSymbolicMemoryValue(MemoryAccess(0x1004, CPUSIZE.DWORD)), 0x1122aa44)
+        self.assertEqual(self.Triton.getSymbolicMemory(0x1003).getAst().evaluate(), 0x55)
+
+    def test_symbolic_variable(self):
+        """Check that a symbolic variable of memory is visible through the stored expression."""
+        mem = MemoryAccess(0x2000, CPUSIZE.DWORD)
+        self.Triton.setConcreteMemoryValue(mem, 0x11223344)
+        var = self.Triton.convertMemoryToSymbolicVariable(mem)
+
+        node = self.Triton.getMemoryAst(MemoryAccess(0x2001, CPUSIZE.WORD))
+        self.assertTrue(node.isSymbolized())
+        self.assertEqual(node.evaluate(), 0x2233)
+
+        self.Triton.setConcreteVariableValue(var, 0xaabbccdd)
+        self.assertEqual(self.Triton.getSymbolicMemoryValue(mem), 0xaabbccdd)
+
+    def test_shared_expression(self):
+        """Check that an expression assigned to a register and to the memory is not modified."""
+        mem = MemoryAccess(0x1000, CPUSIZE.QWORD)
+        expr = self.Triton.newSymbolicExpression(self.astCtxt.bv(0x1122334455667788, CPUSIZE.QWORD_BIT))
+        self.Triton.assignSymbolicExpressionToRegister(expr, self.Triton.registers.rax)
+        self.Triton.assignSymbolicExpressionToMemory(expr, mem)
+        self.assertTrue(expr.isRegister())
+        self.assertEqual(self.Triton.getSymbolicRegister(self.Triton.registers.rax).getId(), expr.getId())
+
+        # The conversion of the memory does not change the loads done before
+        load = self.Triton.newSymbolicExpression(self.Triton.getMemoryAst(mem))
+        self.Triton.setConcreteMemoryValue(mem, 0xaabbccdd)
+        self.Triton.convertMemoryToSymbolicVariable(mem)
+        self.assertEqual(load.getAst().evaluate(), 0x1122334455667788)
+        self.assertEqual(expr.getAst().evaluate(), 0x1122334455667788)
+        self.assertEqual(self.Triton.getSymbolicMemoryValue(mem), 0xaabbccdd)
+        self.assertEqual(self.Triton.getSymbolicRegisterValue(self.Triton.registers.rax), 0x1122334455667788)
+
+        # Convert a slice of the range
+        self.Triton.assignSymbolicExpressionToMemory(expr, mem)
+        self.Triton.setConcreteMemoryValue(MemoryAccess(0x1002, CPUSIZE.WORD), 0xaabb)
+        self.Triton.convertMemoryToSymbolicVariable(MemoryAccess(0x1002, CPUSIZE.WORD))
+        self.assertEqual(self.Triton.getSymbolicMemoryValue(mem), 0x11223344aabb7788)
+        self.assertEqual(expr.getAst().evaluate(), 0x1122334455667788)
+
+    def test_read_only_views(self):
+        """Check that reading the symbolic memory does not split the ranges."""
+        expr = self.Triton.newSymbolicExpression(self.astCtxt.bv(0x1122334455667788, CPUSIZE.QWORD_BIT))
+        self.Triton.assignSymbolicExpressionToMemory(expr, MemoryAccess(0x1000, CPUSIZE.QWORD))
+
+        for addr in range(0x1000, 0x1008):
+            se = self.Triton.getSymbolicMemory(addr)
+            self.assertTrue(se.isMemory())
+            self.assertEqual(se.getAst().evaluate(), (0x1122334455667788 >> ((addr - 0x1000) * 8)) & 0xff)
+
+        self.assertEqual(sorted(self.Triton.getSymbolicMemory().keys()), [0x1000])
+        node = self.Triton.getMemoryAst(MemoryAccess(0x1000, CPUSIZE.QWORD))
+        self.assertEqual(node.getType(), AST_NODE.REFERENCE)
+
+    def test_stable_views(self):
+        """Check that reading the symbolic memory twice returns the same expressions."""
+        expr = self.Triton.newSymbolicExpression(self.astCtxt.bv(0x1122334455667788, CPUSIZE.QWORD_BIT))
+        self.Triton.assignSymbolicExpressionToMemory(expr, MemoryAccess(0x1000, CPUSIZE.QWORD))
+        self.Triton.assignSymbolicExpressionToMemory(self.Triton.newSymbolicExpression(self.astCtxt.bv(0xaa, CPUSIZE.BYTE_BIT)), MemoryAccess(0x1005, CPUSIZE.BYTE))
+
+        for addr in range(0x1000, 0x1008):
+            self.assertEqual(self.Triton.getSymbolicMemory(addr).getId(), self.Triton.getSymbolicMemory(addr).getId())
+
+        ids = {addr: se.getId() for addr, se in self.Triton.getSymbolicMemory().items()}
+        self.assertEqual(ids, {addr: se.getId() for addr, se in self.Triton.getSymbolicMemory().items()})
+
+        # Reading does not allocate new expressions
+        count = len(self.Triton.getSymbolicExpressions())
+        self.Triton.getSymbolicMemory(0x1001)
+        self.Triton.getSymbolicMemory()
+        self.assertEqual(len(self.Triton.getSymbolicExpressions()), count)
+
+    def test_taint_slice(self):
+        """Check that the taint of a slice of a range does not taint the whole range."""
+        expr = self.Triton.newSymbolicExpression(self.astCtxt.bv(0x1122334455667788, CPUSIZE.QWORD_BIT))
+        self.Triton.assignSymbolicExpressionToMemory(expr, MemoryAccess(0x1000, CPUSIZE.QWORD))
+
+        self.Triton.taintRegister(self.Triton.registers.ax)
+        self.Triton.taintAssignmentMemoryRegister(MemoryAccess(0x1002, CPUSIZE.WORD), self.Triton.registers.ax)
+
+        self.assertFalse(self.Triton.getSymbolicMemory(0x1001).isTainted())
+        self.assertTrue(self.Triton.getSymbolicMemory(0x1002).isTainted())
+        self.assertTrue(self.Triton.getSymbolicMemory(0x1003).isTainted())
+        self.assertFalse(self.Triton.getSymbolicMemory(0x1004).isTainted())
+        self.assertEqual(self.Triton.getSymbolicMemoryValue(MemoryAccess(0x1000, CPUSIZE.QWORD)), 0x1122334455667788)
+
+        self.Triton.taintAssignmentMemoryImmediate(MemoryAccess(0x1003, CPUSIZE.BYTE))
+        self.assertTrue(self.Triton.getSymbolicMemory(0x1002).isTainted())
+        self.assertFalse(self.Triton.getSymbolicMemory(0x1003).isTainted())
+
+    def test_processing(self):
+        """Check that a store creates a single expression."""
+        self.Triton.setConcreteRegisterValue(self.Triton.registers.rax, 0x3000)
+        self.Triton.convertRegisterToSymbolicVariable(self.Triton.registers.rbx)
+
+        inst = Instruction("\x48\x89\x18")   # mov [rax], rbx
+        self.Triton.processing(inst)
+        self.assertEqual(len(inst.getSymbolicExpressions()), 2)
+
+        inst = Instruction("\x48\x8b\x08")   # mov rcx, [rax]
+        self.Triton.processing(inst)
+        self.assertTrue(self.Triton.isRegisterSymbolized(self.Triton.registers.rcx))
+
+
 class TestSymbolicBuilding(unittest.TestCase):
 
     """Testing symbolic building."""
@@ -25,7 +25,7 @@ class TestSymbolicExpression(unittest.TestCase):
         self.ctx.processing(self.inst2)
 
         self.expr1 = self.inst1.getSymbolicExpressions()[0]
-        self.expr2 = self.inst2.getSymbolicExpressions()[8]
+        self.expr2 = self.inst2.getSymbolicExpressions()[0]
 
     def test_expressions(self):
         """Test expressions"""
@@ -85,6 +85,49 @@ class TestTaint(unittest.TestCase):
         self.assertFalse(Triton.isRegisterTainted(Triton.registers.eax))
         self.assertFalse(Triton.isRegisterTainted(Triton.registers.ax))
 
+    def test_taint_sub_register(self):
+        """Check byte-precise tainting of sub-registers."""
+        Triton = TritonContext()
+        Triton.setArchitecture(ARCH.X86_64)
+
+        Triton.taintRegister(Triton.registers.ah)
+        self.assertFalse(Triton.isRegisterTainted(Triton.registers.al))
+        self.assertTrue(Triton.isRegisterTainted(Triton.registers.ax))
+        self.assertEqual([r.getName() for r in Triton.getTaintedRegisters()], ["rax"])
+
+        # al <- imm keeps ah, ah <- imm untaints ax
+        self.assertFalse(Triton.taintAssignmentRegisterImmediate(Triton.registers.al))
+        self.assertTrue(Triton.isRegisterTainted(Triton.registers.ah))
+        self.assertFalse(Triton.taintAssignmentRegisterImmediate(Triton.registers.ah))
+        self.assertFalse(Triton.isRegisterTainted(Triton.registers.rax))
+
+        # cl <- bh, then dx U cl
+        Triton.taintRegister(Triton.registers.bh)
+        self.assertTrue(Triton.taintAssignmentRegisterRegister(Triton.registers.cl, Triton.registers.bh))
+        self.assertTrue(Triton.isRegisterTainted(Triton.registers.cl))
+        self.assertFalse(Triton.isRegisterTainted(Triton.registers.ch))
+        self.assertTrue(Triton.taintUnionRegisterRegister(Triton.registers.dx, Triton.registers.cl))
+        self.assertTrue(Triton.isRegisterTainted(Triton.registers.dh))
+        self.assertTrue(Triton.isRegisterTainted(Triton.registers.dl))
+
+        # Dword writes clear the upper bytes, as the symbolic engine does
+        Triton.taintRegister(Triton.registers.rsi)
+        self.assertFalse(Triton.taintAssignmentRegisterImmediate(Triton.registers.esi))
+        self.assertFalse(Triton.isRegisterTainted(Triton.registers.rsi))
+        Triton.taintRegister(Triton.registers.rdi)
+        self.assertFalse(Triton.taintAssignmentRegisterImmediate(Triton.registers.di))
+        self.assertTrue(Triton.isRegisterTainted(Triton.registers.rdi))
+        self.assertFalse(Triton.isRegisterTainted(Triton.registers.di))
+
+        # Vector lanes
+        Triton.taintAssignmentRegisterMemory(Triton.registers.xmm1, MemoryAccess(0x1000, 16))
+        self.assertFalse(Triton.isRegisterTainted(Triton.registers.zmm1))
+        Triton.taintMemory(0x1000)
+        Triton.taintAssignmentRegisterMemory(Triton.registers.xmm1, MemoryAccess(0x1000, 16))
+        self.assertTrue(Triton.isRegisterTainted(Triton.registers.ymm1))
+        Triton.untaintRegister(Triton.registers.xmm1)
+        self.assertFalse(Triton.isRegisterTainted(Triton.registers.zmm1))
+
     def test_taint_assignement_memory_immediate(self):
         """Check tainting assignment memory <- immediate."""
         Triton = TritonContext()
@@ -429,6 +472,104 @@ class TestTaint(unittest.TestCase):
         self.assertTrue(0x4003 in m)
         self.assertFalse(0x5000 in m)
 
+    def test_taint_memory_range(self):
+        """Taint memory ranges"""
+        Triton = TritonContext()
+        Triton.setArchitecture(ARCH.X86_64)
+
+        self.assertEqual(Triton.getTaintedMemoryRanges(), [])
+
+        # Across pages, merged with the adjacent ranges
+        self.assertTrue(Triton.taintMemoryRange(0x10ff0, 0x20))
+        Triton.taintMemory(MemoryAccess(0x11010, 8))
+        Triton.taintMemory(0x20000)
+        self.assertEqual(Triton.getTaintedMemoryRanges(), [(0x10ff0, 0x28), (0x20000, 1)])
+        self.assertEqual(len(Triton.getTaintedMemory()), 0x29)
+
+        self.assertTrue(Triton.isMemoryTainted(MemoryAccess(0x10fe9, 8)))
+        self.assertFalse(Triton.isMemoryTainted(MemoryAccess(0x10fe8, 8)))
+        self.assertTrue(Triton.isMemoryTainted(MemoryAccess(0x11017, 8)))
+        self.assertFalse(Triton.isMemoryTainted(MemoryAccess(0x11018, 8)))
+
+        self.assertFalse(Triton.untaintMemoryRange(0x10ff8, 0x10))
+        self.assertEqual(Triton.getTaintedMemoryRanges(), [(0x10ff0, 8), (0x11008, 0x10), (0x20000, 1)])
+        self.assertFalse(Triton.isMemoryTainted(MemoryAccess(0x10ff8, 16)))
+
+        # A large input
+        Triton.untaintMemoryRange(0, 0x30000)
+        self.assertEqual(Triton.getTaintedMemoryRanges(), [])
+        Triton.taintMemoryRange(0x7fff0000, 0x100000)
+        self.assertEqual(Triton.getTaintedMemoryRanges(), [(0x7fff0000, 0x100000)])
+        self.assertTrue(Triton.isMemoryTainted(MemoryAccess(0x800effff, 1)))
+        self.assertFalse(Triton.isMemoryTainted(MemoryAccess(0x800f0000, 64)))
+
+        # Disabled engine
+        Triton.enableTaintEngine(False)
+        self.assertFalse(Triton.taintMemoryRange(0x1000, 0x10))
+        self.assertTrue(Triton.untaintMemoryRange(0x7fff0000, 0x10))
+        self.assertEqual(Triton.getTaintedMemoryRanges(), [(0x7fff0000, 0x100000)])
+
+        with self.assertRaises(TypeError):
+            Triton.taintMemoryRange(0x1000)
+        with self.assertRaises(TypeError):
+            Triton.untaintMemoryRange("0x1000", 1)
+
+    def test_taint_labels(self):
+        """Taint labels"""
+        Triton = TritonContext()
+        Triton.setArchitecture(ARCH.X86_64)
+
+        # Labels are not tracked by default
+        self.assertTrue(Triton.taintMemoryWithLabel(MemoryAccess(0x1000, 4), 1))
+        self.assertTrue(Triton.isMemoryTainted(MemoryAccess(0x1000, 4)))
+        self.assertEqual(Triton.getMemoryTaintLabels(MemoryAccess(0x1000, 4)), [])
+
+        Triton.enableMode(MODE.TAINT_LABELS, True)
+        Triton.taintMemoryWithLabel(MemoryAccess(0x1000, 2), 1)
+        Triton.taintMemoryWithLabel(0x1002, 2)
+        Triton.taintMemoryWithLabel(MemoryAccess(0x1003, 1), 3)
+        self.assertEqual(Triton.getMemoryTaintLabels(0x1000), [1])
+        self.assertEqual(Triton.getMemoryTaintLabels(0x1003), [3])
+        self.assertEqual(Triton.getMemoryTaintLabels(MemoryAccess(0x1000, 4)), [1, 2, 3])
+
+        # reg <- mem, reg U reg, mem <- reg
+        self.assertTrue(Triton.taintAssignmentRegisterMemory(Triton.registers.rax, MemoryAccess(0x1000, 2)))
+        self.assertTrue(Triton.taintAssignmentRegisterMemory(Triton.registers.rbx, MemoryAccess(0x1002, 1)))
+        self.assertEqual(Triton.getRegisterTaintLabels(Triton.registers.rax), [1])
+        self.assertEqual(Triton.getRegisterTaintLabels(Triton.registers.bl), [2])
+        self.assertTrue(Triton.taintUnionRegisterRegister(Triton.registers.eax, Triton.registers.rbx))
+        self.assertEqual(Triton.getRegisterTaintLabels(Triton.registers.rax), [1, 2])
+        self.assertTrue(Triton.taintAssignmentMemoryRegister(MemoryAccess(0x2000, 8), Triton.registers.rax))
+        self.assertEqual(Triton.getMemoryTaintLabels(MemoryAccess(0x2007, 1)), [1, 2])
+
+        # mem U mem is byte per byte
+        Triton.taintRegisterWithLabel(Triton.registers.rcx, 4)
+        self.assertTrue(Triton.taintAssignmentMemoryRegister(MemoryAccess(0x3000, 4), Triton.registers.ecx))
+        self.assertTrue(Triton.taintUnionMemoryMemory(MemoryAccess(0x3000, 4), MemoryAccess(0x1000, 4)))
+        self.assertEqual(Triton.getMemoryTaintLabels(0x3000), [1, 4])
+        self.assertEqual(Triton.getMemoryTaintLabels(0x3002), [2, 4])
+        self.assertEqual(Triton.getMemoryTaintLabels(0x3003), [3, 4])
+
+        # Assignments from untainted operands clear the labels
+        self.assertFalse(Triton.taintAssignmentRegisterImmediate(Triton.registers.rax))
+        self.assertEqual(Triton.getRegisterTaintLabels(Triton.registers.rax), [])
+        self.assertFalse(Triton.taintAssignmentMemoryImmediate(MemoryAccess(0x2000, 8)))
+        self.assertEqual(Triton.getMemoryTaintLabels(MemoryAccess(0x2000, 8)), [])
+        Triton.untaintRegister(Triton.registers.rcx)
+        self.assertEqual(Triton.getRegisterTaintLabels(Triton.registers.rcx), [])
+
+        # Through pointers
+        Triton.enableMode(MODE.TAINT_THROUGH_POINTERS, True)
+        mem = MemoryAccess(0x4000, 8)
+        mem.setBaseRegister(Triton.registers.rbx)
+        self.assertTrue(Triton.taintAssignmentRegisterMemory(Triton.registers.rdx, mem))
+        self.assertEqual(Triton.getRegisterTaintLabels(Triton.registers.rdx), [2])
+
+        with self.assertRaises(TypeError):
+            Triton.taintMemoryWithLabel(MemoryAccess(0x1000, 4))
+        with self.assertRaises(TypeError):
+            Triton.getRegisterTaintLabels(0x1000)
+
     def test_taint_set_register(self):
         """Set taint register"""
         Triton = TritonContext()
@@ -691,3 +832,87 @@ class TestTaint(unittest.TestCase):
         ctx.processing(inst)
 
         self.assertTrue(ctx.isRegisterTainted(ctx.registers.rbx))
+
+
+class TestTaintFastPath(unittest.TestCase):
+
+    """Testing the taint of the TAINT_FAST_PATH mode against the full semantics."""
+
+    # (arch, modes, initial values, tainted registers and memory ranges, code)
+    SCENARIOS = [
+        (ARCH.X86, [], {}, ["eax"], [
+            "\x8D\x04\x06",                 # lea eax,[esi+eax*1]
+        ]),
+        (ARCH.X86_64, [], {"rax": 0x2000}, ["rax"], [
+            "\x48\x0F\xB6\x18",             # movzx rbx,BYTE PTR [rax]
+        ]),
+        (ARCH.X86_64, [MODE.TAINT_THROUGH_POINTERS], {"rax": 0x2000}, ["rax"], [
+            "\x48\x0F\xB6\x18",             # movzx rbx,BYTE PTR [rax]
+        ]),
+        (ARCH.X86_64, [MODE.TAINT_THROUGH_POINTERS], {}, ["rax"], [
+            "\x48\x89\x18",                 # mov [rax], rbx
+            "\x48\x31\x18",                 # xor [rax], rbx
+            "\x48\x33\x18",                 # xor rbx, [rax]
+        ]),
+        (ARCH.X86_64, [MODE.TAINT_THROUGH_POINTERS], {}, ["rbx"], [
+            "\x48\x89\x18",                 # mov [rax], rbx
+            "\x48\x31\x18",                 # xor [rax], rbx
+            "\x48\x33\x18",                 # xor rbx, [rax]
+        ]),
+        (ARCH.X86_64, [], {"rax": 0x2000}, ["rax", (0x2000, 8)], [
+            "\x48\x31\x18",                 # xor [rax], rbx
+            "\x48\x33\x18",                 # xor rbx, [rax]
+        ]),
+        (ARCH.X86_64, [], {"rsp": 0x7fff0000, "rax": 0x10, "rbx": 0x41}, ["rbx"], [
+            "\x53",                         # push rbx
+            "\x59",                         # pop rcx
+            "\x48\x01\xC8",                 # add rax, rcx
+            "\x48\x83\xF8\x50",             # cmp rax, 0x50
+            "\x75\x02",                     # jne +2
+            "\xE8\x00\x00\x00\x00",         # call +0
+            "\xC3",                         # ret
+            "\x48\x8D\x41\xF8",             # lea rax, [rcx-8]
+            "\x48\x31\x18",                 # xor [rax], rbx
+            "\x48\x8B\x10",                 # mov rdx, [rax]
+        ]),
+    ]
+
+    def run_scenario(self, fastPath, arch, modes, values, tainted, code):
+        """Process the code and return the taint and the concrete state."""
+        ctx = TritonContext()
+        ctx.setArchitecture(arch)
+        ctx.enableSymbolicEngine(False)
+        ctx.enableMode(MODE.TAINT_FAST_PATH, fastPath)
+        for mode in modes:
+            ctx.enableMode(mode, True)
+
+        for name, value in values.items():
+            ctx.setConcreteRegisterValue(getattr(ctx.registers, name), value)
+
+        for item in tainted:
+            if isinstance(item, tuple):
+                ctx.taintMemory(MemoryAccess(item[0], item[1]))
+            else:
+                ctx.taintRegister(getattr(ctx.registers, item))
+
+        pc = ctx.registers.rip if arch == ARCH.X86_64 else ctx.registers.eip
+        ctx.setConcreteRegisterValue(pc, 0x1000)
+
+        insts = []
+        for opcode in code:
+            inst = Instruction(opcode)
+            inst.setAddress(ctx.getConcreteRegisterValue(pc))
+            ctx.processing(inst)
+            insts.append((inst.isTainted(), inst.isConditionTaken(), len(inst.getLoadAccess()), len(inst.getStoreAccess())))
+
+        registers = sorted(r.getName() for r in ctx.getTaintedRegisters())
+        memory = sorted(ctx.getTaintedMemory())
+        concrete = sorted((r.getName(), ctx.getConcreteRegisterValue(r)) for r in ctx.getParentRegisters())
+        return insts, registers, memory, concrete
+
+    def test_fast_path(self):
+        """Check that the taint and the concrete state do not depend on TAINT_FAST_PATH."""
+        for scenario in self.SCENARIOS:
+            full = self.run_scenario(False, *scenario)
+            fast = self.run_scenario(True, *scenario)
+            self.assertEqual(full, fast)